@@ -18,21 +18,6 @@ namespace BE
     DataType* PTR   = &PTRINSTANCE;
     DataType* TOKEN = &TOKENINSTANCE;
 
-    namespace
-    {
-        static uint32_t g_vreg_count = 0;
-    }
-
-    Register getVReg(DataType* dt)
-    {
-        return Register(g_vreg_count++, dt, true);
-    }
-
-    void ensureVRegBase(uint32_t base)
-    {
-        if (base > g_vreg_count) g_vreg_count = base;
-    }
-
     MoveInst* createMove(Operand* dst, Operand* src, const std::string& c) { return new MoveInst(src, dst, c); }
 
     MoveInst* createMove(Operand* dst, int imme, const std::string& c)
@@ -152,9 +152,6 @@ namespace BE
       public:
         FrameIndexOperand(int fi) : Operand(I64, Operand::Type::FRAME_INDEX), frameIndex(fi) {}
     };
-
-    Register getVReg(DataType* dt);
-    void     ensureVRegBase(uint32_t base);
 }  // namespace BE
 
 #endif  // __BACKEND_MIR_DEFS_H__
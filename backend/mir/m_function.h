@@ -19,6 +19,8 @@ namespace BE
         int                        paramSize     = 0;
         std::vector<MInstruction*> allocInsts;
         MFrameInfo                 frameInfo;
+        // 虚拟寄存器按函数编号，各函数的后端流程互不依赖，可以在不同线程上进行
+        uint32_t                   nextVReg = 0;
 
       public:
         Function(const std::string& name)
@@ -33,6 +35,13 @@ namespace BE
             }
             blocks.clear();
         }
+
+        Register newVReg(DataType* dt) { return Register(nextVReg++, dt, true); }
+        // isel 直接沿用 IR 的寄存器号作为虚拟寄存器号，新建的虚拟寄存器需从其之后开始编号
+        void ensureVRegBase(uint32_t base)
+        {
+            if (base > nextVReg) nextVReg = base;
+        }
     };
 }  // namespace BE
 
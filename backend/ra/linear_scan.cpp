@@ -9,6 +9,7 @@
 #include <backend/common/cfg_builder.h>
 #include <utils/dynamic_bitset.h>
 #include <debug.h>
+#include <stats.h>
 
 #include <map>
 #include <set>
@@ -131,7 +132,7 @@ namespace BE::RA
 
     void LinearScanRA::allocateFunction(BE::Function& func, const BE::Targeting::TargetRegInfo& regInfo)
     {
-        ASSERT(BE::Targeting::g_adapter && "TargetInstrAdapter is not set");
+        ASSERT(adapter && "TargetInstrAdapter is not set");
 
         std::map<BE::Block*, std::pair<int, int>>                                   blockRange;
         std::vector<std::pair<BE::Block*, std::deque<BE::MInstruction*>::iterator>> id2iter;
@@ -143,7 +144,7 @@ namespace BE::RA
             for (auto it = block->insts.begin(); it != block->insts.end(); ++it, ++ins_id)
             {
                 id2iter.emplace_back(block, it);
-                if (BE::Targeting::g_adapter->isCall(*it)) callPoints.insert(ins_id);
+                if (adapter->isCall(*it)) callPoints.insert(ins_id);
             }
             blockRange[block] = {start, ins_id};
         }
@@ -155,8 +156,8 @@ namespace BE::RA
             for (auto it = block->insts.begin(); it != block->insts.end(); ++it)
             {
                 std::vector<BE::Register> uses, defs;
-                BE::Targeting::g_adapter->enumUses(*it, uses);
-                BE::Targeting::g_adapter->enumDefs(*it, defs);
+                adapter->enumUses(*it, uses);
+                adapter->enumDefs(*it, defs);
                 for (auto& d : defs)
                     if (!def.count(d)) def.insert(d);
                 for (auto& u : uses)
@@ -174,7 +175,7 @@ namespace BE::RA
         BE::MIR::CFG*                                 cfg = nullptr;
         std::map<BE::Block*, std::vector<BE::Block*>> succs;
         {
-            BE::MIR::CFGBuilder cfgBuilder(BE::Targeting::g_adapter);
+            BE::MIR::CFGBuilder cfgBuilder(adapter);
             cfg = cfgBuilder.buildCFGForFunction(&func);
             for (auto& [bid, block] : func.blocks)
             {
@@ -253,8 +254,8 @@ namespace BE::RA
             {
                 uses.clear();
                 defs.clear();
-                BE::Targeting::g_adapter->enumUses(*it, uses);
-                BE::Targeting::g_adapter->enumDefs(*it, defs);
+                adapter->enumUses(*it, uses);
+                adapter->enumDefs(*it, defs);
 
                 for (const auto& d : defs)
                 {
@@ -330,6 +331,7 @@ namespace BE::RA
             int size = r.dt ? r.dt->getDataWidth() : 8;
             int fi   = func.frameInfo.createSpillSlot(size, size);
             spillFrameIndex[r] = fi;
+            Stats::bump("vregs spilled");
             return fi;
         };
 
@@ -531,11 +533,11 @@ namespace BE::RA
 
                 std::vector<BE::Register> uses;
                 std::vector<BE::Register> defs;
-                BE::Targeting::g_adapter->enumUses(inst, uses);
-                BE::Targeting::g_adapter->enumDefs(inst, defs);
+                adapter->enumUses(inst, uses);
+                adapter->enumDefs(inst, defs);
 
                 std::vector<BE::Register> physRegs;
-                BE::Targeting::g_adapter->enumPhysRegs(inst, physRegs);
+                adapter->enumPhysRegs(inst, physRegs);
                 std::unordered_set<int> forbidden;
                 forbidden.reserve(physRegs.size() + uses.size() + defs.size());
                 for (const auto& pr : physRegs)
@@ -610,7 +612,7 @@ namespace BE::RA
                     if (physIt != assignedPhys.end())
                     {
                         BE::Register phys(physIt->second, u.dt, false);
-                        BE::Targeting::g_adapter->replaceUse(inst, u, phys);
+                        adapter->replaceUse(inst, u, phys);
                         continue;
                     }
 
@@ -623,10 +625,10 @@ namespace BE::RA
                     if (!reloaded.count(u))
                     {
                         auto it = findIt();
-                        BE::Targeting::g_adapter->insertReloadBefore(block, it, scratchIt->second, ensureSpillSlot(u));
+                        adapter->insertReloadBefore(block, it, scratchIt->second, ensureSpillSlot(u));
                         reloaded.insert(u);
                     }
-                    BE::Targeting::g_adapter->replaceUse(inst, u, scratchIt->second);
+                    adapter->replaceUse(inst, u, scratchIt->second);
                 }
 
                 for (const auto& d : defs)
@@ -636,7 +638,7 @@ namespace BE::RA
                     if (physIt != assignedPhys.end())
                     {
                         BE::Register phys(physIt->second, d.dt, false);
-                        BE::Targeting::g_adapter->replaceDef(inst, d, phys);
+                        adapter->replaceDef(inst, d, phys);
                         continue;
                     }
 
@@ -646,11 +648,11 @@ namespace BE::RA
                         BE::Register scratch = pickScratch(d);
                         scratchIt = scratchMap.emplace(d, scratch).first;
                     }
-                    BE::Targeting::g_adapter->replaceDef(inst, d, scratchIt->second);
+                    adapter->replaceDef(inst, d, scratchIt->second);
                     if (!spilledDef.count(d))
                     {
                         auto it = findIt();
-                        BE::Targeting::g_adapter->insertSpillAfter(block, it, scratchIt->second, ensureSpillSlot(d));
+                        adapter->insertSpillAfter(block, it, scratchIt->second, ensureSpillSlot(d));
                         spilledDef.insert(d);
                     }
                 }
@@ -8,7 +8,13 @@ namespace BE::RA
 {
     class LinearScanRA : public RegisterAllocator<LinearScanRA>
     {
+      private:
+        const BE::Targeting::TargetInstrAdapter* adapter;
+
       public:
+        explicit LinearScanRA(const BE::Targeting::TargetInstrAdapter* adapter) : adapter(adapter) {}
+
+        // 只读写传入的函数，不同函数可以在不同线程上分配
         void allocateFunction(BE::Function& func, const BE::Targeting::TargetRegInfo& regInfo);
     };
 }  // namespace BE::RA
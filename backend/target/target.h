@@ -11,12 +11,14 @@
 namespace ME
 {
     class Module;
+    class Function;
     class Block;
 }  // namespace ME
 namespace BE
 {
     class Module;
 }
+class ThreadPool;
 
 namespace BE::Targeting
 {
@@ -25,6 +27,9 @@ namespace BE::Targeting
       public:
         std::map<const ME::Block*, BE::DAG::SelectionDAG*> block_dags;
 
+        // 非空时 runPipeline 可按函数并行处理；为空则串行
+        ThreadPool* pool = nullptr;
+
         virtual ~BackendTarget()
         {
             for (auto& [_, dag] : block_dags)
@@ -37,6 +42,8 @@ namespace BE::Targeting
 
         virtual const char* getName() const = 0;
 
+        void setThreadPool(ThreadPool* threadPool) { pool = threadPool; }
+
         void buildDAG(ME::Module* ir)
         {
             DAG::DAGBuilder builder;
@@ -44,7 +51,7 @@ namespace BE::Targeting
             {
                 if (!f) continue;
 
-                for (auto& [bid, ir_block] : f->blocks)
+                for (auto* ir_block : f->blocks)
                 {
                     auto* dag = new DAG::SelectionDAG();
                     builder.build(*ir_block, *dag);
@@ -53,6 +60,16 @@ namespace BE::Targeting
             }
         }
         virtual void runPipeline(ME::Module* ir, BE::Module* backend, std::ostream* out) = 0;
+
+        /*
+         * 流式编译（-fstream）：beginStream 输出文件头；此后中端每完成一个函数就调用一次 runFunction，
+         * 该函数走完整个后端流程并立即输出，其 MIR 随即释放；endStream 输出全局数据
+         * supportsStreaming 为 false 的目标只能对整个模块调用 runPipeline
+         */
+        virtual bool supportsStreaming() const { return false; }
+        virtual void beginStream(ME::Module*, BE::Module*, std::ostream*) {}
+        virtual void runFunction(ME::Function*) {}
+        virtual void endStream() {}
     };
 }  // namespace BE::Targeting
 
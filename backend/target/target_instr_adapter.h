@@ -92,9 +92,6 @@ namespace BE::Targeting
             ERROR("Using base target instruction adapter insertSpillAfter method is not allowed");
         }
     };
-
-    inline const TargetInstrAdapter* g_adapter = nullptr;
-    inline void                      setTargetInstrAdapter(const TargetInstrAdapter* adapter) { g_adapter = adapter; }
 }  // namespace BE::Targeting
 
 #endif  // __BACKEND_TARGET_TARGET_INSTR_ADAPTER_H__
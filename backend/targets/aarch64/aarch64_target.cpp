@@ -15,14 +15,6 @@
 #include <map>
 #include <vector>
 
-namespace BE
-{
-    namespace RA
-    {
-        void setTargetInstrAdapter(const BE::Targeting::TargetInstrAdapter* adapter);
-    }
-}  // namespace BE
-
 namespace BE::Targeting::AArch64
 {
     namespace
@@ -41,7 +33,6 @@ namespace BE::Targeting::AArch64
     {
         static BE::Targeting::AArch64::InstrAdapter s_adapter;
         static BE::Targeting::AArch64::RegInfo      s_regInfo;
-        BE::Targeting::setTargetInstrAdapter(&s_adapter);
 
         TODO("选择一种 Instruction Selector 实现，并完成指令选择");
         // BE::AArch64::DAGIsel isel(ir, backend, this);
@@ -63,7 +54,7 @@ namespace BE::Targeting::AArch64
         // RA
         {
             TODO("使用你实现的寄存器分配器进行寄存器分配");
-            // BE::RA::LinearScanRA ra;
+            // BE::RA::LinearScanRA ra(&s_adapter);
             // ra.allocate(*backend, s_regInfo);
         }
 
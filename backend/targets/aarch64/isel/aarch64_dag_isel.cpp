@@ -68,7 +68,7 @@ namespace BE::AArch64
         if (node->hasIRRegId())
             vreg = getOrCreateVReg(node->getIRRegId(), dt);
         else
-            vreg = getVReg(dt);
+            vreg = ctx_.mfunc->newVReg(dt);
 
         nodeToVReg_[node] = vreg;
     }
@@ -100,7 +100,7 @@ namespace BE::AArch64
             DataType* dt = (node->getNumValues() > 0) ? node->getValueType(0) : BE::I32;
             if (!dt) dt = (opcode == DAG::ISD::CONST_I32) ? BE::I32 : BE::I64;
 
-            Register destReg = getVReg(dt);
+            Register destReg = ctx_.mfunc->newVReg(dt);
             int64_t  imm     = node->hasImmI64() ? node->getImmI64() : 0;
 
             if (imm == 0)
@@ -140,7 +140,7 @@ namespace BE::AArch64
         {
             DataType* dt = (node->getNumValues() > 0) ? node->getValueType(0) : BE::F32;
             if (!dt) dt = BE::F32;
-            Register dstReg = getVReg(dt);
+            Register dstReg = ctx_.mfunc->newVReg(dt);
 
             float fval = node->hasImmF32() ? node->getImmF32() : 0.0f;
 
@@ -152,7 +152,7 @@ namespace BE::AArch64
             }
 
             int      bits  = FLOAT_TO_INT_BITS(fval);
-            Register wTmp  = getVReg(BE::I32);
+            Register wTmp  = ctx_.mfunc->newVReg(BE::I32);
             auto     segs  = decomposeImm64(static_cast<unsigned long long>(static_cast<uint32_t>(bits)));
             bool     first = true;
             for (size_t i = 0; i < 2; ++i)
@@ -203,7 +203,7 @@ namespace BE::AArch64
         if (opcode == DAG::ISD::FRAME_INDEX && node->hasIRRegId())
         {
             size_t   ir_reg_id = node->getIRRegId();
-            Register addrReg   = getVReg(BE::I64);
+            Register addrReg   = ctx_.mfunc->newVReg(BE::I64);
 
             Instr* addr_inst     = createInstr2(Operator::ADD, new RegOperand(addrReg), new RegOperand(PR::sp));
             addr_inst->fiop      = new FrameIndexOperand(ir_reg_id);
@@ -215,7 +215,7 @@ namespace BE::AArch64
 
         if (opcode == DAG::ISD::SYMBOL && node->hasSymbol())
         {
-            Register addrReg = getVReg(BE::I64);
+            Register addrReg = ctx_.mfunc->newVReg(BE::I64);
             m_block->insts.push_back(
                 createInstr2(Operator::LA, new RegOperand(addrReg), new SymbolOperand(node->getSymbol())));
             return addrReg;
@@ -242,7 +242,7 @@ namespace BE::AArch64
         auto it = ctx_.vregMap.find(ir_reg_id);
         if (it != ctx_.vregMap.end()) return it->second;
 
-        Register vreg           = getVReg(dt);
+        Register vreg           = ctx_.mfunc->newVReg(dt);
         ctx_.vregMap[ir_reg_id] = vreg;
         return vreg;
     }
@@ -470,7 +470,7 @@ namespace BE::AArch64
             if (static_cast<DAG::ISD>(baseNode->getOpcode()) == DAG::ISD::FRAME_INDEX)
             {
                 int fi              = baseNode->getFrameIndex();
-                baseReg             = getVReg(BE::I64);
+                baseReg             = ctx_.mfunc->newVReg(BE::I64);
                 Instr* addrInst     = createInstr2(Operator::ADD, new RegOperand(baseReg), new RegOperand(PR::sp));
                 addrInst->fiop      = new FrameIndexOperand(fi);
                 addrInst->use_fiops = true;
@@ -479,7 +479,7 @@ namespace BE::AArch64
             else if (static_cast<DAG::ISD>(baseNode->getOpcode()) == DAG::ISD::SYMBOL && baseNode->hasSymbol())
             {
                 std::string symbol = baseNode->getSymbol();
-                baseReg            = getVReg(BE::I64);
+                baseReg            = ctx_.mfunc->newVReg(BE::I64);
                 m_block->insts.push_back(
                     createInstr2(Operator::LA, new RegOperand(baseReg), new SymbolOperand(symbol)));
             }
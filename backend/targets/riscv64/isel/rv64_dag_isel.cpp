@@ -66,7 +66,7 @@ namespace BE::RV64
         if (node->hasIRRegId())
             vreg = getOrCreateVReg(node->getIRRegId(), dt);
         else
-            vreg = getVReg(dt);
+            vreg = ctx_.mfunc->newVReg(dt);
 
         nodeToVReg_[node] = vreg;
     }
@@ -97,7 +97,7 @@ namespace BE::RV64
         if (opcode == DAG::ISD::CONST_I32 || opcode == DAG::ISD::CONST_I64)
         {
             DataType* dt      = (opcode == DAG::ISD::CONST_I32) ? BE::I32 : BE::I64;
-            Register  destReg = getVReg(dt);
+            Register  destReg = ctx_.mfunc->newVReg(dt);
             int64_t   imm     = node->hasImmI64() ? node->getImmI64() : 0;
 
             m_block->insts.push_back(createMove(new RegOperand(destReg), static_cast<int>(imm), LOC_STR));
@@ -108,14 +108,14 @@ namespace BE::RV64
 
         if (opcode == DAG::ISD::CONST_F32)
         {
-            Register destReg = getVReg(BE::F32);
+            Register destReg = ctx_.mfunc->newVReg(BE::F32);
 
             if (node->hasImmF32())
             {
                 float    f_val = node->getImmF32();
                 uint32_t bits;
                 memcpy(&bits, &f_val, sizeof(float));
-                Register tempReg = getVReg(BE::I32);
+                Register tempReg = ctx_.mfunc->newVReg(BE::I32);
                 m_block->insts.push_back(createMove(new RegOperand(tempReg), static_cast<int>(bits), LOC_STR));
                 m_block->insts.push_back(createR2Inst(Operator::FMV_W_X, destReg, tempReg));
             }
@@ -151,7 +151,7 @@ namespace BE::RV64
         if (opcode == DAG::ISD::FRAME_INDEX && node->hasIRRegId())
         {
             size_t   ir_reg_id = node->getIRRegId();
-            Register addrReg   = getVReg(BE::I64);
+            Register addrReg   = ctx_.mfunc->newVReg(BE::I64);
 
             Instr* addr_inst = createIInst(Operator::ADDI, addrReg, PR::sp, new FrameIndexOperand(ir_reg_id));
             m_block->insts.push_back(addr_inst);
@@ -161,7 +161,7 @@ namespace BE::RV64
 
         if (opcode == DAG::ISD::SYMBOL && node->hasSymbol())
         {
-            Register addrReg = getVReg(BE::I64);
+            Register addrReg = ctx_.mfunc->newVReg(BE::I64);
             Label    symbolLabel(node->getSymbol(), false, true);
             m_block->insts.push_back(createUInst(Operator::LA, addrReg, symbolLabel));
             return addrReg;
@@ -196,7 +196,7 @@ namespace BE::RV64
             return it->second;
         }
 
-        Register vreg           = getVReg(dt);
+        Register vreg           = ctx_.mfunc->newVReg(dt);
         ctx_.vregMap[ir_reg_id] = vreg;
         return vreg;
     }
@@ -313,7 +313,7 @@ namespace BE::RV64
             lhsReg = materializeAddress(lhs, m_block);
         else if (lhsOp == DAG::ISD::FRAME_INDEX || isAllocaReg)
         {
-            lhsReg            = getVReg(BE::I64);
+            lhsReg            = ctx_.mfunc->newVReg(BE::I64);
             int    fi         = isAllocaReg ? allocaFI : lhs->getFrameIndex();
             Instr* addrInst   = createIInst(Operator::ADDI, lhsReg, PR::sp, 0);
             addrInst->fiop    = new FrameIndexOperand(fi);
@@ -383,7 +383,7 @@ namespace BE::RV64
                 m_block->insts.push_back(createIInst(iop, dst, lhsReg, rhsImm));
             else
             {
-                Register tmpReg = getVReg(lhsReg.dt);
+                Register tmpReg = ctx_.mfunc->newVReg(lhsReg.dt);
                 m_block->insts.push_back(createMove(new RegOperand(tmpReg), rhsImm, LOC_STR));
                 m_block->insts.push_back(createRInst(op, dst, lhsReg, tmpReg));
             }
@@ -488,7 +488,7 @@ namespace BE::RV64
             if (static_cast<DAG::ISD>(baseNode->getOpcode()) == DAG::ISD::FRAME_INDEX)
             {
                 int fi            = baseNode->getFrameIndex();
-                baseReg           = getVReg(BE::I64);
+                baseReg           = ctx_.mfunc->newVReg(BE::I64);
                 Instr* addrInst   = createIInst(Operator::ADDI, baseReg, PR::sp, 0);
                 addrInst->fiop    = new FrameIndexOperand(fi);
                 addrInst->use_ops = true;
@@ -497,7 +497,7 @@ namespace BE::RV64
             else if (static_cast<DAG::ISD>(baseNode->getOpcode()) == DAG::ISD::SYMBOL && baseNode->hasSymbol())
             {
                 std::string symbol = baseNode->getSymbol();
-                baseReg            = getVReg(BE::I64);
+                baseReg            = ctx_.mfunc->newVReg(BE::I64);
                 Label symbolLabel(symbol, false, true);
                 m_block->insts.push_back(createUInst(Operator::LA, baseReg, symbolLabel));
             }
@@ -508,9 +508,9 @@ namespace BE::RV64
 
             if (offset < -2048 || offset > 2047)
             {
-                Register offsetReg = getVReg(BE::I64);
+                Register offsetReg = ctx_.mfunc->newVReg(BE::I64);
                 m_block->insts.push_back(createMove(new RegOperand(offsetReg), static_cast<int>(offset), LOC_STR));
-                Register finalBase = getVReg(BE::I64);
+                Register finalBase = ctx_.mfunc->newVReg(BE::I64);
                 m_block->insts.push_back(createRInst(Operator::ADD, finalBase, baseReg, offsetReg));
                 m_block->insts.push_back(createIInst(loadOp, dst, finalBase, 0));
             }
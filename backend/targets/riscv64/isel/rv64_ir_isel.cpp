@@ -50,7 +50,31 @@ namespace BE::RV64
 
     void IRIsel::runImpl() { apply(*this, *ir_module_); }
 
+    void IRIsel::run(ThreadPool& pool)
+    {
+        // 全局变量与函数外壳按原顺序串行创建，各函数体的指令选择互不相关，在线程池上并行完成
+        selectGlobals(*ir_module_);
+        auto&                      funcs = ir_module_->functions;
+        std::vector<BE::Function*> m_funcs;
+        m_funcs.reserve(funcs.size());
+        for (auto* func : funcs) m_funcs.push_back(createFunction(*func));
+        pool.parallelFor(funcs.size(), [&](size_t i) { selectFunction(*funcs[i], m_funcs[i]); });
+    }
+
+    BE::Function* IRIsel::runFunction(ME::Function& func)
+    {
+        BE::Function* m_func = createFunction(func);
+        selectFunction(func, m_func);
+        return m_func;
+    }
+
     void IRIsel::visit(ME::Module& module)
+    {
+        selectGlobals(module);
+        for (auto* func : module.functions) apply(*this, *func);
+    }
+
+    void IRIsel::selectGlobals(ME::Module& module)
     {
         for (auto* gv : module.globalVars)
         {
@@ -92,27 +116,31 @@ namespace BE::RV64
 
             m_backend_module->globals.push_back(be_gv);
         }
-
-        for (auto* func : module.functions) apply(*this, *func);
     }
-    void IRIsel::visit(ME::Function& func)
+    void IRIsel::visit(ME::Function& func) { selectFunction(func, createFunction(func)); }
+
+    BE::Function* IRIsel::createFunction(ME::Function& func)
     {
-        BE::ensureVRegBase(static_cast<uint32_t>(func.getMaxReg() + 1));
         auto* m_func = new BE::Function(func.funcDef ? func.funcDef->funcName : "");
+        m_func->ensureVRegBase(static_cast<uint32_t>(func.getMaxReg() + 1));
         m_backend_module->functions.push_back(m_func);
+        return m_func;
+    }
+
+    void IRIsel::selectFunction(ME::Function& func, BE::Function* m_func)
+    {
         s_cur_func  = m_func;
         s_cur_block = nullptr;
 
-        for (auto& [label, ir_block] : func.blocks)
+        for (auto* ir_block : func.blocks)
         {
-            if (!ir_block) continue;
-            uint32_t bid        = static_cast<uint32_t>(label);
+            uint32_t bid        = static_cast<uint32_t>(ir_block->blockId);
             m_func->blocks[bid] = new BE::Block(bid);
         }
 
         if (func.funcDef && !func.blocks.empty())
         {
-            uint32_t entryLabel = static_cast<uint32_t>(func.blocks.begin()->first);
+            uint32_t entryLabel = static_cast<uint32_t>(func.blocks.front()->blockId);
             auto     entryIt    = s_cur_func->blocks.find(entryLabel);
             if (entryIt == s_cur_func->blocks.end() || !entryIt->second)
                 ERROR("IR isel function entry block not initialized");
@@ -183,10 +211,7 @@ namespace BE::RV64
             }
         }
 
-        for (auto& [_, ir_block] : func.blocks)
-        {
-            if (ir_block) apply(*this, *ir_block);
-        }
+        for (auto* ir_block : func.blocks) apply(*this, *ir_block);
     }
     void IRIsel::visit(ME::Block& block)
     {
@@ -218,7 +243,7 @@ namespace BE::RV64
             case ME::OperandType::GLOBAL:
             {
                 auto* gop = static_cast<ME::GlobalOperand*>(inst.ptr);
-                baseReg   = getVReg(BE::PTR);
+                baseReg   = s_cur_func->newVReg(BE::PTR);
                 Label symbolLabel(gop->name, false, true);
                 s_cur_block->insts.push_back(createUInst(Operator::LA, baseReg, symbolLabel));
                 break;
@@ -245,21 +270,21 @@ namespace BE::RV64
             case ME::OperandType::IMMEI32:
             {
                 auto* imm = static_cast<ME::ImmeI32Operand*>(inst.val);
-                valReg    = getVReg(valType);
+                valReg    = s_cur_func->newVReg(valType);
                 s_cur_block->insts.push_back(createMove(new RegOperand(valReg), imm->value, LOC_STR));
                 break;
             }
             case ME::OperandType::IMMEF32:
             {
                 auto* imm = static_cast<ME::ImmeF32Operand*>(inst.val);
-                valReg    = getVReg(valType);
+                valReg    = s_cur_func->newVReg(valType);
                 s_cur_block->insts.push_back(createMove(new RegOperand(valReg), imm->value, LOC_STR));
                 break;
             }
             case ME::OperandType::GLOBAL:
             {
                 auto* gop = static_cast<ME::GlobalOperand*>(inst.val);
-                valReg    = getVReg(BE::PTR);
+                valReg    = s_cur_func->newVReg(BE::PTR);
                 Label symbolLabel(gop->name, false, true);
                 s_cur_block->insts.push_back(createUInst(Operator::LA, valReg, symbolLabel));
                 break;
@@ -278,7 +303,7 @@ namespace BE::RV64
             case ME::OperandType::GLOBAL:
             {
                 auto* gop = static_cast<ME::GlobalOperand*>(inst.ptr);
-                baseReg   = getVReg(BE::PTR);
+                baseReg   = s_cur_func->newVReg(BE::PTR);
                 Label symbolLabel(gop->name, false, true);
                 s_cur_block->insts.push_back(createUInst(Operator::LA, baseReg, symbolLabel));
                 break;
@@ -305,21 +330,21 @@ namespace BE::RV64
                 case ME::OperandType::IMMEI32:
                 {
                     auto*    imm = static_cast<ME::ImmeI32Operand*>(op);
-                    Register reg = getVReg(dt);
+                    Register reg = s_cur_func->newVReg(dt);
                     s_cur_block->insts.push_back(createMove(new RegOperand(reg), imm->value, LOC_STR));
                     return reg;
                 }
                 case ME::OperandType::IMMEF32:
                 {
                     auto*    imm = static_cast<ME::ImmeF32Operand*>(op);
-                    Register reg = getVReg(dt);
+                    Register reg = s_cur_func->newVReg(dt);
                     s_cur_block->insts.push_back(createMove(new RegOperand(reg), imm->value, LOC_STR));
                     return reg;
                 }
                 case ME::OperandType::GLOBAL:
                 {
                     auto*    gop = static_cast<ME::GlobalOperand*>(op);
-                    Register reg = getVReg(BE::PTR);
+                    Register reg = s_cur_func->newVReg(BE::PTR);
                     Label    symbolLabel(gop->name, false, true);
                     s_cur_block->insts.push_back(createUInst(Operator::LA, reg, symbolLabel));
                     return reg;
@@ -450,14 +475,14 @@ namespace BE::RV64
                 case ME::OperandType::IMMEI32:
                 {
                     auto*    imm = static_cast<ME::ImmeI32Operand*>(op);
-                    Register reg = getVReg(dt);
+                    Register reg = s_cur_func->newVReg(dt);
                     s_cur_block->insts.push_back(createMove(new RegOperand(reg), imm->value, LOC_STR));
                     return reg;
                 }
                 case ME::OperandType::GLOBAL:
                 {
                     auto*    gop = static_cast<ME::GlobalOperand*>(op);
-                    Register reg = getVReg(BE::PTR);
+                    Register reg = s_cur_func->newVReg(BE::PTR);
                     Label    symbolLabel(gop->name, false, true);
                     s_cur_block->insts.push_back(createUInst(Operator::LA, reg, symbolLabel));
                     return reg;
@@ -501,7 +526,7 @@ namespace BE::RV64
 
         auto zextIfNeeded = [&](Register reg) -> Register {
             if (!isUnsigned || opType != BE::I32) return reg;
-            Register zextReg = getVReg(BE::I64);
+            Register zextReg = s_cur_func->newVReg(BE::I64);
             s_cur_block->insts.push_back(createR2Inst(Operator::ZEXT_W, zextReg, reg));
             return zextReg;
         };
@@ -619,14 +644,14 @@ namespace BE::RV64
         {
             case ME::ICmpOp::EQ:
             {
-                Register tmp = getVReg(opType);
+                Register tmp = s_cur_func->newVReg(opType);
                 s_cur_block->insts.push_back(createRInst(Operator::XOR, tmp, lhsReg, rhsReg));
                 s_cur_block->insts.push_back(createIInst(Operator::SLTIU, dst, tmp, 1));
                 break;
             }
             case ME::ICmpOp::NE:
             {
-                Register tmp = getVReg(opType);
+                Register tmp = s_cur_func->newVReg(opType);
                 s_cur_block->insts.push_back(createRInst(Operator::XOR, tmp, lhsReg, rhsReg));
                 s_cur_block->insts.push_back(createRInst(Operator::SLTU, dst, PR::x0, tmp));
                 break;
@@ -634,7 +659,7 @@ namespace BE::RV64
             case ME::ICmpOp::SGT: s_cur_block->insts.push_back(createRInst(Operator::SLT, dst, rhsReg, lhsReg)); break;
             case ME::ICmpOp::SGE:
             {
-                Register tmp = getVReg(opType);
+                Register tmp = s_cur_func->newVReg(opType);
                 s_cur_block->insts.push_back(createRInst(Operator::SLT, tmp, lhsReg, rhsReg));
                 s_cur_block->insts.push_back(createIInst(Operator::XORI, dst, tmp, 1));
                 break;
@@ -642,7 +667,7 @@ namespace BE::RV64
             case ME::ICmpOp::SLT: s_cur_block->insts.push_back(createRInst(Operator::SLT, dst, lhsReg, rhsReg)); break;
             case ME::ICmpOp::SLE:
             {
-                Register tmp = getVReg(opType);
+                Register tmp = s_cur_func->newVReg(opType);
                 s_cur_block->insts.push_back(createRInst(Operator::SLT, tmp, rhsReg, lhsReg));
                 s_cur_block->insts.push_back(createIInst(Operator::XORI, dst, tmp, 1));
                 break;
@@ -650,7 +675,7 @@ namespace BE::RV64
             case ME::ICmpOp::UGT: s_cur_block->insts.push_back(createRInst(Operator::SLTU, dst, rhsReg, lhsReg)); break;
             case ME::ICmpOp::UGE:
             {
-                Register tmp = getVReg(opType);
+                Register tmp = s_cur_func->newVReg(opType);
                 s_cur_block->insts.push_back(createRInst(Operator::SLTU, tmp, lhsReg, rhsReg));
                 s_cur_block->insts.push_back(createIInst(Operator::XORI, dst, tmp, 1));
                 break;
@@ -658,7 +683,7 @@ namespace BE::RV64
             case ME::ICmpOp::ULT: s_cur_block->insts.push_back(createRInst(Operator::SLTU, dst, lhsReg, rhsReg)); break;
             case ME::ICmpOp::ULE:
             {
-                Register tmp = getVReg(opType);
+                Register tmp = s_cur_func->newVReg(opType);
                 s_cur_block->insts.push_back(createRInst(Operator::SLTU, tmp, rhsReg, lhsReg));
                 s_cur_block->insts.push_back(createIInst(Operator::XORI, dst, tmp, 1));
                 break;
@@ -682,7 +707,7 @@ namespace BE::RV64
                 case ME::OperandType::IMMEF32:
                 {
                     auto*    imm = static_cast<ME::ImmeF32Operand*>(op);
-                    Register reg = getVReg(opType);
+                    Register reg = s_cur_func->newVReg(opType);
                     s_cur_block->insts.push_back(createMove(new RegOperand(reg), imm->value, LOC_STR));
                     return reg;
                 }
@@ -694,15 +719,15 @@ namespace BE::RV64
         Register rhsReg = materializeOperand(inst.rhs);
 
         auto emitOrdered = [&](Register out) {
-            Register lhsOrd = getVReg(BE::I32);
-            Register rhsOrd = getVReg(BE::I32);
+            Register lhsOrd = s_cur_func->newVReg(BE::I32);
+            Register rhsOrd = s_cur_func->newVReg(BE::I32);
             s_cur_block->insts.push_back(createRInst(Operator::FEQ_S, lhsOrd, lhsReg, lhsReg));
             s_cur_block->insts.push_back(createRInst(Operator::FEQ_S, rhsOrd, rhsReg, rhsReg));
             s_cur_block->insts.push_back(createRInst(Operator::AND, out, lhsOrd, rhsOrd));
         };
 
         auto emitUnordered = [&](Register out) {
-            Register ordered = getVReg(BE::I32);
+            Register ordered = s_cur_func->newVReg(BE::I32);
             emitOrdered(ordered);
             s_cur_block->insts.push_back(createIInst(Operator::XORI, out, ordered, 1));
         };
@@ -728,7 +753,7 @@ namespace BE::RV64
             {
                 s_cur_block->insts.push_back(createRInst(Operator::FEQ_S, dst, lhsReg, rhsReg));
                 s_cur_block->insts.push_back(createIInst(Operator::XORI, dst, dst, 1));
-                Register ordered = getVReg(BE::I32);
+                Register ordered = s_cur_func->newVReg(BE::I32);
                 emitOrdered(ordered);
                 s_cur_block->insts.push_back(createRInst(Operator::AND, dst, dst, ordered));
                 break;
@@ -737,7 +762,7 @@ namespace BE::RV64
             case ME::FCmpOp::UEQ:
             {
                 s_cur_block->insts.push_back(createRInst(Operator::FEQ_S, dst, lhsReg, rhsReg));
-                Register unordered = getVReg(BE::I32);
+                Register unordered = s_cur_func->newVReg(BE::I32);
                 emitUnordered(unordered);
                 s_cur_block->insts.push_back(createRInst(Operator::OR, dst, dst, unordered));
                 break;
@@ -745,7 +770,7 @@ namespace BE::RV64
             case ME::FCmpOp::UGT:
             {
                 s_cur_block->insts.push_back(createRInst(Operator::FLT_S, dst, rhsReg, lhsReg));
-                Register unordered = getVReg(BE::I32);
+                Register unordered = s_cur_func->newVReg(BE::I32);
                 emitUnordered(unordered);
                 s_cur_block->insts.push_back(createRInst(Operator::OR, dst, dst, unordered));
                 break;
@@ -753,7 +778,7 @@ namespace BE::RV64
             case ME::FCmpOp::UGE:
             {
                 s_cur_block->insts.push_back(createRInst(Operator::FLE_S, dst, rhsReg, lhsReg));
-                Register unordered = getVReg(BE::I32);
+                Register unordered = s_cur_func->newVReg(BE::I32);
                 emitUnordered(unordered);
                 s_cur_block->insts.push_back(createRInst(Operator::OR, dst, dst, unordered));
                 break;
@@ -761,7 +786,7 @@ namespace BE::RV64
             case ME::FCmpOp::ULT:
             {
                 s_cur_block->insts.push_back(createRInst(Operator::FLT_S, dst, lhsReg, rhsReg));
-                Register unordered = getVReg(BE::I32);
+                Register unordered = s_cur_func->newVReg(BE::I32);
                 emitUnordered(unordered);
                 s_cur_block->insts.push_back(createRInst(Operator::OR, dst, dst, unordered));
                 break;
@@ -769,7 +794,7 @@ namespace BE::RV64
             case ME::FCmpOp::ULE:
             {
                 s_cur_block->insts.push_back(createRInst(Operator::FLE_S, dst, lhsReg, rhsReg));
-                Register unordered = getVReg(BE::I32);
+                Register unordered = s_cur_func->newVReg(BE::I32);
                 emitUnordered(unordered);
                 s_cur_block->insts.push_back(createRInst(Operator::OR, dst, dst, unordered));
                 break;
@@ -778,7 +803,7 @@ namespace BE::RV64
             {
                 s_cur_block->insts.push_back(createRInst(Operator::FEQ_S, dst, lhsReg, rhsReg));
                 s_cur_block->insts.push_back(createIInst(Operator::XORI, dst, dst, 1));
-                Register unordered = getVReg(BE::I32);
+                Register unordered = s_cur_func->newVReg(BE::I32);
                 emitUnordered(unordered);
                 s_cur_block->insts.push_back(createRInst(Operator::OR, dst, dst, unordered));
                 break;
@@ -865,7 +890,7 @@ namespace BE::RV64
         if (!s_cur_block) ERROR("IR isel call without current block");
 
         // Handle LLVM intrinsics by redirecting to C library functions
-        std::string actualFuncName = inst.funcName;
+        std::string actualFuncName(inst.funcName);
         size_t actualArgCount = inst.args.size();
         
         // Map LLVM intrinsics to C library functions
@@ -907,14 +932,14 @@ namespace BE::RV64
                 case ME::OperandType::IMMEI32:
                 {
                     auto*    imm = static_cast<ME::ImmeI32Operand*>(op);
-                    Register r   = getVReg(dt);
+                    Register r   = s_cur_func->newVReg(dt);
                     s_cur_block->insts.push_back(createMove(new RegOperand(r), imm->value, LOC_STR));
                     return r;
                 }
                 case ME::OperandType::IMMEF32:
                 {
                     auto*    imm = static_cast<ME::ImmeF32Operand*>(op);
-                    Register r   = getVReg(dt);
+                    Register r   = s_cur_func->newVReg(dt);
                     s_cur_block->insts.push_back(createMove(new RegOperand(r), imm->value, LOC_STR));
                     return r;
                 }
@@ -922,7 +947,7 @@ namespace BE::RV64
                 {
                     auto*    gop = static_cast<ME::GlobalOperand*>(op);
                     Label    symbolLabel(gop->name, false, true);
-                    Register r = getVReg(BE::PTR);
+                    Register r = s_cur_func->newVReg(BE::PTR);
                     s_cur_block->insts.push_back(createUInst(Operator::LA, r, symbolLabel));
                     // 若目标为浮点形参，后续会用 faX 从 r 搬过去；整数则直接用 aX 搬
                     return r;
@@ -1060,7 +1085,7 @@ namespace BE::RV64
                     Label symbolLabel(gop->name, false, true);
                     if (destReg.dt == BE::F32 || destReg.dt == BE::F64)
                     {
-                        Register tmp = getVReg(BE::PTR);
+                        Register tmp = s_cur_func->newVReg(BE::PTR);
                         s_cur_block->insts.push_back(createUInst(Operator::LA, tmp, symbolLabel));
                         s_cur_block->insts.push_back(createMove(new RegOperand(destReg), new RegOperand(tmp), LOC_STR));
                     }
@@ -1114,7 +1139,7 @@ namespace BE::RV64
             case ME::OperandType::GLOBAL:
             {
                 auto* gop = static_cast<ME::GlobalOperand*>(inst.basePtr);
-                baseReg   = getVReg(BE::PTR);
+                baseReg   = s_cur_func->newVReg(BE::PTR);
                 Label symbolLabel(gop->name, false, true);
                 s_cur_block->insts.push_back(createUInst(Operator::LA, baseReg, symbolLabel));
                 break;
@@ -1180,7 +1205,7 @@ namespace BE::RV64
             Register idx64 = idxReg;
             if (idxReg.dt == BE::I32)
             {
-                Register zextReg = getVReg(BE::I64);
+                Register zextReg = s_cur_func->newVReg(BE::I64);
                 s_cur_block->insts.push_back(createR2Inst(Operator::ZEXT_W, zextReg, idxReg));
                 idx64 = zextReg;
             }
@@ -1190,16 +1215,16 @@ namespace BE::RV64
             {
                 if (isPow2(byteStride))
                 {
-                    Register shReg = getVReg(BE::I64);
+                    Register shReg = s_cur_func->newVReg(BE::I64);
                     s_cur_block->insts.push_back(createIInst(Operator::SLLI, shReg, idx64, log2i(byteStride)));
                     scaledReg = shReg;
                 }
                 else
                 {
-                    Register strideReg = getVReg(BE::I64);
+                    Register strideReg = s_cur_func->newVReg(BE::I64);
                     s_cur_block->insts.push_back(
                         createMove(new RegOperand(strideReg), static_cast<int>(byteStride), LOC_STR));
-                    Register mulReg = getVReg(BE::I64);
+                    Register mulReg = s_cur_func->newVReg(BE::I64);
                     s_cur_block->insts.push_back(createRInst(Operator::MUL, mulReg, idx64, strideReg));
                     scaledReg = mulReg;
                 }
@@ -1212,7 +1237,7 @@ namespace BE::RV64
             }
             else
             {
-                Register sumReg = getVReg(BE::I64);
+                Register sumReg = s_cur_func->newVReg(BE::I64);
                 s_cur_block->insts.push_back(createRInst(Operator::ADD, sumReg, offsetReg, scaledReg));
                 offsetReg = sumReg;
             }
@@ -1229,10 +1254,10 @@ namespace BE::RV64
                 }
                 else
                 {
-                    Register immReg = getVReg(BE::I64);
+                    Register immReg = s_cur_func->newVReg(BE::I64);
                     s_cur_block->insts.push_back(
                         createMove(new RegOperand(immReg), static_cast<int>(constOffset), LOC_STR));
-                    Register sumReg = getVReg(BE::I64);
+                    Register sumReg = s_cur_func->newVReg(BE::I64);
                     s_cur_block->insts.push_back(createRInst(Operator::ADD, sumReg, offsetReg, immReg));
                     offsetReg = sumReg;
                 }
@@ -1246,7 +1271,7 @@ namespace BE::RV64
                     return;
                 }
 
-                Register immReg = getVReg(BE::I64);
+                Register immReg = s_cur_func->newVReg(BE::I64);
                 s_cur_block->insts.push_back(
                     createMove(new RegOperand(immReg), static_cast<int>(constOffset), LOC_STR));
                 s_cur_block->insts.push_back(createRInst(Operator::ADD, dst, baseReg, immReg));
@@ -1272,7 +1297,7 @@ namespace BE::RV64
             case ME::OperandType::IMMEF32:
             {
                 auto* imm = static_cast<ME::ImmeF32Operand*>(inst.src);
-                srcReg    = getVReg(BE::F32);
+                srcReg    = s_cur_func->newVReg(BE::F32);
                 s_cur_block->insts.push_back(createMove(new RegOperand(srcReg), imm->value, LOC_STR));
                 break;
             }
@@ -1295,7 +1320,7 @@ namespace BE::RV64
             case ME::OperandType::IMMEI32:
             {
                 auto* imm = static_cast<ME::ImmeI32Operand*>(inst.src);
-                srcReg    = getVReg(BE::I32);
+                srcReg    = s_cur_func->newVReg(BE::I32);
                 s_cur_block->insts.push_back(createMove(new RegOperand(srcReg), imm->value, LOC_STR));
                 break;
             }
@@ -1347,7 +1372,7 @@ namespace BE::RV64
         {
             if (srcIsImm)
             {
-                srcReg = getVReg(srcType);
+                srcReg = s_cur_func->newVReg(srcType);
                 s_cur_block->insts.push_back(createMove(new RegOperand(srcReg), immVal, LOC_STR));
             }
             s_cur_block->insts.push_back(createR2Inst(Operator::ZEXT_W, dst, srcReg));
@@ -1362,7 +1387,8 @@ namespace BE::RV64
 
         if (!inst.res || inst.res->getType() != ME::OperandType::REG) ERROR("Phi destination must be a register");
 
-        BE::DataType* dstType = mapType(inst.dt);
+        // 指针 phi 与 GEP 的结果使用同一种虚拟寄存器类型
+        BE::DataType* dstType = inst.dt == ME::DataType::PTR ? BE::PTR : mapType(inst.dt);
         Register      dst     = makeVReg(inst.res->getRegNum(), dstType);
         auto*         phiInst = new BE::PhiInst(dst);
 
@@ -2,6 +2,7 @@
 #define __BACKEND_TARGETS_RISCV64_ISEL_RV64_IR_ISEL_H__
 
 #include <backend/isel/isel_base.h>
+#include <thread_pool.h>
 
 /*
  * 注：当前目录下有 rv64_dag_isel 与 rv64_ir_isel 两份实现，它们的功能是一致的，你只需要选择其中一份来完成就行
@@ -50,7 +51,18 @@ namespace BE::RV64
 
         void runImpl();
 
+        void          selectGlobals(ME::Module& module);
+        BE::Function* createFunction(ME::Function& func);
+        void          selectFunction(ME::Function& func, BE::Function* m_func);
+
       public:
+        using BE::ISelBase<IRIsel>::run;
+        // 按函数并行做指令选择，结果与串行的 run() 一致
+        void run(ThreadPool& pool);
+        // 流式编译：全局变量与各函数分开选择，结果与 run() 一致
+        void          runGlobals() { selectGlobals(*ir_module_); }
+        BE::Function* runFunction(ME::Function& func);
+
         void visit(ME::Module& module) override;
         void visit(ME::Function& func) override;
         void visit(ME::Block& block) override;
@@ -0,0 +1,191 @@
+#include <backend/targets/riscv64/passes/lowering/branch_relaxation.h>
+#include <backend/mir/m_instruction.h>
+#include <stats.h>
+#include <iterator>
+#include <unordered_map>
+#include <vector>
+
+namespace BE::RV64::Passes::Lowering
+{
+    using namespace BE;
+    using namespace BE::RV64;
+
+    namespace
+    {
+        // B 型指令的偏移为 13 位有符号数
+        static inline bool inBranchRange(long long dist) { return dist >= -4096 && dist <= 4094; }
+
+        static bool isCondBranch(Operator op)
+        {
+            switch (op)
+            {
+                case Operator::BEQ:
+                case Operator::BNE:
+                case Operator::BLT:
+                case Operator::BGE:
+                case Operator::BLTU:
+                case Operator::BGEU:
+                case Operator::BGT:
+                case Operator::BLE:
+                case Operator::BGTU:
+                case Operator::BLEU: return true;
+                default: return false;
+            }
+        }
+
+        static Operator invertBranch(Operator op)
+        {
+            switch (op)
+            {
+                case Operator::BEQ: return Operator::BNE;
+                case Operator::BNE: return Operator::BEQ;
+                case Operator::BLT: return Operator::BGE;
+                case Operator::BGE: return Operator::BLT;
+                case Operator::BLTU: return Operator::BGEU;
+                case Operator::BGEU: return Operator::BLTU;
+                case Operator::BGT: return Operator::BLE;
+                case Operator::BLE: return Operator::BGT;
+                case Operator::BGTU: return Operator::BLEU;
+                case Operator::BLEU: return Operator::BGTU;
+                default: return op;
+            }
+        }
+
+        // 指令的最大长度：汇编器会展开为两条指令的 li / la / call 按 8 字节计，其余按 4 字节；
+        // 压缩扩展只会让实际长度更短，因此按此估算的距离不小于真实距离
+        static long long maxSize(MInstruction* inst)
+        {
+            auto* ri = dynamic_cast<Instr*>(inst);
+            if (!ri) return 4;
+            switch (ri->op)
+            {
+                case Operator::LI:
+                case Operator::LA:
+                case Operator::CALL: return 8;
+                default: return 4;
+            }
+        }
+
+        // 跳转指令的目标块号；目标不是块时返回 false
+        static bool targetOf(Instr* inst, int& target)
+        {
+            if (!isCondBranch(inst->op) && inst->op != Operator::JAL) return false;
+            if (!inst->use_label)
+            {
+                target = inst->imme;
+                return true;
+            }
+            if (inst->label.is_data || inst->label.jmp_label < 0) return false;
+            target = inst->label.jmp_label;
+            return true;
+        }
+
+        static void setTarget(Instr* inst, int target)
+        {
+            if (!inst->use_label)
+            {
+                inst->imme = target;
+                return;
+            }
+            inst->label.jmp_label = target;
+            inst->label.lnum      = static_cast<uint32_t>(target);
+        }
+    }  // namespace
+
+    void BranchRelaxationPass::runOnModule(BE::Module& module)
+    {
+        for (auto* func : module.functions) runOnFunction(func);
+    }
+
+    void BranchRelaxationPass::runOnFunction(BE::Function* func)
+    {
+        if (!func || func->blocks.empty()) return;
+
+        // 输出顺序即块号顺序；拆出的块先按布局记录，最后统一重新编号
+        std::vector<Block*> layout;
+        for (auto& [id, block] : func->blocks) layout.push_back(block);
+        uint32_t nextId  = func->blocks.rbegin()->first + 1;
+        bool     split   = false;
+        size_t   relaxed = 0;
+
+        // 拆块会让其后的偏移整体后移，因此每次拆块后重新计算偏移，直到所有条件跳转都在范围内
+        for (bool changed = true; changed;)
+        {
+            changed = false;
+            std::unordered_map<int, long long> blockStart;
+            long long                          pc = 0;
+            for (auto* block : layout)
+            {
+                blockStart[static_cast<int>(block->blockId)] = pc;
+                for (auto* inst : block->insts) pc += maxSize(inst);
+            }
+
+            pc = 0;
+            for (size_t bi = 0; bi < layout.size() && !changed; ++bi)
+            {
+                Block* block = layout[bi];
+                for (auto it = block->insts.begin(); it != block->insts.end(); pc += maxSize(*it), ++it)
+                {
+                    auto* br     = dynamic_cast<Instr*>(*it);
+                    int   target = 0;
+                    if (!br || !isCondBranch(br->op) || !targetOf(br, target)) continue;
+                    auto dst = blockStart.find(target);
+                    if (dst == blockStart.end() || inBranchRange(dst->second - pc)) continue;
+                    ++relaxed;
+
+                    // 常见形式 bxx L1; j L2 且 L2 在范围内：交换两个目标，指令长度不变，偏移无需重算
+                    auto next = std::next(it);
+                    if (next != block->insts.end() && std::next(next) == block->insts.end())
+                    {
+                        auto* jump = dynamic_cast<Instr*>(*next);
+                        int   other = 0;
+                        if (jump && jump->op == Operator::JAL && jump->rd == PR::x0 && targetOf(jump, other))
+                        {
+                            auto alt = blockStart.find(other);
+                            if (alt != blockStart.end() && inBranchRange(alt->second - pc))
+                            {
+                                br->op = invertBranch(br->op);
+                                setTarget(br, other);
+                                setTarget(jump, target);
+                                continue;
+                            }
+                        }
+                    }
+
+                    // 一般情况：跳转之后的指令拆到紧随其后的新块，条件取反跳过新插入的 j
+                    Block* rest = new Block(nextId++);
+                    rest->insts.assign(next, block->insts.end());
+                    block->insts.erase(next, block->insts.end());
+                    br->op = invertBranch(br->op);
+                    setTarget(br, static_cast<int>(rest->blockId));
+                    block->insts.push_back(createJInst(Operator::JAL, PR::x0, Label(target)));
+                    layout.insert(layout.begin() + static_cast<std::ptrdiff_t>(bi) + 1, rest);
+                    split   = true;
+                    changed = true;
+                    break;
+                }
+            }
+        }
+
+        if (relaxed) Stats::bump("branches relaxed", relaxed);
+        if (!split) return;
+
+        // 按布局顺序重新编号，使块号顺序与输出顺序一致
+        std::unordered_map<int, int> renumber;
+        for (size_t i = 0; i < layout.size(); ++i) renumber[static_cast<int>(layout[i]->blockId)] = static_cast<int>(i);
+        func->blocks.clear();
+        for (auto* block : layout)
+        {
+            for (auto* inst : block->insts)
+            {
+                auto* ri     = dynamic_cast<Instr*>(inst);
+                int   target = 0;
+                if (!ri || !targetOf(ri, target)) continue;
+                auto it = renumber.find(target);
+                if (it != renumber.end()) setTarget(ri, it->second);
+            }
+            block->blockId               = static_cast<uint32_t>(renumber[static_cast<int>(block->blockId)]);
+            func->blocks[block->blockId] = block;
+        }
+    }
+}  // namespace BE::RV64::Passes::Lowering
@@ -0,0 +1,29 @@
+#ifndef __BACKEND_RV64_PASSES_LOWERING_BRANCH_RELAXATION_H__
+#define __BACKEND_RV64_PASSES_LOWERING_BRANCH_RELAXATION_H__
+
+#include <backend/mir/m_module.h>
+#include <backend/mir/m_function.h>
+#include <backend/mir/m_block.h>
+#include <backend/targets/riscv64/rv64_defs.h>
+
+namespace BE::RV64::Passes::Lowering
+{
+    /*
+     * 分支松弛：条件跳转的偏移只有 ±4 KiB，函数较大时目标可能超出范围。
+     * 按块的输出顺序与每条指令的最大长度估算偏移，把超出范围的 bxx rs1, rs2, L 改写为
+     * b!xx rs1, rs2, .next; j L，其中 .next 是从跳转之后拆出的新块；j 的范围为 ±1 MiB。
+     * 块后紧跟的是跳到范围内目标的 j 时，直接交换两个目标，不拆块。
+     * 需在栈帧展开之后、汇编输出之前运行，此时指令序列不再变化
+     */
+    class BranchRelaxationPass
+    {
+      public:
+        BranchRelaxationPass()  = default;
+        ~BranchRelaxationPass() = default;
+
+        void runOnModule(BE::Module& module);
+        void runOnFunction(BE::Function* func);
+    };
+}  // namespace BE::RV64::Passes::Lowering
+
+#endif  // __BACKEND_RV64_PASSES_LOWERING_BRANCH_RELAXATION_H__
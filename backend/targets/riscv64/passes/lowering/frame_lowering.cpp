@@ -57,7 +57,7 @@ namespace BE::RV64::Passes::Lowering
                 if (ri->op == Operator::ADDI || ri->op == Operator::ADDIW)
                 {
                     BE::DataType* offType = ri->rd.dt ? ri->rd.dt : BE::I64;
-                    Register      offReg  = BE::getVReg(offType);
+                    Register      offReg  = func->newVReg(offType);
                     it = block->insts.insert(it, BE::createMove(new BE::RegOperand(offReg), offset));
                     ++it;
 
@@ -73,8 +73,8 @@ namespace BE::RV64::Passes::Lowering
                 if (isLoadOp(ri->op) || isStoreOp(ri->op))
                 {
                     Register baseReg = isStoreOp(ri->op) ? ri->rs2 : ri->rs1;
-                    Register offReg  = BE::getVReg(BE::I64);
-                    Register addrReg = BE::getVReg(BE::I64);
+                    Register offReg  = func->newVReg(BE::I64);
+                    Register addrReg = func->newVReg(BE::I64);
 
                     it = block->insts.insert(it, BE::createMove(new BE::RegOperand(offReg), offset));
                     ++it;
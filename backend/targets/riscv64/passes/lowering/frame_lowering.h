@@ -18,8 +18,6 @@ namespace BE::RV64::Passes::Lowering
         ~FrameLoweringPass() = default;
 
         void runOnModule(BE::Module& module);
-
-      private:
         void runOnFunction(BE::Function* func);
     };
 }  // namespace BE::RV64::Passes::Lowering
@@ -1,5 +1,6 @@
 #include <backend/targets/riscv64/passes/lowering/phi_elimination.h>
 #include <debug.h>
+#include <stats.h>
 #include <algorithm>
 #include <set>
 
@@ -72,7 +73,8 @@ namespace BE::RV64::Passes::Lowering
             return block->insts.end();
         }
 
-        static std::vector<MoveInst*> buildParallelMoves(const std::vector<std::pair<Register, Operand*>>& copies)
+        static std::vector<MoveInst*> buildParallelMoves(
+            BE::Function* func, const std::vector<std::pair<Register, Operand*>>& copies)
         {
             std::map<Register, Operand*> pending;
             for (const auto& [dst, src] : copies)
@@ -124,7 +126,7 @@ namespace BE::RV64::Passes::Lowering
                     continue;
                 }
 
-                Register tmp = getVReg(dst.dt);
+                Register tmp = func->newVReg(dst.dt);
                 moves.push_back(createMove(new RegOperand(tmp), src));
                 it->second = new RegOperand(tmp);
             }
@@ -176,8 +178,9 @@ namespace BE::RV64::Passes::Lowering
             auto itSucc = func->blocks.find(edge.succ);
             if (itPred == func->blocks.end() || itSucc == func->blocks.end()) continue;
 
-            auto moves = buildParallelMoves(copies);
+            auto moves = buildParallelMoves(func, copies);
             if (moves.empty()) continue;
+            Stats::bump("copies inserted", moves.size());
 
             bool needSplit = succs[edge.pred].size() > 1;
             if (!needSplit)
@@ -198,6 +201,7 @@ namespace BE::RV64::Passes::Lowering
             if (!br) continue;
 
             uint32_t newId = nextId++;
+            Stats::bump("critical edges split");
             auto*    newBlock = new Block(newId);
             for (auto* mv : moves) newBlock->insts.push_back(mv);
             newBlock->insts.push_back(createJInst(Operator::JAL, PR::x0, Label(static_cast<int>(edge.succ))));
@@ -22,8 +22,6 @@ namespace BE::RV64::Passes::Lowering
         ~PhiEliminationPass() = default;
 
         void runOnModule(BE::Module& module, const BE::Targeting::TargetInstrAdapter* adapter);
-
-      private:
         void runOnFunction(BE::Function* func, const BE::Targeting::TargetInstrAdapter* adapter);
     };
 }  // namespace BE::RV64::Passes::Lowering
@@ -15,8 +15,6 @@ namespace BE::RV64::Passes::Lowering
         ~StackLoweringPass() = default;
 
         void runOnModule(BE::Module& module);
-
-      private:
         void lowerFunction(BE::Function* func);
     };
 
@@ -14,6 +14,11 @@ namespace BE::RV64
 
         void generateAssembly() override;
 
+        // 分段输出：各函数可由不同线程写入各自的缓冲区，再按原顺序拼接
+        void generateHeader() { printHeader(); }
+        void generateFunction(BE::Function* func) { printFunction(func); }
+        void generateGlobals() { printGlobalDefinitions(); }
+
       protected:
         void printHeader() override;
         void printFunctions() override;
@@ -6,6 +6,7 @@
 #include <backend/targets/riscv64/passes/lowering/frame_lowering.h>
 #include <backend/targets/riscv64/passes/lowering/stack_lowering.h>
 #include <backend/targets/riscv64/passes/lowering/phi_elimination.h>
+#include <backend/targets/riscv64/passes/lowering/branch_relaxation.h>
 #include <backend/targets/riscv64/rv64_codegen.h>
 
 #include <backend/common/cfg_builder.h>
@@ -18,17 +19,13 @@
 #include <backend/mir/m_defs.h>
 
 #include <debug.h>
+#include <stats.h>
+#include <thread_pool.h>
 
 #include <map>
+#include <sstream>
 #include <vector>
 #include <cstring>
-namespace BE
-{
-    namespace RA
-    {
-        void setTargetInstrAdapter(const BE::Targeting::TargetInstrAdapter* adapter);
-    }
-}  // namespace BE
 
 namespace BE::Targeting::RV64
 {
@@ -49,125 +46,280 @@ namespace BE::Targeting::RV64
     {
         static bool isFloatType(BE::DataType* dt) { return dt == BE::F32 || dt == BE::F64; }
 
-        static void lowerPseudoMoves(BE::Module& m)
+        static Stats::IRSize mirSize(BE::Module& m)
         {
+            Stats::IRSize size{0, 0};
             for (auto* func : m.functions)
             {
-                for (auto& kv : func->blocks)
+                size.blocks += func->blocks.size();
+                for (auto& [id, block] : func->blocks) size.insts += block->insts.size();
+            }
+            return size;
+        }
+
+        static void lowerPseudoMoves(BE::Function& func)
+        {
+            for (auto& kv : func.blocks)
+            {
+                auto* block = kv.second;
+                for (auto it = block->insts.begin(); it != block->insts.end();)
                 {
-                    auto* block = kv.second;
-                    for (auto it = block->insts.begin(); it != block->insts.end();)
-                    {
-                        auto* mv = dynamic_cast<BE::MoveInst*>(*it);
-                        if (!mv || mv->dest->ot != BE::Operand::Type::REG) { ++it; continue; }
+                    auto* mv = dynamic_cast<BE::MoveInst*>(*it);
+                    if (!mv || mv->dest->ot != BE::Operand::Type::REG) { ++it; continue; }
 
-                        auto dstReg = static_cast<BE::RegOperand*>(mv->dest)->reg;
-                        bool dstFlt = isFloatType(dstReg.dt);
+                    auto dstReg = static_cast<BE::RegOperand*>(mv->dest)->reg;
+                    bool dstFlt = isFloatType(dstReg.dt);
 
-                        std::vector<BE::MInstruction*> replace;
-                        bool                            remove = false;
+                    std::vector<BE::MInstruction*> replace;
+                    bool                            remove = false;
 
-                        switch (mv->src->ot)
+                    switch (mv->src->ot)
+                    {
+                        case BE::Operand::Type::REG:
                         {
-                            case BE::Operand::Type::REG:
+                            auto srcReg = static_cast<BE::RegOperand*>(mv->src)->reg;
+                            if (srcReg == dstReg) { remove = true; break; }
+
+                            if (dstFlt)
                             {
-                                auto srcReg = static_cast<BE::RegOperand*>(mv->src)->reg;
-                                if (srcReg == dstReg) { remove = true; break; }
-
-                                if (dstFlt)
-                                {
-                                    auto op = (dstReg.dt == BE::F32) ? BE::RV64::Operator::FMV_S : BE::RV64::Operator::FMV_D;
-                                    replace.push_back(BE::RV64::createR2Inst(op, dstReg, srcReg));
-                                }
-                                else
-                                {
-                                    auto op = (dstReg.dt == BE::I32) ? BE::RV64::Operator::ADDIW : BE::RV64::Operator::ADDI;
-                                    replace.push_back(BE::RV64::createIInst(op, dstReg, srcReg, 0));
-                                }
-                                break;
+                                auto op = (dstReg.dt == BE::F32) ? BE::RV64::Operator::FMV_S : BE::RV64::Operator::FMV_D;
+                                replace.push_back(BE::RV64::createR2Inst(op, dstReg, srcReg));
                             }
-                            case BE::Operand::Type::IMMI32:
+                            else
                             {
-                                int imm = static_cast<BE::I32Operand*>(mv->src)->val;
-                                if (dstFlt)
-                                {
-                                    BE::Register tmp = BE::getVReg(BE::I32);
-                                    replace.push_back(BE::RV64::createUInst(BE::RV64::Operator::LI, tmp, imm));
-                                    replace.push_back(BE::RV64::createR2Inst(BE::RV64::Operator::FMV_W_X, dstReg, tmp));
-                                }
-                                else
-                                {
-                                    replace.push_back(BE::RV64::createUInst(BE::RV64::Operator::LI, dstReg, imm));
-                                }
-                                break;
+                                auto op = (dstReg.dt == BE::I32) ? BE::RV64::Operator::ADDIW : BE::RV64::Operator::ADDI;
+                                replace.push_back(BE::RV64::createIInst(op, dstReg, srcReg, 0));
                             }
-                            case BE::Operand::Type::IMMF32:
+                            break;
+                        }
+                        case BE::Operand::Type::IMMI32:
+                        {
+                            int imm = static_cast<BE::I32Operand*>(mv->src)->val;
+                            if (dstFlt)
                             {
-                                float fval = static_cast<BE::F32Operand*>(mv->src)->val;
-                                int   bits = 0;
-                                std::memcpy(&bits, &fval, sizeof(bits));
-                                BE::Register tmp = BE::getVReg(BE::I32);
-                                replace.push_back(BE::RV64::createUInst(BE::RV64::Operator::LI, tmp, bits));
+                                BE::Register tmp = func.newVReg(BE::I32);
+                                replace.push_back(BE::RV64::createUInst(BE::RV64::Operator::LI, tmp, imm));
                                 replace.push_back(BE::RV64::createR2Inst(BE::RV64::Operator::FMV_W_X, dstReg, tmp));
-                                break;
                             }
-                            default: break;
+                            else
+                            {
+                                replace.push_back(BE::RV64::createUInst(BE::RV64::Operator::LI, dstReg, imm));
+                            }
+                            break;
                         }
-
-                        if (replace.empty() && !remove) { ++it; continue; }
-
-                        BE::MInstruction::delInst(*it);
-                        it = block->insts.erase(it);
-                        for (auto* inst : replace)
+                        case BE::Operand::Type::IMMF32:
                         {
-                            it = block->insts.insert(it, inst);
-                            ++it;
+                            float fval = static_cast<BE::F32Operand*>(mv->src)->val;
+                            int   bits = 0;
+                            std::memcpy(&bits, &fval, sizeof(bits));
+                            BE::Register tmp = func.newVReg(BE::I32);
+                            replace.push_back(BE::RV64::createUInst(BE::RV64::Operator::LI, tmp, bits));
+                            replace.push_back(BE::RV64::createR2Inst(BE::RV64::Operator::FMV_W_X, dstReg, tmp));
+                            break;
                         }
+                        default: break;
+                    }
+
+                    if (replace.empty() && !remove) { ++it; continue; }
+
+                    BE::MInstruction::delInst(*it);
+                    it = block->insts.erase(it);
+                    for (auto* inst : replace)
+                    {
+                        it = block->insts.insert(it, inst);
+                        ++it;
                     }
                 }
             }
         }
 
-        static void runPreRAPasses(BE::Module& m, const BE::Targeting::TargetInstrAdapter* adapter)
+        // 对 0..n-1 执行 fn；有线程池时在工作线程上并行执行
+        template <typename Fn>
+        static void forEachIndex(size_t n, ThreadPool* pool, Fn&& fn)
         {
-            BE::RV64::Passes::Lowering::FrameLoweringPass frameLowering;
-            frameLowering.runOnModule(m);
-
-            // 对实现了 mem2reg 优化的同学，还需完成 Phi Elimination
-            BE::RV64::Passes::Lowering::PhiEliminationPass phiElim;
-            phiElim.runOnModule(m, adapter);
-
-            lowerPseudoMoves(m);
-        }
-        static void runRAPipeline(BE::Module& m, const BE::Targeting::RV64::RegInfo& regInfo)
-        {
-            // TODO("使用你实现的寄存器分配器进行寄存器分配");
-            BE::RA::LinearScanRA ls;
-            ls.allocate(m, regInfo);
+            if (!pool)
+            {
+                for (size_t i = 0; i < n; ++i) fn(i);
+                return;
+            }
+            pool->parallelFor(n, fn);
         }
-        static void runPostRAPasses(BE::Module& m)
+
+        template <typename Fn>
+        static void forEachFunction(BE::Module& m, ThreadPool* pool, Fn&& fn)
         {
-            BE::RV64::Passes::Lowering::StackLoweringPass stackLowering;
-            stackLowering.runOnModule(m);
+            forEachIndex(m.functions.size(), pool, [&](size_t i) { fn(*m.functions[i]); });
         }
     }  // namespace
 
+    void Target::frameLowering(BE::Function& func)
+    {
+        BE::RV64::Passes::Lowering::FrameLoweringPass frameLowering;
+        frameLowering.runOnFunction(&func);
+    }
+
+    void Target::phiElimination(BE::Function& func)
+    {
+        // 对实现了 mem2reg 优化的同学，还需完成 Phi Elimination
+        BE::RV64::Passes::Lowering::PhiEliminationPass phiElim;
+        phiElim.runOnFunction(&func, &adapter);
+    }
+
+    void Target::registerAllocation(BE::Function& func)
+    {
+        // TODO("使用你实现的寄存器分配器进行寄存器分配");
+        BE::RA::LinearScanRA ls(&adapter);
+        ls.allocateFunction(func, regInfo);
+    }
+
+    void Target::stackLowering(BE::Function& func)
+    {
+        BE::RV64::Passes::Lowering::StackLoweringPass stackLowering;
+        stackLowering.lowerFunction(&func);
+    }
+
+    void Target::branchRelaxation(BE::Function& func)
+    {
+        BE::RV64::Passes::Lowering::BranchRelaxationPass branchRelaxation;
+        branchRelaxation.runOnFunction(&func);
+    }
+
+    /*
+     * 后端流程的每个阶段都只读写单个函数（目标描述 adapter / regInfo 只读共享），
+     * 因此逐阶段地按函数并行执行；阶段之间保留屏障，便于 -ftime-report 分阶段计时。
+     * 汇编输出先写入各函数私有的缓冲区，再按原函数顺序拼接，保证输出与串行一致。
+     */
     void Target::runPipeline(ME::Module* ir, BE::Module* backend, std::ostream* out)
     {
-        static BE::Targeting::RV64::InstrAdapter s_adapter;
-        static BE::Targeting::RV64::RegInfo      s_regInfo;
-        BE::Targeting::setTargetInstrAdapter(&s_adapter);
+        auto size = [backend]() { return mirSize(*backend); };
 
         // TODO("选择一种 Instruction Selector 实现，并完成指令选择");
         // BE::RV64::DAGIsel isel(ir, backend, this);
-        BE::RV64::IRIsel isel(ir, backend, this);
-        isel.run();
+        {
+            Stats::Scope     scope("instruction selection", size);
+            BE::RV64::IRIsel isel(ir, backend, this);
+            if (pool)
+                isel.run(*pool);
+            else
+                isel.run();
+        }
+
+        {
+            Stats::Scope scope("frame lowering", size);
+            forEachFunction(*backend, pool, [this](BE::Function& func) { frameLowering(func); });
+        }
+        {
+            Stats::Scope scope("phi elimination", size);
+            forEachFunction(*backend, pool, [this](BE::Function& func) { phiElimination(func); });
+        }
+        {
+            Stats::Scope scope("lower pseudo moves", size);
+            forEachFunction(*backend, pool, [](BE::Function& func) { lowerPseudoMoves(func); });
+        }
+        {
+            Stats::Scope scope("register allocation", size);
+            forEachFunction(*backend, pool, [this](BE::Function& func) { registerAllocation(func); });
+        }
+        {
+            Stats::Scope scope("stack lowering", size);
+            forEachFunction(*backend, pool, [this](BE::Function& func) { stackLowering(func); });
+        }
+        {
+            Stats::Scope scope("branch relaxation", size);
+            forEachFunction(*backend, pool, [this](BE::Function& func) { branchRelaxation(func); });
+        }
+
+        {
+            Stats::Scope                    scope("asm emission");
+            std::vector<std::ostringstream> buffers(backend->functions.size());
+            forEachIndex(buffers.size(), pool, [&](size_t i) {
+                BE::RV64::CodeGen codegen(backend, buffers[i]);
+                codegen.generateFunction(backend->functions[i]);
+            });
+
+            BE::RV64::CodeGen codegen(backend, *out);
+            codegen.generateHeader();
+            for (auto& buf : buffers) *out << buf.str();
+            codegen.generateGlobals();
+        }
+    }
 
-        runPreRAPasses(*backend, &s_adapter);
-        runRAPipeline(*backend, s_regInfo);
-        runPostRAPasses(*backend);
+    /*
+     * 流式编译：汇编依次为文件头、各函数、全局数据，函数可以生成一个输出一个，全局数据留到 endStream。
+     * 各阶段与 runPipeline 相同，只是对单个函数依次执行；阶段计时由调用者合并到同名记录上。
+     */
+    void Target::beginStream(ME::Module* ir, BE::Module* backend, std::ostream* out)
+    {
+        streamIR      = ir;
+        streamBackend = backend;
+        streamOut     = out;
 
         BE::RV64::CodeGen codegen(backend, *out);
-        codegen.generateAssembly();
+        codegen.generateHeader();
+    }
+
+    void Target::runFunction(ME::Function* func)
+    {
+        auto          size  = [this]() { return mirSize(*streamBackend); };
+        BE::Function* mfunc = nullptr;
+        {
+            Stats::Scope     scope("instruction selection", size);
+            BE::RV64::IRIsel isel(streamIR, streamBackend, this);
+            mfunc = isel.runFunction(*func);
+        }
+
+        {
+            Stats::Scope scope("frame lowering", size);
+            frameLowering(*mfunc);
+        }
+        {
+            Stats::Scope scope("phi elimination", size);
+            phiElimination(*mfunc);
+        }
+        {
+            Stats::Scope scope("lower pseudo moves", size);
+            lowerPseudoMoves(*mfunc);
+        }
+        {
+            Stats::Scope scope("register allocation", size);
+            registerAllocation(*mfunc);
+        }
+        {
+            Stats::Scope scope("stack lowering", size);
+            stackLowering(*mfunc);
+        }
+        {
+            Stats::Scope scope("branch relaxation", size);
+            branchRelaxation(*mfunc);
+        }
+
+        {
+            Stats::Scope      scope("asm emission");
+            BE::RV64::CodeGen codegen(streamBackend, *streamOut);
+            codegen.generateFunction(mfunc);
+        }
+
+        // 已经输出，MIR 不再需要
+        streamBackend->functions.pop_back();
+        delete mfunc;
+    }
+
+    void Target::endStream()
+    {
+        // 全局数据的选择不依赖任何函数，放到最后与输出一起完成
+        {
+            Stats::Scope     scope("instruction selection");
+            BE::RV64::IRIsel isel(streamIR, streamBackend, this);
+            isel.runGlobals();
+        }
+        {
+            Stats::Scope      scope("asm emission");
+            BE::RV64::CodeGen codegen(streamBackend, *streamOut);
+            codegen.generateGlobals();
+        }
+
+        streamIR      = nullptr;
+        streamBackend = nullptr;
+        streamOut     = nullptr;
     }
 }  // namespace BE::Targeting::RV64
@@ -2,23 +2,49 @@
 #define __BACKEND_TARGETS_RISCV64_RV64_TARGET_H__
 
 #include <backend/target/target.h>
+#include <backend/targets/riscv64/rv64_instr_adapter.h>
+#include <backend/targets/riscv64/rv64_reg_info.h>
 
 namespace BE
 {
     class Module;
+    class Function;
 }
 namespace ME
 {
     class Module;
+    class Function;
 }
 
 namespace BE::Targeting::RV64
 {
     class Target : public BackendTarget
     {
+      private:
+        // 只读的目标描述，由所有工作线程共享
+        InstrAdapter adapter;
+        RegInfo      regInfo;
+
+        // 流式编译的状态，在 beginStream 与 endStream 之间有效
+        ME::Module*   streamIR      = nullptr;
+        BE::Module*   streamBackend = nullptr;
+        std::ostream* streamOut     = nullptr;
+
+        // 指令选择之后的各阶段，每次只处理一个函数；整模块流程与流式编译共用
+        void frameLowering(BE::Function& func);
+        void phiElimination(BE::Function& func);
+        void registerAllocation(BE::Function& func);
+        void stackLowering(BE::Function& func);
+        void branchRelaxation(BE::Function& func);
+
       public:
         const char* getName() const override { return "riscv64"; }
         void        runPipeline(ME::Module* ir, BE::Module* backend, std::ostream* out) override;
+
+        bool supportsStreaming() const override { return true; }
+        void beginStream(ME::Module* ir, BE::Module* backend, std::ostream* out) override;
+        void runFunction(ME::Function* func) override;
+        void endStream() override;
     };
 }  // namespace BE::Targeting::RV64
 
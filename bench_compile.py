@@ -0,0 +1,463 @@
+"""
+This script benchmarks the compile time of the SysY compiler.
+It times bin/compiler on the functional and optimize test cases and on
+generated programs that grow one axis at a time (function size, nesting
+depth, number of globals, array initializer size, call graph width).
+Per-phase times come from -ftime-report=json. For every axis it fits a
+scaling exponent per phase; any phase growing faster than --max-exponent
+is a problem. These exponents do not depend on the machine, so they are
+checked on every run.
+
+Absolute timings do. They are only compared against a baseline recorded
+on the same host (bench_compile_baseline.<host>.json, not committed):
+a file or phase that got slower by more than --tolerance is a problem.
+A missing baseline is a problem as well, so a fresh checkout or CI runner
+cannot pass the gate without comparing anything: record one first with
+--update-baseline, or pass --no-baseline to check only the parts above
+that do not depend on the host.
+
+Compile failures and inputs that hit the per-run timeout are problems too.
+"""
+import argparse
+import json
+import math
+import os
+import platform
+import subprocess
+import sys
+import tempfile
+import time
+from typing import Callable, Dict, List, Optional, Tuple
+
+
+SYSY = "bin/compiler"
+CORPUS_DIRS = ["testcase/functional", "testcase/optimize"]
+# timings only compare within one machine, so every host keeps its own baseline
+BASELINE_FILE = f"bench_compile_baseline.{platform.node() or 'local'}.json"
+
+# main.cpp: most inputs must compile within 5s, large ones within 30s
+SOFT_LIMIT_MS = 5000.0
+HARD_LIMIT_MS = 30000.0
+TIMEOUT_S = 60.0
+
+
+class CompileTimeout(Exception):
+    """Raised when a single compilation runs past TIMEOUT_S."""
+
+
+def gen_func_size(n: int) -> str:
+    """One function with n statements mixing arithmetic, branches and loops."""
+    stmts = []
+    for i in range(n):
+        kind = i % 4
+        if kind == 0:
+            stmts.append(f"  a = a * 3 + b % {i % 7 + 2};")
+        elif kind == 1:
+            stmts.append(f"  b = (b + a) / 2 - c + {i % 11};")
+        elif kind == 2:
+            stmts.append("  if (a > b) c = c + a; else c = c - b;")
+        else:
+            stmts.append("  while (c > 1000) c = c / 2;")
+    body = "\n".join(stmts)
+    return (f"int f(int a, int b) {{\n  int c = 0;\n{body}\n  return a + b + c;\n}}\n"
+            "int main() {\n  return f(1, 3) % 256;\n}\n")
+
+
+def gen_nesting(n: int) -> str:
+    """n nested blocks alternating if and while, each declaring a local."""
+    lines = ["int main() {", "  int s = 0;"]
+    for k in range(n):
+        indent = "  " * (k + 1)
+        if k % 2 == 0:
+            lines.append(f"{indent}if (s < {k + 100}) {{")
+        else:
+            lines.append(f"{indent}while (s < {k + 3}) {{")
+            lines.append(f"{indent}  s = s + 1;")
+        lines.append(f"{indent}  int x{k} = s + {k};")
+        lines.append(f"{indent}  s = s + x{k} % 3;")
+    lines.append("  " * (n + 1) + "s = s + 7;")
+    for k in reversed(range(n)):
+        lines.append("  " * (k + 1) + "}")
+    lines.append("  return s % 256;")
+    lines.append("}")
+    return "\n".join(lines) + "\n"
+
+
+def gen_globals(n: int) -> str:
+    """n global scalars and small arrays; main reads a fixed number of them."""
+    decls = []
+    for i in range(n):
+        if i % 4 == 3:
+            decls.append(f"int g{i}[4] = {{{i}, {i + 1}}};")
+        elif i % 4 == 2:
+            decls.append(f"float g{i} = {i}.5;")
+        else:
+            decls.append(f"int g{i} = {i};")
+    uses = []
+    for i in range(0, n, max(1, n // 64)):
+        uses.append(f"  s = s + g{i}[1];" if i % 4 == 3 else f"  s = s + g{i};")
+    return ("\n".join(decls) + "\nint main() {\n  int s = 0;\n" + "\n".join(uses) +
+            "\n  return s % 256;\n}\n")
+
+
+def gen_array_init(n: int) -> str:
+    """A global and a local array, each with an n-element initializer."""
+    values = ", ".join(str(i % 97) for i in range(n))
+    return (f"int ga[{n}] = {{{values}}};\n"
+            f"int main() {{\n  int la[{n}] = {{{values}}};\n"
+            f"  return (ga[{n - 1}] + la[{n // 2}]) % 256;\n}}\n")
+
+
+def gen_call_width(n: int) -> str:
+    """main calls n distinct small functions."""
+    funcs = [f"int f{i}(int x) {{\n  return x * {i % 13 + 1} + {i};\n}}" for i in range(n)]
+    calls = [f"  s = (s + f{i}(s)) % 65536;" for i in range(n)]
+    return ("\n".join(funcs) + "\nint main() {\n  int s = 0;\n" + "\n".join(calls) +
+            "\n  return s % 256;\n}\n")
+
+
+# axis name -> (generator, default sizes, what n means)
+AXES: Dict[str, Tuple[Callable[[int], str], List[int], str]] = {
+    "func_size": (gen_func_size, [250, 500, 1000, 2000], "statements in one function"),
+    "nesting": (gen_nesting, [50, 100, 200, 400], "nesting depth of blocks"),
+    "globals": (gen_globals, [1000, 2000, 4000, 8000], "global declarations"),
+    "array_init": (gen_array_init, [2500, 5000, 10000, 20000], "array initializer elements"),
+    "call_width": (gen_call_width, [250, 500, 1000, 2000], "functions called from main"),
+}
+
+
+def compile_once(src_file: str, stage: str, opt_level: int) -> Optional[Dict[str, float]]:
+    """
+    Compiles src_file once and returns per-phase wall times in milliseconds.
+
+    Top-level stages are keyed by name, their direct children by
+    "parent/child"; "total" is the wall time of the whole process.
+    Returns None if the compiler fails and raises CompileTimeout if it
+    runs past TIMEOUT_S.
+    """
+    start = time.perf_counter()
+    try:
+        res = subprocess.run([
+            SYSY, src_file, stage, "-o", "/dev/null", f"-O{opt_level}", "-ftime-report=json"
+        ], stdout=subprocess.DEVNULL, stderr=subprocess.PIPE, text=True, check=False, timeout=TIMEOUT_S)
+    except subprocess.TimeoutExpired as exc:
+        raise CompileTimeout(src_file) from exc
+    total = (time.perf_counter() - start) * 1000.0
+    if res.returncode != 0:
+        return None
+
+    report = None
+    for line in reversed(res.stderr.splitlines()):
+        if line.startswith("{"):
+            report = json.loads(line)
+            break
+    if report is None:
+        return None
+
+    phases = {"total": total}
+    parent = ""
+    for stage_rec in report["stages"]:
+        if stage_rec["depth"] == 0:
+            parent = stage_rec["name"]
+            key = parent
+        elif stage_rec["depth"] == 1:
+            key = parent + "/" + stage_rec["name"]
+        else:
+            continue
+        phases[key] = phases.get(key, 0.0) + stage_rec["wall_ms"]
+    return phases
+
+
+def compile_best(src_file: str, stage: str, opt_level: int, repeat: int) -> Optional[Dict[str, float]]:
+    """Compiles src_file repeat times and keeps the fastest run of each phase."""
+    best = None
+    for _ in range(repeat):
+        phases = compile_once(src_file, stage, opt_level)
+        if phases is None:
+            return None
+        if best is None:
+            best = phases
+        else:
+            for key, ms in phases.items():
+                best[key] = min(best.get(key, ms), ms)
+    return best
+
+
+def fit_exponent(sizes: List[int], times: List[float], min_ms: float) -> Optional[float]:
+    """
+    Least-squares slope of log(time) over log(n), i.e. k in time ~ n^k.
+    Points faster than min_ms are dominated by noise and skipped.
+    """
+    points = [(math.log(n), math.log(t)) for n, t in zip(sizes, times) if t >= min_ms]
+    if len(points) < 2:
+        return None
+    mean_x = sum(x for x, _ in points) / len(points)
+    mean_y = sum(y for _, y in points) / len(points)
+    var = sum((x - mean_x) ** 2 for x, _ in points)
+    if var == 0:
+        return None
+    return sum((x - mean_x) * (y - mean_y) for x, y in points) / var
+
+
+def check_limit(name: str, ms: float, problems: List[str]):
+    """Reports compile times over the course limits."""
+    if ms > HARD_LIMIT_MS:
+        problems.append(f"{name}: {ms:.0f} ms exceeds the {HARD_LIMIT_MS / 1000:.0f}s limit")
+    elif ms > SOFT_LIMIT_MS:
+        print(f"\033[93mWarning:\033[0m {name} takes {ms:.0f} ms (over {SOFT_LIMIT_MS / 1000:.0f}s)")
+
+
+def run_corpus(args, problems: List[str]) -> Dict[str, Dict[str, float]]:
+    """Times every .sy file under CORPUS_DIRS."""
+    files = []
+    for corpus_dir in CORPUS_DIRS:
+        for root, _, names in os.walk(corpus_dir):
+            files.extend(os.path.join(root, f) for f in names if f.endswith(".sy"))
+    files.sort()
+
+    results = {}
+    for i, src_file in enumerate(files):
+        print(f"\r\033[K[{i + 1}/{len(files)}] {src_file}", end="", flush=True)
+        try:
+            phases = compile_best(src_file, args.stage, args.opt, args.repeat)
+        except CompileTimeout:
+            problems.append(f"{src_file}: timed out after {TIMEOUT_S:.0f}s")
+            continue
+        if phases is None:
+            problems.append(f"{src_file}: compilation failed")
+            continue
+        results[src_file] = phases
+        check_limit(src_file, phases["total"], problems)
+    print("\r\033[K", end="")
+
+    if results:
+        totals = sorted(((p["total"], f) for f, p in results.items()), reverse=True)
+        print(f"Corpus: {len(results)} files, {sum(t for t, _ in totals):.0f} ms in total")
+        print("Slowest:")
+        for ms, src_file in totals[:args.top]:
+            print(f"  {ms:10.1f} ms  {src_file}")
+    return results
+
+
+def time_axis(axis: str, sizes: List[int], repeat: int, tmp_dir: str, args,
+              problems: List[str]) -> List[Dict[str, float]]:
+    """
+    Times the generator of axis at every size, smallest first. A size that
+    fails or times out is a problem and ends the axis, since larger sizes
+    would only fail the same way; the returned runs cover the sizes before it.
+    """
+    generator = AXES[axis][0]
+    runs = []
+    for n in sizes:
+        print(f"\r\033[K{axis} n={n}", end="", flush=True)
+        src_file = os.path.join(tmp_dir, f"{axis}_{n}.sy")
+        with open(src_file, "w", encoding="utf-8") as f:
+            f.write(generator(n))
+        try:
+            phases = compile_best(src_file, args.stage, args.opt, repeat)
+        except CompileTimeout:
+            problems.append(f"{axis} n={n}: timed out after {TIMEOUT_S:.0f}s")
+            break
+        if phases is None:
+            problems.append(f"{axis} n={n}: compilation failed")
+            break
+        runs.append(phases)
+    print("\r\033[K", end="")
+    return runs
+
+
+def fit_curves(sizes: List[int], runs: List[Dict[str, float]],
+               args) -> Tuple[Dict[str, List[float]], Dict[str, Optional[float]]]:
+    """Per-phase timing curves over sizes and their fitted exponents."""
+    # every phase that shows up in any run; a phase missing from a run took no time there
+    keys = []
+    for phases in runs:
+        keys.extend(k for k in phases if k not in keys)
+    curves = {k: [phases.get(k, 0.0) for phases in runs] for k in keys}
+    exponents = {k: fit_exponent(sizes[:len(runs)], ts, args.min_ms) for k, ts in curves.items()}
+    return curves, exponents
+
+
+def superlinear(exponents: Dict[str, Optional[float]], args) -> List[str]:
+    """Phases whose fitted exponent exceeds --max-exponent."""
+    return [k for k, e in exponents.items() if e is not None and e > args.max_exponent]
+
+
+def run_scaling(args, problems: List[str]) -> Dict[str, dict]:
+    """
+    Times each generator at growing sizes and fits per-phase scaling
+    exponents. An axis that looks superlinear is timed again with twice the
+    runs and each point keeps its faster measurement, so one noisy point
+    does not decide the fit; check_exponents then judges the refit.
+    """
+    results = {}
+    axes = args.axes.split(",") if args.axes else list(AXES)
+    with tempfile.TemporaryDirectory() as tmp_dir:
+        for axis in axes:
+            if axis not in AXES:
+                problems.append(f"unknown axis {axis}")
+                continue
+            _, sizes, meaning = AXES[axis]
+            sizes = [max(1, int(n * args.scale)) for n in sizes]
+
+            runs = time_axis(axis, sizes, args.repeat, tmp_dir, args, problems)
+            if not runs:
+                continue
+            sizes = sizes[:len(runs)]
+            curves, exponents = fit_curves(sizes, runs, args)
+            if superlinear(exponents, args):
+                again = time_axis(axis, sizes, args.repeat * 2, tmp_dir, args, [])
+                if len(again) == len(runs):
+                    runs = [{k: min(ms, b.get(k, ms)) for k, ms in a.items()} for a, b in zip(runs, again)]
+                    curves, exponents = fit_curves(sizes, runs, args)
+            for n, phases in zip(sizes, runs):
+                check_limit(f"{axis} n={n}", phases["total"], problems)
+            results[axis] = {"sizes": sizes, "phases": curves, "exponents": exponents}
+
+            keys = list(curves)
+            print(f"Axis {axis} (n = {meaning})")
+            shown = [k for k in keys if "/" not in k]
+            print("  " + "n".rjust(8) + "".join(k[:14].rjust(16) for k in shown))
+            for j, n in enumerate(sizes):
+                print("  " + str(n).rjust(8) + "".join(f"{curves[k][j]:16.1f}" for k in shown))
+            print("  " + "exponent".rjust(8) +
+                  "".join((f"{exponents[k]:16.2f}" if exponents[k] is not None else "-".rjust(16)) for k in shown))
+    return results
+
+
+def check_exponents(scaling: Dict[str, dict], args, problems: List[str]):
+    """Every phase growing faster than n^--max-exponent is a problem, with or without a baseline."""
+    for axis, result in scaling.items():
+        for k in superlinear(result["exponents"], args):
+            problems.append(f"{axis}: {k} grows superlinearly (time ~ n^{result['exponents'][k]:.2f}, "
+                            f"limit n^{args.max_exponent:.2f})")
+
+
+def slower(cur: float, base: float, args) -> bool:
+    """A timing regresses if it is both relatively and absolutely slower than the baseline."""
+    return cur > base * (1.0 + args.tolerance) and cur - base > args.min_ms
+
+
+def recheck(src_file: str, phases: Dict[str, float], args) -> Dict[str, float]:
+    """
+    Times src_file again with twice the runs and keeps the faster of the two
+    measurements per phase, so a single noisy pass is not reported as a
+    regression.
+    """
+    try:
+        again = compile_best(src_file, args.stage, args.opt, args.repeat * 2)
+    except CompileTimeout:
+        again = None
+    if again is None:
+        return phases
+    return {k: min(ms, again.get(k, ms)) for k, ms in phases.items()}
+
+
+def compare_baseline(baseline: dict, corpus: Dict[str, Dict[str, float]], scaling: Dict[str, dict],
+                     args, problems: List[str]):
+    """
+    Compares per-file totals and every scaling axis against the baseline.
+    An axis is compared at the largest size both runs reached; a run that
+    stopped early has already reported the failing size as a problem.
+    """
+    for src_file, phases in corpus.items():
+        base = baseline.get("corpus", {}).get(src_file)
+        if base and slower(phases["total"], base["total"], args):
+            phases = recheck(src_file, phases, args)
+            if slower(phases["total"], base["total"], args):
+                problems.append(f"{src_file}: {base['total']:.1f} ms -> {phases['total']:.1f} ms")
+
+    with tempfile.TemporaryDirectory() as tmp_dir:
+        for axis, result in scaling.items():
+            base = baseline.get("scaling", {}).get(axis)
+            if not base:
+                print(f"\033[93mWarning:\033[0m baseline has no {axis} axis; record one with --update-baseline")
+                continue
+            common = [n for n in result["sizes"] if n in base["sizes"]]
+            if not common:
+                problems.append(f"{axis}: sizes {result['sizes']} share none with the baseline's {base['sizes']}")
+                continue
+            n = common[-1]
+            j = result["sizes"].index(n)
+            bj = base["sizes"].index(n)
+            last = {k: times[j] for k, times in result["phases"].items()}
+            suspects = [k for k, ms in last.items() if k in base["phases"] and slower(ms, base["phases"][k][bj], args)]
+            if not suspects:
+                continue
+            src_file = os.path.join(tmp_dir, f"{axis}_{n}.sy")
+            with open(src_file, "w", encoding="utf-8") as f:
+                f.write(AXES[axis][0](n))
+            last = recheck(src_file, last, args)
+            for k in suspects:
+                base_ms = base["phases"][k][bj]
+                if slower(last[k], base_ms, args):
+                    problems.append(f"{axis} n={n}: {k} {base_ms:.1f} ms -> {last[k]:.1f} ms")
+
+
+def main():
+    """Main function to parse arguments and run the benchmarks."""
+    parser = argparse.ArgumentParser(description="SysY Compiler Compile-Time Benchmark")
+    parser.add_argument("--stage", default="-S", choices=["-llvm", "-S"], help="Compiler output stage.")
+    parser.add_argument("--opt", default=1, type=int, choices=[0, 1, 2, 3], help="Optimization level.")
+    parser.add_argument("--repeat", default=3, type=int, help="Runs per input; the fastest one is kept.")
+    parser.add_argument("--axes", default="", help="Comma separated scaling axes (default: all).")
+    parser.add_argument("--scale", default=1.0, type=float, help="Multiplier applied to every generated size.")
+    parser.add_argument("--no-corpus", action="store_true", help="Skip the test case corpus.")
+    parser.add_argument("--no-scaling", action="store_true", help="Skip the generated programs.")
+    parser.add_argument("--top", default=10, type=int, help="Number of slowest corpus files to list.")
+    parser.add_argument("--max-exponent", default=1.3, type=float,
+                        help="Scaling exponents above this are reported as superlinear.")
+    parser.add_argument("--min-ms", default=20.0, type=float,
+                        help="Timings below this are ignored by the scaling fit and the regression check.")
+    parser.add_argument("--tolerance", default=0.25, type=float, help="Allowed relative slowdown over the baseline.")
+    parser.add_argument("--baseline", default=BASELINE_FILE, help="Baseline file of this host to compare against.")
+    parser.add_argument("--update-baseline", action="store_true", help="Store this run as the new baseline.")
+    parser.add_argument("--no-baseline", action="store_true",
+                        help="Skip the timing comparison; a missing baseline is then not a problem.")
+    args = parser.parse_args()
+
+    if not os.path.exists(SYSY):
+        print(f"{SYSY} not found, run make first")
+        sys.exit(1)
+
+    problems: List[str] = []
+    corpus = {} if args.no_corpus else run_corpus(args, problems)
+    scaling = {} if args.no_scaling else run_scaling(args, problems)
+    check_exponents(scaling, args, problems)
+
+    config = {"host": platform.node(), "stage": args.stage, "opt": args.opt, "scale": args.scale}
+    if args.update_baseline:
+        if problems:
+            print("Not recording a baseline from a run with problems")
+        else:
+            with open(args.baseline, "w", encoding="utf-8") as f:
+                json.dump(dict(config, corpus=corpus, scaling=scaling), f, indent=1)
+            print(f"Baseline written to {args.baseline}")
+    elif args.no_baseline:
+        print("--no-baseline: only scaling exponents, limits and failures are checked")
+    elif os.path.exists(args.baseline):
+        with open(args.baseline, "r", encoding="utf-8") as f:
+            baseline = json.load(f)
+        recorded = {k: baseline.get(k) for k in config}
+        if recorded != config:
+            problems.append(f"{args.baseline} was recorded with {recorded}, this run uses {config}; "
+                            "pass a matching --baseline or record one with --update-baseline")
+        else:
+            compare_baseline(baseline, corpus, scaling, args, problems)
+    else:
+        problems.append(f"no baseline at {args.baseline}; record one for this host with --update-baseline, "
+                        "or pass --no-baseline to skip the timing comparison")
+
+    print("\n" + "=" * 30)
+    if problems:
+        print(f"\t\033[91m{len(problems)} problem(s)\033[0m")
+        for problem in problems:
+            print(f"\t{problem}")
+    else:
+        print("\t\033[92mNo regressions\033[0m")
+    print("=" * 30)
+    sys.exit(1 if problems else 0)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,371 @@
+"""
+This script benchmarks the speed of the RV64 code the SysY compiler generates.
+It compiles every test case under testcase/optimize and the performance-style
+functional cases (those that call starttime()/stoptime()) at each requested
+-O level, links them like rv2bin.sh, runs them under qemu-riscv64 and checks
+their output against the standard answers.
+
+Each run is measured in one of two ways:
+- icount: the number of guest instructions, counted by the qemu insn plugin
+  (--qemu-plugin). Deterministic, so one run is enough.
+- timer: the TOTAL that sylib's after_main() prints for the starttime()/
+  stoptime() sections, or the wall time of the whole run for programs that
+  do not time themselves. Noisy, so every run is repeated and the fastest
+  one is kept.
+
+For every test it prints the cost at each level and the speedup over the
+first level. With --update-baseline the run is stored as a baseline; later
+runs report every test and level that got slower than the baseline by more
+than --tolerance. Baselines are kept per setup:
+- icount: the counts only depend on the compiler, qemu and the RISC-V
+  toolchain (which brings libc). They are stored in
+  bench_run_icount_baseline.json, which is committed, with one entry per
+  qemu and toolchain version.
+- timer: the times depend on the machine. They are stored in
+  bench_run_baseline.<host>.json, which is not committed.
+A missing baseline for the current setup is a problem; --no-baseline only
+checks outputs and failures.
+
+Wrong answers, compile, link and run failures are problems too.
+"""
+import argparse
+import json
+import os
+import platform
+import re
+import subprocess
+import sys
+import tempfile
+import time
+from typing import Dict, List, Optional, Tuple
+
+
+SYSY = "bin/compiler"
+TOOLCHAINS_CONF = "toolchains.conf"
+OPTIMIZE_DIR = "testcase/optimize"
+FUNCTIONAL_DIR = "testcase/functional"
+# icount results hold on any machine with the same qemu and toolchain, so they are committed;
+# timer results only compare within one machine, so every host keeps its own baseline
+ICOUNT_BASELINE_FILE = "bench_run_icount_baseline.json"
+TIMER_BASELINE_FILE = f"bench_run_baseline.{platform.node() or 'local'}.json"
+
+COMPILE_TIMEOUT_S = 60.0
+RUN_TIMEOUT_S = 120.0
+
+RISCV_GCC = "riscv64-unknown-elf-gcc"
+TEXT_ADDR = "0x90000000"
+
+# sylib.c after_main(): "TOTAL: %dH-%dM-%dS-%dus"
+TOTAL_RE = re.compile(r"^TOTAL: (\d+)H-(\d+)M-(\d+)S-(\d+)us$", re.MULTILINE)
+# qemu contrib/plugins/insn.c prints "insns: N" ("total insns: N" in older releases)
+INSNS_RE = re.compile(r"insns: (\d+)")
+
+UNITS = {"icount": "insns", "timer": "us"}
+
+
+class BenchError(Exception):
+    """A test that could not be measured; the message says at which step."""
+
+
+def load_toolchains_config():
+    """Load RISCV_GCC and TEXT_ADDR from toolchains.conf, like rv2bin.sh."""
+    global RISCV_GCC, TEXT_ADDR
+
+    if not os.path.exists(TOOLCHAINS_CONF):
+        return
+    with open(TOOLCHAINS_CONF, "r", encoding="utf-8") as f:
+        for line in f:
+            line = line.strip()
+            if not line or line.startswith("#") or "=" not in line:
+                continue
+            key, value = (s.strip() for s in line.split("=", 1))
+            if key == "RISCV_GCC":
+                RISCV_GCC = value
+            elif key == "TEXT_ADDR":
+                TEXT_ADDR = value
+
+
+def tool_version(command: str) -> str:
+    """First line of `command --version`, or "unknown" if it cannot be run."""
+    try:
+        res = subprocess.run([command, "--version"], capture_output=True, text=True, check=False, timeout=10)
+    except (OSError, subprocess.TimeoutExpired):
+        return "unknown"
+    lines = res.stdout.strip().splitlines()
+    return lines[0].strip() if res.returncode == 0 and lines else "unknown"
+
+
+def baseline_key(args) -> str:
+    """The setup a baseline is valid for: qemu and toolchain versions for icount, the host for timer."""
+    if args.measure == "icount":
+        return f"qemu: {tool_version('qemu-riscv64')}; toolchain: {tool_version(RISCV_GCC)}"
+    return f"host: {platform.node()}; toolchain: {RISCV_GCC}"
+
+
+def load_baselines(path: str) -> Dict[str, dict]:
+    """Every entry recorded in the baseline file, keyed by baseline_key(); empty if there is no file."""
+    if not os.path.exists(path):
+        return {}
+    with open(path, "r", encoding="utf-8") as f:
+        return json.load(f).get("baselines", {})
+
+
+def uses_timer(src_file: str) -> bool:
+    """Whether the program times itself with starttime()/stoptime()."""
+    with open(src_file, "r", encoding="utf-8", errors="replace") as f:
+        return "starttime" in f.read()
+
+
+def collect_tests(args) -> List[str]:
+    """Every .sy under testcase/optimize plus the functional cases that call starttime()."""
+    files = []
+    for root, _, names in os.walk(OPTIMIZE_DIR):
+        files.extend(os.path.join(root, f) for f in names if f.endswith(".sy"))
+    for root, _, names in os.walk(FUNCTIONAL_DIR):
+        for f in names:
+            src_file = os.path.join(root, f)
+            if f.endswith(".sy") and (args.all_functional or uses_timer(src_file)):
+                files.append(src_file)
+    if args.filter:
+        files = [f for f in files if args.filter in f]
+    return sorted(files)
+
+
+def build(src_file: str, opt_level: int, tmp_dir: str) -> str:
+    """Compiles src_file to RV64 assembly and links it against libsysy_riscv; returns the binary."""
+    asm_file = os.path.join(tmp_dir, "bench.s")
+    obj_file = os.path.join(tmp_dir, "bench.o")
+    bin_file = os.path.join(tmp_dir, "bench.bin")
+    steps = [
+        ("compile", [SYSY, src_file, "-S", "-o", asm_file, f"-O{opt_level}"]),
+        ("assemble", [RISCV_GCC, asm_file, "-c", "-o", obj_file, "-w"]),
+        ("link", [RISCV_GCC, obj_file, "-o", bin_file, "-L./lib", "-lsysy_riscv",
+                  "-static", "-mcmodel=medany", f"-Wl,--no-relax,-Ttext={TEXT_ADDR}"]),
+    ]
+    for step, command in steps:
+        try:
+            res = subprocess.run(command, stdout=subprocess.DEVNULL, stderr=subprocess.DEVNULL,
+                                 check=False, timeout=COMPILE_TIMEOUT_S)
+        except subprocess.TimeoutExpired as exc:
+            raise BenchError(f"{step} timed out") from exc
+        except FileNotFoundError as exc:
+            raise BenchError(f"{command[0]} not found") from exc
+        if res.returncode != 0:
+            raise BenchError(f"{step} failed")
+    return bin_file
+
+
+def expected_output(src_file: str) -> Optional[str]:
+    """The .out next to src_file, or None if the test has no standard answer."""
+    out_file = os.path.splitext(src_file)[0] + ".out"
+    if not os.path.exists(out_file):
+        return None
+    with open(out_file, "r", encoding="utf-8", errors="replace") as f:
+        return f.read()
+
+
+def same_output(actual: str, expected: str) -> bool:
+    """Compares like test.py's diff -b --strip-trailing-cr: whitespace runs and line ends do not matter."""
+    def norm(text: str) -> List[str]:
+        return [" ".join(line.split()) for line in text.replace("\r", "").rstrip("\n").split("\n")]
+    return norm(actual) == norm(expected)
+
+
+def run_once(bin_file: str, src_file: str, args, tmp_dir: str) -> Tuple[str, float]:
+    """
+    Runs bin_file under qemu-riscv64 and returns its output in the .out format
+    (stdout, then the exit code on its own line) and its cost.
+    """
+    in_file = os.path.splitext(src_file)[0] + ".in"
+    command = ["qemu-riscv64"]
+    log_file = os.path.join(tmp_dir, "insn.log")
+    if args.measure == "icount":
+        command += ["-plugin", args.qemu_plugin, "-d", "plugin", "-D", log_file]
+        if os.path.exists(log_file):
+            os.remove(log_file)
+    command.append(bin_file)
+
+    start = time.perf_counter()
+    try:
+        with open(in_file, "rb") if os.path.exists(in_file) else open(os.devnull, "rb") as stdin_file:
+            res = subprocess.run(command, stdin=stdin_file, capture_output=True, check=False,
+                                 timeout=RUN_TIMEOUT_S)
+    except subprocess.TimeoutExpired as exc:
+        raise BenchError(f"run timed out after {RUN_TIMEOUT_S:.0f}s") from exc
+    except FileNotFoundError as exc:
+        raise BenchError("qemu-riscv64 not found") from exc
+    wall_us = (time.perf_counter() - start) * 1e6
+    if res.returncode < 0 or res.returncode == 139:
+        raise BenchError("runtime error")
+
+    stdout = res.stdout.decode("utf-8", errors="replace")
+    if stdout and not stdout.endswith("\n"):
+        stdout += "\n"
+    output = stdout + f"{res.returncode}\n"
+
+    if args.measure == "icount":
+        try:
+            with open(log_file, "r", encoding="utf-8", errors="replace") as f:
+                counts = INSNS_RE.findall(f.read())
+        except IOError:
+            counts = []
+        if not counts:
+            raise BenchError(f"no instruction count in the log of {args.qemu_plugin}")
+        return output, float(counts[-1])
+
+    stderr = res.stderr.decode("utf-8", errors="replace")
+    total = TOTAL_RE.search(stderr)
+    if total and "Timer@" in stderr:
+        h, m, s, us = (int(g) for g in total.groups())
+        return output, float(((h * 60 + m) * 60 + s) * 1000000 + us)
+    return output, wall_us
+
+
+def measure(src_file: str, opt_level: int, args, tmp_dir: str) -> float:
+    """Builds and runs src_file at opt_level, checks the output and returns its cheapest run."""
+    bin_file = build(src_file, opt_level, tmp_dir)
+    expected = expected_output(src_file)
+    best = None
+    for _ in range(1 if args.measure == "icount" else args.repeat):
+        output, cost = run_once(bin_file, src_file, args, tmp_dir)
+        if expected is not None and not same_output(output, expected):
+            raise BenchError("wrong answer")
+        best = cost if best is None else min(best, cost)
+    return best
+
+
+def run_tests(tests: List[str], levels: List[int], args,
+              problems: List[str]) -> Dict[str, Dict[str, float]]:
+    """Measures every test at every level; a failure at one level does not stop the others."""
+    results: Dict[str, Dict[str, float]] = {}
+    with tempfile.TemporaryDirectory() as tmp_dir:
+        for i, src_file in enumerate(tests):
+            results[src_file] = {}
+            for opt_level in levels:
+                print(f"\r\033[K[{i + 1}/{len(tests)}] {src_file} -O{opt_level}", end="", flush=True)
+                try:
+                    results[src_file][f"O{opt_level}"] = measure(src_file, opt_level, args, tmp_dir)
+                except BenchError as exc:
+                    problems.append(f"{src_file} -O{opt_level}: {exc}")
+    print("\r\033[K", end="")
+    return results
+
+
+def print_report(results: Dict[str, Dict[str, float]], levels: List[int], args):
+    """Prints the cost at every level and the speedup of each level over the first one."""
+    keys = [f"O{l}" for l in levels]
+    width = max([len(f) for f in results] + [4])
+    print(f"Cost in {UNITS[args.measure]}, speedup over -{keys[0]} in parentheses")
+    print("test".ljust(width) + "".join(k.rjust(24) for k in keys))
+    speedups: Dict[str, List[float]] = {k: [] for k in keys[1:]}
+    for src_file, costs in results.items():
+        row = src_file.ljust(width)
+        base = costs.get(keys[0])
+        for k in keys:
+            if k not in costs:
+                row += "-".rjust(24)
+                continue
+            cell = f"{costs[k]:.0f}"
+            if k != keys[0] and base and costs[k] > 0:
+                speedups[k].append(base / costs[k])
+                cell += f" ({base / costs[k]:.2f}x)"
+            row += cell.rjust(24)
+        print(row)
+    for k, ratios in speedups.items():
+        if ratios:
+            geomean = 1.0
+            for r in ratios:
+                geomean *= r ** (1.0 / len(ratios))
+            print(f"-{k} over -{keys[0]}: geomean {geomean:.2f}x, min {min(ratios):.2f}x, "
+                  f"max {max(ratios):.2f}x over {len(ratios)} tests")
+
+
+def compare_baseline(baseline: dict, results: Dict[str, Dict[str, float]], args, problems: List[str]):
+    """Every test and level slower than the baseline by more than --tolerance is a regression."""
+    for src_file, costs in results.items():
+        base_costs = baseline.get("results", {}).get(src_file, {})
+        for k, cost in costs.items():
+            base = base_costs.get(k)
+            if base and cost > base * (1.0 + args.tolerance):
+                problems.append(f"{src_file} -{k}: {base:.0f} -> {cost:.0f} {UNITS[args.measure]} "
+                                f"({cost / base:.2f}x slower)")
+
+
+def main():
+    """Main function to parse arguments and run the benchmarks."""
+    load_toolchains_config()
+
+    parser = argparse.ArgumentParser(description="SysY Compiler Generated Code Benchmark (RV64)")
+    parser.add_argument("--levels", default="0,1,2", help="Comma separated -O levels; speedups are over the first.")
+    parser.add_argument("--measure", default="", choices=["", "icount", "timer"],
+                        help="icount needs --qemu-plugin; default: icount if a plugin is given, else timer.")
+    parser.add_argument("--qemu-plugin", default=os.environ.get("QEMU_INSN_PLUGIN", ""),
+                        help="Path to qemu's libinsn.so (default: $QEMU_INSN_PLUGIN).")
+    parser.add_argument("--repeat", default=3, type=int, help="Runs per test in timer mode; the fastest is kept.")
+    parser.add_argument("--all-functional", action="store_true",
+                        help="Include every functional case, not only those calling starttime().")
+    parser.add_argument("--filter", default="", help="Only run tests whose path contains this string.")
+    parser.add_argument("--tolerance", default=None, type=float,
+                        help="Allowed relative slowdown over the baseline (default: 0.02 for icount, 0.25 for timer).")
+    parser.add_argument("--baseline", default="",
+                        help=f"Baseline file (default: {ICOUNT_BASELINE_FILE} for icount, "
+                             f"{TIMER_BASELINE_FILE} for timer).")
+    parser.add_argument("--update-baseline", action="store_true",
+                        help="Store this run as the baseline of the current qemu/toolchain (icount) or host (timer).")
+    parser.add_argument("--no-baseline", action="store_true",
+                        help="Skip the baseline comparison; a missing baseline is then not a problem.")
+    args = parser.parse_args()
+
+    if not args.measure:
+        args.measure = "icount" if args.qemu_plugin else "timer"
+    if args.tolerance is None:
+        args.tolerance = 0.02 if args.measure == "icount" else 0.25
+    if not args.baseline:
+        args.baseline = ICOUNT_BASELINE_FILE if args.measure == "icount" else TIMER_BASELINE_FILE
+    if args.measure == "icount" and not os.path.exists(args.qemu_plugin):
+        print(f"icount needs qemu's insn plugin, {args.qemu_plugin or 'none'} given")
+        sys.exit(1)
+    if not os.path.exists(SYSY):
+        print(f"{SYSY} not found, run make first")
+        sys.exit(1)
+    levels = [int(l) for l in args.levels.split(",")]
+
+    problems: List[str] = []
+    tests = collect_tests(args)
+    results = run_tests(tests, levels, args, problems)
+    print_report(results, levels, args)
+
+    key = baseline_key(args)
+    baselines = load_baselines(args.baseline)
+    if args.update_baseline:
+        if problems:
+            print("Not recording a baseline from a run with problems")
+        else:
+            baselines[key] = {"measure": args.measure, "levels": levels, "results": results}
+            with open(args.baseline, "w", encoding="utf-8") as f:
+                json.dump({"baselines": baselines}, f, indent=1, sort_keys=True)
+            print(f"Baseline for {key} written to {args.baseline}")
+            if args.measure == "icount":
+                print(f"Commit {args.baseline} so other machines with this qemu and toolchain compare against it")
+    elif args.no_baseline:
+        print("--no-baseline: only outputs and failures are checked")
+    elif key in baselines and baselines[key].get("measure") == args.measure:
+        compare_baseline(baselines[key], results, args, problems)
+    else:
+        recorded = [k for k, b in baselines.items() if b.get("measure") == args.measure]
+        problems.append(f"no {args.measure} baseline for {key} in {args.baseline} (recorded: {recorded or 'none'}); "
+                        "record one with --update-baseline, or pass --no-baseline to skip the comparison")
+
+    print("\n" + "=" * 30)
+    if problems:
+        print(f"\t\033[91m{len(problems)} problem(s)\033[0m")
+        for problem in problems:
+            print(f"\t{problem}")
+    else:
+        print("\t\033[92mNo regressions\033[0m")
+    print("=" * 30)
+    sys.exit(1 if problems else 0)
+
+
+if __name__ == "__main__":
+    main()
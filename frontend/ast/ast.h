@@ -4,7 +4,10 @@
 #include <frontend/ast/ast_defs.h>
 #include <frontend/ast/ast_visitor.h>
 #include <frontend/symbol/symbol_entry.h>
-#include <vector>
+#include <arena.h>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
 
 /*
 如果需要，你可以在类中添加成员变量和成员函数，辅助你完成实验
@@ -19,7 +22,58 @@ namespace FE::AST
 
   using Entry = FE::Sym::Entry;
 
+  // 子节点列表：元素连续存放在 arena 上，只读接口与 std::vector 相同
+  // 追加时容量不足则在同一 arena 上另开两倍空间并整体搬移，旧空间随 arena 一起回收
+  template <typename T>
+  class Span
+  {
+    static_assert(std::is_trivially_copyable_v<T>, "Span 按字节搬移元素");
+
+  private:
+    T *ptr = nullptr;
+    uint32_t len = 0;
+    uint32_t cap = 0;
+
+    void grow(Arena &arena)
+    {
+      uint32_t newCap = cap ? cap * 2 : 4;
+      T *newPtr = static_cast<T *>(arena.allocate(newCap * sizeof(T), alignof(T)));
+      if (len) std::memcpy(newPtr, ptr, len * sizeof(T));
+      ptr = newPtr;
+      cap = newCap;
+    }
+
+  public:
+    size_t size() const { return len; }
+    bool empty() const { return len == 0; }
+
+    T &operator[](size_t i) { return ptr[i]; }
+    const T &operator[](size_t i) const { return ptr[i]; }
+    T &front() { return ptr[0]; }
+    T &back() { return ptr[len - 1]; }
+
+    T *begin() { return ptr; }
+    T *end() { return ptr + len; }
+    const T *begin() const { return ptr; }
+    const T *end() const { return ptr + len; }
+
+    void push_back(Arena &arena, T v)
+    {
+      if (len == cap) grow(arena);
+      ptr[len++] = v;
+    }
+    void push_front(Arena &arena, T v)
+    {
+      if (len == cap) grow(arena);
+      std::memmove(ptr + 1, ptr, len * sizeof(T));
+      ptr[0] = v;
+      ++len;
+    }
+  };
+
   // AST的节点类
+  // 节点均从 arena 分配（见 FE::Parser::make），整棵树随 arena 一次释放而不逐个析构，
+  // 因此节点不得持有需要析构的成员，析构函数也不是虚函数
   class Node
   {
   public:
@@ -28,7 +82,6 @@ namespace FE::AST
     NodeAttr attr; // 携带节点属性，是语法树标记的重点对象
 
     Node(int line_num = -1, int col_num = -1) : line_num(line_num), col_num(col_num), attr() {}
-    virtual ~Node() = default;
 
     virtual void accept(Visitor &visitor) = 0;
   };
@@ -37,15 +90,14 @@ namespace FE::AST
   class Root : public Node
   {
   private:
-    std::vector<StmtNode *> *stmts;
+    Span<StmtNode *> *stmts;
 
   public:
-    Root(std::vector<StmtNode *> *stmts) : Node(-1, -1), stmts(stmts) {}
-    virtual ~Root() override;
+    Root(Span<StmtNode *> *stmts) : Node(-1, -1), stmts(stmts) {}
 
     virtual void accept(Visitor &visitor) override { visitor.visit(*this); }
 
-    std::vector<StmtNode *> *getStmts() const { return stmts; }
+    Span<StmtNode *> *getStmts() const { return stmts; }
   };
 } // namespace FE::AST
 
@@ -13,7 +13,6 @@ namespace FE::AST
     {
       public:
         DeclNode(int line_num = -1, int col_num = -1) : Node(line_num, col_num) {}
-        virtual ~DeclNode() override = default;
 
         virtual void accept(Visitor& visitor) override = 0;
     };
@@ -27,7 +26,6 @@ namespace FE::AST
         InitDecl(bool singleInit = false, int line_num = -1, int col_num = -1)
             : DeclNode(line_num, col_num), singleInit(singleInit)
         {}
-        virtual ~InitDecl() override = default;
 
         virtual void accept(Visitor& visitor) override = 0;
     };
@@ -42,7 +40,6 @@ namespace FE::AST
         Initializer(ExprNode* expr, int line_num = -1, int col_num = -1)
             : InitDecl(true, line_num, col_num), init_val(expr)
         {}
-        virtual ~Initializer() override;
 
         virtual void accept(Visitor& visitor) override { visitor.visit(*this); }
     };
@@ -52,13 +49,12 @@ namespace FE::AST
     class InitializerList : public InitDecl
     {
       public:
-        std::vector<InitDecl*>* init_list;
+        Span<InitDecl*>* init_list;
 
       public:
-        InitializerList(std::vector<InitDecl*>* init_list, int line_num = -1, int col_num = -1)
+        InitializerList(Span<InitDecl*>* init_list, int line_num = -1, int col_num = -1)
             : InitDecl(false, line_num, col_num), init_list(init_list)
         {}
-        virtual ~InitializerList() override;
 
         virtual void accept(Visitor& visitor) override { visitor.visit(*this); }
 
@@ -76,7 +72,6 @@ namespace FE::AST
         VarDeclarator(ExprNode* lval, InitDecl* init = nullptr, int line_num = -1, int col_num = -1)
             : DeclNode(line_num, col_num), lval(lval), init(init)
         {}
-        virtual ~VarDeclarator() override;
 
         virtual void accept(Visitor& visitor) override { visitor.visit(*this); }
     };
@@ -85,16 +80,14 @@ namespace FE::AST
     class ParamDeclarator : public DeclNode
     {
       public:
-        Type*                   type;
-        Entry*                  entry;
-        std::vector<ExprNode*>* dims;
+        Type*            type;
+        Entry*           entry;
+        Span<ExprNode*>* dims;
 
       public:
-        ParamDeclarator(
-            Type* type, Entry* entry, std::vector<ExprNode*>* dims = nullptr, int line_num = -1, int col_num = -1)
+        ParamDeclarator(Type* type, Entry* entry, Span<ExprNode*>* dims = nullptr, int line_num = -1, int col_num = -1)
             : DeclNode(line_num, col_num), type(type), entry(entry), dims(dims)
         {}
-        virtual ~ParamDeclarator() override;
 
         virtual void accept(Visitor& visitor) override { visitor.visit(*this); }
     };
@@ -105,16 +98,15 @@ namespace FE::AST
     class VarDeclaration : public DeclNode
     {
       public:
-        Type*                        type;
-        std::vector<VarDeclarator*>* decls;
-        bool                         isConstDecl;
+        Type*                 type;
+        Span<VarDeclarator*>* decls;
+        bool                  isConstDecl;
 
       public:
-        VarDeclaration(Type* type, std::vector<VarDeclarator*>* decls, bool isConstDecl = false, int line_num = -1,
+        VarDeclaration(Type* type, Span<VarDeclarator*>* decls, bool isConstDecl = false, int line_num = -1,
             int col_num = -1)
             : DeclNode(line_num, col_num), type(type), decls(decls), isConstDecl(isConstDecl)
         {}
-        virtual ~VarDeclaration() override;
 
         virtual void accept(Visitor& visitor) override { visitor.visit(*this); }
     };
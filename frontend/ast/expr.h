@@ -18,7 +18,6 @@ namespace FE::AST
         ExprNode(int line_num = -1, int col_num = -1)
             : Node(line_num, col_num), trueTar(static_cast<size_t>(-1)), falseTar(static_cast<size_t>(-1))
         {}
-        virtual ~ExprNode() override = default;
 
         virtual void accept(Visitor& visitor) override = 0;
 
@@ -31,15 +30,14 @@ namespace FE::AST
     class LeftValExpr : public ExprNode
     {
       public:
-        bool                    isLval;
-        Entry*                  entry;
-        std::vector<ExprNode*>* indices;
+        bool             isLval;
+        Entry*           entry;
+        Span<ExprNode*>* indices;
 
       public:
-        LeftValExpr(Entry* entry, std::vector<ExprNode*>* indices = nullptr, int line_num = -1, int col_num = -1)
+        LeftValExpr(Entry* entry, Span<ExprNode*>* indices = nullptr, int line_num = -1, int col_num = -1)
             : ExprNode(line_num, col_num), entry(entry), indices(indices)
         {}
-        virtual ~LeftValExpr() override;
 
         virtual void accept(Visitor& visitor) override { visitor.visit(*this); }
     };
@@ -54,7 +52,6 @@ namespace FE::AST
         LiteralExpr(int v, int line_num = -1, int col_num = -1) : ExprNode(line_num, col_num), literal(v) {}
         LiteralExpr(long long v, int line_num = -1, int col_num = -1) : ExprNode(line_num, col_num), literal(v) {}
         LiteralExpr(float v, int line_num = -1, int col_num = -1) : ExprNode(line_num, col_num), literal(v) {}
-        virtual ~LiteralExpr() override = default;
 
         virtual void accept(Visitor& visitor) override { visitor.visit(*this); }
 
@@ -72,7 +69,6 @@ namespace FE::AST
         UnaryExpr(Operator op, ExprNode* expr, int line_num = -1, int col_num = -1)
             : ExprNode(line_num, col_num), op(op), expr(expr)
         {}
-        virtual ~UnaryExpr() override;
 
         virtual void accept(Visitor& visitor) override { visitor.visit(*this); }
     };
@@ -89,7 +85,6 @@ namespace FE::AST
         BinaryExpr(Operator op, ExprNode* lhs, ExprNode* rhs, int line_num = -1, int col_num = -1)
             : ExprNode(line_num, col_num), op(op), lhs(lhs), rhs(rhs)
         {}
-        virtual ~BinaryExpr() override;
 
         virtual void accept(Visitor& visitor) override { visitor.visit(*this); }
     };
@@ -98,14 +93,13 @@ namespace FE::AST
     class CallExpr : public ExprNode
     {
       public:
-        Entry*                  func;
-        std::vector<ExprNode*>* args;
+        Entry*           func;
+        Span<ExprNode*>* args;
 
       public:
-        CallExpr(Entry* func, std::vector<ExprNode*>* args = nullptr, int line_num = -1, int col_num = -1)
+        CallExpr(Entry* func, Span<ExprNode*>* args = nullptr, int line_num = -1, int col_num = -1)
             : ExprNode(line_num, col_num), func(func), args(args)
         {}
-        virtual ~CallExpr() override;
 
         virtual void accept(Visitor& visitor) override { visitor.visit(*this); }
     };
@@ -115,13 +109,12 @@ namespace FE::AST
     class CommaExpr : public ExprNode
     {
       public:
-        std::vector<ExprNode*>* exprs;
+        Span<ExprNode*>* exprs;
 
       public:
-        CommaExpr(std::vector<ExprNode*>* exprs, int line_num = -1, int col_num = -1)
+        CommaExpr(Span<ExprNode*>* exprs, int line_num = -1, int col_num = -1)
             : ExprNode(line_num, col_num), exprs(exprs)
         {}
-        virtual ~CommaExpr() override;
 
         virtual void accept(Visitor& visitor) override { visitor.visit(*this); }
 
@@ -13,7 +13,6 @@ namespace FE::AST
     {
       public:
         StmtNode(int line_num = -1, int col_num = -1) : Node(line_num, col_num) {}
-        virtual ~StmtNode() override = default;
 
         virtual void accept(Visitor& visitor) override = 0;
         virtual bool isVarDeclStmt()                   = 0;
@@ -27,7 +26,6 @@ namespace FE::AST
 
       public:
         ExprStmt(ExprNode* expr, int line_num = -1, int col_num = -1) : StmtNode(line_num, col_num), expr(expr) {}
-        virtual ~ExprStmt() override;
 
         virtual void accept(Visitor& visitor) override { visitor.visit(*this); }
         virtual bool isVarDeclStmt() override { return false; }
@@ -38,17 +36,16 @@ namespace FE::AST
     class FuncDeclStmt : public StmtNode
     {
       public:
-        Type*                          retType;
-        Entry*                         entry;
-        std::vector<ParamDeclarator*>* params;
-        StmtNode*                      body;
+        Type*                   retType;
+        Entry*                  entry;
+        Span<ParamDeclarator*>* params;
+        StmtNode*               body;
 
       public:
-        FuncDeclStmt(Type* retType, Entry* entry, std::vector<ParamDeclarator*>* params, StmtNode* body = nullptr,
+        FuncDeclStmt(Type* retType, Entry* entry, Span<ParamDeclarator*>* params, StmtNode* body = nullptr,
             int line_num = -1, int col_num = -1)
             : StmtNode(line_num, col_num), retType(retType), entry(entry), params(params), body(body)
         {}
-        virtual ~FuncDeclStmt() override;
 
         virtual void accept(Visitor& visitor) override { visitor.visit(*this); }
         virtual bool isVarDeclStmt() override { return false; }
@@ -64,7 +61,6 @@ namespace FE::AST
       public:
         VarDeclStmt(VarDeclaration* decl, int line_num = -1, int col_num = -1) : StmtNode(line_num, col_num), decl(decl)
         {}
-        virtual ~VarDeclStmt() override;
 
         virtual void accept(Visitor& visitor) override { visitor.visit(*this); }
         virtual bool isVarDeclStmt() override { return true; }
@@ -74,13 +70,12 @@ namespace FE::AST
     class BlockStmt : public StmtNode
     {
       public:
-        std::vector<StmtNode*>* stmts;
+        Span<StmtNode*>* stmts;
 
       public:
-        BlockStmt(std::vector<StmtNode*>* stmts, int line_num = -1, int col_num = -1)
+        BlockStmt(Span<StmtNode*>* stmts, int line_num = -1, int col_num = -1)
             : StmtNode(line_num, col_num), stmts(stmts)
         {}
-        virtual ~BlockStmt() override;
 
         virtual void accept(Visitor& visitor) override { visitor.visit(*this); }
         virtual bool isVarDeclStmt() override { return false; }
@@ -96,7 +91,6 @@ namespace FE::AST
         ReturnStmt(ExprNode* retExpr = nullptr, int line_num = -1, int col_num = -1)
             : StmtNode(line_num, col_num), retExpr(retExpr)
         {}
-        virtual ~ReturnStmt() override;
 
         virtual void accept(Visitor& visitor) override { visitor.visit(*this); }
         virtual bool isVarDeclStmt() override { return false; }
@@ -114,7 +108,6 @@ namespace FE::AST
         WhileStmt(ExprNode* cond = nullptr, StmtNode* body = nullptr, int line_num = -1, int col_num = -1)
             : StmtNode(line_num, col_num), cond(cond), body(body)
         {}
-        virtual ~WhileStmt() override;
 
         virtual void accept(Visitor& visitor) override { visitor.visit(*this); }
         virtual bool isVarDeclStmt() override { return false; }
@@ -134,7 +127,6 @@ namespace FE::AST
             int col_num = -1)
             : StmtNode(line_num, col_num), cond(cond), thenStmt(thenStmt), elseStmt(elseStmt)
         {}
-        virtual ~IfStmt() override;
 
         virtual void accept(Visitor& visitor) override { visitor.visit(*this); }
         virtual bool isVarDeclStmt() override { return false; }
@@ -144,7 +136,6 @@ namespace FE::AST
     {
       public:
         BreakStmt(int line_num = -1, int col_num = -1) : StmtNode(line_num, col_num) {}
-        virtual ~BreakStmt() override = default;
 
         virtual void accept(Visitor& visitor) override { visitor.visit(*this); }
         virtual bool isVarDeclStmt() override { return false; }
@@ -154,7 +145,6 @@ namespace FE::AST
     {
       public:
         ContinueStmt(int line_num = -1, int col_num = -1) : StmtNode(line_num, col_num) {}
-        virtual ~ContinueStmt() override = default;
 
         virtual void accept(Visitor& visitor) override { visitor.visit(*this); }
         virtual bool isVarDeclStmt() override { return false; }
@@ -176,7 +166,6 @@ namespace FE::AST
             int line_num = -1, int col_num = -1)
             : StmtNode(line_num, col_num), init(init), cond(cond), step(step), body(body)
         {}
-        virtual ~ForStmt() override;
 
         virtual void accept(Visitor& visitor) override { visitor.visit(*this); }
         virtual bool isVarDeclStmt() override { return false; }
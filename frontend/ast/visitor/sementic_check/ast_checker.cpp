@@ -10,6 +10,25 @@ namespace FE::AST
         //(void)node;
         //TODO("Lab3-1: Implement Root node semantic checking");
 
+        beginCheck();
+
+        auto stmts_ptr = node.getStmts();
+        if (!stmts_ptr) return true;
+
+        bool ok = true;
+
+        // 遍历所有顶层语句
+        for (auto stmt : *stmts_ptr)
+        {
+            if (!checkTopLevel(stmt)) ok = false;
+        }
+
+        if (!finishCheck()) ok = false;
+        return ok;
+    }
+
+    void ASTChecker::beginCheck()
+    {
         // 恢复初始状态
         errors.clear();
         glbSymbols.clear();
@@ -18,79 +37,81 @@ namespace FE::AST
 
         // funcDecls.clear(); 
         // libFuncRegister();
+    }
 
-        auto stmts_ptr = node.getStmts();
-        if (!stmts_ptr) return true;
+    bool ASTChecker::checkTopLevel(StmtNode* stmt)
+    {
+        if (!stmt) return true;
 
         bool ok = true;
 
-        // 遍历所有顶层语句
-        for (auto stmt : *stmts_ptr)
+        // 是否是全局变量声明语句
+        if (stmt->isVarDeclStmt())
         {
-            if (!stmt) continue;
-
-            // 是否是全局变量声明语句
-            if (stmt->isVarDeclStmt())
+            auto *vdeclStmt = static_cast<VarDeclStmt*>(stmt);
+            auto *vdecl = vdeclStmt->decl; // VarDeclaration*
+            for (auto *decltor : *vdecl->decls)
             {
-                auto *vdeclStmt = static_cast<VarDeclStmt*>(stmt);
-                auto *vdecl = vdeclStmt->decl; // VarDeclaration*
-                for (auto *decltor : *vdecl->decls)
+                // decltor->lval应该是LeftValExpr类型
+                auto *lval = dynamic_cast<LeftValExpr*>(decltor->lval);
+                if (!lval || !lval->entry)
                 {
-                    // decltor->lval应该是LeftValExpr类型
-                    auto *lval = dynamic_cast<LeftValExpr*>(decltor->lval);
-                    if (!lval || !lval->entry)
-                    {
-                        errors.push_back("Invalid global variable declarator at line " + std::to_string(decltor->line_num));
-                        ok = false;
-                        continue;
-                    }
+                    errors.push_back("Invalid global variable declarator at line " + std::to_string(decltor->line_num));
+                    ok = false;
+                    continue;
                 }
             }
-            else if (auto *fdeclStmt = dynamic_cast<FuncDeclStmt*>(stmt)) // 函数声明语句
+        }
+        else if (auto *fdeclStmt = dynamic_cast<FuncDeclStmt*>(stmt)) // 函数声明语句
+        {
+            auto *entry = fdeclStmt->entry;
+            if (!entry)
+            {
+                errors.push_back("Anonymous function declaration at line " + std::to_string(fdeclStmt->line_num));
+                ok = false;
+            }
+            else
             {
-                auto *entry = fdeclStmt->entry;
-                if (!entry)
+                if (funcDecls.find(entry) != funcDecls.end())
                 {
-                    errors.push_back("Anonymous function declaration at line " + std::to_string(fdeclStmt->line_num));
+                    errors.push_back("redefinition of function '" + entry->getName() +
+                                    "' at line " + std::to_string(fdeclStmt->line_num));
                     ok = false;
                 }
                 else
                 {
-                    if (funcDecls.find(entry) != funcDecls.end())
+                    funcDecls[entry] = fdeclStmt; // 记录函数声明
+                }
+
+                // 根据文档，在SysY语言中main函数必须：
+                // 1. 无参数；
+                // 2. 返回类型为int。
+                // 和C语言有一点区别！
+                if (entry->getName() == "main")
+                {
+                    if (fdeclStmt->retType != intType)
                     {
-                        errors.push_back("redefinition of function '" + entry->getName() +
-                                        "' at line " + std::to_string(fdeclStmt->line_num));
+                        errors.push_back("main function must return int at line " + std::to_string(fdeclStmt->line_num));
                         ok = false;
                     }
-                    else
-                    {
-                        funcDecls[entry] = fdeclStmt; // 记录函数声明
-                    }
-
-                    // 根据文档，在SysY语言中main函数必须：
-                    // 1. 无参数；
-                    // 2. 返回类型为int。
-                    // 和C语言有一点区别！
-                    if (entry->getName() == "main")
+                    if (fdeclStmt->params && !fdeclStmt->params->empty())
                     {
-                        if (fdeclStmt->retType != intType)
-                        {
-                            errors.push_back("main function must return int at line " + std::to_string(fdeclStmt->line_num));
-                            ok = false;
-                        }
-                        if (fdeclStmt->params && !fdeclStmt->params->empty())
-                        {
-                            errors.push_back("main must have no parameters at line " + std::to_string(fdeclStmt->line_num));
-                            ok = false;
-                        }
+                        errors.push_back("main must have no parameters at line " + std::to_string(fdeclStmt->line_num));
+                        ok = false;
                     }
                 }
             }
-
-            // 继续访问顶层语句进行语义检查
-            if (!apply(*this, *stmt)) ok = false;
         }
 
+        // 继续访问顶层语句进行语义检查
+        if (!apply(*this, *stmt)) ok = false;
+        return ok;
+    }
+
+    bool ASTChecker::finishCheck()
+    {
+        bool ok = true;
+
         // 检查main函数是否存在
         FE::Sym::Entry* mainEntry = FE::Sym::Entry::getEntry("main");
         if (funcDecls.find(mainEntry) == funcDecls.end())
@@ -105,6 +126,37 @@ namespace FE::AST
         return ok;
     }
 
+    void ASTChecker::detachFuncBody(FuncDeclStmt* node)
+    {
+        auto it = node && node->entry ? funcDecls.find(node->entry) : funcDecls.end();
+        if (it == funcDecls.end() || it->second != node) return;
+
+        // 调用处的检查与 IR 生成只用到返回类型、各形参的类型及其是否为数组，数组各维的表达式不再保留
+        Span<ParamDeclarator*>* params = nullptr;
+        if (node->params)
+        {
+            params = libArena.create<Span<ParamDeclarator*>>();
+            for (auto* p : *node->params)
+            {
+                ParamDeclarator* copy = nullptr;
+                if (p)
+                {
+                    Span<ExprNode*>* dims = nullptr;
+                    if (p->dims)
+                    {
+                        dims = libArena.create<Span<ExprNode*>>();
+                        for (size_t i = 0; i < p->dims->size(); ++i) dims->push_back(libArena, nullptr);
+                    }
+                    copy       = libArena.create<ParamDeclarator>(p->type, p->entry, dims, p->line_num, p->col_num);
+                    copy->attr = p->attr;
+                }
+                params->push_back(libArena, copy);
+            }
+        }
+        it->second = libArena.create<FuncDeclStmt>(node->retType, node->entry, params, nullptr, node->line_num,
+            node->col_num);
+    }
+
     void ASTChecker::libFuncRegister()
     {
         // 示例实现：注册 SysY 标准库函数到 funcDecls 中
@@ -141,81 +193,81 @@ namespace FE::AST
         static SymEnt* _sysy_stoptime  = SymEnt::getEntry("_sysy_stoptime");
 
         // int getint()
-        funcDecls[getint] = new FuncDeclStmt(intType, getint, nullptr);
+        funcDecls[getint] = libArena.create<FuncDeclStmt>(intType, getint, nullptr);
 
         // int getch()
-        funcDecls[getch] = new FuncDeclStmt(intType, getch, nullptr);
+        funcDecls[getch] = libArena.create<FuncDeclStmt>(intType, getch, nullptr);
 
         // int getarray(int a[])
-        auto getarray_params = new std::vector<ParamDeclarator*>();
-        auto getarray_param  = new ParamDeclarator(TypeFactory::getPtrType(intType), SymEnt::getEntry("a"));
+        auto getarray_params = libArena.create<Span<ParamDeclarator*>>();
+        auto getarray_param  = libArena.create<ParamDeclarator>(TypeFactory::getPtrType(intType), SymEnt::getEntry("a"));
         getarray_param->attr.val.value.type = TypeFactory::getPtrType(intType);
-        getarray_params->push_back(getarray_param);
-        funcDecls[getarray] = new FuncDeclStmt(intType, getarray, getarray_params);
+        getarray_params->push_back(libArena, getarray_param);
+        funcDecls[getarray] = libArena.create<FuncDeclStmt>(intType, getarray, getarray_params);
 
         // float getfloat()
-        funcDecls[getfloat] = new FuncDeclStmt(floatType, getfloat, nullptr);
+        funcDecls[getfloat] = libArena.create<FuncDeclStmt>(floatType, getfloat, nullptr);
 
         // int getfarray(float a[])
-        auto getfarray_params = new std::vector<ParamDeclarator*>();
-        auto getfarray_param  = new ParamDeclarator(TypeFactory::getPtrType(floatType), SymEnt::getEntry("a"));
+        auto getfarray_params = libArena.create<Span<ParamDeclarator*>>();
+        auto getfarray_param  = libArena.create<ParamDeclarator>(TypeFactory::getPtrType(floatType), SymEnt::getEntry("a"));
         getfarray_param->attr.val.value.type = TypeFactory::getPtrType(floatType);
-        getfarray_params->push_back(getfarray_param);
-        funcDecls[getfarray] = new FuncDeclStmt(intType, getfarray, getfarray_params);
+        getfarray_params->push_back(libArena, getfarray_param);
+        funcDecls[getfarray] = libArena.create<FuncDeclStmt>(intType, getfarray, getfarray_params);
 
         // void putint(int a)
-        auto putint_params                = new std::vector<ParamDeclarator*>();
-        auto putint_param                 = new ParamDeclarator(intType, SymEnt::getEntry("a"));
+        auto putint_params                = libArena.create<Span<ParamDeclarator*>>();
+        auto putint_param                 = libArena.create<ParamDeclarator>(intType, SymEnt::getEntry("a"));
         putint_param->attr.val.value.type = intType;
-        putint_params->push_back(putint_param);
-        funcDecls[putint] = new FuncDeclStmt(voidType, putint, putint_params);
+        putint_params->push_back(libArena, putint_param);
+        funcDecls[putint] = libArena.create<FuncDeclStmt>(voidType, putint, putint_params);
 
         // void putch(int a)
-        auto putch_params                = new std::vector<ParamDeclarator*>();
-        auto putch_param                 = new ParamDeclarator(intType, SymEnt::getEntry("a"));
+        auto putch_params                = libArena.create<Span<ParamDeclarator*>>();
+        auto putch_param                 = libArena.create<ParamDeclarator>(intType, SymEnt::getEntry("a"));
         putch_param->attr.val.value.type = intType;
-        putch_params->push_back(putch_param);
-        funcDecls[putch] = new FuncDeclStmt(voidType, putch, putch_params);
+        putch_params->push_back(libArena, putch_param);
+        funcDecls[putch] = libArena.create<FuncDeclStmt>(voidType, putch, putch_params);
 
         // void putarray(int n, int a[])
-        auto putarray_params                 = new std::vector<ParamDeclarator*>();
-        auto putarray_param1                 = new ParamDeclarator(intType, SymEnt::getEntry("n"));
+        auto putarray_params                 = libArena.create<Span<ParamDeclarator*>>();
+        auto putarray_param1                 = libArena.create<ParamDeclarator>(intType, SymEnt::getEntry("n"));
         putarray_param1->attr.val.value.type = intType;
-        auto putarray_param2 = new ParamDeclarator(TypeFactory::getPtrType(intType), SymEnt::getEntry("a"));
+        auto putarray_param2 = libArena.create<ParamDeclarator>(TypeFactory::getPtrType(intType), SymEnt::getEntry("a"));
         putarray_param2->attr.val.value.type = TypeFactory::getPtrType(intType);
-        putarray_params->push_back(putarray_param1);
-        putarray_params->push_back(putarray_param2);
-        funcDecls[putarray] = new FuncDeclStmt(voidType, putarray, putarray_params);
+        putarray_params->push_back(libArena, putarray_param1);
+        putarray_params->push_back(libArena, putarray_param2);
+        funcDecls[putarray] = libArena.create<FuncDeclStmt>(voidType, putarray, putarray_params);
 
         // void putfloat(float a)
-        auto putfloat_params                = new std::vector<ParamDeclarator*>();
-        auto putfloat_param                 = new ParamDeclarator(floatType, SymEnt::getEntry("a"));
+        auto putfloat_params                = libArena.create<Span<ParamDeclarator*>>();
+        auto putfloat_param                 = libArena.create<ParamDeclarator>(floatType, SymEnt::getEntry("a"));
         putfloat_param->attr.val.value.type = floatType;
-        putfloat_params->push_back(putfloat_param);
-        funcDecls[putfloat] = new FuncDeclStmt(voidType, putfloat, putfloat_params);
+        putfloat_params->push_back(libArena, putfloat_param);
+        funcDecls[putfloat] = libArena.create<FuncDeclStmt>(voidType, putfloat, putfloat_params);
 
         // void putfarray(int n, float a[])
-        auto putfarray_params                 = new std::vector<ParamDeclarator*>();
-        auto putfarray_param1                 = new ParamDeclarator(intType, SymEnt::getEntry("n"));
+        auto putfarray_params                 = libArena.create<Span<ParamDeclarator*>>();
+        auto putfarray_param1                 = libArena.create<ParamDeclarator>(intType, SymEnt::getEntry("n"));
         putfarray_param1->attr.val.value.type = intType;
-        auto putfarray_param2 = new ParamDeclarator(TypeFactory::getPtrType(floatType), SymEnt::getEntry("a"));
+        auto putfarray_param2 = libArena.create<ParamDeclarator>(TypeFactory::getPtrType(floatType), SymEnt::getEntry("a"));
         putfarray_param2->attr.val.value.type = TypeFactory::getPtrType(floatType);
-        putfarray_params->push_back(putfarray_param1);
-        putfarray_params->push_back(putfarray_param2);
-        funcDecls[putfarray] = new FuncDeclStmt(voidType, putfarray, putfarray_params);
+        putfarray_params->push_back(libArena, putfarray_param1);
+        putfarray_params->push_back(libArena, putfarray_param2);
+        funcDecls[putfarray] = libArena.create<FuncDeclStmt>(voidType, putfarray, putfarray_params);
 
         // void _sysy_starttime(int lineno)
-        auto starttime_params                = new std::vector<ParamDeclarator*>();
-        auto starttime_param                 = new ParamDeclarator(intType, SymEnt::getEntry("lineno"));
+        auto starttime_params                = libArena.create<Span<ParamDeclarator*>>();
+        auto starttime_param                 = libArena.create<ParamDeclarator>(intType, SymEnt::getEntry("lineno"));
         starttime_param->attr.val.value.type = intType;
-        starttime_params->push_back(starttime_param);
-        funcDecls[_sysy_starttime] = new FuncDeclStmt(voidType, _sysy_starttime, starttime_params);
+        starttime_params->push_back(libArena, starttime_param);
+        funcDecls[_sysy_starttime] = libArena.create<FuncDeclStmt>(voidType, _sysy_starttime, starttime_params);
 
         // void _sysy_stoptime(int lineno)
-        auto stoptime_params                = new std::vector<ParamDeclarator*>();
-        auto stoptime_param                 = new ParamDeclarator(intType, SymEnt::getEntry("lineno"));
+        auto stoptime_params                = libArena.create<Span<ParamDeclarator*>>();
+        auto stoptime_param                 = libArena.create<ParamDeclarator>(intType, SymEnt::getEntry("lineno"));
         stoptime_param->attr.val.value.type = intType;
-        stoptime_params->push_back(stoptime_param);
-        funcDecls[_sysy_stoptime] = new FuncDeclStmt(voidType, _sysy_stoptime, stoptime_params);
+        stoptime_params->push_back(libArena, stoptime_param);
+        funcDecls[_sysy_stoptime] = libArena.create<FuncDeclStmt>(voidType, _sysy_stoptime, stoptime_params);
     }
 }  // namespace FE::AST
@@ -42,6 +42,7 @@ namespace FE::AST
         FE::Sym::SymTable                        symTable; // 符号表
         std::map<FE::Sym::Entry*, VarAttr>       glbSymbols; // 全局变量符号表
         std::map<FE::Sym::Entry*, FuncDeclStmt*> funcDecls; // 函数声明表
+        Arena                                    libArena; // 库函数声明节点及流式编译中保留的函数签名，随检查器一起释放
 
         bool mainExists;
 
@@ -57,6 +58,7 @@ namespace FE::AST
             : symTable(),
               glbSymbols(),
               funcDecls(),
+              libArena(),
               mainExists(false),
               funcHasReturn(false),
               curFuncRetType(voidType),
@@ -66,33 +68,20 @@ namespace FE::AST
             libFuncRegister();
         }
 
-        ~ASTChecker()
-        {
-            const char* libFuncNames[] = {"getint",
-                "getch",
-                "getarray",
-                "getfloat",
-                "getfarray",
-                "putint",
-                "putch",
-                "putarray",
-                "putfloat",
-                "putfarray",
-                "_sysy_starttime",
-                "_sysy_stoptime"};
-
-            for (const char* name : libFuncNames)
-            {
-                FE::Sym::Entry* entry = FE::Sym::Entry::getEntry(name);
-                auto            it    = funcDecls.find(entry);
-                if (it != funcDecls.end()) delete it->second;
-            }
-        }
-
       public:
         const std::map<FE::Sym::Entry*, VarAttr>&       getGlbSymbols() const { return glbSymbols; }
         const std::map<FE::Sym::Entry*, FuncDeclStmt*>& getFuncDecls() const { return funcDecls; }
 
+        /*
+         * 分步检查，visit(Root) 即依次调用这三步；流式编译时每解析出一条顶层语句就检查一条
+         * - finishCheck 检查 main 是否存在
+         * - detachFuncBody：函数的 AST 即将释放时调用，funcDecls 改为指向只含签名的副本，供之后的调用处检查
+         */
+        void beginCheck();
+        bool checkTopLevel(StmtNode* stmt);
+        bool finishCheck();
+        void detachFuncBody(FuncDeclStmt* node);
+
       private:
         // Basic AST nodes
         bool visit(Root& node) override;
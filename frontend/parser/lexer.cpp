@@ -0,0 +1,446 @@
+// Local stand-in for the flex-generated scanner (flex is unavailable in this sandbox). NOT committed.
+#include <frontend/parser/yacc.h>
+#include <frontend/parser/scanner.h>
+#include <frontend/parser/location.hh>
+#include <frontend/parser/parser.h>
+#include <stdexcept>
+#include <string>
+#include <limits>
+#include <cmath>
+#include <cctype>
+#include <iostream>
+
+using namespace FE;
+
+static location loc;
+#define TAB_WIDTH 4
+int handleTab();
+long long convertToInt(const char* str, const char end, bool& isLongLong);
+float convertToFloatDec(const char* str);
+float convertToFloatHex(const char* str);
+
+Yacc_FlexLexer::Yacc_FlexLexer(std::istream& i, std::ostream& o) : yyin(i.rdbuf()), yyout(o.rdbuf()) { ctor_common(); }
+Yacc_FlexLexer::Yacc_FlexLexer(std::istream* i, std::ostream* o)
+    : yyin(i ? i->rdbuf() : std::cin.rdbuf()), yyout(o ? o->rdbuf() : std::cout.rdbuf()) { ctor_common(); }
+void Yacc_FlexLexer::ctor_common() { yytext = nullptr; yyleng = 0; yylineno = 1; yy_flex_debug = 0; }
+Yacc_FlexLexer::~Yacc_FlexLexer() {}
+void Yacc_FlexLexer::yy_switch_to_buffer(yy_buffer_state*) {}
+yy_buffer_state* Yacc_FlexLexer::yy_create_buffer(std::istream*, int) { return nullptr; }
+yy_buffer_state* Yacc_FlexLexer::yy_create_buffer(std::istream&, int) { return nullptr; }
+void Yacc_FlexLexer::yy_delete_buffer(yy_buffer_state*) {}
+void Yacc_FlexLexer::yyrestart(std::istream*) {}
+void Yacc_FlexLexer::yyrestart(std::istream&) {}
+int Yacc_FlexLexer::yylex() { return 0; }
+void Yacc_FlexLexer::switch_streams(std::istream& i, std::ostream& o) { yyin.rdbuf(i.rdbuf()); yyout.rdbuf(o.rdbuf()); }
+void Yacc_FlexLexer::switch_streams(std::istream* i, std::ostream* o)
+{
+    if (i) yyin.rdbuf(i->rdbuf());
+    if (o) yyout.rdbuf(o->rdbuf());
+}
+int Yacc_FlexLexer::yywrap() { return 1; }
+int Yacc_FlexLexer::LexerInput(char*, int) { return 0; }
+void Yacc_FlexLexer::LexerOutput(const char* b, int n) { yyout.write(b, n); }
+void Yacc_FlexLexer::LexerError(const char* msg) { std::cerr << msg << std::endl; exit(2); }
+
+static bool isIdStart(char c) { return std::isalpha((unsigned char)c) || c == '_'; }
+static bool isIdChar(char c) { return std::isalnum((unsigned char)c) || c == '_'; }
+
+FE::YaccParser::symbol_type FE::Scanner::nextToken()
+{
+    const char* s = source.data();
+    size_t      n = source.size();
+    std::string text;
+    auto        take = [&](size_t len) {
+        text   = std::string(s + offset, len);
+        yyleng = (int)len;
+        yytext = text.data();
+        loc.step();
+        loc.columns(len);
+        tokenStart = offset;
+        offset += len;
+    };
+    readPos = n;
+    while (true)
+    {
+        if (offset >= n) { loc.step(); return YaccParser::make_END(loc); }
+        char c = s[offset];
+        if (c == '\n') { take(1); loc.lines(1); loc.step(); continue; }
+        if (c == ' ' || c == '\f' || c == '\r' || c == '\v')
+        {
+            size_t e = offset;
+            while (e < n && (s[e] == ' ' || s[e] == '\f' || s[e] == '\r' || s[e] == '\v')) ++e;
+            take(e - offset);
+            continue;
+        }
+        if (c == '\t') { take(1); loc.columns(handleTab()); continue; }
+        if (c == '/' && offset + 1 < n && s[offset + 1] == '/')
+        {
+            size_t e = offset;
+            while (e < n && s[e] != '\n') ++e;
+            take(e - offset);
+            loc.columns(yyleng);
+            loc.step();
+            continue;
+        }
+        if (c == '/' && offset + 1 < n && s[offset + 1] == '*')
+        {
+            take(2);
+            bool closed = false;
+            while (offset < n)
+            {
+                if (s[offset] == '*' && offset + 1 < n && s[offset + 1] == '/') { take(2); loc.step(); closed = true; break; }
+                if (s[offset] == '\n') { take(1); loc.lines(1); loc.step(); continue; }
+                take(1);
+            }
+            if (!closed) _parser.reportError(loc, "Unterminated comment");
+            continue;
+        }
+        if (isIdStart(c))
+        {
+            size_t e = offset;
+            while (e < n && isIdChar(s[e])) ++e;
+            take(e - offset);
+            static const std::pair<const char*, int> kws[] = {{"if", 0}, {"else", 1}, {"for", 2}, {"while", 3},
+                {"continue", 4}, {"break", 5}, {"switch", 6}, {"case", 7}, {"goto", 8}, {"do", 9}, {"return", 10},
+                {"const", 11}, {"int", 12}, {"float", 13}, {"void", 14}, {"char", 15}};
+            for (auto& kw : kws)
+                if (text == kw.first) switch (kw.second)
+                    {
+                        case 0: return YaccParser::make_IF(loc);
+                        case 1: return YaccParser::make_ELSE(loc);
+                        case 2: return YaccParser::make_FOR(loc);
+                        case 3: return YaccParser::make_WHILE(loc);
+                        case 4: return YaccParser::make_CONTINUE(loc);
+                        case 5: return YaccParser::make_BREAK(loc);
+                        case 6: return YaccParser::make_SWITCH(loc);
+                        case 7: return YaccParser::make_CASE(loc);
+                        case 8: return YaccParser::make_GOTO(loc);
+                        case 9: return YaccParser::make_DO(loc);
+                        case 10: return YaccParser::make_RETURN(loc);
+                        case 11: return YaccParser::make_CONST(loc);
+                        case 12: return YaccParser::make_INT(loc);
+                        case 13: return YaccParser::make_FLOAT(loc);
+                        case 14: return YaccParser::make_VOID(loc);
+                        case 15: return YaccParser::make_CHAR(loc);
+                    }
+            return YaccParser::make_IDENT(text, loc);
+        }
+        if (c == '"')
+        {
+            size_t e = offset + 1;
+            while (e < n && s[e] != '"') ++e;
+            if (e < n)
+            {
+                take(e + 1 - offset);
+                return YaccParser::make_STR_CONST(text.substr(1, text.size() - 2), loc);
+            }
+        }
+        if (std::isdigit((unsigned char)c) || (c == '.' && offset + 1 < n && std::isdigit((unsigned char)s[offset + 1])))
+        {
+            size_t e = offset;
+            bool   isFloat = false, hex = false;
+            if (c == '0' && offset + 1 < n && (s[offset + 1] == 'x' || s[offset + 1] == 'X'))
+            {
+                hex = true;
+                e += 2;
+                while (e < n && std::isxdigit((unsigned char)s[e])) ++e;
+                if (e < n && s[e] == '.') { isFloat = true; ++e; while (e < n && std::isxdigit((unsigned char)s[e])) ++e; }
+                if (e < n && (s[e] == 'p' || s[e] == 'P'))
+                {
+                    isFloat = true; ++e;
+                    if (e < n && (s[e] == '+' || s[e] == '-')) ++e;
+                    while (e < n && std::isdigit((unsigned char)s[e])) ++e;
+                }
+            }
+            else
+            {
+                while (e < n && std::isdigit((unsigned char)s[e])) ++e;
+                if (e < n && s[e] == '.') { isFloat = true; ++e; while (e < n && std::isdigit((unsigned char)s[e])) ++e; }
+                if (e < n && (s[e] == 'e' || s[e] == 'E'))
+                {
+                    size_t f = e + 1;
+                    if (f < n && (s[f] == '+' || s[f] == '-')) ++f;
+                    if (f < n && std::isdigit((unsigned char)s[f]))
+                    {
+                        isFloat = true;
+                        while (f < n && std::isdigit((unsigned char)s[f])) ++f;
+                        e = f;
+                    }
+                }
+            }
+            take(e - offset);
+            try
+            {
+                if (isFloat)
+                    return YaccParser::make_FLOAT_CONST(hex ? convertToFloatHex(yytext) : convertToFloatDec(yytext), loc);
+                bool      isLL   = false;
+                long long result = convertToInt(yytext, '\0', isLL);
+                if (isLL) return YaccParser::make_LL_CONST(result, loc);
+                return YaccParser::make_INT_CONST(static_cast<int>(result), loc);
+            }
+            catch (const std::exception& ex)
+            {
+                _parser.reportError(loc, std::string("Error parsing number: ") + ex.what());
+                return YaccParser::make_ERR_TOKEN(text, loc);
+            }
+        }
+        auto two = [&](const char* op) { return offset + 1 < n && s[offset] == op[0] && s[offset + 1] == op[1]; };
+        if (two("<=")) { take(2); return YaccParser::make_LE(loc); }
+        if (two(">=")) { take(2); return YaccParser::make_GE(loc); }
+        if (two("==")) { take(2); return YaccParser::make_EQ(loc); }
+        if (two("!=")) { take(2); return YaccParser::make_NEQ(loc); }
+        if (two("&&")) { take(2); return YaccParser::make_AND(loc); }
+        if (two("||")) { take(2); return YaccParser::make_OR(loc); }
+        take(1);
+        switch (c)
+        {
+            case '!': return YaccParser::make_NOT(loc);
+            case '<': return YaccParser::make_LT(loc);
+            case '>': return YaccParser::make_GT(loc);
+            case '+': return YaccParser::make_PLUS(loc);
+            case '-': return YaccParser::make_MINUS(loc);
+            case '*': return YaccParser::make_STAR(loc);
+            case '/': return YaccParser::make_SLASH(loc);
+            case '%': return YaccParser::make_PERCENT(loc);
+            case '=': return YaccParser::make_ASSIGN(loc);
+            case ';': return YaccParser::make_SEMICOLON(loc);
+            case ',': return YaccParser::make_COMMA(loc);
+            case '(': return YaccParser::make_LPAREN(loc);
+            case ')': return YaccParser::make_RPAREN(loc);
+            case '[': return YaccParser::make_LBRACKET(loc);
+            case ']': return YaccParser::make_RBRACKET(loc);
+            case '{': return YaccParser::make_LBRACE(loc);
+            case '}': return YaccParser::make_RBRACE(loc);
+            default: LexerOutput(text.data(), 1); break;
+        }
+    }
+}
+
+int handleTab()
+{
+    // 该函数用于处理制表符，根据当前位置计算制表符应占用的列数
+    // 如，在TAB_WIDTH为4的情况下：
+    // 对于" \t"，则会对 '\t' 返回 3
+    // 对于"   \t"，则会对 '\t' 返回 1
+    // 对于"    \t"，则会对 '\t' 返回 4
+
+    int& c = loc.begin.column;
+    return TAB_WIDTH - ((c - 1) % TAB_WIDTH) - 1;
+}
+
+long long convertToInt(const char* str, const char end, bool& isLongLong)
+{
+    // 该函数用于将字符串转换为整数，能正确处理格式无误的十进制、十六进制和八进制整数
+    // 接受一个 isLongLong 引用参数，用于指示结果是否超出 int 范围
+
+    int         base       = 10;
+    long long   result     = 0;
+    int         isNegative = 0;
+    const char* ptr        = str;
+    static int  zeroOffset = '0';
+    static int  aOffset    = 'a' - 10;
+    static int  AOffset    = 'A' - 10;
+    int*        offset     = NULL;
+    isLongLong             = false;
+
+    if (*ptr == '-')
+    {
+        isNegative = 1;
+        ++ptr;
+    }
+    else if (*ptr == '+') { ++ptr; }
+
+    if (ptr[0] == '0' && (ptr[1] == 'x' || ptr[1] == 'X'))
+    {
+        base = 16;
+        ptr += 2;
+    }
+    else if (ptr[0] == '0')
+    {
+        base = 8;
+        ptr += 1;
+    }
+
+    while (*ptr != end)
+    {
+        int value = 0;
+
+        if (base == 16)
+        {
+            if (*ptr >= '0' && *ptr <= '9')
+                offset = &zeroOffset;
+            else if (*ptr >= 'a' && *ptr <= 'f')
+                offset = &aOffset;
+            else if (*ptr >= 'A' && *ptr <= 'F')
+                offset = &AOffset;
+        }
+        else { offset = &zeroOffset; }
+
+        value  = *ptr - *offset;
+        result = result * base + value;
+        ++ptr;
+    }
+
+    if (isNegative) result = -result;
+
+    if (result > std::numeric_limits<int>::max() || result < std::numeric_limits<int>::min())
+    {
+        isLongLong = true;
+        if (result > std::numeric_limits<long long>::max() || result < std::numeric_limits<long long>::min())
+        {
+            throw std::out_of_range(str + std::string(" overflow or underflow for long long"));
+        }
+    }
+
+    return result;
+}
+
+float convertToFloatDec(const char* str)
+{
+    // 该函数用于将字符串转换为浮点数，能正确处理格式无误的十进制浮点数
+
+    const char* head = str;
+    if (str == NULL) { return 0.0f; }
+
+    int sign = 1;
+    if (*str == '-')
+    {
+        sign = -1;
+        str++;
+    }
+    else if (*str == '+') { str++; }
+
+    double integerPart = 0.0;
+    while (isdigit(*str))
+    {
+        integerPart = integerPart * 10 + (*str - '0');
+        str++;
+    }
+
+    double fractionPart = 0.0;
+    if (*str == '.')
+    {
+        str++;
+        double divisor = 10.0;
+        while (isdigit(*str))
+        {
+            fractionPart += (*str - '0') / divisor;
+            divisor *= 10.0;
+            str++;
+        }
+    }
+
+    double value = integerPart + fractionPart;
+
+    if (*str == 'e' || *str == 'E')
+    {
+        str++;
+        int expSign = 1;
+        if (*str == '-')
+        {
+            expSign = -1;
+            str++;
+        }
+        else if (*str == '+') { str++; }
+
+        int exponent = 0;
+        while (isdigit(*str))
+        {
+            exponent = exponent * 10 + (*str - '0');
+            str++;
+        }
+
+        value *= pow(10, expSign * exponent);
+    }
+
+    value = sign * value;
+
+    if (value > std::numeric_limits<float>::max() || value < -std::numeric_limits<float>::max())
+    {
+        throw std::out_of_range(
+            head + ((value > std::numeric_limits<float>::max()) ? std::string(" overflow") : std::string(" underflow")));
+    }
+
+    return static_cast<float>(value);
+}
+
+float convertToFloatHex(const char* str)
+{
+    // 该函数用于将字符串转换为浮点数，能正确处理格式无误的十六进制浮点数
+
+    const char* head = str;
+    if (str == NULL) { return 0.0f; }
+
+    int sign = 1;
+    if (*str == '-')
+    {
+        sign = -1;
+        str++;
+    }
+    else if (*str == '+') { str++; }
+
+    if (*str == '0' && (*(str + 1) == 'x' || *(str + 1) == 'X')) { str += 2; }
+
+    unsigned long long integerPart = 0;
+    while (isxdigit(*str))
+    {
+        int digit = 0;
+        if (isdigit(*str)) { digit = (*str - '0'); }
+        else if (*str >= 'a' && *str <= 'f') { digit = (*str - 'a' + 10); }
+        else if (*str >= 'A' && *str <= 'F') { digit = (*str - 'A' + 10); }
+        integerPart = integerPart * 16 + digit;
+        str++;
+    }
+
+    double fractionPart = 0.0;
+    if (*str == '.')
+    {
+        str++;
+        unsigned long long numerator   = 0;
+        unsigned long long denominator = 1;
+        while (isxdigit(*str))
+        {
+            int digit = 0;
+            if (isdigit(*str)) { digit = (*str - '0'); }
+            else if (*str >= 'a' && *str <= 'f') { digit = (*str - 'a' + 10); }
+            else if (*str >= 'A' && *str <= 'F') { digit = (*str - 'A' + 10); }
+            numerator = numerator * 16 + digit;
+            denominator *= 16;
+            str++;
+        }
+        fractionPart = (double)numerator / (double)denominator;
+    }
+
+    double value = (double)integerPart + fractionPart;
+
+    if (*str == 'p' || *str == 'P')
+    {
+        str++;
+        int expSign = 1;
+        if (*str == '-')
+        {
+            expSign = -1;
+            str++;
+        }
+        else if (*str == '+') { str++; }
+
+        int exponent = 0;
+        while (isdigit(*str))
+        {
+            exponent = exponent * 10 + (*str - '0');
+            str++;
+        }
+
+        value *= pow(2, expSign * exponent);
+    }
+
+    value = sign * value;
+
+    if (value > std::numeric_limits<float>::max() || value < -std::numeric_limits<float>::max())
+    {
+        throw std::out_of_range(
+            head + ((value > std::numeric_limits<float>::max()) ? std::string(" overflow") : std::string(" underflow")));
+    }
+
+    return static_cast<float>(value);
+}
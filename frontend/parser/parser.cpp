@@ -1,5 +1,7 @@
 #include <frontend/parser/parser.h>
 #include <debug.h>
+#include <string>
+#include <vector>
 
 namespace FE
 {
@@ -8,6 +10,18 @@ namespace FE
 
     void Parser::reportError(const location& loc, const std::string& message) { _parser.error(loc, message); }
 
+    // bison 的 symbol_name 每次调用都会构造新的 std::string，这里按种类缓存一份，Token 只引用缓存
+    static std::string_view tokenName(YaccParser::symbol_kind_type k)
+    {
+        static const std::vector<std::string> names = [] {
+            std::vector<std::string> v(YaccParser::YYNTOKENS);
+            for (int i = 0; i < YaccParser::YYNTOKENS; ++i)
+                v[i] = YaccParser::symbol_name(static_cast<YaccParser::symbol_kind_type>(i));
+            return v;
+        }();
+        return names[k];
+    }
+
     std::vector<Token> Parser::parseTokens_impl()
     {
         std::vector<Token> tokens;
@@ -17,10 +31,10 @@ namespace FE
             if (token.kind() == kind::S_END) break;
 
             Token result;
-            result.token_name    = token.name();
+            result.token_name    = tokenName(token.kind());
             result.line_number   = token.location.begin.line;
             result.column_number = token.location.begin.column - 1;
-            result.lexeme        = _scanner.YYText();
+            result.lexeme        = _scanner.lexeme();
 
             switch (token.kind())
             {
@@ -63,6 +77,23 @@ namespace FE
         return tokens;
     }
 
+    AST::Span<AST::StmtNode*>* Parser::addTopLevel(AST::Span<AST::StmtNode*>* list, AST::StmtNode* stmt)
+    {
+        // 语句归约时其后的 Token 还未产生任何节点，回退到上一条顶层语句之后正好释放本条语句的 AST
+        bool consumed = stmt && onTopLevel && onTopLevel(stmt);
+        if (consumed)
+        {
+            astArena.rewind(topMark);
+            numNodes = topNodes;
+        }
+
+        if (!list) list = makeList<AST::StmtNode*>();
+        if (stmt && !consumed) list->push_back(astArena, stmt);
+        topMark  = astArena.mark();
+        topNodes = numNodes;
+        return list;
+    }
+
     AST::Root* Parser::parseAST_impl()
     {
         _parser.parse();
@@ -4,6 +4,13 @@
 #include <frontend/iparser.h>
 #include <frontend/parser/scanner.h>
 #include <frontend/parser/yacc.h>
+#include <arena.h>
+#include <functional>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
 
 namespace FE
 {
@@ -16,18 +23,61 @@ namespace FE
         YaccParser _parser;
 
       public:
+        // AST 节点与子节点列表都从这里分配，随 Parser 析构整块释放；ast 不能比 Parser 活得更久
+        Arena      astArena;
         AST::Root* ast;
 
+        /*
+         * 流式编译：设置后每归约出一条顶层语句就立即交给它处理
+         * 返回 true 表示该语句已处理完毕，不再放入 Root，其 AST 随即通过回退 astArena 释放
+         */
+        std::function<bool(AST::StmtNode*)> onTopLevel;
+
+      private:
+        std::string ownedSource;  // 从 istream 构造时读入的源码
+        Arena::Mark topMark;      // 上一条顶层语句处理完后 astArena 的分配位置
+        size_t      numNodes;     // 当前存活的 AST 节点数，供 -fmem-report 统计
+        size_t      topNodes;     // topMark 处的 numNodes
+
       public:
+        // 源码需在 Parser 及其产生的 Token 存活期间保持有效（如 MappedFile 的映射区）
+        Parser(std::string_view source, std::ostream* outStream)
+            : iParser<Parser>(nullptr, outStream), _scanner(*this), _parser(_scanner, *this), astArena(), ast(nullptr),
+              onTopLevel(), ownedSource(), topMark(astArena.mark()), numNodes(0), topNodes(0)
+        {
+            _scanner.switch_streams(nullptr, outStream);
+            _scanner.setSource(source);
+        }
         Parser(std::istream* inStream, std::ostream* outStream)
-            : iParser<Parser>(inStream, outStream), _scanner(*this), _parser(_scanner, *this), ast(nullptr)
+            : iParser<Parser>(inStream, outStream), _scanner(*this), _parser(_scanner, *this), astArena(), ast(nullptr),
+              onTopLevel(), ownedSource(), topMark(astArena.mark()), numNodes(0), topNodes(0)
         {
-            _scanner.switch_streams(inStream, outStream);
+            ownedSource.assign(std::istreambuf_iterator<char>(*inStream), std::istreambuf_iterator<char>());
+            _scanner.switch_streams(nullptr, outStream);
+            _scanner.setSource(ownedSource);
         }
         ~Parser() {}
 
         void reportError(const location& loc, const std::string& message);
 
+        template <typename T, typename... Args>
+        T* make(Args&&... args)
+        {
+            static_assert(std::is_trivially_destructible_v<T>, "AST 整块释放，节点不会被析构");
+            ++numNodes;
+            return astArena.create<T>(std::forward<Args>(args)...);
+        }
+        template <typename T>
+        AST::Span<T>* makeList()
+        {
+            return astArena.create<AST::Span<T>>();
+        }
+
+        // 将一条顶层语句加入 list（为空时新建），返回加入后的列表；交由 onTopLevel 处理掉的语句不加入
+        AST::Span<AST::StmtNode*>* addTopLevel(AST::Span<AST::StmtNode*>* list, AST::StmtNode* stmt);
+
+        size_t nodeCount() const { return numNodes; }
+
       private:
         std::vector<Token> parseTokens_impl();
         AST::Root*         parseAST_impl();
@@ -11,6 +11,9 @@
 #define YY_DECL FE::YaccParser::symbol_type FE::Scanner::nextToken()
 
 #include <frontend/parser/yacc.h>
+#include <algorithm>
+#include <cstring>
+#include <string_view>
 
 // 从源代码输入流中读取字符
 // 根据词法规则（lexer.l 中定义的正则表达式）识别出 Token
@@ -24,11 +27,34 @@ namespace FE
       private:
         Parser& _parser;
 
+        // 整个源文件（通常是 mmap 的映射区），flex 通过 LexerInput 直接从这里取字符，不经过 istream
+        std::string_view source;
+        size_t           readPos    = 0;  // 已交给 flex 的字节数
+        size_t           offset     = 0;  // 已匹配的字节数，由 YY_USER_ACTION 维护
+        size_t           tokenStart = 0;  // 最近一次匹配在 source 中的起始偏移
+
       public:
         Scanner(Parser& parser) : _parser(parser) {}
         virtual ~Scanner() {}
 
         virtual YaccParser::symbol_type nextToken();
+
+        void setSource(std::string_view src)
+        {
+            source  = src;
+            readPos = offset = tokenStart = 0;
+        }
+        // 最近一次匹配的原文，直接指向 source，不做拷贝
+        std::string_view lexeme() const { return source.substr(tokenStart, offset - tokenStart); }
+
+      protected:
+        int LexerInput(char* buf, int maxSize) override
+        {
+            size_t n = std::min(source.size() - readPos, static_cast<size_t>(maxSize));
+            std::memcpy(buf, source.data() + readPos, n);
+            readPos += n;
+            return static_cast<int>(n);
+        }
     };
 }  // namespace FE
 
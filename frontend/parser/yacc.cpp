@@ -0,0 +1,2661 @@
+// A Bison parser, made by GNU Bison 3.8.2.
+
+// Skeleton implementation for Bison LALR(1) parsers in C++
+
+// Copyright (C) 2002-2015, 2018-2021 Free Software Foundation, Inc.
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+// As a special exception, you may create a larger work that contains
+// part or all of the Bison parser skeleton and distribute that work
+// under terms of your choice, so long as that work isn't itself a
+// parser generator using the skeleton or a modified version thereof
+// as a parser skeleton.  Alternatively, if you modify or redistribute
+// the parser skeleton itself, you may (at your option) remove this
+// special exception, which will cause the skeleton and the resulting
+// Bison output files to be licensed under the GNU General Public
+// License without this special exception.
+
+// This special exception was added by the Free Software Foundation in
+// version 2.2 of Bison.
+
+// DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+// especially those whose name start with YY_ or yy_.  They are
+// private implementation details that can be changed or removed.
+
+// "%code top" blocks.
+#line 36 "frontend/parser/yacc.y"
+
+    #include <iostream>
+
+    #include <frontend/parser/parser.h>
+    #include <frontend/parser/location.hh>
+    #include <frontend/parser/scanner.h>
+    #include <frontend/parser/yacc.h>
+    #include <frontend/ast/ast.h>
+    #include <frontend/ast/expr.h>
+    #include <frontend/ast/stmt.h>
+    #include <frontend/ast/decl.h>
+    #include <frontend/symbol/symbol_table.h>
+
+    using namespace FE;
+    using namespace FE::AST;
+
+    static YaccParser::symbol_type yylex(Scanner& scanner, Parser &parser)
+    {
+        (void)parser;
+        return scanner.nextToken(); 
+    }
+
+
+#line 63 "frontend/parser/yacc.cpp"
+
+
+
+
+#include "yacc.h"
+
+
+
+
+#ifndef YY_
+# if defined YYENABLE_NLS && YYENABLE_NLS
+#  if ENABLE_NLS
+#   include <libintl.h> // FIXME: INFRINGES ON USER NAME SPACE.
+#   define YY_(msgid) dgettext ("bison-runtime", msgid)
+#  endif
+# endif
+# ifndef YY_
+#  define YY_(msgid) msgid
+# endif
+#endif
+
+
+// Whether we are compiled with exception support.
+#ifndef YY_EXCEPTIONS
+# if defined __GNUC__ && !defined __EXCEPTIONS
+#  define YY_EXCEPTIONS 0
+# else
+#  define YY_EXCEPTIONS 1
+# endif
+#endif
+
+#define YYRHSLOC(Rhs, K) ((Rhs)[K].location)
+/* YYLLOC_DEFAULT -- Set CURRENT to span from RHS[1] to RHS[N].
+   If N is 0, then set CURRENT to the empty location which ends
+   the previous symbol: RHS[0] (always defined).  */
+
+# ifndef YYLLOC_DEFAULT
+#  define YYLLOC_DEFAULT(Current, Rhs, N)                               \
+    do                                                                  \
+      if (N)                                                            \
+        {                                                               \
+          (Current).begin  = YYRHSLOC (Rhs, 1).begin;                   \
+          (Current).end    = YYRHSLOC (Rhs, N).end;                     \
+        }                                                               \
+      else                                                              \
+        {                                                               \
+          (Current).begin = (Current).end = YYRHSLOC (Rhs, 0).end;      \
+        }                                                               \
+    while (false)
+# endif
+
+
+// Enable debugging if requested.
+#if YYDEBUG
+
+// A pseudo ostream that takes yydebug_ into account.
+# define YYCDEBUG if (yydebug_) (*yycdebug_)
+
+# define YY_SYMBOL_PRINT(Title, Symbol)         \
+  do {                                          \
+    if (yydebug_)                               \
+    {                                           \
+      *yycdebug_ << Title << ' ';               \
+      yy_print_ (*yycdebug_, Symbol);           \
+      *yycdebug_ << '\n';                       \
+    }                                           \
+  } while (false)
+
+# define YY_REDUCE_PRINT(Rule)          \
+  do {                                  \
+    if (yydebug_)                       \
+      yy_reduce_print_ (Rule);          \
+  } while (false)
+
+# define YY_STACK_PRINT()               \
+  do {                                  \
+    if (yydebug_)                       \
+      yy_stack_print_ ();                \
+  } while (false)
+
+#else // !YYDEBUG
+
+# define YYCDEBUG if (false) std::cerr
+# define YY_SYMBOL_PRINT(Title, Symbol)  YY_USE (Symbol)
+# define YY_REDUCE_PRINT(Rule)           static_cast<void> (0)
+# define YY_STACK_PRINT()                static_cast<void> (0)
+
+#endif // !YYDEBUG
+
+#define yyerrok         (yyerrstatus_ = 0)
+#define yyclearin       (yyla.clear ())
+
+#define YYACCEPT        goto yyacceptlab
+#define YYABORT         goto yyabortlab
+#define YYERROR         goto yyerrorlab
+#define YYRECOVERING()  (!!yyerrstatus_)
+
+#line 5 "frontend/parser/yacc.y"
+namespace  FE  {
+#line 163 "frontend/parser/yacc.cpp"
+
+  /// Build a parser object.
+   YaccParser :: YaccParser  (FE::Scanner& scanner_yyarg, FE::Parser& parser_yyarg)
+#if YYDEBUG
+    : yydebug_ (false),
+      yycdebug_ (&std::cerr),
+#else
+    :
+#endif
+      scanner (scanner_yyarg),
+      parser (parser_yyarg)
+  {}
+
+   YaccParser ::~ YaccParser  ()
+  {}
+
+   YaccParser ::syntax_error::~syntax_error () YY_NOEXCEPT YY_NOTHROW
+  {}
+
+  /*---------.
+  | symbol.  |
+  `---------*/
+
+
+
+  // by_state.
+   YaccParser ::by_state::by_state () YY_NOEXCEPT
+    : state (empty_state)
+  {}
+
+   YaccParser ::by_state::by_state (const by_state& that) YY_NOEXCEPT
+    : state (that.state)
+  {}
+
+  void
+   YaccParser ::by_state::clear () YY_NOEXCEPT
+  {
+    state = empty_state;
+  }
+
+  void
+   YaccParser ::by_state::move (by_state& that)
+  {
+    state = that.state;
+    that.clear ();
+  }
+
+   YaccParser ::by_state::by_state (state_type s) YY_NOEXCEPT
+    : state (s)
+  {}
+
+   YaccParser ::symbol_kind_type
+   YaccParser ::by_state::kind () const YY_NOEXCEPT
+  {
+    if (state == empty_state)
+      return symbol_kind::S_YYEMPTY;
+    else
+      return YY_CAST (symbol_kind_type, yystos_[+state]);
+  }
+
+   YaccParser ::stack_symbol_type::stack_symbol_type ()
+  {}
+
+   YaccParser ::stack_symbol_type::stack_symbol_type (YY_RVREF (stack_symbol_type) that)
+    : super_type (YY_MOVE (that.state), YY_MOVE (that.location))
+  {
+    switch (that.kind ())
+    {
+      case symbol_kind::S_ASSIGN_EXPR: // ASSIGN_EXPR
+      case symbol_kind::S_EXPR: // EXPR
+      case symbol_kind::S_NOCOMMA_EXPR: // NOCOMMA_EXPR
+      case symbol_kind::S_LOGICAL_OR_EXPR: // LOGICAL_OR_EXPR
+      case symbol_kind::S_LOGICAL_AND_EXPR: // LOGICAL_AND_EXPR
+      case symbol_kind::S_EQUALITY_EXPR: // EQUALITY_EXPR
+      case symbol_kind::S_RELATIONAL_EXPR: // RELATIONAL_EXPR
+      case symbol_kind::S_ADDSUB_EXPR: // ADDSUB_EXPR
+      case symbol_kind::S_MULDIV_EXPR: // MULDIV_EXPR
+      case symbol_kind::S_UNARY_EXPR: // UNARY_EXPR
+      case symbol_kind::S_BASIC_EXPR: // BASIC_EXPR
+      case symbol_kind::S_FUNC_CALL_EXPR: // FUNC_CALL_EXPR
+      case symbol_kind::S_ARRAY_DIMENSION_EXPR: // ARRAY_DIMENSION_EXPR
+      case symbol_kind::S_LEFT_VAL_EXPR: // LEFT_VAL_EXPR
+      case symbol_kind::S_LITERAL_EXPR: // LITERAL_EXPR
+        value.YY_MOVE_OR_COPY< FE::AST::ExprNode* > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_INITIALIZER: // INITIALIZER
+        value.YY_MOVE_OR_COPY< FE::AST::InitDecl* > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_UNARY_OP: // UNARY_OP
+        value.YY_MOVE_OR_COPY< FE::AST::Operator > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_PARAM_DECLARATOR: // PARAM_DECLARATOR
+        value.YY_MOVE_OR_COPY< FE::AST::ParamDeclarator* > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_PROGRAM: // PROGRAM
+        value.YY_MOVE_OR_COPY< FE::AST::Root* > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_EXPR_LIST: // EXPR_LIST
+      case symbol_kind::S_ARRAY_DIMENSION_EXPR_LIST: // ARRAY_DIMENSION_EXPR_LIST
+        value.YY_MOVE_OR_COPY< FE::AST::Span<FE::AST::ExprNode*>* > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_INITIALIZER_LIST: // INITIALIZER_LIST
+        value.YY_MOVE_OR_COPY< FE::AST::Span<FE::AST::InitDecl*>* > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_PARAM_DECLARATOR_LIST: // PARAM_DECLARATOR_LIST
+        value.YY_MOVE_OR_COPY< FE::AST::Span<FE::AST::ParamDeclarator*>* > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_TOP_STMT_LIST: // TOP_STMT_LIST
+      case symbol_kind::S_STMT_LIST: // STMT_LIST
+        value.YY_MOVE_OR_COPY< FE::AST::Span<FE::AST::StmtNode*>* > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_VAR_DECLARATOR_LIST: // VAR_DECLARATOR_LIST
+        value.YY_MOVE_OR_COPY< FE::AST::Span<FE::AST::VarDeclarator*>* > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_STMT: // STMT
+      case symbol_kind::S_CONTINUE_STMT: // CONTINUE_STMT
+      case symbol_kind::S_EXPR_STMT: // EXPR_STMT
+      case symbol_kind::S_VAR_DECL_STMT: // VAR_DECL_STMT
+      case symbol_kind::S_FUNC_BODY: // FUNC_BODY
+      case symbol_kind::S_FUNC_DECL_STMT: // FUNC_DECL_STMT
+      case symbol_kind::S_FOR_STMT: // FOR_STMT
+      case symbol_kind::S_IF_STMT: // IF_STMT
+      case symbol_kind::S_BREAK_STMT: // BREAK_STMT
+      case symbol_kind::S_RETURN_STMT: // RETURN_STMT
+      case symbol_kind::S_WHILE_STMT: // WHILE_STMT
+      case symbol_kind::S_BLOCK_STMT: // BLOCK_STMT
+        value.YY_MOVE_OR_COPY< FE::AST::StmtNode* > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_TYPE: // TYPE
+        value.YY_MOVE_OR_COPY< FE::AST::Type* > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_VAR_DECLARATION: // VAR_DECLARATION
+        value.YY_MOVE_OR_COPY< FE::AST::VarDeclaration* > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_VAR_DECLARATOR: // VAR_DECLARATOR
+        value.YY_MOVE_OR_COPY< FE::AST::VarDeclarator* > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_FLOAT_CONST: // FLOAT_CONST
+        value.YY_MOVE_OR_COPY< float > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_INT_CONST: // INT_CONST
+        value.YY_MOVE_OR_COPY< int > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_LL_CONST: // LL_CONST
+        value.YY_MOVE_OR_COPY< long long > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_STR_CONST: // STR_CONST
+      case symbol_kind::S_ERR_TOKEN: // ERR_TOKEN
+      case symbol_kind::S_SLASH_COMMENT: // SLASH_COMMENT
+      case symbol_kind::S_IDENT: // IDENT
+        value.YY_MOVE_OR_COPY< std::string > (YY_MOVE (that.value));
+        break;
+
+      default:
+        break;
+    }
+
+#if 201103L <= YY_CPLUSPLUS
+    // that is emptied.
+    that.state = empty_state;
+#endif
+  }
+
+   YaccParser ::stack_symbol_type::stack_symbol_type (state_type s, YY_MOVE_REF (symbol_type) that)
+    : super_type (s, YY_MOVE (that.location))
+  {
+    switch (that.kind ())
+    {
+      case symbol_kind::S_ASSIGN_EXPR: // ASSIGN_EXPR
+      case symbol_kind::S_EXPR: // EXPR
+      case symbol_kind::S_NOCOMMA_EXPR: // NOCOMMA_EXPR
+      case symbol_kind::S_LOGICAL_OR_EXPR: // LOGICAL_OR_EXPR
+      case symbol_kind::S_LOGICAL_AND_EXPR: // LOGICAL_AND_EXPR
+      case symbol_kind::S_EQUALITY_EXPR: // EQUALITY_EXPR
+      case symbol_kind::S_RELATIONAL_EXPR: // RELATIONAL_EXPR
+      case symbol_kind::S_ADDSUB_EXPR: // ADDSUB_EXPR
+      case symbol_kind::S_MULDIV_EXPR: // MULDIV_EXPR
+      case symbol_kind::S_UNARY_EXPR: // UNARY_EXPR
+      case symbol_kind::S_BASIC_EXPR: // BASIC_EXPR
+      case symbol_kind::S_FUNC_CALL_EXPR: // FUNC_CALL_EXPR
+      case symbol_kind::S_ARRAY_DIMENSION_EXPR: // ARRAY_DIMENSION_EXPR
+      case symbol_kind::S_LEFT_VAL_EXPR: // LEFT_VAL_EXPR
+      case symbol_kind::S_LITERAL_EXPR: // LITERAL_EXPR
+        value.move< FE::AST::ExprNode* > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_INITIALIZER: // INITIALIZER
+        value.move< FE::AST::InitDecl* > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_UNARY_OP: // UNARY_OP
+        value.move< FE::AST::Operator > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_PARAM_DECLARATOR: // PARAM_DECLARATOR
+        value.move< FE::AST::ParamDeclarator* > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_PROGRAM: // PROGRAM
+        value.move< FE::AST::Root* > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_EXPR_LIST: // EXPR_LIST
+      case symbol_kind::S_ARRAY_DIMENSION_EXPR_LIST: // ARRAY_DIMENSION_EXPR_LIST
+        value.move< FE::AST::Span<FE::AST::ExprNode*>* > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_INITIALIZER_LIST: // INITIALIZER_LIST
+        value.move< FE::AST::Span<FE::AST::InitDecl*>* > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_PARAM_DECLARATOR_LIST: // PARAM_DECLARATOR_LIST
+        value.move< FE::AST::Span<FE::AST::ParamDeclarator*>* > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_TOP_STMT_LIST: // TOP_STMT_LIST
+      case symbol_kind::S_STMT_LIST: // STMT_LIST
+        value.move< FE::AST::Span<FE::AST::StmtNode*>* > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_VAR_DECLARATOR_LIST: // VAR_DECLARATOR_LIST
+        value.move< FE::AST::Span<FE::AST::VarDeclarator*>* > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_STMT: // STMT
+      case symbol_kind::S_CONTINUE_STMT: // CONTINUE_STMT
+      case symbol_kind::S_EXPR_STMT: // EXPR_STMT
+      case symbol_kind::S_VAR_DECL_STMT: // VAR_DECL_STMT
+      case symbol_kind::S_FUNC_BODY: // FUNC_BODY
+      case symbol_kind::S_FUNC_DECL_STMT: // FUNC_DECL_STMT
+      case symbol_kind::S_FOR_STMT: // FOR_STMT
+      case symbol_kind::S_IF_STMT: // IF_STMT
+      case symbol_kind::S_BREAK_STMT: // BREAK_STMT
+      case symbol_kind::S_RETURN_STMT: // RETURN_STMT
+      case symbol_kind::S_WHILE_STMT: // WHILE_STMT
+      case symbol_kind::S_BLOCK_STMT: // BLOCK_STMT
+        value.move< FE::AST::StmtNode* > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_TYPE: // TYPE
+        value.move< FE::AST::Type* > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_VAR_DECLARATION: // VAR_DECLARATION
+        value.move< FE::AST::VarDeclaration* > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_VAR_DECLARATOR: // VAR_DECLARATOR
+        value.move< FE::AST::VarDeclarator* > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_FLOAT_CONST: // FLOAT_CONST
+        value.move< float > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_INT_CONST: // INT_CONST
+        value.move< int > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_LL_CONST: // LL_CONST
+        value.move< long long > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_STR_CONST: // STR_CONST
+      case symbol_kind::S_ERR_TOKEN: // ERR_TOKEN
+      case symbol_kind::S_SLASH_COMMENT: // SLASH_COMMENT
+      case symbol_kind::S_IDENT: // IDENT
+        value.move< std::string > (YY_MOVE (that.value));
+        break;
+
+      default:
+        break;
+    }
+
+    // that is emptied.
+    that.kind_ = symbol_kind::S_YYEMPTY;
+  }
+
+#if YY_CPLUSPLUS < 201103L
+   YaccParser ::stack_symbol_type&
+   YaccParser ::stack_symbol_type::operator= (const stack_symbol_type& that)
+  {
+    state = that.state;
+    switch (that.kind ())
+    {
+      case symbol_kind::S_ASSIGN_EXPR: // ASSIGN_EXPR
+      case symbol_kind::S_EXPR: // EXPR
+      case symbol_kind::S_NOCOMMA_EXPR: // NOCOMMA_EXPR
+      case symbol_kind::S_LOGICAL_OR_EXPR: // LOGICAL_OR_EXPR
+      case symbol_kind::S_LOGICAL_AND_EXPR: // LOGICAL_AND_EXPR
+      case symbol_kind::S_EQUALITY_EXPR: // EQUALITY_EXPR
+      case symbol_kind::S_RELATIONAL_EXPR: // RELATIONAL_EXPR
+      case symbol_kind::S_ADDSUB_EXPR: // ADDSUB_EXPR
+      case symbol_kind::S_MULDIV_EXPR: // MULDIV_EXPR
+      case symbol_kind::S_UNARY_EXPR: // UNARY_EXPR
+      case symbol_kind::S_BASIC_EXPR: // BASIC_EXPR
+      case symbol_kind::S_FUNC_CALL_EXPR: // FUNC_CALL_EXPR
+      case symbol_kind::S_ARRAY_DIMENSION_EXPR: // ARRAY_DIMENSION_EXPR
+      case symbol_kind::S_LEFT_VAL_EXPR: // LEFT_VAL_EXPR
+      case symbol_kind::S_LITERAL_EXPR: // LITERAL_EXPR
+        value.copy< FE::AST::ExprNode* > (that.value);
+        break;
+
+      case symbol_kind::S_INITIALIZER: // INITIALIZER
+        value.copy< FE::AST::InitDecl* > (that.value);
+        break;
+
+      case symbol_kind::S_UNARY_OP: // UNARY_OP
+        value.copy< FE::AST::Operator > (that.value);
+        break;
+
+      case symbol_kind::S_PARAM_DECLARATOR: // PARAM_DECLARATOR
+        value.copy< FE::AST::ParamDeclarator* > (that.value);
+        break;
+
+      case symbol_kind::S_PROGRAM: // PROGRAM
+        value.copy< FE::AST::Root* > (that.value);
+        break;
+
+      case symbol_kind::S_EXPR_LIST: // EXPR_LIST
+      case symbol_kind::S_ARRAY_DIMENSION_EXPR_LIST: // ARRAY_DIMENSION_EXPR_LIST
+        value.copy< FE::AST::Span<FE::AST::ExprNode*>* > (that.value);
+        break;
+
+      case symbol_kind::S_INITIALIZER_LIST: // INITIALIZER_LIST
+        value.copy< FE::AST::Span<FE::AST::InitDecl*>* > (that.value);
+        break;
+
+      case symbol_kind::S_PARAM_DECLARATOR_LIST: // PARAM_DECLARATOR_LIST
+        value.copy< FE::AST::Span<FE::AST::ParamDeclarator*>* > (that.value);
+        break;
+
+      case symbol_kind::S_TOP_STMT_LIST: // TOP_STMT_LIST
+      case symbol_kind::S_STMT_LIST: // STMT_LIST
+        value.copy< FE::AST::Span<FE::AST::StmtNode*>* > (that.value);
+        break;
+
+      case symbol_kind::S_VAR_DECLARATOR_LIST: // VAR_DECLARATOR_LIST
+        value.copy< FE::AST::Span<FE::AST::VarDeclarator*>* > (that.value);
+        break;
+
+      case symbol_kind::S_STMT: // STMT
+      case symbol_kind::S_CONTINUE_STMT: // CONTINUE_STMT
+      case symbol_kind::S_EXPR_STMT: // EXPR_STMT
+      case symbol_kind::S_VAR_DECL_STMT: // VAR_DECL_STMT
+      case symbol_kind::S_FUNC_BODY: // FUNC_BODY
+      case symbol_kind::S_FUNC_DECL_STMT: // FUNC_DECL_STMT
+      case symbol_kind::S_FOR_STMT: // FOR_STMT
+      case symbol_kind::S_IF_STMT: // IF_STMT
+      case symbol_kind::S_BREAK_STMT: // BREAK_STMT
+      case symbol_kind::S_RETURN_STMT: // RETURN_STMT
+      case symbol_kind::S_WHILE_STMT: // WHILE_STMT
+      case symbol_kind::S_BLOCK_STMT: // BLOCK_STMT
+        value.copy< FE::AST::StmtNode* > (that.value);
+        break;
+
+      case symbol_kind::S_TYPE: // TYPE
+        value.copy< FE::AST::Type* > (that.value);
+        break;
+
+      case symbol_kind::S_VAR_DECLARATION: // VAR_DECLARATION
+        value.copy< FE::AST::VarDeclaration* > (that.value);
+        break;
+
+      case symbol_kind::S_VAR_DECLARATOR: // VAR_DECLARATOR
+        value.copy< FE::AST::VarDeclarator* > (that.value);
+        break;
+
+      case symbol_kind::S_FLOAT_CONST: // FLOAT_CONST
+        value.copy< float > (that.value);
+        break;
+
+      case symbol_kind::S_INT_CONST: // INT_CONST
+        value.copy< int > (that.value);
+        break;
+
+      case symbol_kind::S_LL_CONST: // LL_CONST
+        value.copy< long long > (that.value);
+        break;
+
+      case symbol_kind::S_STR_CONST: // STR_CONST
+      case symbol_kind::S_ERR_TOKEN: // ERR_TOKEN
+      case symbol_kind::S_SLASH_COMMENT: // SLASH_COMMENT
+      case symbol_kind::S_IDENT: // IDENT
+        value.copy< std::string > (that.value);
+        break;
+
+      default:
+        break;
+    }
+
+    location = that.location;
+    return *this;
+  }
+
+   YaccParser ::stack_symbol_type&
+   YaccParser ::stack_symbol_type::operator= (stack_symbol_type& that)
+  {
+    state = that.state;
+    switch (that.kind ())
+    {
+      case symbol_kind::S_ASSIGN_EXPR: // ASSIGN_EXPR
+      case symbol_kind::S_EXPR: // EXPR
+      case symbol_kind::S_NOCOMMA_EXPR: // NOCOMMA_EXPR
+      case symbol_kind::S_LOGICAL_OR_EXPR: // LOGICAL_OR_EXPR
+      case symbol_kind::S_LOGICAL_AND_EXPR: // LOGICAL_AND_EXPR
+      case symbol_kind::S_EQUALITY_EXPR: // EQUALITY_EXPR
+      case symbol_kind::S_RELATIONAL_EXPR: // RELATIONAL_EXPR
+      case symbol_kind::S_ADDSUB_EXPR: // ADDSUB_EXPR
+      case symbol_kind::S_MULDIV_EXPR: // MULDIV_EXPR
+      case symbol_kind::S_UNARY_EXPR: // UNARY_EXPR
+      case symbol_kind::S_BASIC_EXPR: // BASIC_EXPR
+      case symbol_kind::S_FUNC_CALL_EXPR: // FUNC_CALL_EXPR
+      case symbol_kind::S_ARRAY_DIMENSION_EXPR: // ARRAY_DIMENSION_EXPR
+      case symbol_kind::S_LEFT_VAL_EXPR: // LEFT_VAL_EXPR
+      case symbol_kind::S_LITERAL_EXPR: // LITERAL_EXPR
+        value.move< FE::AST::ExprNode* > (that.value);
+        break;
+
+      case symbol_kind::S_INITIALIZER: // INITIALIZER
+        value.move< FE::AST::InitDecl* > (that.value);
+        break;
+
+      case symbol_kind::S_UNARY_OP: // UNARY_OP
+        value.move< FE::AST::Operator > (that.value);
+        break;
+
+      case symbol_kind::S_PARAM_DECLARATOR: // PARAM_DECLARATOR
+        value.move< FE::AST::ParamDeclarator* > (that.value);
+        break;
+
+      case symbol_kind::S_PROGRAM: // PROGRAM
+        value.move< FE::AST::Root* > (that.value);
+        break;
+
+      case symbol_kind::S_EXPR_LIST: // EXPR_LIST
+      case symbol_kind::S_ARRAY_DIMENSION_EXPR_LIST: // ARRAY_DIMENSION_EXPR_LIST
+        value.move< FE::AST::Span<FE::AST::ExprNode*>* > (that.value);
+        break;
+
+      case symbol_kind::S_INITIALIZER_LIST: // INITIALIZER_LIST
+        value.move< FE::AST::Span<FE::AST::InitDecl*>* > (that.value);
+        break;
+
+      case symbol_kind::S_PARAM_DECLARATOR_LIST: // PARAM_DECLARATOR_LIST
+        value.move< FE::AST::Span<FE::AST::ParamDeclarator*>* > (that.value);
+        break;
+
+      case symbol_kind::S_TOP_STMT_LIST: // TOP_STMT_LIST
+      case symbol_kind::S_STMT_LIST: // STMT_LIST
+        value.move< FE::AST::Span<FE::AST::StmtNode*>* > (that.value);
+        break;
+
+      case symbol_kind::S_VAR_DECLARATOR_LIST: // VAR_DECLARATOR_LIST
+        value.move< FE::AST::Span<FE::AST::VarDeclarator*>* > (that.value);
+        break;
+
+      case symbol_kind::S_STMT: // STMT
+      case symbol_kind::S_CONTINUE_STMT: // CONTINUE_STMT
+      case symbol_kind::S_EXPR_STMT: // EXPR_STMT
+      case symbol_kind::S_VAR_DECL_STMT: // VAR_DECL_STMT
+      case symbol_kind::S_FUNC_BODY: // FUNC_BODY
+      case symbol_kind::S_FUNC_DECL_STMT: // FUNC_DECL_STMT
+      case symbol_kind::S_FOR_STMT: // FOR_STMT
+      case symbol_kind::S_IF_STMT: // IF_STMT
+      case symbol_kind::S_BREAK_STMT: // BREAK_STMT
+      case symbol_kind::S_RETURN_STMT: // RETURN_STMT
+      case symbol_kind::S_WHILE_STMT: // WHILE_STMT
+      case symbol_kind::S_BLOCK_STMT: // BLOCK_STMT
+        value.move< FE::AST::StmtNode* > (that.value);
+        break;
+
+      case symbol_kind::S_TYPE: // TYPE
+        value.move< FE::AST::Type* > (that.value);
+        break;
+
+      case symbol_kind::S_VAR_DECLARATION: // VAR_DECLARATION
+        value.move< FE::AST::VarDeclaration* > (that.value);
+        break;
+
+      case symbol_kind::S_VAR_DECLARATOR: // VAR_DECLARATOR
+        value.move< FE::AST::VarDeclarator* > (that.value);
+        break;
+
+      case symbol_kind::S_FLOAT_CONST: // FLOAT_CONST
+        value.move< float > (that.value);
+        break;
+
+      case symbol_kind::S_INT_CONST: // INT_CONST
+        value.move< int > (that.value);
+        break;
+
+      case symbol_kind::S_LL_CONST: // LL_CONST
+        value.move< long long > (that.value);
+        break;
+
+      case symbol_kind::S_STR_CONST: // STR_CONST
+      case symbol_kind::S_ERR_TOKEN: // ERR_TOKEN
+      case symbol_kind::S_SLASH_COMMENT: // SLASH_COMMENT
+      case symbol_kind::S_IDENT: // IDENT
+        value.move< std::string > (that.value);
+        break;
+
+      default:
+        break;
+    }
+
+    location = that.location;
+    // that is emptied.
+    that.state = empty_state;
+    return *this;
+  }
+#endif
+
+  template <typename Base>
+  void
+   YaccParser ::yy_destroy_ (const char* yymsg, basic_symbol<Base>& yysym) const
+  {
+    if (yymsg)
+      YY_SYMBOL_PRINT (yymsg, yysym);
+  }
+
+#if YYDEBUG
+  template <typename Base>
+  void
+   YaccParser ::yy_print_ (std::ostream& yyo, const basic_symbol<Base>& yysym) const
+  {
+    std::ostream& yyoutput = yyo;
+    YY_USE (yyoutput);
+    if (yysym.empty ())
+      yyo << "empty symbol";
+    else
+      {
+        symbol_kind_type yykind = yysym.kind ();
+        yyo << (yykind < YYNTOKENS ? "token" : "nterm")
+            << ' ' << yysym.name () << " ("
+            << yysym.location << ": ";
+        YY_USE (yykind);
+        yyo << ')';
+      }
+  }
+#endif
+
+  void
+   YaccParser ::yypush_ (const char* m, YY_MOVE_REF (stack_symbol_type) sym)
+  {
+    if (m)
+      YY_SYMBOL_PRINT (m, sym);
+    yystack_.push (YY_MOVE (sym));
+  }
+
+  void
+   YaccParser ::yypush_ (const char* m, state_type s, YY_MOVE_REF (symbol_type) sym)
+  {
+#if 201103L <= YY_CPLUSPLUS
+    yypush_ (m, stack_symbol_type (s, std::move (sym)));
+#else
+    stack_symbol_type ss (s, sym);
+    yypush_ (m, ss);
+#endif
+  }
+
+  void
+   YaccParser ::yypop_ (int n) YY_NOEXCEPT
+  {
+    yystack_.pop (n);
+  }
+
+#if YYDEBUG
+  std::ostream&
+   YaccParser ::debug_stream () const
+  {
+    return *yycdebug_;
+  }
+
+  void
+   YaccParser ::set_debug_stream (std::ostream& o)
+  {
+    yycdebug_ = &o;
+  }
+
+
+   YaccParser ::debug_level_type
+   YaccParser ::debug_level () const
+  {
+    return yydebug_;
+  }
+
+  void
+   YaccParser ::set_debug_level (debug_level_type l)
+  {
+    yydebug_ = l;
+  }
+#endif // YYDEBUG
+
+   YaccParser ::state_type
+   YaccParser ::yy_lr_goto_state_ (state_type yystate, int yysym)
+  {
+    int yyr = yypgoto_[yysym - YYNTOKENS] + yystate;
+    if (0 <= yyr && yyr <= yylast_ && yycheck_[yyr] == yystate)
+      return yytable_[yyr];
+    else
+      return yydefgoto_[yysym - YYNTOKENS];
+  }
+
+  bool
+   YaccParser ::yy_pact_value_is_default_ (int yyvalue) YY_NOEXCEPT
+  {
+    return yyvalue == yypact_ninf_;
+  }
+
+  bool
+   YaccParser ::yy_table_value_is_error_ (int yyvalue) YY_NOEXCEPT
+  {
+    return yyvalue == yytable_ninf_;
+  }
+
+  int
+   YaccParser ::operator() ()
+  {
+    return parse ();
+  }
+
+  int
+   YaccParser ::parse ()
+  {
+    int yyn;
+    /// Length of the RHS of the rule being reduced.
+    int yylen = 0;
+
+    // Error handling.
+    int yynerrs_ = 0;
+    int yyerrstatus_ = 0;
+
+    /// The lookahead symbol.
+    symbol_type yyla;
+
+    /// The locations where the error started and ended.
+    stack_symbol_type yyerror_range[3];
+
+    /// The return value of parse ().
+    int yyresult;
+
+#if YY_EXCEPTIONS
+    try
+#endif // YY_EXCEPTIONS
+      {
+    YYCDEBUG << "Starting parse\n";
+
+
+    /* Initialize the stack.  The initial state will be set in
+       yynewstate, since the latter expects the semantical and the
+       location values to have been already stored, initialize these
+       stacks with a primary value.  */
+    yystack_.clear ();
+    yypush_ (YY_NULLPTR, 0, YY_MOVE (yyla));
+
+  /*-----------------------------------------------.
+  | yynewstate -- push a new symbol on the stack.  |
+  `-----------------------------------------------*/
+  yynewstate:
+    YYCDEBUG << "Entering state " << int (yystack_[0].state) << '\n';
+    YY_STACK_PRINT ();
+
+    // Accept?
+    if (yystack_[0].state == yyfinal_)
+      YYACCEPT;
+
+    goto yybackup;
+
+
+  /*-----------.
+  | yybackup.  |
+  `-----------*/
+  yybackup:
+    // Try to take a decision without lookahead.
+    yyn = yypact_[+yystack_[0].state];
+    if (yy_pact_value_is_default_ (yyn))
+      goto yydefault;
+
+    // Read a lookahead token.
+    if (yyla.empty ())
+      {
+        YYCDEBUG << "Reading a token\n";
+#if YY_EXCEPTIONS
+        try
+#endif // YY_EXCEPTIONS
+          {
+            symbol_type yylookahead (yylex (scanner, parser));
+            yyla.move (yylookahead);
+          }
+#if YY_EXCEPTIONS
+        catch (const syntax_error& yyexc)
+          {
+            YYCDEBUG << "Caught exception: " << yyexc.what() << '\n';
+            error (yyexc);
+            goto yyerrlab1;
+          }
+#endif // YY_EXCEPTIONS
+      }
+    YY_SYMBOL_PRINT ("Next token is", yyla);
+
+    if (yyla.kind () == symbol_kind::S_YYerror)
+    {
+      // The scanner already issued an error message, process directly
+      // to error recovery.  But do not keep the error token as
+      // lookahead, it is too special and may lead us to an endless
+      // loop in error recovery. */
+      yyla.kind_ = symbol_kind::S_YYUNDEF;
+      goto yyerrlab1;
+    }
+
+    /* If the proper action on seeing token YYLA.TYPE is to reduce or
+       to detect an error, take that action.  */
+    yyn += yyla.kind ();
+    if (yyn < 0 || yylast_ < yyn || yycheck_[yyn] != yyla.kind ())
+      {
+        goto yydefault;
+      }
+
+    // Reduce or error.
+    yyn = yytable_[yyn];
+    if (yyn <= 0)
+      {
+        if (yy_table_value_is_error_ (yyn))
+          goto yyerrlab;
+        yyn = -yyn;
+        goto yyreduce;
+      }
+
+    // Count tokens shifted since error; after three, turn off error status.
+    if (yyerrstatus_)
+      --yyerrstatus_;
+
+    // Shift the lookahead token.
+    yypush_ ("Shifting", state_type (yyn), YY_MOVE (yyla));
+    goto yynewstate;
+
+
+  /*-----------------------------------------------------------.
+  | yydefault -- do the default action for the current state.  |
+  `-----------------------------------------------------------*/
+  yydefault:
+    yyn = yydefact_[+yystack_[0].state];
+    if (yyn == 0)
+      goto yyerrlab;
+    goto yyreduce;
+
+
+  /*-----------------------------.
+  | yyreduce -- do a reduction.  |
+  `-----------------------------*/
+  yyreduce:
+    yylen = yyr2_[yyn];
+    {
+      stack_symbol_type yylhs;
+      yylhs.state = yy_lr_goto_state_ (yystack_[yylen].state, yyr1_[yyn]);
+      /* Variants are always initialized to an empty instance of the
+         correct type. The default '$$ = $1' action is NOT applied
+         when using variants.  */
+      switch (yyr1_[yyn])
+    {
+      case symbol_kind::S_ASSIGN_EXPR: // ASSIGN_EXPR
+      case symbol_kind::S_EXPR: // EXPR
+      case symbol_kind::S_NOCOMMA_EXPR: // NOCOMMA_EXPR
+      case symbol_kind::S_LOGICAL_OR_EXPR: // LOGICAL_OR_EXPR
+      case symbol_kind::S_LOGICAL_AND_EXPR: // LOGICAL_AND_EXPR
+      case symbol_kind::S_EQUALITY_EXPR: // EQUALITY_EXPR
+      case symbol_kind::S_RELATIONAL_EXPR: // RELATIONAL_EXPR
+      case symbol_kind::S_ADDSUB_EXPR: // ADDSUB_EXPR
+      case symbol_kind::S_MULDIV_EXPR: // MULDIV_EXPR
+      case symbol_kind::S_UNARY_EXPR: // UNARY_EXPR
+      case symbol_kind::S_BASIC_EXPR: // BASIC_EXPR
+      case symbol_kind::S_FUNC_CALL_EXPR: // FUNC_CALL_EXPR
+      case symbol_kind::S_ARRAY_DIMENSION_EXPR: // ARRAY_DIMENSION_EXPR
+      case symbol_kind::S_LEFT_VAL_EXPR: // LEFT_VAL_EXPR
+      case symbol_kind::S_LITERAL_EXPR: // LITERAL_EXPR
+        yylhs.value.emplace< FE::AST::ExprNode* > ();
+        break;
+
+      case symbol_kind::S_INITIALIZER: // INITIALIZER
+        yylhs.value.emplace< FE::AST::InitDecl* > ();
+        break;
+
+      case symbol_kind::S_UNARY_OP: // UNARY_OP
+        yylhs.value.emplace< FE::AST::Operator > ();
+        break;
+
+      case symbol_kind::S_PARAM_DECLARATOR: // PARAM_DECLARATOR
+        yylhs.value.emplace< FE::AST::ParamDeclarator* > ();
+        break;
+
+      case symbol_kind::S_PROGRAM: // PROGRAM
+        yylhs.value.emplace< FE::AST::Root* > ();
+        break;
+
+      case symbol_kind::S_EXPR_LIST: // EXPR_LIST
+      case symbol_kind::S_ARRAY_DIMENSION_EXPR_LIST: // ARRAY_DIMENSION_EXPR_LIST
+        yylhs.value.emplace< FE::AST::Span<FE::AST::ExprNode*>* > ();
+        break;
+
+      case symbol_kind::S_INITIALIZER_LIST: // INITIALIZER_LIST
+        yylhs.value.emplace< FE::AST::Span<FE::AST::InitDecl*>* > ();
+        break;
+
+      case symbol_kind::S_PARAM_DECLARATOR_LIST: // PARAM_DECLARATOR_LIST
+        yylhs.value.emplace< FE::AST::Span<FE::AST::ParamDeclarator*>* > ();
+        break;
+
+      case symbol_kind::S_TOP_STMT_LIST: // TOP_STMT_LIST
+      case symbol_kind::S_STMT_LIST: // STMT_LIST
+        yylhs.value.emplace< FE::AST::Span<FE::AST::StmtNode*>* > ();
+        break;
+
+      case symbol_kind::S_VAR_DECLARATOR_LIST: // VAR_DECLARATOR_LIST
+        yylhs.value.emplace< FE::AST::Span<FE::AST::VarDeclarator*>* > ();
+        break;
+
+      case symbol_kind::S_STMT: // STMT
+      case symbol_kind::S_CONTINUE_STMT: // CONTINUE_STMT
+      case symbol_kind::S_EXPR_STMT: // EXPR_STMT
+      case symbol_kind::S_VAR_DECL_STMT: // VAR_DECL_STMT
+      case symbol_kind::S_FUNC_BODY: // FUNC_BODY
+      case symbol_kind::S_FUNC_DECL_STMT: // FUNC_DECL_STMT
+      case symbol_kind::S_FOR_STMT: // FOR_STMT
+      case symbol_kind::S_IF_STMT: // IF_STMT
+      case symbol_kind::S_BREAK_STMT: // BREAK_STMT
+      case symbol_kind::S_RETURN_STMT: // RETURN_STMT
+      case symbol_kind::S_WHILE_STMT: // WHILE_STMT
+      case symbol_kind::S_BLOCK_STMT: // BLOCK_STMT
+        yylhs.value.emplace< FE::AST::StmtNode* > ();
+        break;
+
+      case symbol_kind::S_TYPE: // TYPE
+        yylhs.value.emplace< FE::AST::Type* > ();
+        break;
+
+      case symbol_kind::S_VAR_DECLARATION: // VAR_DECLARATION
+        yylhs.value.emplace< FE::AST::VarDeclaration* > ();
+        break;
+
+      case symbol_kind::S_VAR_DECLARATOR: // VAR_DECLARATOR
+        yylhs.value.emplace< FE::AST::VarDeclarator* > ();
+        break;
+
+      case symbol_kind::S_FLOAT_CONST: // FLOAT_CONST
+        yylhs.value.emplace< float > ();
+        break;
+
+      case symbol_kind::S_INT_CONST: // INT_CONST
+        yylhs.value.emplace< int > ();
+        break;
+
+      case symbol_kind::S_LL_CONST: // LL_CONST
+        yylhs.value.emplace< long long > ();
+        break;
+
+      case symbol_kind::S_STR_CONST: // STR_CONST
+      case symbol_kind::S_ERR_TOKEN: // ERR_TOKEN
+      case symbol_kind::S_SLASH_COMMENT: // SLASH_COMMENT
+      case symbol_kind::S_IDENT: // IDENT
+        yylhs.value.emplace< std::string > ();
+        break;
+
+      default:
+        break;
+    }
+
+
+      // Default location.
+      {
+        stack_type::slice range (yystack_, yylen);
+        YYLLOC_DEFAULT (yylhs.location, range, yylen);
+        yyerror_range[1].location = yylhs.location;
+      }
+
+      // Perform the reduction.
+      YY_REDUCE_PRINT (yyn);
+#if YY_EXCEPTIONS
+      try
+#endif // YY_EXCEPTIONS
+        {
+          switch (yyn)
+            {
+  case 2: // PROGRAM: TOP_STMT_LIST
+#line 161 "frontend/parser/yacc.y"
+                  {
+        yylhs.value.as < FE::AST::Root* > () = parser.make<Root>(yystack_[0].value.as < FE::AST::Span<FE::AST::StmtNode*>* > ());
+        parser.ast = yylhs.value.as < FE::AST::Root* > ();
+    }
+#line 1071 "frontend/parser/yacc.cpp"
+    break;
+
+  case 3: // PROGRAM: PROGRAM END
+#line 165 "frontend/parser/yacc.y"
+                  { // 当读到END时，表示输入结束
+        YYACCEPT;
+    }
+#line 1079 "frontend/parser/yacc.cpp"
+    break;
+
+  case 4: // TOP_STMT_LIST: STMT
+#line 172 "frontend/parser/yacc.y"
+         {
+        yylhs.value.as < FE::AST::Span<FE::AST::StmtNode*>* > () = parser.addTopLevel(nullptr, yystack_[0].value.as < FE::AST::StmtNode* > ());
+    }
+#line 1087 "frontend/parser/yacc.cpp"
+    break;
+
+  case 5: // TOP_STMT_LIST: TOP_STMT_LIST STMT
+#line 175 "frontend/parser/yacc.y"
+                         {
+        yylhs.value.as < FE::AST::Span<FE::AST::StmtNode*>* > () = parser.addTopLevel(yystack_[1].value.as < FE::AST::Span<FE::AST::StmtNode*>* > (), yystack_[0].value.as < FE::AST::StmtNode* > ());
+    }
+#line 1095 "frontend/parser/yacc.cpp"
+    break;
+
+  case 6: // STMT_LIST: STMT
+#line 182 "frontend/parser/yacc.y"
+         { // 若只匹配到一个语句，则创建一个新的语句列表
+        yylhs.value.as < FE::AST::Span<FE::AST::StmtNode*>* > () = parser.makeList<StmtNode*>();
+        if (yystack_[0].value.as < FE::AST::StmtNode* > ()) yylhs.value.as < FE::AST::Span<FE::AST::StmtNode*>* > ()->push_back(parser.astArena, yystack_[0].value.as < FE::AST::StmtNode* > ());
+    }
+#line 1104 "frontend/parser/yacc.cpp"
+    break;
+
+  case 7: // STMT_LIST: STMT_LIST STMT
+#line 186 "frontend/parser/yacc.y"
+                     { // 若已有语句列表，则将新语句加入列表
+        yylhs.value.as < FE::AST::Span<FE::AST::StmtNode*>* > () = yystack_[1].value.as < FE::AST::Span<FE::AST::StmtNode*>* > ();
+        if (yystack_[0].value.as < FE::AST::StmtNode* > ()) yylhs.value.as < FE::AST::Span<FE::AST::StmtNode*>* > ()->push_back(parser.astArena, yystack_[0].value.as < FE::AST::StmtNode* > ());
+    }
+#line 1113 "frontend/parser/yacc.cpp"
+    break;
+
+  case 8: // STMT: EXPR_STMT
+#line 195 "frontend/parser/yacc.y"
+              { // 表达式语句
+        yylhs.value.as < FE::AST::StmtNode* > () = yystack_[0].value.as < FE::AST::StmtNode* > ();
+    }
+#line 1121 "frontend/parser/yacc.cpp"
+    break;
+
+  case 9: // STMT: VAR_DECL_STMT
+#line 198 "frontend/parser/yacc.y"
+                    { // 变量声明语句
+        yylhs.value.as < FE::AST::StmtNode* > () = yystack_[0].value.as < FE::AST::StmtNode* > ();
+    }
+#line 1129 "frontend/parser/yacc.cpp"
+    break;
+
+  case 10: // STMT: FUNC_DECL_STMT
+#line 201 "frontend/parser/yacc.y"
+                     { // 函数声明语句
+        yylhs.value.as < FE::AST::StmtNode* > () = yystack_[0].value.as < FE::AST::StmtNode* > ();
+    }
+#line 1137 "frontend/parser/yacc.cpp"
+    break;
+
+  case 11: // STMT: FOR_STMT
+#line 204 "frontend/parser/yacc.y"
+               { // for语句（SysY语言支持for语句吗？）
+        yylhs.value.as < FE::AST::StmtNode* > () = yystack_[0].value.as < FE::AST::StmtNode* > ();
+    }
+#line 1145 "frontend/parser/yacc.cpp"
+    break;
+
+  case 12: // STMT: IF_STMT
+#line 207 "frontend/parser/yacc.y"
+              { // if语句
+        yylhs.value.as < FE::AST::StmtNode* > () = yystack_[0].value.as < FE::AST::StmtNode* > ();
+    }
+#line 1153 "frontend/parser/yacc.cpp"
+    break;
+
+  case 13: // STMT: CONTINUE_STMT
+#line 210 "frontend/parser/yacc.y"
+                    { // continue语句
+        yylhs.value.as < FE::AST::StmtNode* > () = yystack_[0].value.as < FE::AST::StmtNode* > ();
+    }
+#line 1161 "frontend/parser/yacc.cpp"
+    break;
+
+  case 14: // STMT: SEMICOLON
+#line 213 "frontend/parser/yacc.y"
+                { // 分号（作为空语句处理）
+        yylhs.value.as < FE::AST::StmtNode* > () = nullptr;
+    }
+#line 1169 "frontend/parser/yacc.cpp"
+    break;
+
+  case 15: // STMT: SLASH_COMMENT
+#line 216 "frontend/parser/yacc.y"
+                    { // 单行注释（作为空语句处理）
+        yylhs.value.as < FE::AST::StmtNode* > () = nullptr;
+    }
+#line 1177 "frontend/parser/yacc.cpp"
+    break;
+
+  case 16: // STMT: BREAK_STMT
+#line 221 "frontend/parser/yacc.y"
+                 { // break语句
+        yylhs.value.as < FE::AST::StmtNode* > () = yystack_[0].value.as < FE::AST::StmtNode* > ();
+    }
+#line 1185 "frontend/parser/yacc.cpp"
+    break;
+
+  case 17: // STMT: RETURN_STMT
+#line 224 "frontend/parser/yacc.y"
+                  { // return语句
+        yylhs.value.as < FE::AST::StmtNode* > () = yystack_[0].value.as < FE::AST::StmtNode* > ();
+    }
+#line 1193 "frontend/parser/yacc.cpp"
+    break;
+
+  case 18: // STMT: WHILE_STMT
+#line 227 "frontend/parser/yacc.y"
+                 { // while语句
+        yylhs.value.as < FE::AST::StmtNode* > () = yystack_[0].value.as < FE::AST::StmtNode* > ();
+    }
+#line 1201 "frontend/parser/yacc.cpp"
+    break;
+
+  case 19: // STMT: BLOCK_STMT
+#line 230 "frontend/parser/yacc.y"
+                 { // 块语句
+        yylhs.value.as < FE::AST::StmtNode* > () = yystack_[0].value.as < FE::AST::StmtNode* > ();
+    }
+#line 1209 "frontend/parser/yacc.cpp"
+    break;
+
+  case 20: // CONTINUE_STMT: CONTINUE SEMICOLON
+#line 237 "frontend/parser/yacc.y"
+                       {
+        yylhs.value.as < FE::AST::StmtNode* > () = parser.make<ContinueStmt>(yystack_[1].location.begin.line, yystack_[1].location.begin.column);
+    }
+#line 1217 "frontend/parser/yacc.cpp"
+    break;
+
+  case 21: // EXPR_STMT: EXPR SEMICOLON
+#line 244 "frontend/parser/yacc.y"
+                   {
+        yylhs.value.as < FE::AST::StmtNode* > () = parser.make<ExprStmt>(yystack_[1].value.as < FE::AST::ExprNode* > (), yystack_[1].location.begin.line, yystack_[1].location.begin.column);
+    }
+#line 1225 "frontend/parser/yacc.cpp"
+    break;
+
+  case 22: // VAR_DECLARATION: TYPE VAR_DECLARATOR_LIST
+#line 251 "frontend/parser/yacc.y"
+                             {
+        yylhs.value.as < FE::AST::VarDeclaration* > () = parser.make<VarDeclaration>(yystack_[1].value.as < FE::AST::Type* > (), yystack_[0].value.as < FE::AST::Span<FE::AST::VarDeclarator*>* > (), false, yystack_[1].location.begin.line, yystack_[1].location.begin.column);
+    }
+#line 1233 "frontend/parser/yacc.cpp"
+    break;
+
+  case 23: // VAR_DECLARATION: CONST TYPE VAR_DECLARATOR_LIST
+#line 254 "frontend/parser/yacc.y"
+                                     {
+        yylhs.value.as < FE::AST::VarDeclaration* > () = parser.make<VarDeclaration>(yystack_[1].value.as < FE::AST::Type* > (), yystack_[0].value.as < FE::AST::Span<FE::AST::VarDeclarator*>* > (), true, yystack_[2].location.begin.line, yystack_[2].location.begin.column);
+    }
+#line 1241 "frontend/parser/yacc.cpp"
+    break;
+
+  case 24: // VAR_DECL_STMT: VAR_DECLARATION SEMICOLON
+#line 263 "frontend/parser/yacc.y"
+                              {
+        yylhs.value.as < FE::AST::StmtNode* > () = parser.make<VarDeclStmt>(yystack_[1].value.as < FE::AST::VarDeclaration* > (), yystack_[1].location.begin.line, yystack_[1].location.begin.column);
+    }
+#line 1249 "frontend/parser/yacc.cpp"
+    break;
+
+  case 25: // FUNC_BODY: LBRACE RBRACE
+#line 270 "frontend/parser/yacc.y"
+                  {
+        yylhs.value.as < FE::AST::StmtNode* > () = nullptr;
+    }
+#line 1257 "frontend/parser/yacc.cpp"
+    break;
+
+  case 26: // FUNC_BODY: LBRACE STMT_LIST RBRACE
+#line 273 "frontend/parser/yacc.y"
+                              {
+        if (!yystack_[1].value.as < FE::AST::Span<FE::AST::StmtNode*>* > () || yystack_[1].value.as < FE::AST::Span<FE::AST::StmtNode*>* > ()->empty()) yylhs.value.as < FE::AST::StmtNode* > () = nullptr;
+        else if (yystack_[1].value.as < FE::AST::Span<FE::AST::StmtNode*>* > ()->size() == 1) yylhs.value.as < FE::AST::StmtNode* > () = (*yystack_[1].value.as < FE::AST::Span<FE::AST::StmtNode*>* > ())[0];
+        else yylhs.value.as < FE::AST::StmtNode* > () = parser.make<BlockStmt>(yystack_[1].value.as < FE::AST::Span<FE::AST::StmtNode*>* > (), yystack_[2].location.begin.line, yystack_[2].location.begin.column);
+    }
+#line 1267 "frontend/parser/yacc.cpp"
+    break;
+
+  case 27: // FUNC_DECL_STMT: TYPE IDENT LPAREN PARAM_DECLARATOR_LIST RPAREN FUNC_BODY
+#line 282 "frontend/parser/yacc.y"
+                                                             {
+        Entry* entry = Entry::getEntry(yystack_[4].value.as < std::string > ());
+        yylhs.value.as < FE::AST::StmtNode* > () = parser.make<FuncDeclStmt>(yystack_[5].value.as < FE::AST::Type* > (), entry, yystack_[2].value.as < FE::AST::Span<FE::AST::ParamDeclarator*>* > (), yystack_[0].value.as < FE::AST::StmtNode* > (), yystack_[5].location.begin.line, yystack_[5].location.begin.column);
+    }
+#line 1276 "frontend/parser/yacc.cpp"
+    break;
+
+  case 28: // FOR_STMT: FOR LPAREN VAR_DECLARATION SEMICOLON EXPR SEMICOLON EXPR RPAREN STMT
+#line 290 "frontend/parser/yacc.y"
+                                                                         {
+        VarDeclStmt* initStmt = parser.make<VarDeclStmt>(yystack_[6].value.as < FE::AST::VarDeclaration* > (), yystack_[6].location.begin.line, yystack_[6].location.begin.column);
+        yylhs.value.as < FE::AST::StmtNode* > () = parser.make<ForStmt>(initStmt, yystack_[4].value.as < FE::AST::ExprNode* > (), yystack_[2].value.as < FE::AST::ExprNode* > (), yystack_[0].value.as < FE::AST::StmtNode* > (), yystack_[8].location.begin.line, yystack_[8].location.begin.column);
+    }
+#line 1285 "frontend/parser/yacc.cpp"
+    break;
+
+  case 29: // FOR_STMT: FOR LPAREN EXPR SEMICOLON EXPR SEMICOLON EXPR RPAREN STMT
+#line 294 "frontend/parser/yacc.y"
+                                                                {
+        StmtNode* initStmt = parser.make<ExprStmt>(yystack_[6].value.as < FE::AST::ExprNode* > (), yystack_[6].value.as < FE::AST::ExprNode* > ()->line_num, yystack_[6].value.as < FE::AST::ExprNode* > ()->col_num);
+        yylhs.value.as < FE::AST::StmtNode* > () = parser.make<ForStmt>(initStmt, yystack_[4].value.as < FE::AST::ExprNode* > (), yystack_[2].value.as < FE::AST::ExprNode* > (), yystack_[0].value.as < FE::AST::StmtNode* > (), yystack_[8].location.begin.line, yystack_[8].location.begin.column);
+    }
+#line 1294 "frontend/parser/yacc.cpp"
+    break;
+
+  case 30: // IF_STMT: IF LPAREN EXPR RPAREN STMT
+#line 304 "frontend/parser/yacc.y"
+                                          { // 注意定义优先级
+        yylhs.value.as < FE::AST::StmtNode* > () = parser.make<IfStmt>(yystack_[2].value.as < FE::AST::ExprNode* > (), yystack_[0].value.as < FE::AST::StmtNode* > (), nullptr, yystack_[4].location.begin.line, yystack_[4].location.begin.column);
+    }
+#line 1302 "frontend/parser/yacc.cpp"
+    break;
+
+  case 31: // IF_STMT: IF LPAREN EXPR RPAREN STMT ELSE STMT
+#line 307 "frontend/parser/yacc.y"
+                                           {
+        yylhs.value.as < FE::AST::StmtNode* > () = parser.make<IfStmt>(yystack_[4].value.as < FE::AST::ExprNode* > (), yystack_[2].value.as < FE::AST::StmtNode* > (), yystack_[0].value.as < FE::AST::StmtNode* > (), yystack_[6].location.begin.line, yystack_[6].location.begin.column);
+    }
+#line 1310 "frontend/parser/yacc.cpp"
+    break;
+
+  case 32: // BREAK_STMT: BREAK SEMICOLON
+#line 316 "frontend/parser/yacc.y"
+                    {
+        yylhs.value.as < FE::AST::StmtNode* > () = parser.make<BreakStmt>(yystack_[1].location.begin.line, yystack_[1].location.begin.column);
+    }
+#line 1318 "frontend/parser/yacc.cpp"
+    break;
+
+  case 33: // RETURN_STMT: RETURN SEMICOLON
+#line 322 "frontend/parser/yacc.y"
+                     {  // 无返回值：return;
+        yylhs.value.as < FE::AST::StmtNode* > () = parser.make<ReturnStmt>(nullptr, yystack_[1].location.begin.line, yystack_[1].location.begin.column);
+    }
+#line 1326 "frontend/parser/yacc.cpp"
+    break;
+
+  case 34: // RETURN_STMT: RETURN EXPR SEMICOLON
+#line 325 "frontend/parser/yacc.y"
+                            {  // 有返回值：return expression;
+        yylhs.value.as < FE::AST::StmtNode* > () = parser.make<ReturnStmt>(yystack_[1].value.as < FE::AST::ExprNode* > (), yystack_[2].location.begin.line, yystack_[2].location.begin.column);
+    }
+#line 1334 "frontend/parser/yacc.cpp"
+    break;
+
+  case 35: // WHILE_STMT: WHILE LPAREN EXPR RPAREN STMT
+#line 332 "frontend/parser/yacc.y"
+                                  {
+        yylhs.value.as < FE::AST::StmtNode* > () = parser.make<WhileStmt>(yystack_[2].value.as < FE::AST::ExprNode* > (), yystack_[0].value.as < FE::AST::StmtNode* > (), yystack_[4].location.begin.line, yystack_[4].location.begin.column);
+    }
+#line 1342 "frontend/parser/yacc.cpp"
+    break;
+
+  case 36: // BLOCK_STMT: LBRACE STMT_LIST RBRACE
+#line 339 "frontend/parser/yacc.y"
+                            {
+        yylhs.value.as < FE::AST::StmtNode* > () = parser.make<BlockStmt>(yystack_[1].value.as < FE::AST::Span<FE::AST::StmtNode*>* > (), yystack_[2].location.begin.line, yystack_[2].location.begin.column);
+    }
+#line 1350 "frontend/parser/yacc.cpp"
+    break;
+
+  case 37: // BLOCK_STMT: LBRACE RBRACE
+#line 342 "frontend/parser/yacc.y"
+                    { // 空语句块
+        yylhs.value.as < FE::AST::StmtNode* > () = parser.make<BlockStmt>(parser.makeList<StmtNode*>(), yystack_[1].location.begin.line, yystack_[1].location.begin.column);
+    }
+#line 1358 "frontend/parser/yacc.cpp"
+    break;
+
+  case 38: // PARAM_DECLARATOR: TYPE IDENT
+#line 349 "frontend/parser/yacc.y"
+               {
+        Entry* entry = Entry::getEntry(yystack_[0].value.as < std::string > ());
+        yylhs.value.as < FE::AST::ParamDeclarator* > () = parser.make<ParamDeclarator>(yystack_[1].value.as < FE::AST::Type* > (), entry, nullptr, yystack_[1].location.begin.line, yystack_[1].location.begin.column);
+    }
+#line 1367 "frontend/parser/yacc.cpp"
+    break;
+
+  case 39: // PARAM_DECLARATOR: TYPE IDENT LBRACKET RBRACKET
+#line 353 "frontend/parser/yacc.y"
+                                   {
+        Span<ExprNode*>* dim = parser.makeList<ExprNode*>();
+        dim->push_back(parser.astArena, parser.make<LiteralExpr>(-1, yystack_[1].location.begin.line, yystack_[1].location.begin.column));
+        Entry* entry = Entry::getEntry(yystack_[2].value.as < std::string > ());
+        yylhs.value.as < FE::AST::ParamDeclarator* > () = parser.make<ParamDeclarator>(yystack_[3].value.as < FE::AST::Type* > (), entry, dim, yystack_[3].location.begin.line, yystack_[3].location.begin.column);
+    }
+#line 1378 "frontend/parser/yacc.cpp"
+    break;
+
+  case 40: // PARAM_DECLARATOR: TYPE IDENT LBRACKET RBRACKET ARRAY_DIMENSION_EXPR_LIST
+#line 361 "frontend/parser/yacc.y"
+                                                             {
+        Span<ExprNode*>* dim = yystack_[0].value.as < FE::AST::Span<FE::AST::ExprNode*>* > ();
+        dim->push_front(parser.astArena, parser.make<LiteralExpr>(-1, yystack_[2].location.begin.line, yystack_[2].location.begin.column));
+        Entry* entry = Entry::getEntry(yystack_[3].value.as < std::string > ());
+        yylhs.value.as < FE::AST::ParamDeclarator* > () = parser.make<ParamDeclarator>(yystack_[4].value.as < FE::AST::Type* > (), entry, dim, yystack_[4].location.begin.line, yystack_[4].location.begin.column);
+    }
+#line 1389 "frontend/parser/yacc.cpp"
+    break;
+
+  case 41: // PARAM_DECLARATOR: TYPE IDENT ARRAY_DIMENSION_EXPR_LIST
+#line 367 "frontend/parser/yacc.y"
+                                           {
+        Entry* entry = Entry::getEntry(yystack_[1].value.as < std::string > ());
+        yylhs.value.as < FE::AST::ParamDeclarator* > () = parser.make<ParamDeclarator>(yystack_[2].value.as < FE::AST::Type* > (), entry, yystack_[0].value.as < FE::AST::Span<FE::AST::ExprNode*>* > (), yystack_[2].location.begin.line, yystack_[2].location.begin.column);
+    }
+#line 1398 "frontend/parser/yacc.cpp"
+    break;
+
+  case 42: // PARAM_DECLARATOR_LIST: %empty
+#line 375 "frontend/parser/yacc.y"
+                {
+        yylhs.value.as < FE::AST::Span<FE::AST::ParamDeclarator*>* > () = parser.makeList<ParamDeclarator*>();
+    }
+#line 1406 "frontend/parser/yacc.cpp"
+    break;
+
+  case 43: // PARAM_DECLARATOR_LIST: PARAM_DECLARATOR
+#line 380 "frontend/parser/yacc.y"
+                       { // 形式1：单个参数
+        yylhs.value.as < FE::AST::Span<FE::AST::ParamDeclarator*>* > () = parser.makeList<ParamDeclarator*>();
+        yylhs.value.as < FE::AST::Span<FE::AST::ParamDeclarator*>* > ()->push_back(parser.astArena, yystack_[0].value.as < FE::AST::ParamDeclarator* > ());
+    }
+#line 1415 "frontend/parser/yacc.cpp"
+    break;
+
+  case 44: // PARAM_DECLARATOR_LIST: PARAM_DECLARATOR_LIST COMMA PARAM_DECLARATOR
+#line 384 "frontend/parser/yacc.y"
+                                                   { // 形式2：多个参数
+        yylhs.value.as < FE::AST::Span<FE::AST::ParamDeclarator*>* > () = yystack_[2].value.as < FE::AST::Span<FE::AST::ParamDeclarator*>* > ();
+        yylhs.value.as < FE::AST::Span<FE::AST::ParamDeclarator*>* > ()->push_back(parser.astArena, yystack_[0].value.as < FE::AST::ParamDeclarator* > ());
+    }
+#line 1424 "frontend/parser/yacc.cpp"
+    break;
+
+  case 45: // VAR_DECLARATOR: IDENT
+#line 395 "frontend/parser/yacc.y"
+          {
+        Entry* entry = Entry::getEntry(yystack_[0].value.as < std::string > ());
+        ExprNode* lval = parser.make<LeftValExpr>(entry, nullptr, yystack_[0].location.begin.line, yystack_[0].location.begin.column);
+        yylhs.value.as < FE::AST::VarDeclarator* > () = parser.make<VarDeclarator>(lval, nullptr, yystack_[0].location.begin.line, yystack_[0].location.begin.column);
+    }
+#line 1434 "frontend/parser/yacc.cpp"
+    break;
+
+  case 46: // VAR_DECLARATOR: IDENT ASSIGN INITIALIZER
+#line 402 "frontend/parser/yacc.y"
+                               {
+        Entry* entry = Entry::getEntry(yystack_[2].value.as < std::string > ());
+        ExprNode* lval = parser.make<LeftValExpr>(entry, nullptr, yystack_[2].location.begin.line, yystack_[2].location.begin.column);
+        yylhs.value.as < FE::AST::VarDeclarator* > () = parser.make<VarDeclarator>(lval, yystack_[0].value.as < FE::AST::InitDecl* > (), yystack_[2].location.begin.line, yystack_[2].location.begin.column);
+    }
+#line 1444 "frontend/parser/yacc.cpp"
+    break;
+
+  case 47: // VAR_DECLARATOR: IDENT ARRAY_DIMENSION_EXPR_LIST
+#line 409 "frontend/parser/yacc.y"
+                                      {
+        Entry* entry = Entry::getEntry(yystack_[1].value.as < std::string > ());
+        ExprNode* lval = parser.make<LeftValExpr>(entry, yystack_[0].value.as < FE::AST::Span<FE::AST::ExprNode*>* > (), yystack_[1].location.begin.line, yystack_[1].location.begin.column);
+        yylhs.value.as < FE::AST::VarDeclarator* > () = parser.make<VarDeclarator>(lval, nullptr, yystack_[1].location.begin.line, yystack_[1].location.begin.column);
+    }
+#line 1454 "frontend/parser/yacc.cpp"
+    break;
+
+  case 48: // VAR_DECLARATOR: IDENT ARRAY_DIMENSION_EXPR_LIST ASSIGN INITIALIZER
+#line 416 "frontend/parser/yacc.y"
+                                                         {
+        Entry* entry = Entry::getEntry(yystack_[3].value.as < std::string > ());
+        ExprNode* lval = parser.make<LeftValExpr>(entry, yystack_[2].value.as < FE::AST::Span<FE::AST::ExprNode*>* > (), yystack_[3].location.begin.line, yystack_[3].location.begin.column);
+        yylhs.value.as < FE::AST::VarDeclarator* > () = parser.make<VarDeclarator>(lval, yystack_[0].value.as < FE::AST::InitDecl* > (), yystack_[3].location.begin.line, yystack_[3].location.begin.column);
+    }
+#line 1464 "frontend/parser/yacc.cpp"
+    break;
+
+  case 49: // VAR_DECLARATOR: IDENT LBRACKET RBRACKET
+#line 423 "frontend/parser/yacc.y"
+                              {
+        Entry* entry = Entry::getEntry(yystack_[2].value.as < std::string > ());
+        ExprNode* lval = parser.make<LeftValExpr>(entry, nullptr, yystack_[2].location.begin.line, yystack_[2].location.begin.column);
+        yylhs.value.as < FE::AST::VarDeclarator* > () = parser.make<VarDeclarator>(lval, nullptr, yystack_[2].location.begin.line, yystack_[2].location.begin.column);
+    }
+#line 1474 "frontend/parser/yacc.cpp"
+    break;
+
+  case 50: // VAR_DECLARATOR: IDENT LBRACKET RBRACKET ARRAY_DIMENSION_EXPR_LIST
+#line 430 "frontend/parser/yacc.y"
+                                                        {
+        Entry* entry = Entry::getEntry(yystack_[3].value.as < std::string > ());
+        ExprNode* lval = parser.make<LeftValExpr>(entry, yystack_[0].value.as < FE::AST::Span<FE::AST::ExprNode*>* > (), yystack_[3].location.begin.line, yystack_[3].location.begin.column);
+        yylhs.value.as < FE::AST::VarDeclarator* > () = parser.make<VarDeclarator>(lval, nullptr, yystack_[3].location.begin.line, yystack_[3].location.begin.column);
+    }
+#line 1484 "frontend/parser/yacc.cpp"
+    break;
+
+  case 51: // VAR_DECLARATOR: IDENT LBRACKET RBRACKET ARRAY_DIMENSION_EXPR_LIST ASSIGN INITIALIZER
+#line 437 "frontend/parser/yacc.y"
+                                                                           {
+        Entry* entry = Entry::getEntry(yystack_[5].value.as < std::string > ());
+        ExprNode* lval = parser.make<LeftValExpr>(entry, yystack_[2].value.as < FE::AST::Span<FE::AST::ExprNode*>* > (), yystack_[5].location.begin.line, yystack_[5].location.begin.column);
+        yylhs.value.as < FE::AST::VarDeclarator* > () = parser.make<VarDeclarator>(lval, yystack_[0].value.as < FE::AST::InitDecl* > (), yystack_[5].location.begin.line, yystack_[5].location.begin.column);
+    }
+#line 1494 "frontend/parser/yacc.cpp"
+    break;
+
+  case 52: // VAR_DECLARATOR_LIST: VAR_DECLARATOR
+#line 446 "frontend/parser/yacc.y"
+                   {
+        yylhs.value.as < FE::AST::Span<FE::AST::VarDeclarator*>* > () = parser.makeList<VarDeclarator*>();
+        yylhs.value.as < FE::AST::Span<FE::AST::VarDeclarator*>* > ()->push_back(parser.astArena, yystack_[0].value.as < FE::AST::VarDeclarator* > ());
+    }
+#line 1503 "frontend/parser/yacc.cpp"
+    break;
+
+  case 53: // VAR_DECLARATOR_LIST: VAR_DECLARATOR_LIST COMMA VAR_DECLARATOR
+#line 450 "frontend/parser/yacc.y"
+                                               {
+        yylhs.value.as < FE::AST::Span<FE::AST::VarDeclarator*>* > () = yystack_[2].value.as < FE::AST::Span<FE::AST::VarDeclarator*>* > ();
+        yylhs.value.as < FE::AST::Span<FE::AST::VarDeclarator*>* > ()->push_back(parser.astArena, yystack_[0].value.as < FE::AST::VarDeclarator* > ());
+    }
+#line 1512 "frontend/parser/yacc.cpp"
+    break;
+
+  case 54: // INITIALIZER: NOCOMMA_EXPR
+#line 460 "frontend/parser/yacc.y"
+                 {
+        yylhs.value.as < FE::AST::InitDecl* > () = parser.make<Initializer>(yystack_[0].value.as < FE::AST::ExprNode* > (), yystack_[0].location.begin.line, yystack_[0].location.begin.column);
+    }
+#line 1520 "frontend/parser/yacc.cpp"
+    break;
+
+  case 55: // INITIALIZER: LBRACE INITIALIZER_LIST RBRACE
+#line 463 "frontend/parser/yacc.y"
+                                     {
+        yylhs.value.as < FE::AST::InitDecl* > () = parser.make<InitializerList>(yystack_[1].value.as < FE::AST::Span<FE::AST::InitDecl*>* > (), yystack_[2].location.begin.line, yystack_[2].location.begin.column);
+    }
+#line 1528 "frontend/parser/yacc.cpp"
+    break;
+
+  case 56: // INITIALIZER: LBRACE INITIALIZER_LIST COMMA RBRACE
+#line 467 "frontend/parser/yacc.y"
+                                           {
+        yylhs.value.as < FE::AST::InitDecl* > () = parser.make<InitializerList>(yystack_[2].value.as < FE::AST::Span<FE::AST::InitDecl*>* > (), yystack_[3].location.begin.line, yystack_[3].location.begin.column);
+    }
+#line 1536 "frontend/parser/yacc.cpp"
+    break;
+
+  case 57: // INITIALIZER: LBRACE RBRACE
+#line 470 "frontend/parser/yacc.y"
+                    {
+        // 空初始化列表 {}
+        yylhs.value.as < FE::AST::InitDecl* > () = parser.make<InitializerList>(parser.makeList<InitDecl*>(), yystack_[1].location.begin.line, yystack_[1].location.begin.column);
+    }
+#line 1545 "frontend/parser/yacc.cpp"
+    break;
+
+  case 58: // INITIALIZER_LIST: INITIALIZER
+#line 478 "frontend/parser/yacc.y"
+                {
+        yylhs.value.as < FE::AST::Span<FE::AST::InitDecl*>* > () = parser.makeList<InitDecl*>();
+        yylhs.value.as < FE::AST::Span<FE::AST::InitDecl*>* > ()->push_back(parser.astArena, yystack_[0].value.as < FE::AST::InitDecl* > ());
+    }
+#line 1554 "frontend/parser/yacc.cpp"
+    break;
+
+  case 59: // INITIALIZER_LIST: INITIALIZER_LIST COMMA INITIALIZER
+#line 482 "frontend/parser/yacc.y"
+                                         {
+        yylhs.value.as < FE::AST::Span<FE::AST::InitDecl*>* > () = yystack_[2].value.as < FE::AST::Span<FE::AST::InitDecl*>* > ();
+        yylhs.value.as < FE::AST::Span<FE::AST::InitDecl*>* > ()->push_back(parser.astArena, yystack_[0].value.as < FE::AST::InitDecl* > ());
+    }
+#line 1563 "frontend/parser/yacc.cpp"
+    break;
+
+  case 60: // ASSIGN_EXPR: LEFT_VAL_EXPR ASSIGN NOCOMMA_EXPR
+#line 492 "frontend/parser/yacc.y"
+                                      { // 左值表达式=右值表达式
+        yylhs.value.as < FE::AST::ExprNode* > () = parser.make<BinaryExpr>(Operator::ASSIGN, yystack_[2].value.as < FE::AST::ExprNode* > (), yystack_[0].value.as < FE::AST::ExprNode* > (), yystack_[1].location.begin.line, yystack_[1].location.begin.column);
+    }
+#line 1571 "frontend/parser/yacc.cpp"
+    break;
+
+  case 61: // EXPR_LIST: NOCOMMA_EXPR
+#line 499 "frontend/parser/yacc.y"
+                 {
+        yylhs.value.as < FE::AST::Span<FE::AST::ExprNode*>* > () = parser.makeList<ExprNode*>();
+        yylhs.value.as < FE::AST::Span<FE::AST::ExprNode*>* > ()->push_back(parser.astArena, yystack_[0].value.as < FE::AST::ExprNode* > ());
+    }
+#line 1580 "frontend/parser/yacc.cpp"
+    break;
+
+  case 62: // EXPR_LIST: EXPR_LIST COMMA NOCOMMA_EXPR
+#line 503 "frontend/parser/yacc.y"
+                                   {
+        yylhs.value.as < FE::AST::Span<FE::AST::ExprNode*>* > () = yystack_[2].value.as < FE::AST::Span<FE::AST::ExprNode*>* > ();
+        yylhs.value.as < FE::AST::Span<FE::AST::ExprNode*>* > ()->push_back(parser.astArena, yystack_[0].value.as < FE::AST::ExprNode* > ());
+    }
+#line 1589 "frontend/parser/yacc.cpp"
+    break;
+
+  case 63: // EXPR: NOCOMMA_EXPR
+#line 511 "frontend/parser/yacc.y"
+                 {
+        yylhs.value.as < FE::AST::ExprNode* > () = yystack_[0].value.as < FE::AST::ExprNode* > ();
+    }
+#line 1597 "frontend/parser/yacc.cpp"
+    break;
+
+  case 64: // EXPR: EXPR COMMA NOCOMMA_EXPR
+#line 514 "frontend/parser/yacc.y"
+                              {
+        if (yystack_[2].value.as < FE::AST::ExprNode* > ()->isCommaExpr()) {
+            CommaExpr* ce = static_cast<CommaExpr*>(yystack_[2].value.as < FE::AST::ExprNode* > ());
+            ce->exprs->push_back(parser.astArena, yystack_[0].value.as < FE::AST::ExprNode* > ());
+            yylhs.value.as < FE::AST::ExprNode* > () = ce;
+        } else {
+            auto vec = parser.makeList<ExprNode*>();
+            vec->push_back(parser.astArena, yystack_[2].value.as < FE::AST::ExprNode* > ());
+            vec->push_back(parser.astArena, yystack_[0].value.as < FE::AST::ExprNode* > ());
+            yylhs.value.as < FE::AST::ExprNode* > () = parser.make<CommaExpr>(vec, yystack_[2].value.as < FE::AST::ExprNode* > ()->line_num, yystack_[2].value.as < FE::AST::ExprNode* > ()->col_num);
+        }
+    }
+#line 1614 "frontend/parser/yacc.cpp"
+    break;
+
+  case 65: // NOCOMMA_EXPR: LOGICAL_OR_EXPR
+#line 530 "frontend/parser/yacc.y"
+                    {
+        yylhs.value.as < FE::AST::ExprNode* > () = yystack_[0].value.as < FE::AST::ExprNode* > ();
+    }
+#line 1622 "frontend/parser/yacc.cpp"
+    break;
+
+  case 66: // NOCOMMA_EXPR: ASSIGN_EXPR
+#line 533 "frontend/parser/yacc.y"
+                  {
+        yylhs.value.as < FE::AST::ExprNode* > () = yystack_[0].value.as < FE::AST::ExprNode* > ();
+    }
+#line 1630 "frontend/parser/yacc.cpp"
+    break;
+
+  case 67: // LOGICAL_OR_EXPR: LOGICAL_AND_EXPR
+#line 542 "frontend/parser/yacc.y"
+                     {
+        yylhs.value.as < FE::AST::ExprNode* > () = yystack_[0].value.as < FE::AST::ExprNode* > ();
+    }
+#line 1638 "frontend/parser/yacc.cpp"
+    break;
+
+  case 68: // LOGICAL_OR_EXPR: LOGICAL_OR_EXPR OR LOGICAL_AND_EXPR
+#line 545 "frontend/parser/yacc.y"
+                                          {
+    yylhs.value.as < FE::AST::ExprNode* > () = parser.make<BinaryExpr>(Operator::OR, yystack_[2].value.as < FE::AST::ExprNode* > (), yystack_[0].value.as < FE::AST::ExprNode* > (), yystack_[1].location.begin.line, yystack_[1].location.begin.column);
+    }
+#line 1646 "frontend/parser/yacc.cpp"
+    break;
+
+  case 69: // LOGICAL_AND_EXPR: EQUALITY_EXPR
+#line 554 "frontend/parser/yacc.y"
+                  {
+        yylhs.value.as < FE::AST::ExprNode* > () = yystack_[0].value.as < FE::AST::ExprNode* > ();
+    }
+#line 1654 "frontend/parser/yacc.cpp"
+    break;
+
+  case 70: // LOGICAL_AND_EXPR: LOGICAL_AND_EXPR AND EQUALITY_EXPR
+#line 557 "frontend/parser/yacc.y"
+                                         {
+    yylhs.value.as < FE::AST::ExprNode* > () = parser.make<BinaryExpr>(Operator::AND, yystack_[2].value.as < FE::AST::ExprNode* > (), yystack_[0].value.as < FE::AST::ExprNode* > (), yystack_[1].location.begin.line, yystack_[1].location.begin.column);
+    }
+#line 1662 "frontend/parser/yacc.cpp"
+    break;
+
+  case 71: // EQUALITY_EXPR: RELATIONAL_EXPR
+#line 566 "frontend/parser/yacc.y"
+                    {
+        yylhs.value.as < FE::AST::ExprNode* > () = yystack_[0].value.as < FE::AST::ExprNode* > ();
+    }
+#line 1670 "frontend/parser/yacc.cpp"
+    break;
+
+  case 72: // EQUALITY_EXPR: EQUALITY_EXPR EQ RELATIONAL_EXPR
+#line 569 "frontend/parser/yacc.y"
+                                       {
+    yylhs.value.as < FE::AST::ExprNode* > () = parser.make<BinaryExpr>(Operator::EQ, yystack_[2].value.as < FE::AST::ExprNode* > (), yystack_[0].value.as < FE::AST::ExprNode* > (), yystack_[1].location.begin.line, yystack_[1].location.begin.column);
+    }
+#line 1678 "frontend/parser/yacc.cpp"
+    break;
+
+  case 73: // EQUALITY_EXPR: EQUALITY_EXPR NEQ RELATIONAL_EXPR
+#line 572 "frontend/parser/yacc.y"
+                                        {
+    yylhs.value.as < FE::AST::ExprNode* > () = parser.make<BinaryExpr>(Operator::NEQ, yystack_[2].value.as < FE::AST::ExprNode* > (), yystack_[0].value.as < FE::AST::ExprNode* > (), yystack_[1].location.begin.line, yystack_[1].location.begin.column);
+    }
+#line 1686 "frontend/parser/yacc.cpp"
+    break;
+
+  case 74: // RELATIONAL_EXPR: ADDSUB_EXPR
+#line 581 "frontend/parser/yacc.y"
+               {
+        yylhs.value.as < FE::AST::ExprNode* > ()=yystack_[0].value.as < FE::AST::ExprNode* > ();
+    }
+#line 1694 "frontend/parser/yacc.cpp"
+    break;
+
+  case 75: // RELATIONAL_EXPR: RELATIONAL_EXPR LT ADDSUB_EXPR
+#line 585 "frontend/parser/yacc.y"
+                                     {
+        // < (小于)
+        yylhs.value.as < FE::AST::ExprNode* > () = parser.make<BinaryExpr>(Operator::LT, yystack_[2].value.as < FE::AST::ExprNode* > (), yystack_[0].value.as < FE::AST::ExprNode* > (), yystack_[1].location.begin.line, yystack_[1].location.begin.column);
+    }
+#line 1703 "frontend/parser/yacc.cpp"
+    break;
+
+  case 76: // RELATIONAL_EXPR: RELATIONAL_EXPR GT ADDSUB_EXPR
+#line 589 "frontend/parser/yacc.y"
+                                     {
+        // > (大于)
+        yylhs.value.as < FE::AST::ExprNode* > () = parser.make<BinaryExpr>(Operator::GT, yystack_[2].value.as < FE::AST::ExprNode* > (), yystack_[0].value.as < FE::AST::ExprNode* > (), yystack_[1].location.begin.line, yystack_[1].location.begin.column);
+    }
+#line 1712 "frontend/parser/yacc.cpp"
+    break;
+
+  case 77: // RELATIONAL_EXPR: RELATIONAL_EXPR LE ADDSUB_EXPR
+#line 593 "frontend/parser/yacc.y"
+                                     {
+        // <= (小于等于)
+        yylhs.value.as < FE::AST::ExprNode* > () = parser.make<BinaryExpr>(Operator::LE, yystack_[2].value.as < FE::AST::ExprNode* > (), yystack_[0].value.as < FE::AST::ExprNode* > (), yystack_[1].location.begin.line, yystack_[1].location.begin.column);
+    }
+#line 1721 "frontend/parser/yacc.cpp"
+    break;
+
+  case 78: // RELATIONAL_EXPR: RELATIONAL_EXPR GE ADDSUB_EXPR
+#line 597 "frontend/parser/yacc.y"
+                                     {
+        // >= (大于等于)
+        yylhs.value.as < FE::AST::ExprNode* > () = parser.make<BinaryExpr>(Operator::GE, yystack_[2].value.as < FE::AST::ExprNode* > (), yystack_[0].value.as < FE::AST::ExprNode* > (), yystack_[1].location.begin.line, yystack_[1].location.begin.column);
+    }
+#line 1730 "frontend/parser/yacc.cpp"
+    break;
+
+  case 79: // ADDSUB_EXPR: MULDIV_EXPR
+#line 609 "frontend/parser/yacc.y"
+               {
+        yylhs.value.as < FE::AST::ExprNode* > ()=yystack_[0].value.as < FE::AST::ExprNode* > ();
+    }
+#line 1738 "frontend/parser/yacc.cpp"
+    break;
+
+  case 80: // ADDSUB_EXPR: ADDSUB_EXPR PLUS MULDIV_EXPR
+#line 612 "frontend/parser/yacc.y"
+                                  {
+        yylhs.value.as < FE::AST::ExprNode* > ()=parser.make<BinaryExpr>(Operator::ADD, yystack_[2].value.as < FE::AST::ExprNode* > (), yystack_[0].value.as < FE::AST::ExprNode* > (), yystack_[1].location.begin.line, yystack_[1].location.begin.column);
+    }
+#line 1746 "frontend/parser/yacc.cpp"
+    break;
+
+  case 81: // ADDSUB_EXPR: ADDSUB_EXPR MINUS MULDIV_EXPR
+#line 615 "frontend/parser/yacc.y"
+                                   {
+        yylhs.value.as < FE::AST::ExprNode* > ()=parser.make<BinaryExpr>(Operator::SUB, yystack_[2].value.as < FE::AST::ExprNode* > (), yystack_[0].value.as < FE::AST::ExprNode* > (), yystack_[1].location.begin.line, yystack_[1].location.begin.column);
+    }
+#line 1754 "frontend/parser/yacc.cpp"
+    break;
+
+  case 82: // MULDIV_EXPR: UNARY_EXPR
+#line 624 "frontend/parser/yacc.y"
+              {
+        yylhs.value.as < FE::AST::ExprNode* > ()=yystack_[0].value.as < FE::AST::ExprNode* > ();
+    }
+#line 1762 "frontend/parser/yacc.cpp"
+    break;
+
+  case 83: // MULDIV_EXPR: MULDIV_EXPR STAR UNARY_EXPR
+#line 627 "frontend/parser/yacc.y"
+                                  {
+        yylhs.value.as < FE::AST::ExprNode* > () = parser.make<BinaryExpr>(Operator::MUL, yystack_[2].value.as < FE::AST::ExprNode* > (), yystack_[0].value.as < FE::AST::ExprNode* > (), yystack_[1].location.begin.line, yystack_[1].location.begin.column);
+    }
+#line 1770 "frontend/parser/yacc.cpp"
+    break;
+
+  case 84: // MULDIV_EXPR: MULDIV_EXPR SLASH UNARY_EXPR
+#line 630 "frontend/parser/yacc.y"
+                                   {
+        yylhs.value.as < FE::AST::ExprNode* > () = parser.make<BinaryExpr>(Operator::DIV, yystack_[2].value.as < FE::AST::ExprNode* > (), yystack_[0].value.as < FE::AST::ExprNode* > (), yystack_[1].location.begin.line, yystack_[1].location.begin.column);
+    }
+#line 1778 "frontend/parser/yacc.cpp"
+    break;
+
+  case 85: // MULDIV_EXPR: MULDIV_EXPR PERCENT UNARY_EXPR
+#line 633 "frontend/parser/yacc.y"
+                                     {
+        yylhs.value.as < FE::AST::ExprNode* > () = parser.make<BinaryExpr>(Operator::MOD, yystack_[2].value.as < FE::AST::ExprNode* > (), yystack_[0].value.as < FE::AST::ExprNode* > (), yystack_[1].location.begin.line, yystack_[1].location.begin.column);
+    }
+#line 1786 "frontend/parser/yacc.cpp"
+    break;
+
+  case 86: // UNARY_EXPR: BASIC_EXPR
+#line 639 "frontend/parser/yacc.y"
+               {
+        yylhs.value.as < FE::AST::ExprNode* > () = yystack_[0].value.as < FE::AST::ExprNode* > ();
+    }
+#line 1794 "frontend/parser/yacc.cpp"
+    break;
+
+  case 87: // UNARY_EXPR: UNARY_OP UNARY_EXPR
+#line 642 "frontend/parser/yacc.y"
+                          {
+        yylhs.value.as < FE::AST::ExprNode* > () = parser.make<UnaryExpr>(yystack_[1].value.as < FE::AST::Operator > (), yystack_[0].value.as < FE::AST::ExprNode* > (), yystack_[0].value.as < FE::AST::ExprNode* > ()->line_num, yystack_[0].value.as < FE::AST::ExprNode* > ()->col_num);
+    }
+#line 1802 "frontend/parser/yacc.cpp"
+    break;
+
+  case 88: // BASIC_EXPR: LITERAL_EXPR
+#line 648 "frontend/parser/yacc.y"
+                 {
+        yylhs.value.as < FE::AST::ExprNode* > () = yystack_[0].value.as < FE::AST::ExprNode* > ();
+    }
+#line 1810 "frontend/parser/yacc.cpp"
+    break;
+
+  case 89: // BASIC_EXPR: LEFT_VAL_EXPR
+#line 651 "frontend/parser/yacc.y"
+                    {
+        yylhs.value.as < FE::AST::ExprNode* > () = yystack_[0].value.as < FE::AST::ExprNode* > ();
+    }
+#line 1818 "frontend/parser/yacc.cpp"
+    break;
+
+  case 90: // BASIC_EXPR: LPAREN EXPR RPAREN
+#line 654 "frontend/parser/yacc.y"
+                         {
+        yylhs.value.as < FE::AST::ExprNode* > () = yystack_[1].value.as < FE::AST::ExprNode* > ();
+    }
+#line 1826 "frontend/parser/yacc.cpp"
+    break;
+
+  case 91: // BASIC_EXPR: FUNC_CALL_EXPR
+#line 657 "frontend/parser/yacc.y"
+                     {
+        yylhs.value.as < FE::AST::ExprNode* > () = yystack_[0].value.as < FE::AST::ExprNode* > ();
+    }
+#line 1834 "frontend/parser/yacc.cpp"
+    break;
+
+  case 92: // FUNC_CALL_EXPR: IDENT LPAREN RPAREN
+#line 663 "frontend/parser/yacc.y"
+                        {//无参数函数调用
+        std::string funcName = yystack_[2].value.as < std::string > ();
+        if (funcName != "starttime" && funcName != "stoptime")
+        {
+            //普通函数调用
+            Entry* entry = Entry::getEntry(funcName);
+            yylhs.value.as < FE::AST::ExprNode* > () = parser.make<CallExpr>(entry, nullptr, yystack_[2].location.begin.line, yystack_[2].location.begin.column);
+        }
+        else
+        {   
+            //特殊系统函数处理 
+            funcName = "_sysy_" + funcName;
+            Span<ExprNode*>* args = parser.makeList<ExprNode*>();
+            //自动添加行号作为参数
+            args->push_back(parser.astArena, parser.make<LiteralExpr>(static_cast<int>(yystack_[2].location.begin.line), yystack_[2].location.begin.line, yystack_[2].location.begin.column));
+            yylhs.value.as < FE::AST::ExprNode* > () = parser.make<CallExpr>(Entry::getEntry(funcName), args, yystack_[2].location.begin.line, yystack_[2].location.begin.column);
+        }
+    }
+#line 1857 "frontend/parser/yacc.cpp"
+    break;
+
+  case 93: // FUNC_CALL_EXPR: IDENT LPAREN EXPR_LIST RPAREN
+#line 681 "frontend/parser/yacc.y"
+                                    {//有参数函数调用
+        Entry* entry = Entry::getEntry(yystack_[3].value.as < std::string > ());
+        yylhs.value.as < FE::AST::ExprNode* > () = parser.make<CallExpr>(entry, yystack_[1].value.as < FE::AST::Span<FE::AST::ExprNode*>* > (), yystack_[3].location.begin.line, yystack_[3].location.begin.column);
+    }
+#line 1866 "frontend/parser/yacc.cpp"
+    break;
+
+  case 94: // ARRAY_DIMENSION_EXPR: LBRACKET NOCOMMA_EXPR RBRACKET
+#line 689 "frontend/parser/yacc.y"
+                                   {
+        yylhs.value.as < FE::AST::ExprNode* > () = yystack_[1].value.as < FE::AST::ExprNode* > ();
+    }
+#line 1874 "frontend/parser/yacc.cpp"
+    break;
+
+  case 95: // ARRAY_DIMENSION_EXPR_LIST: ARRAY_DIMENSION_EXPR
+#line 699 "frontend/parser/yacc.y"
+                         {
+        // 创建表达式列表
+        auto* list = parser.makeList<ExprNode*>();
+        list->push_back(parser.astArena, yystack_[0].value.as < FE::AST::ExprNode* > ());
+        yylhs.value.as < FE::AST::Span<FE::AST::ExprNode*>* > () = list;
+    }
+#line 1885 "frontend/parser/yacc.cpp"
+    break;
+
+  case 96: // ARRAY_DIMENSION_EXPR_LIST: ARRAY_DIMENSION_EXPR_LIST ARRAY_DIMENSION_EXPR
+#line 705 "frontend/parser/yacc.y"
+                                                     {
+        yystack_[1].value.as < FE::AST::Span<FE::AST::ExprNode*>* > ()->push_back(parser.astArena, yystack_[0].value.as < FE::AST::ExprNode* > ());
+        yylhs.value.as < FE::AST::Span<FE::AST::ExprNode*>* > () = yystack_[1].value.as < FE::AST::Span<FE::AST::ExprNode*>* > ();
+    }
+#line 1894 "frontend/parser/yacc.cpp"
+    break;
+
+  case 97: // LEFT_VAL_EXPR: IDENT
+#line 713 "frontend/parser/yacc.y"
+          {
+        Entry* entry = Entry::getEntry(yystack_[0].value.as < std::string > ());
+        yylhs.value.as < FE::AST::ExprNode* > () = parser.make<LeftValExpr>(entry, nullptr, yystack_[0].location.begin.line, yystack_[0].location.begin.column);
+    }
+#line 1903 "frontend/parser/yacc.cpp"
+    break;
+
+  case 98: // LEFT_VAL_EXPR: IDENT ARRAY_DIMENSION_EXPR_LIST
+#line 717 "frontend/parser/yacc.y"
+                                      {
+        Entry* entry = Entry::getEntry(yystack_[1].value.as < std::string > ());
+        yylhs.value.as < FE::AST::ExprNode* > () = parser.make<LeftValExpr>(entry, yystack_[0].value.as < FE::AST::Span<FE::AST::ExprNode*>* > (), yystack_[1].location.begin.line, yystack_[1].location.begin.column);
+    }
+#line 1912 "frontend/parser/yacc.cpp"
+    break;
+
+  case 99: // LITERAL_EXPR: INT_CONST
+#line 725 "frontend/parser/yacc.y"
+              {//整型常量
+        yylhs.value.as < FE::AST::ExprNode* > () = parser.make<LiteralExpr>(yystack_[0].value.as < int > (), yystack_[0].location.begin.line, yystack_[0].location.begin.column);
+    }
+#line 1920 "frontend/parser/yacc.cpp"
+    break;
+
+  case 100: // LITERAL_EXPR: LL_CONST
+#line 731 "frontend/parser/yacc.y"
+               {
+        // $1 的类型为 long long
+        yylhs.value.as < FE::AST::ExprNode* > () = parser.make<LiteralExpr>(yystack_[0].value.as < long long > (), yystack_[0].location.begin.line, yystack_[0].location.begin.column);
+    }
+#line 1929 "frontend/parser/yacc.cpp"
+    break;
+
+  case 101: // LITERAL_EXPR: FLOAT_CONST
+#line 735 "frontend/parser/yacc.y"
+                  {
+        // 浮点数常量 (例如: 3.14)
+        yylhs.value.as < FE::AST::ExprNode* > () = parser.make<LiteralExpr>(yystack_[0].value.as < float > (), yystack_[0].location.begin.line, yystack_[0].location.begin.column);
+    }
+#line 1938 "frontend/parser/yacc.cpp"
+    break;
+
+  case 102: // TYPE: INT
+#line 746 "frontend/parser/yacc.y"
+        {
+        yylhs.value.as < FE::AST::Type* > () = intType; 
+    }
+#line 1946 "frontend/parser/yacc.cpp"
+    break;
+
+  case 103: // TYPE: FLOAT
+#line 750 "frontend/parser/yacc.y"
+            {
+        yylhs.value.as < FE::AST::Type* > () = floatType;
+    }
+#line 1954 "frontend/parser/yacc.cpp"
+    break;
+
+  case 104: // TYPE: VOID
+#line 754 "frontend/parser/yacc.y"
+           {
+        yylhs.value.as < FE::AST::Type* > () = voidType;
+    }
+#line 1962 "frontend/parser/yacc.cpp"
+    break;
+
+  case 105: // TYPE: LONG_LONG
+#line 758 "frontend/parser/yacc.y"
+                {
+        yylhs.value.as < FE::AST::Type* > () = llType;
+    }
+#line 1970 "frontend/parser/yacc.cpp"
+    break;
+
+  case 106: // UNARY_OP: PLUS
+#line 768 "frontend/parser/yacc.y"
+         { yylhs.value.as < FE::AST::Operator > () = Operator::ADD; }
+#line 1976 "frontend/parser/yacc.cpp"
+    break;
+
+  case 107: // UNARY_OP: MINUS
+#line 769 "frontend/parser/yacc.y"
+            { yylhs.value.as < FE::AST::Operator > () = Operator::SUB; }
+#line 1982 "frontend/parser/yacc.cpp"
+    break;
+
+  case 108: // UNARY_OP: NOT
+#line 770 "frontend/parser/yacc.y"
+          { yylhs.value.as < FE::AST::Operator > () = Operator::NOT; }
+#line 1988 "frontend/parser/yacc.cpp"
+    break;
+
+
+#line 1992 "frontend/parser/yacc.cpp"
+
+            default:
+              break;
+            }
+        }
+#if YY_EXCEPTIONS
+      catch (const syntax_error& yyexc)
+        {
+          YYCDEBUG << "Caught exception: " << yyexc.what() << '\n';
+          error (yyexc);
+          YYERROR;
+        }
+#endif // YY_EXCEPTIONS
+      YY_SYMBOL_PRINT ("-> $$ =", yylhs);
+      yypop_ (yylen);
+      yylen = 0;
+
+      // Shift the result of the reduction.
+      yypush_ (YY_NULLPTR, YY_MOVE (yylhs));
+    }
+    goto yynewstate;
+
+
+  /*--------------------------------------.
+  | yyerrlab -- here on detecting error.  |
+  `--------------------------------------*/
+  yyerrlab:
+    // If not already recovering from an error, report this error.
+    if (!yyerrstatus_)
+      {
+        ++yynerrs_;
+        context yyctx (*this, yyla);
+        std::string msg = yysyntax_error_ (yyctx);
+        error (yyla.location, YY_MOVE (msg));
+      }
+
+
+    yyerror_range[1].location = yyla.location;
+    if (yyerrstatus_ == 3)
+      {
+        /* If just tried and failed to reuse lookahead token after an
+           error, discard it.  */
+
+        // Return failure if at end of input.
+        if (yyla.kind () == symbol_kind::S_YYEOF)
+          YYABORT;
+        else if (!yyla.empty ())
+          {
+            yy_destroy_ ("Error: discarding", yyla);
+            yyla.clear ();
+          }
+      }
+
+    // Else will try to reuse lookahead token after shifting the error token.
+    goto yyerrlab1;
+
+
+  /*---------------------------------------------------.
+  | yyerrorlab -- error raised explicitly by YYERROR.  |
+  `---------------------------------------------------*/
+  yyerrorlab:
+    /* Pacify compilers when the user code never invokes YYERROR and
+       the label yyerrorlab therefore never appears in user code.  */
+    if (false)
+      YYERROR;
+
+    /* Do not reclaim the symbols of the rule whose action triggered
+       this YYERROR.  */
+    yypop_ (yylen);
+    yylen = 0;
+    YY_STACK_PRINT ();
+    goto yyerrlab1;
+
+
+  /*-------------------------------------------------------------.
+  | yyerrlab1 -- common code for both syntax error and YYERROR.  |
+  `-------------------------------------------------------------*/
+  yyerrlab1:
+    yyerrstatus_ = 3;   // Each real token shifted decrements this.
+    // Pop stack until we find a state that shifts the error token.
+    for (;;)
+      {
+        yyn = yypact_[+yystack_[0].state];
+        if (!yy_pact_value_is_default_ (yyn))
+          {
+            yyn += symbol_kind::S_YYerror;
+            if (0 <= yyn && yyn <= yylast_
+                && yycheck_[yyn] == symbol_kind::S_YYerror)
+              {
+                yyn = yytable_[yyn];
+                if (0 < yyn)
+                  break;
+              }
+          }
+
+        // Pop the current state because it cannot handle the error token.
+        if (yystack_.size () == 1)
+          YYABORT;
+
+        yyerror_range[1].location = yystack_[0].location;
+        yy_destroy_ ("Error: popping", yystack_[0]);
+        yypop_ ();
+        YY_STACK_PRINT ();
+      }
+    {
+      stack_symbol_type error_token;
+
+      yyerror_range[2].location = yyla.location;
+      YYLLOC_DEFAULT (error_token.location, yyerror_range, 2);
+
+      // Shift the error token.
+      error_token.state = state_type (yyn);
+      yypush_ ("Shifting", YY_MOVE (error_token));
+    }
+    goto yynewstate;
+
+
+  /*-------------------------------------.
+  | yyacceptlab -- YYACCEPT comes here.  |
+  `-------------------------------------*/
+  yyacceptlab:
+    yyresult = 0;
+    goto yyreturn;
+
+
+  /*-----------------------------------.
+  | yyabortlab -- YYABORT comes here.  |
+  `-----------------------------------*/
+  yyabortlab:
+    yyresult = 1;
+    goto yyreturn;
+
+
+  /*-----------------------------------------------------.
+  | yyreturn -- parsing is finished, return the result.  |
+  `-----------------------------------------------------*/
+  yyreturn:
+    if (!yyla.empty ())
+      yy_destroy_ ("Cleanup: discarding lookahead", yyla);
+
+    /* Do not reclaim the symbols of the rule whose action triggered
+       this YYABORT or YYACCEPT.  */
+    yypop_ (yylen);
+    YY_STACK_PRINT ();
+    while (1 < yystack_.size ())
+      {
+        yy_destroy_ ("Cleanup: popping", yystack_[0]);
+        yypop_ ();
+      }
+
+    return yyresult;
+  }
+#if YY_EXCEPTIONS
+    catch (...)
+      {
+        YYCDEBUG << "Exception caught: cleaning lookahead and stack\n";
+        // Do not try to display the values of the reclaimed symbols,
+        // as their printers might throw an exception.
+        if (!yyla.empty ())
+          yy_destroy_ (YY_NULLPTR, yyla);
+
+        while (1 < yystack_.size ())
+          {
+            yy_destroy_ (YY_NULLPTR, yystack_[0]);
+            yypop_ ();
+          }
+        throw;
+      }
+#endif // YY_EXCEPTIONS
+  }
+
+  void
+   YaccParser ::error (const syntax_error& yyexc)
+  {
+    error (yyexc.location, yyexc.what ());
+  }
+
+  /* Return YYSTR after stripping away unnecessary quotes and
+     backslashes, so that it's suitable for yyerror.  The heuristic is
+     that double-quoting is unnecessary unless the string contains an
+     apostrophe, a comma, or backslash (other than backslash-backslash).
+     YYSTR is taken from yytname.  */
+  std::string
+   YaccParser ::yytnamerr_ (const char *yystr)
+  {
+    if (*yystr == '"')
+      {
+        std::string yyr;
+        char const *yyp = yystr;
+
+        for (;;)
+          switch (*++yyp)
+            {
+            case '\'':
+            case ',':
+              goto do_not_strip_quotes;
+
+            case '\\':
+              if (*++yyp != '\\')
+                goto do_not_strip_quotes;
+              else
+                goto append;
+
+            append:
+            default:
+              yyr += *yyp;
+              break;
+
+            case '"':
+              return yyr;
+            }
+      do_not_strip_quotes: ;
+      }
+
+    return yystr;
+  }
+
+  std::string
+   YaccParser ::symbol_name (symbol_kind_type yysymbol)
+  {
+    return yytnamerr_ (yytname_[yysymbol]);
+  }
+
+
+
+  //  YaccParser ::context.
+   YaccParser ::context::context (const  YaccParser & yyparser, const symbol_type& yyla)
+    : yyparser_ (yyparser)
+    , yyla_ (yyla)
+  {}
+
+  int
+   YaccParser ::context::expected_tokens (symbol_kind_type yyarg[], int yyargn) const
+  {
+    // Actual number of expected tokens
+    int yycount = 0;
+
+    const int yyn = yypact_[+yyparser_.yystack_[0].state];
+    if (!yy_pact_value_is_default_ (yyn))
+      {
+        /* Start YYX at -YYN if negative to avoid negative indexes in
+           YYCHECK.  In other words, skip the first -YYN actions for
+           this state because they are default actions.  */
+        const int yyxbegin = yyn < 0 ? -yyn : 0;
+        // Stay within bounds of both yycheck and yytname.
+        const int yychecklim = yylast_ - yyn + 1;
+        const int yyxend = yychecklim < YYNTOKENS ? yychecklim : YYNTOKENS;
+        for (int yyx = yyxbegin; yyx < yyxend; ++yyx)
+          if (yycheck_[yyx + yyn] == yyx && yyx != symbol_kind::S_YYerror
+              && !yy_table_value_is_error_ (yytable_[yyx + yyn]))
+            {
+              if (!yyarg)
+                ++yycount;
+              else if (yycount == yyargn)
+                return 0;
+              else
+                yyarg[yycount++] = YY_CAST (symbol_kind_type, yyx);
+            }
+      }
+
+    if (yyarg && yycount == 0 && 0 < yyargn)
+      yyarg[0] = symbol_kind::S_YYEMPTY;
+    return yycount;
+  }
+
+
+
+
+
+
+  int
+   YaccParser ::yy_syntax_error_arguments_ (const context& yyctx,
+                                                 symbol_kind_type yyarg[], int yyargn) const
+  {
+    /* There are many possibilities here to consider:
+       - If this state is a consistent state with a default action, then
+         the only way this function was invoked is if the default action
+         is an error action.  In that case, don't check for expected
+         tokens because there are none.
+       - The only way there can be no lookahead present (in yyla) is
+         if this state is a consistent state with a default action.
+         Thus, detecting the absence of a lookahead is sufficient to
+         determine that there is no unexpected or expected token to
+         report.  In that case, just report a simple "syntax error".
+       - Don't assume there isn't a lookahead just because this state is
+         a consistent state with a default action.  There might have
+         been a previous inconsistent state, consistent state with a
+         non-default action, or user semantic action that manipulated
+         yyla.  (However, yyla is currently not documented for users.)
+       - Of course, the expected token list depends on states to have
+         correct lookahead information, and it depends on the parser not
+         to perform extra reductions after fetching a lookahead from the
+         scanner and before detecting a syntax error.  Thus, state merging
+         (from LALR or IELR) and default reductions corrupt the expected
+         token list.  However, the list is correct for canonical LR with
+         one exception: it will still contain any token that will not be
+         accepted due to an error action in a later state.
+    */
+
+    if (!yyctx.lookahead ().empty ())
+      {
+        if (yyarg)
+          yyarg[0] = yyctx.token ();
+        int yyn = yyctx.expected_tokens (yyarg ? yyarg + 1 : yyarg, yyargn - 1);
+        return yyn + 1;
+      }
+    return 0;
+  }
+
+  // Generate an error message.
+  std::string
+   YaccParser ::yysyntax_error_ (const context& yyctx) const
+  {
+    // Its maximum.
+    enum { YYARGS_MAX = 5 };
+    // Arguments of yyformat.
+    symbol_kind_type yyarg[YYARGS_MAX];
+    int yycount = yy_syntax_error_arguments_ (yyctx, yyarg, YYARGS_MAX);
+
+    char const* yyformat = YY_NULLPTR;
+    switch (yycount)
+      {
+#define YYCASE_(N, S)                         \
+        case N:                               \
+          yyformat = S;                       \
+        break
+      default: // Avoid compiler warnings.
+        YYCASE_ (0, YY_("syntax error"));
+        YYCASE_ (1, YY_("syntax error, unexpected %s"));
+        YYCASE_ (2, YY_("syntax error, unexpected %s, expecting %s"));
+        YYCASE_ (3, YY_("syntax error, unexpected %s, expecting %s or %s"));
+        YYCASE_ (4, YY_("syntax error, unexpected %s, expecting %s or %s or %s"));
+        YYCASE_ (5, YY_("syntax error, unexpected %s, expecting %s or %s or %s or %s"));
+#undef YYCASE_
+      }
+
+    std::string yyres;
+    // Argument number.
+    std::ptrdiff_t yyi = 0;
+    for (char const* yyp = yyformat; *yyp; ++yyp)
+      if (yyp[0] == '%' && yyp[1] == 's' && yyi < yycount)
+        {
+          yyres += symbol_name (yyarg[yyi++]);
+          ++yyp;
+        }
+      else
+        yyres += *yyp;
+    return yyres;
+  }
+
+
+  const signed char  YaccParser ::yypact_ninf_ = -107;
+
+  const signed char  YaccParser ::yytable_ninf_ = -1;
+
+  const short
+   YaccParser ::yypact_[] =
+  {
+     325,  -107,  -107,  -107,  -107,   -21,  -107,  -107,  -107,  -107,
+    -107,  -107,  -107,   -26,   -17,     5,     2,    20,   398,    39,
+    -107,   434,   157,     4,   325,  -107,  -107,  -107,    52,  -107,
+    -107,  -107,  -107,  -107,  -107,  -107,  -107,  -107,   -33,  -107,
+      30,    35,    27,    80,    59,    21,  -107,  -107,  -107,    76,
+    -107,    72,   434,   367,   434,  -107,    65,   434,   389,   434,
+    -107,  -107,  -107,    67,    91,   -15,  -107,   199,  -107,  -107,
+    -107,  -107,  -107,  -107,   434,   434,   434,   434,   434,   434,
+     434,   434,   434,   434,   434,   434,   434,   434,   434,    -7,
+    -107,    71,  -107,  -107,  -107,    31,  -107,    85,  -107,    37,
+      84,    79,    91,    41,  -107,    -6,    71,  -107,  -107,  -107,
+    -107,    35,    27,    80,    80,    59,    59,    59,    59,    21,
+      21,  -107,  -107,  -107,  -107,   211,    39,   253,    12,    91,
+     434,  -107,  -107,   325,   434,   434,   325,    11,  -107,  -107,
+    -107,    44,   119,    65,   211,  -107,  -107,   109,    81,    88,
+    -107,  -107,  -107,   -30,    39,    94,    97,    15,  -107,   325,
+     434,   434,    68,  -107,  -107,   241,  -107,   337,    65,   211,
+    -107,    48,    58,  -107,  -107,  -107,   283,    65,  -107,   325,
+     325,  -107,    65,  -107,  -107
+  };
+
+  const signed char
+   YaccParser ::yydefact_[] =
+  {
+       0,    99,   100,   101,    15,    97,   106,   107,   108,   102,
+     103,   104,   105,     0,     0,     0,     0,     0,     0,     0,
+      14,     0,     0,     0,     2,     4,    13,     8,     0,     9,
+      10,    11,    12,    16,    17,    18,    19,    66,     0,    63,
+      65,    67,    69,    71,    74,    79,    82,    86,    91,    89,
+      88,     0,     0,     0,     0,    95,    98,     0,     0,     0,
+      20,    32,    33,     0,     0,     0,    37,     0,     6,     1,
+       3,     5,    24,    21,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,    45,
+      52,    22,    87,    89,    92,     0,    61,     0,    96,     0,
+       0,     0,     0,     0,    34,    45,    23,    90,    36,     7,
+      64,    68,    70,    72,    73,    75,    76,    77,    78,    80,
+      81,    83,    84,    85,    60,     0,    42,     0,    47,     0,
+       0,    93,    94,     0,     0,     0,     0,     0,    46,    54,
+      43,     0,     0,    49,     0,    53,    62,    30,     0,     0,
+      35,    57,    58,     0,     0,     0,    38,    50,    48,     0,
+       0,     0,     0,    55,    44,     0,    27,     0,    41,     0,
+      31,     0,     0,    56,    59,    25,     0,    39,    51,     0,
+       0,    26,    40,    28,    29
+  };
+
+  const short
+   YaccParser ::yypgoto_[] =
+  {
+    -107,  -107,  -107,   -19,     0,  -107,  -107,    89,  -107,  -107,
+    -107,  -107,  -107,  -107,  -107,  -107,  -107,    -5,  -107,    19,
+      86,  -106,  -107,  -107,  -107,   -16,   -42,  -107,    78,    75,
+      57,    26,    54,   -35,  -107,  -107,   -53,    -4,   384,  -107,
+     -13,  -107
+  };
+
+  const unsigned char
+   YaccParser ::yydefgoto_[] =
+  {
+       0,    23,    24,    67,    68,    26,    27,    28,    29,   166,
+      30,    31,    32,    33,    34,    35,    36,   140,   141,    90,
+      91,   138,   153,    37,    95,    38,    39,    40,    41,    42,
+      43,    44,    45,    46,    47,    48,    55,   128,    49,    50,
+      51,    52
+  };
+
+  const unsigned char
+   YaccParser ::yytable_[] =
+  {
+      25,    56,    63,    98,    69,    65,    64,   125,   125,    73,
+      74,    96,    97,   162,     1,     2,     3,    92,    57,   163,
+       5,     6,     7,    53,    71,    54,   144,    58,    74,   169,
+     107,   152,   110,    85,    86,     8,    87,   126,   158,   127,
+     127,    99,   101,   103,    60,   102,   124,    77,    78,    59,
+     121,   122,   123,    75,    70,    21,   174,    76,    54,   137,
+     151,    54,    61,   178,     9,    10,    11,   109,    12,    83,
+      84,     1,     2,     3,   130,    98,   131,     5,     6,     7,
+      74,    89,   133,   139,    74,    97,   136,   154,   146,   155,
+      88,    74,     8,   179,    72,   139,    79,    80,    81,    82,
+     105,    74,   139,   180,    98,   115,   116,   117,   118,   104,
+      74,    54,    21,   142,   129,    98,   137,   173,   148,   149,
+     139,   135,    74,   160,    74,    97,   134,   139,   156,    98,
+     161,    74,   132,   147,   113,   114,   150,   119,   120,   157,
+     159,   142,   165,   167,   171,   172,   176,   100,   145,   164,
+     106,   112,   168,   111,     0,     0,     0,     0,     0,   170,
+       1,     2,     3,     0,     0,     4,     5,     6,     7,     0,
+       0,     0,     0,   182,     0,     0,   109,     0,     0,   183,
+     184,     8,     9,    10,    11,     0,    12,    13,     0,    14,
+      15,    16,    17,     0,     0,     0,     0,    18,    19,    20,
+       0,    21,     1,     2,     3,    22,    66,     4,     5,     6,
+       7,     0,     0,     0,     1,     2,     3,     0,     0,     0,
+       5,     6,     7,     8,     9,    10,    11,     0,    12,    13,
+       0,    14,    15,    16,    17,     8,     0,     0,     0,    18,
+      19,    20,     0,    21,     1,     2,     3,    22,   108,     4,
+       5,     6,     7,     0,     0,    21,     1,     2,     3,   137,
+       0,     0,     5,     6,     7,     8,     9,    10,    11,     0,
+      12,    13,     0,    14,    15,    16,    17,     8,     0,     0,
+       0,    18,    19,    20,     0,    21,     1,     2,     3,    22,
+     175,     4,     5,     6,     7,     0,     0,    21,     0,     0,
+     143,     0,     0,     0,     0,     0,     0,     8,     9,    10,
+      11,     0,    12,    13,     0,    14,    15,    16,    17,     0,
+       0,     0,     0,    18,    19,    20,     0,    21,     1,     2,
+       3,    22,   181,     4,     5,     6,     7,     0,     0,     0,
+       1,     2,     3,     0,     0,     0,     5,     6,     7,     8,
+       9,    10,    11,     0,    12,    13,     0,    14,    15,    16,
+      17,     8,     0,     0,     0,    18,    19,    20,     0,    21,
+       1,     2,     3,    22,     0,     0,     5,     6,     7,     0,
+       0,    21,     0,     0,   177,     0,     0,     0,     0,     0,
+       0,     8,     1,     2,     3,     0,     0,     0,     5,     6,
+       7,     1,     2,     3,     0,     0,     0,     5,     6,     7,
+       0,    21,    94,     8,     9,    10,    11,     0,    12,     0,
+       0,     0,     8,     0,     0,     0,     0,     0,     0,     0,
+      19,     0,     0,    21,     0,     0,    93,     1,     2,     3,
+      62,     0,    21,     5,     6,     7,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     8,    93,
+      93,    93,    93,    93,    93,    93,    93,    93,    93,    93,
+      93,    93,     0,     0,     0,     0,     0,     0,    21
+  };
+
+  const short
+   YaccParser ::yycheck_[] =
+  {
+       0,     5,    18,    56,     0,    21,    19,    14,    14,    42,
+      43,    53,    54,    43,     3,     4,     5,    52,    44,    49,
+       9,    10,    11,    44,    24,    46,    14,    44,    43,    14,
+      45,   137,    74,    12,    13,    24,    15,    44,   144,    46,
+      46,    57,    58,    59,    42,    58,    88,    20,    21,    44,
+      85,    86,    87,    23,    50,    44,   162,    22,    46,    48,
+      49,    46,    42,   169,    25,    26,    27,    67,    29,    10,
+      11,     3,     4,     5,    43,   128,    45,     9,    10,    11,
+      43,     9,    45,   125,    43,   127,    45,    43,   130,    45,
+      14,    43,    24,    45,    42,   137,    16,    17,    18,    19,
+       9,    43,   144,    45,   157,    79,    80,    81,    82,    42,
+      43,    46,    44,   126,    43,   168,    48,    49,   134,   135,
+     162,    42,    43,    42,    43,   167,    42,   169,     9,   182,
+      42,    43,    47,   133,    77,    78,   136,    83,    84,   143,
+      31,   154,    48,    46,   160,   161,   165,    58,   129,   154,
+      64,    76,   156,    75,    -1,    -1,    -1,    -1,    -1,   159,
+       3,     4,     5,    -1,    -1,     8,     9,    10,    11,    -1,
+      -1,    -1,    -1,   177,    -1,    -1,   176,    -1,    -1,   179,
+     180,    24,    25,    26,    27,    -1,    29,    30,    -1,    32,
+      33,    34,    35,    -1,    -1,    -1,    -1,    40,    41,    42,
+      -1,    44,     3,     4,     5,    48,    49,     8,     9,    10,
+      11,    -1,    -1,    -1,     3,     4,     5,    -1,    -1,    -1,
+       9,    10,    11,    24,    25,    26,    27,    -1,    29,    30,
+      -1,    32,    33,    34,    35,    24,    -1,    -1,    -1,    40,
+      41,    42,    -1,    44,     3,     4,     5,    48,    49,     8,
+       9,    10,    11,    -1,    -1,    44,     3,     4,     5,    48,
+      -1,    -1,     9,    10,    11,    24,    25,    26,    27,    -1,
+      29,    30,    -1,    32,    33,    34,    35,    24,    -1,    -1,
+      -1,    40,    41,    42,    -1,    44,     3,     4,     5,    48,
+      49,     8,     9,    10,    11,    -1,    -1,    44,    -1,    -1,
+      47,    -1,    -1,    -1,    -1,    -1,    -1,    24,    25,    26,
+      27,    -1,    29,    30,    -1,    32,    33,    34,    35,    -1,
+      -1,    -1,    -1,    40,    41,    42,    -1,    44,     3,     4,
+       5,    48,    49,     8,     9,    10,    11,    -1,    -1,    -1,
+       3,     4,     5,    -1,    -1,    -1,     9,    10,    11,    24,
+      25,    26,    27,    -1,    29,    30,    -1,    32,    33,    34,
+      35,    24,    -1,    -1,    -1,    40,    41,    42,    -1,    44,
+       3,     4,     5,    48,    -1,    -1,     9,    10,    11,    -1,
+      -1,    44,    -1,    -1,    47,    -1,    -1,    -1,    -1,    -1,
+      -1,    24,     3,     4,     5,    -1,    -1,    -1,     9,    10,
+      11,     3,     4,     5,    -1,    -1,    -1,     9,    10,    11,
+      -1,    44,    45,    24,    25,    26,    27,    -1,    29,    -1,
+      -1,    -1,    24,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      41,    -1,    -1,    44,    -1,    -1,    52,     3,     4,     5,
+      42,    -1,    44,     9,    10,    11,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    24,    75,
+      76,    77,    78,    79,    80,    81,    82,    83,    84,    85,
+      86,    87,    -1,    -1,    -1,    -1,    -1,    -1,    44
+  };
+
+  const signed char
+   YaccParser ::yystos_[] =
+  {
+       0,     3,     4,     5,     8,     9,    10,    11,    24,    25,
+      26,    27,    29,    30,    32,    33,    34,    35,    40,    41,
+      42,    44,    48,    53,    54,    56,    57,    58,    59,    60,
+      62,    63,    64,    65,    66,    67,    68,    75,    77,    78,
+      79,    80,    81,    82,    83,    84,    85,    86,    87,    90,
+      91,    92,    93,    44,    46,    88,    89,    44,    44,    44,
+      42,    42,    42,    77,    92,    77,    49,    55,    56,     0,
+      50,    56,    42,    42,    43,    23,    22,    20,    21,    16,
+      17,    18,    19,    10,    11,    12,    13,    15,    14,     9,
+      71,    72,    85,    90,    45,    76,    78,    78,    88,    77,
+      59,    77,    92,    77,    42,     9,    72,    45,    49,    56,
+      78,    80,    81,    82,    82,    83,    83,    83,    83,    84,
+      84,    85,    85,    85,    78,    14,    44,    46,    89,    43,
+      43,    45,    47,    45,    42,    42,    45,    48,    73,    78,
+      69,    70,    92,    47,    14,    71,    78,    56,    77,    77,
+      56,    49,    73,    74,    43,    45,     9,    89,    73,    31,
+      42,    42,    43,    49,    69,    48,    61,    46,    89,    14,
+      56,    77,    77,    49,    73,    49,    55,    47,    73,    45,
+      45,    49,    89,    56,    56
+  };
+
+  const signed char
+   YaccParser ::yyr1_[] =
+  {
+       0,    52,    53,    53,    54,    54,    55,    55,    56,    56,
+      56,    56,    56,    56,    56,    56,    56,    56,    56,    56,
+      57,    58,    59,    59,    60,    61,    61,    62,    63,    63,
+      64,    64,    65,    66,    66,    67,    68,    68,    69,    69,
+      69,    69,    70,    70,    70,    71,    71,    71,    71,    71,
+      71,    71,    72,    72,    73,    73,    73,    73,    74,    74,
+      75,    76,    76,    77,    77,    78,    78,    79,    79,    80,
+      80,    81,    81,    81,    82,    82,    82,    82,    82,    83,
+      83,    83,    84,    84,    84,    84,    85,    85,    86,    86,
+      86,    86,    87,    87,    88,    89,    89,    90,    90,    91,
+      91,    91,    92,    92,    92,    92,    93,    93,    93
+  };
+
+  const signed char
+   YaccParser ::yyr2_[] =
+  {
+       0,     2,     1,     2,     1,     2,     1,     2,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       2,     2,     2,     3,     2,     2,     3,     6,     9,     9,
+       5,     7,     2,     2,     3,     5,     3,     2,     2,     4,
+       5,     3,     0,     1,     3,     1,     3,     2,     4,     3,
+       4,     6,     1,     3,     1,     3,     4,     2,     1,     3,
+       3,     1,     3,     1,     3,     1,     1,     1,     3,     1,
+       3,     1,     3,     3,     1,     3,     3,     3,     3,     1,
+       3,     3,     1,     3,     3,     3,     1,     2,     1,     1,
+       3,     1,     3,     4,     3,     1,     2,     1,     2,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1
+  };
+
+
+#if YYDEBUG || 1
+  // YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
+  // First, the terminals, then, starting at \a YYNTOKENS, nonterminals.
+  const char*
+  const  YaccParser ::yytname_[] =
+  {
+  "\"end of file\"", "error", "\"invalid token\"", "INT_CONST",
+  "LL_CONST", "FLOAT_CONST", "STR_CONST", "ERR_TOKEN", "SLASH_COMMENT",
+  "IDENT", "PLUS", "MINUS", "STAR", "SLASH", "ASSIGN", "PERCENT", "LT",
+  "GT", "LE", "GE", "EQ", "NEQ", "AND", "OR", "NOT", "INT", "FLOAT",
+  "VOID", "CHAR", "LONG_LONG", "IF", "ELSE", "FOR", "WHILE", "CONTINUE",
+  "BREAK", "SWITCH", "CASE", "GOTO", "DO", "RETURN", "CONST", "SEMICOLON",
+  "COMMA", "LPAREN", "RPAREN", "LBRACKET", "RBRACKET", "LBRACE", "RBRACE",
+  "END", "THEN", "$accept", "PROGRAM", "TOP_STMT_LIST", "STMT_LIST",
+  "STMT", "CONTINUE_STMT", "EXPR_STMT", "VAR_DECLARATION", "VAR_DECL_STMT",
+  "FUNC_BODY", "FUNC_DECL_STMT", "FOR_STMT", "IF_STMT", "BREAK_STMT",
+  "RETURN_STMT", "WHILE_STMT", "BLOCK_STMT", "PARAM_DECLARATOR",
+  "PARAM_DECLARATOR_LIST", "VAR_DECLARATOR", "VAR_DECLARATOR_LIST",
+  "INITIALIZER", "INITIALIZER_LIST", "ASSIGN_EXPR", "EXPR_LIST", "EXPR",
+  "NOCOMMA_EXPR", "LOGICAL_OR_EXPR", "LOGICAL_AND_EXPR", "EQUALITY_EXPR",
+  "RELATIONAL_EXPR", "ADDSUB_EXPR", "MULDIV_EXPR", "UNARY_EXPR",
+  "BASIC_EXPR", "FUNC_CALL_EXPR", "ARRAY_DIMENSION_EXPR",
+  "ARRAY_DIMENSION_EXPR_LIST", "LEFT_VAL_EXPR", "LITERAL_EXPR", "TYPE",
+  "UNARY_OP", YY_NULLPTR
+  };
+#endif
+
+
+#if YYDEBUG
+  const short
+   YaccParser ::yyrline_[] =
+  {
+       0,   161,   161,   165,   172,   175,   182,   186,   195,   198,
+     201,   204,   207,   210,   213,   216,   221,   224,   227,   230,
+     237,   244,   251,   254,   263,   270,   273,   282,   290,   294,
+     304,   307,   316,   322,   325,   332,   339,   342,   349,   353,
+     361,   367,   375,   380,   384,   395,   402,   409,   416,   423,
+     430,   437,   446,   450,   460,   463,   467,   470,   478,   482,
+     492,   499,   503,   511,   514,   530,   533,   542,   545,   554,
+     557,   566,   569,   572,   581,   585,   589,   593,   597,   609,
+     612,   615,   624,   627,   630,   633,   639,   642,   648,   651,
+     654,   657,   663,   681,   689,   699,   705,   713,   717,   725,
+     731,   735,   746,   750,   754,   758,   768,   769,   770
+  };
+
+  void
+   YaccParser ::yy_stack_print_ () const
+  {
+    *yycdebug_ << "Stack now";
+    for (stack_type::const_iterator
+           i = yystack_.begin (),
+           i_end = yystack_.end ();
+         i != i_end; ++i)
+      *yycdebug_ << ' ' << int (i->state);
+    *yycdebug_ << '\n';
+  }
+
+  void
+   YaccParser ::yy_reduce_print_ (int yyrule) const
+  {
+    int yylno = yyrline_[yyrule];
+    int yynrhs = yyr2_[yyrule];
+    // Print the symbols being reduced, and their result.
+    *yycdebug_ << "Reducing stack by rule " << yyrule - 1
+               << " (line " << yylno << "):\n";
+    // The symbols being reduced.
+    for (int yyi = 0; yyi < yynrhs; yyi++)
+      YY_SYMBOL_PRINT ("   $" << yyi + 1 << " =",
+                       yystack_[(yynrhs) - (yyi + 1)]);
+  }
+#endif // YYDEBUG
+
+
+#line 5 "frontend/parser/yacc.y"
+} //  FE 
+#line 2654 "frontend/parser/yacc.cpp"
+
+#line 773 "frontend/parser/yacc.y"
+
+
+void FE::YaccParser::error(const FE::location& location, const std::string& message)
+{
+    std::cerr << "msg: " << message << ", error happened at: " << location << std::endl;
+}
@@ -0,0 +1,2954 @@
+// A Bison parser, made by GNU Bison 3.8.2.
+
+// Skeleton interface for Bison LALR(1) parsers in C++
+
+// Copyright (C) 2002-2015, 2018-2021 Free Software Foundation, Inc.
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+// As a special exception, you may create a larger work that contains
+// part or all of the Bison parser skeleton and distribute that work
+// under terms of your choice, so long as that work isn't itself a
+// parser generator using the skeleton or a modified version thereof
+// as a parser skeleton.  Alternatively, if you modify or redistribute
+// the parser skeleton itself, you may (at your option) remove this
+// special exception, which will cause the skeleton and the resulting
+// Bison output files to be licensed under the GNU General Public
+// License without this special exception.
+
+// This special exception was added by the Free Software Foundation in
+// version 2.2 of Bison.
+
+
+/**
+ ** \file frontend/parser/yacc.h
+ ** Define the  FE ::parser class.
+ */
+
+// C++ LALR(1) parser skeleton written by Akim Demaille.
+
+// DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+// especially those whose name start with YY_ or yy_.  They are
+// private implementation details that can be changed or removed.
+
+#ifndef YY_YY_FRONTEND_PARSER_YACC_H_INCLUDED
+# define YY_YY_FRONTEND_PARSER_YACC_H_INCLUDED
+// "%code requires" blocks.
+#line 13 "frontend/parser/yacc.y"
+
+    #include <memory>
+    #include <vector>
+    #include <string>
+    #include <sstream>
+    #include <frontend/ast/ast_defs.h>
+    #include <frontend/ast/ast.h>
+    #include <frontend/ast/stmt.h>
+    #include <frontend/ast/expr.h>
+    #include <frontend/ast/decl.h>
+    #include <frontend/symbol/symbol_entry.h>
+
+    using std::vector;
+    using std::string;
+
+    namespace FE
+    {
+        class Parser;
+        class Scanner;
+    }
+
+#line 71 "frontend/parser/yacc.h"
+
+# include <cassert>
+# include <cstdlib> // std::abort
+# include <iostream>
+# include <stdexcept>
+# include <string>
+# include <vector>
+
+#if defined __cplusplus
+# define YY_CPLUSPLUS __cplusplus
+#else
+# define YY_CPLUSPLUS 199711L
+#endif
+
+// Support move semantics when possible.
+#if 201103L <= YY_CPLUSPLUS
+# define YY_MOVE           std::move
+# define YY_MOVE_OR_COPY   move
+# define YY_MOVE_REF(Type) Type&&
+# define YY_RVREF(Type)    Type&&
+# define YY_COPY(Type)     Type
+#else
+# define YY_MOVE
+# define YY_MOVE_OR_COPY   copy
+# define YY_MOVE_REF(Type) Type&
+# define YY_RVREF(Type)    const Type&
+# define YY_COPY(Type)     const Type&
+#endif
+
+// Support noexcept when possible.
+#if 201103L <= YY_CPLUSPLUS
+# define YY_NOEXCEPT noexcept
+# define YY_NOTHROW
+#else
+# define YY_NOEXCEPT
+# define YY_NOTHROW throw ()
+#endif
+
+// Support constexpr when possible.
+#if 201703 <= YY_CPLUSPLUS
+# define YY_CONSTEXPR constexpr
+#else
+# define YY_CONSTEXPR
+#endif
+# include "location.hh"
+#include <typeinfo>
+#ifndef YY_ASSERT
+# include <cassert>
+# define YY_ASSERT assert
+#endif
+
+
+#ifndef YY_ATTRIBUTE_PURE
+# if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
+# else
+#  define YY_ATTRIBUTE_PURE
+# endif
+#endif
+
+#ifndef YY_ATTRIBUTE_UNUSED
+# if defined __GNUC__ && 2 < __GNUC__ + (7 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_UNUSED __attribute__ ((__unused__))
+# else
+#  define YY_ATTRIBUTE_UNUSED
+# endif
+#endif
+
+/* Suppress unused-variable warnings by "using" E.  */
+#if ! defined lint || defined __GNUC__
+# define YY_USE(E) ((void) (E))
+#else
+# define YY_USE(E) /* empty */
+#endif
+
+/* Suppress an incorrect diagnostic about yylval being uninitialized.  */
+#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
+# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
+# else
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
+    _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
+# endif
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
+    _Pragma ("GCC diagnostic pop")
+#else
+# define YY_INITIAL_VALUE(Value) Value
+#endif
+#ifndef YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END
+#endif
+#ifndef YY_INITIAL_VALUE
+# define YY_INITIAL_VALUE(Value) /* Nothing. */
+#endif
+
+#if defined __cplusplus && defined __GNUC__ && ! defined __ICC && 6 <= __GNUC__
+# define YY_IGNORE_USELESS_CAST_BEGIN                          \
+    _Pragma ("GCC diagnostic push")                            \
+    _Pragma ("GCC diagnostic ignored \"-Wuseless-cast\"")
+# define YY_IGNORE_USELESS_CAST_END            \
+    _Pragma ("GCC diagnostic pop")
+#endif
+#ifndef YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_END
+#endif
+
+# ifndef YY_CAST
+#  ifdef __cplusplus
+#   define YY_CAST(Type, Val) static_cast<Type> (Val)
+#   define YY_REINTERPRET_CAST(Type, Val) reinterpret_cast<Type> (Val)
+#  else
+#   define YY_CAST(Type, Val) ((Type) (Val))
+#   define YY_REINTERPRET_CAST(Type, Val) ((Type) (Val))
+#  endif
+# endif
+# ifndef YY_NULLPTR
+#  if defined __cplusplus
+#   if 201103L <= __cplusplus
+#    define YY_NULLPTR nullptr
+#   else
+#    define YY_NULLPTR 0
+#   endif
+#  else
+#   define YY_NULLPTR ((void*)0)
+#  endif
+# endif
+
+/* Debug traces.  */
+#ifndef YYDEBUG
+# define YYDEBUG 0
+#endif
+
+#line 5 "frontend/parser/yacc.y"
+namespace  FE  {
+#line 212 "frontend/parser/yacc.h"
+
+
+
+
+  /// A Bison parser.
+  class  YaccParser 
+  {
+  public:
+#ifdef YYSTYPE
+# ifdef __GNUC__
+#  pragma GCC message "bison: do not #define YYSTYPE in C++, use %define api.value.type"
+# endif
+    typedef YYSTYPE value_type;
+#else
+  /// A buffer to store and retrieve objects.
+  ///
+  /// Sort of a variant, but does not keep track of the nature
+  /// of the stored data, since that knowledge is available
+  /// via the current parser state.
+  class value_type
+  {
+  public:
+    /// Type of *this.
+    typedef value_type self_type;
+
+    /// Empty construction.
+    value_type () YY_NOEXCEPT
+      : yyraw_ ()
+      , yytypeid_ (YY_NULLPTR)
+    {}
+
+    /// Construct and fill.
+    template <typename T>
+    value_type (YY_RVREF (T) t)
+      : yytypeid_ (&typeid (T))
+    {
+      YY_ASSERT (sizeof (T) <= size);
+      new (yyas_<T> ()) T (YY_MOVE (t));
+    }
+
+#if 201103L <= YY_CPLUSPLUS
+    /// Non copyable.
+    value_type (const self_type&) = delete;
+    /// Non copyable.
+    self_type& operator= (const self_type&) = delete;
+#endif
+
+    /// Destruction, allowed only if empty.
+    ~value_type () YY_NOEXCEPT
+    {
+      YY_ASSERT (!yytypeid_);
+    }
+
+# if 201103L <= YY_CPLUSPLUS
+    /// Instantiate a \a T in here from \a t.
+    template <typename T, typename... U>
+    T&
+    emplace (U&&... u)
+    {
+      YY_ASSERT (!yytypeid_);
+      YY_ASSERT (sizeof (T) <= size);
+      yytypeid_ = & typeid (T);
+      return *new (yyas_<T> ()) T (std::forward <U>(u)...);
+    }
+# else
+    /// Instantiate an empty \a T in here.
+    template <typename T>
+    T&
+    emplace ()
+    {
+      YY_ASSERT (!yytypeid_);
+      YY_ASSERT (sizeof (T) <= size);
+      yytypeid_ = & typeid (T);
+      return *new (yyas_<T> ()) T ();
+    }
+
+    /// Instantiate a \a T in here from \a t.
+    template <typename T>
+    T&
+    emplace (const T& t)
+    {
+      YY_ASSERT (!yytypeid_);
+      YY_ASSERT (sizeof (T) <= size);
+      yytypeid_ = & typeid (T);
+      return *new (yyas_<T> ()) T (t);
+    }
+# endif
+
+    /// Instantiate an empty \a T in here.
+    /// Obsolete, use emplace.
+    template <typename T>
+    T&
+    build ()
+    {
+      return emplace<T> ();
+    }
+
+    /// Instantiate a \a T in here from \a t.
+    /// Obsolete, use emplace.
+    template <typename T>
+    T&
+    build (const T& t)
+    {
+      return emplace<T> (t);
+    }
+
+    /// Accessor to a built \a T.
+    template <typename T>
+    T&
+    as () YY_NOEXCEPT
+    {
+      YY_ASSERT (yytypeid_);
+      YY_ASSERT (*yytypeid_ == typeid (T));
+      YY_ASSERT (sizeof (T) <= size);
+      return *yyas_<T> ();
+    }
+
+    /// Const accessor to a built \a T (for %printer).
+    template <typename T>
+    const T&
+    as () const YY_NOEXCEPT
+    {
+      YY_ASSERT (yytypeid_);
+      YY_ASSERT (*yytypeid_ == typeid (T));
+      YY_ASSERT (sizeof (T) <= size);
+      return *yyas_<T> ();
+    }
+
+    /// Swap the content with \a that, of same type.
+    ///
+    /// Both variants must be built beforehand, because swapping the actual
+    /// data requires reading it (with as()), and this is not possible on
+    /// unconstructed variants: it would require some dynamic testing, which
+    /// should not be the variant's responsibility.
+    /// Swapping between built and (possibly) non-built is done with
+    /// self_type::move ().
+    template <typename T>
+    void
+    swap (self_type& that) YY_NOEXCEPT
+    {
+      YY_ASSERT (yytypeid_);
+      YY_ASSERT (*yytypeid_ == *that.yytypeid_);
+      std::swap (as<T> (), that.as<T> ());
+    }
+
+    /// Move the content of \a that to this.
+    ///
+    /// Destroys \a that.
+    template <typename T>
+    void
+    move (self_type& that)
+    {
+# if 201103L <= YY_CPLUSPLUS
+      emplace<T> (std::move (that.as<T> ()));
+# else
+      emplace<T> ();
+      swap<T> (that);
+# endif
+      that.destroy<T> ();
+    }
+
+# if 201103L <= YY_CPLUSPLUS
+    /// Move the content of \a that to this.
+    template <typename T>
+    void
+    move (self_type&& that)
+    {
+      emplace<T> (std::move (that.as<T> ()));
+      that.destroy<T> ();
+    }
+#endif
+
+    /// Copy the content of \a that to this.
+    template <typename T>
+    void
+    copy (const self_type& that)
+    {
+      emplace<T> (that.as<T> ());
+    }
+
+    /// Destroy the stored \a T.
+    template <typename T>
+    void
+    destroy ()
+    {
+      as<T> ().~T ();
+      yytypeid_ = YY_NULLPTR;
+    }
+
+  private:
+#if YY_CPLUSPLUS < 201103L
+    /// Non copyable.
+    value_type (const self_type&);
+    /// Non copyable.
+    self_type& operator= (const self_type&);
+#endif
+
+    /// Accessor to raw memory as \a T.
+    template <typename T>
+    T*
+    yyas_ () YY_NOEXCEPT
+    {
+      void *yyp = yyraw_;
+      return static_cast<T*> (yyp);
+     }
+
+    /// Const accessor to raw memory as \a T.
+    template <typename T>
+    const T*
+    yyas_ () const YY_NOEXCEPT
+    {
+      const void *yyp = yyraw_;
+      return static_cast<const T*> (yyp);
+     }
+
+    /// An auxiliary type to compute the largest semantic type.
+    union union_type
+    {
+      // ASSIGN_EXPR
+      // EXPR
+      // NOCOMMA_EXPR
+      // LOGICAL_OR_EXPR
+      // LOGICAL_AND_EXPR
+      // EQUALITY_EXPR
+      // RELATIONAL_EXPR
+      // ADDSUB_EXPR
+      // MULDIV_EXPR
+      // UNARY_EXPR
+      // BASIC_EXPR
+      // FUNC_CALL_EXPR
+      // ARRAY_DIMENSION_EXPR
+      // LEFT_VAL_EXPR
+      // LITERAL_EXPR
+      char dummy1[sizeof (FE::AST::ExprNode*)];
+
+      // INITIALIZER
+      char dummy2[sizeof (FE::AST::InitDecl*)];
+
+      // UNARY_OP
+      char dummy3[sizeof (FE::AST::Operator)];
+
+      // PARAM_DECLARATOR
+      char dummy4[sizeof (FE::AST::ParamDeclarator*)];
+
+      // PROGRAM
+      char dummy5[sizeof (FE::AST::Root*)];
+
+      // EXPR_LIST
+      // ARRAY_DIMENSION_EXPR_LIST
+      char dummy6[sizeof (FE::AST::Span<FE::AST::ExprNode*>*)];
+
+      // INITIALIZER_LIST
+      char dummy7[sizeof (FE::AST::Span<FE::AST::InitDecl*>*)];
+
+      // PARAM_DECLARATOR_LIST
+      char dummy8[sizeof (FE::AST::Span<FE::AST::ParamDeclarator*>*)];
+
+      // TOP_STMT_LIST
+      // STMT_LIST
+      char dummy9[sizeof (FE::AST::Span<FE::AST::StmtNode*>*)];
+
+      // VAR_DECLARATOR_LIST
+      char dummy10[sizeof (FE::AST::Span<FE::AST::VarDeclarator*>*)];
+
+      // STMT
+      // CONTINUE_STMT
+      // EXPR_STMT
+      // VAR_DECL_STMT
+      // FUNC_BODY
+      // FUNC_DECL_STMT
+      // FOR_STMT
+      // IF_STMT
+      // BREAK_STMT
+      // RETURN_STMT
+      // WHILE_STMT
+      // BLOCK_STMT
+      char dummy11[sizeof (FE::AST::StmtNode*)];
+
+      // TYPE
+      char dummy12[sizeof (FE::AST::Type*)];
+
+      // VAR_DECLARATION
+      char dummy13[sizeof (FE::AST::VarDeclaration*)];
+
+      // VAR_DECLARATOR
+      char dummy14[sizeof (FE::AST::VarDeclarator*)];
+
+      // FLOAT_CONST
+      char dummy15[sizeof (float)];
+
+      // INT_CONST
+      char dummy16[sizeof (int)];
+
+      // LL_CONST
+      char dummy17[sizeof (long long)];
+
+      // STR_CONST
+      // ERR_TOKEN
+      // SLASH_COMMENT
+      // IDENT
+      char dummy18[sizeof (std::string)];
+    };
+
+    /// The size of the largest semantic type.
+    enum { size = sizeof (union_type) };
+
+    /// A buffer to store semantic values.
+    union
+    {
+      /// Strongest alignment constraints.
+      long double yyalign_me_;
+      /// A buffer large enough to store any of the semantic values.
+      char yyraw_[size];
+    };
+
+    /// Whether the content is built: if defined, the name of the stored type.
+    const std::type_info *yytypeid_;
+  };
+
+#endif
+    /// Backward compatibility (Bison 3.8).
+    typedef value_type semantic_type;
+
+    /// Symbol locations.
+    typedef location location_type;
+
+    /// Syntax errors thrown from user actions.
+    struct syntax_error : std::runtime_error
+    {
+      syntax_error (const location_type& l, const std::string& m)
+        : std::runtime_error (m)
+        , location (l)
+      {}
+
+      syntax_error (const syntax_error& s)
+        : std::runtime_error (s.what ())
+        , location (s.location)
+      {}
+
+      ~syntax_error () YY_NOEXCEPT YY_NOTHROW;
+
+      location_type location;
+    };
+
+    /// Token kinds.
+    struct token
+    {
+      enum token_kind_type
+      {
+        TOKEN_YYEMPTY = -2,
+    TOKEN_YYEOF = 0,               // "end of file"
+    TOKEN_YYerror = 256,           // error
+    TOKEN_YYUNDEF = 257,           // "invalid token"
+    TOKEN_INT_CONST = 258,         // INT_CONST
+    TOKEN_LL_CONST = 259,          // LL_CONST
+    TOKEN_FLOAT_CONST = 260,       // FLOAT_CONST
+    TOKEN_STR_CONST = 261,         // STR_CONST
+    TOKEN_ERR_TOKEN = 262,         // ERR_TOKEN
+    TOKEN_SLASH_COMMENT = 263,     // SLASH_COMMENT
+    TOKEN_IDENT = 264,             // IDENT
+    TOKEN_PLUS = 265,              // PLUS
+    TOKEN_MINUS = 266,             // MINUS
+    TOKEN_STAR = 267,              // STAR
+    TOKEN_SLASH = 268,             // SLASH
+    TOKEN_ASSIGN = 269,            // ASSIGN
+    TOKEN_PERCENT = 270,           // PERCENT
+    TOKEN_LT = 271,                // LT
+    TOKEN_GT = 272,                // GT
+    TOKEN_LE = 273,                // LE
+    TOKEN_GE = 274,                // GE
+    TOKEN_EQ = 275,                // EQ
+    TOKEN_NEQ = 276,               // NEQ
+    TOKEN_AND = 277,               // AND
+    TOKEN_OR = 278,                // OR
+    TOKEN_NOT = 279,               // NOT
+    TOKEN_INT = 280,               // INT
+    TOKEN_FLOAT = 281,             // FLOAT
+    TOKEN_VOID = 282,              // VOID
+    TOKEN_CHAR = 283,              // CHAR
+    TOKEN_LONG_LONG = 284,         // LONG_LONG
+    TOKEN_IF = 285,                // IF
+    TOKEN_ELSE = 286,              // ELSE
+    TOKEN_FOR = 287,               // FOR
+    TOKEN_WHILE = 288,             // WHILE
+    TOKEN_CONTINUE = 289,          // CONTINUE
+    TOKEN_BREAK = 290,             // BREAK
+    TOKEN_SWITCH = 291,            // SWITCH
+    TOKEN_CASE = 292,              // CASE
+    TOKEN_GOTO = 293,              // GOTO
+    TOKEN_DO = 294,                // DO
+    TOKEN_RETURN = 295,            // RETURN
+    TOKEN_CONST = 296,             // CONST
+    TOKEN_SEMICOLON = 297,         // SEMICOLON
+    TOKEN_COMMA = 298,             // COMMA
+    TOKEN_LPAREN = 299,            // LPAREN
+    TOKEN_RPAREN = 300,            // RPAREN
+    TOKEN_LBRACKET = 301,          // LBRACKET
+    TOKEN_RBRACKET = 302,          // RBRACKET
+    TOKEN_LBRACE = 303,            // LBRACE
+    TOKEN_RBRACE = 304,            // RBRACE
+    TOKEN_END = 305,               // END
+    TOKEN_THEN = 306               // THEN
+      };
+      /// Backward compatibility alias (Bison 3.6).
+      typedef token_kind_type yytokentype;
+    };
+
+    /// Token kind, as returned by yylex.
+    typedef token::token_kind_type token_kind_type;
+
+    /// Backward compatibility alias (Bison 3.6).
+    typedef token_kind_type token_type;
+
+    /// Symbol kinds.
+    struct symbol_kind
+    {
+      enum symbol_kind_type
+      {
+        YYNTOKENS = 52, ///< Number of tokens.
+        S_YYEMPTY = -2,
+        S_YYEOF = 0,                             // "end of file"
+        S_YYerror = 1,                           // error
+        S_YYUNDEF = 2,                           // "invalid token"
+        S_INT_CONST = 3,                         // INT_CONST
+        S_LL_CONST = 4,                          // LL_CONST
+        S_FLOAT_CONST = 5,                       // FLOAT_CONST
+        S_STR_CONST = 6,                         // STR_CONST
+        S_ERR_TOKEN = 7,                         // ERR_TOKEN
+        S_SLASH_COMMENT = 8,                     // SLASH_COMMENT
+        S_IDENT = 9,                             // IDENT
+        S_PLUS = 10,                             // PLUS
+        S_MINUS = 11,                            // MINUS
+        S_STAR = 12,                             // STAR
+        S_SLASH = 13,                            // SLASH
+        S_ASSIGN = 14,                           // ASSIGN
+        S_PERCENT = 15,                          // PERCENT
+        S_LT = 16,                               // LT
+        S_GT = 17,                               // GT
+        S_LE = 18,                               // LE
+        S_GE = 19,                               // GE
+        S_EQ = 20,                               // EQ
+        S_NEQ = 21,                              // NEQ
+        S_AND = 22,                              // AND
+        S_OR = 23,                               // OR
+        S_NOT = 24,                              // NOT
+        S_INT = 25,                              // INT
+        S_FLOAT = 26,                            // FLOAT
+        S_VOID = 27,                             // VOID
+        S_CHAR = 28,                             // CHAR
+        S_LONG_LONG = 29,                        // LONG_LONG
+        S_IF = 30,                               // IF
+        S_ELSE = 31,                             // ELSE
+        S_FOR = 32,                              // FOR
+        S_WHILE = 33,                            // WHILE
+        S_CONTINUE = 34,                         // CONTINUE
+        S_BREAK = 35,                            // BREAK
+        S_SWITCH = 36,                           // SWITCH
+        S_CASE = 37,                             // CASE
+        S_GOTO = 38,                             // GOTO
+        S_DO = 39,                               // DO
+        S_RETURN = 40,                           // RETURN
+        S_CONST = 41,                            // CONST
+        S_SEMICOLON = 42,                        // SEMICOLON
+        S_COMMA = 43,                            // COMMA
+        S_LPAREN = 44,                           // LPAREN
+        S_RPAREN = 45,                           // RPAREN
+        S_LBRACKET = 46,                         // LBRACKET
+        S_RBRACKET = 47,                         // RBRACKET
+        S_LBRACE = 48,                           // LBRACE
+        S_RBRACE = 49,                           // RBRACE
+        S_END = 50,                              // END
+        S_THEN = 51,                             // THEN
+        S_YYACCEPT = 52,                         // $accept
+        S_PROGRAM = 53,                          // PROGRAM
+        S_TOP_STMT_LIST = 54,                    // TOP_STMT_LIST
+        S_STMT_LIST = 55,                        // STMT_LIST
+        S_STMT = 56,                             // STMT
+        S_CONTINUE_STMT = 57,                    // CONTINUE_STMT
+        S_EXPR_STMT = 58,                        // EXPR_STMT
+        S_VAR_DECLARATION = 59,                  // VAR_DECLARATION
+        S_VAR_DECL_STMT = 60,                    // VAR_DECL_STMT
+        S_FUNC_BODY = 61,                        // FUNC_BODY
+        S_FUNC_DECL_STMT = 62,                   // FUNC_DECL_STMT
+        S_FOR_STMT = 63,                         // FOR_STMT
+        S_IF_STMT = 64,                          // IF_STMT
+        S_BREAK_STMT = 65,                       // BREAK_STMT
+        S_RETURN_STMT = 66,                      // RETURN_STMT
+        S_WHILE_STMT = 67,                       // WHILE_STMT
+        S_BLOCK_STMT = 68,                       // BLOCK_STMT
+        S_PARAM_DECLARATOR = 69,                 // PARAM_DECLARATOR
+        S_PARAM_DECLARATOR_LIST = 70,            // PARAM_DECLARATOR_LIST
+        S_VAR_DECLARATOR = 71,                   // VAR_DECLARATOR
+        S_VAR_DECLARATOR_LIST = 72,              // VAR_DECLARATOR_LIST
+        S_INITIALIZER = 73,                      // INITIALIZER
+        S_INITIALIZER_LIST = 74,                 // INITIALIZER_LIST
+        S_ASSIGN_EXPR = 75,                      // ASSIGN_EXPR
+        S_EXPR_LIST = 76,                        // EXPR_LIST
+        S_EXPR = 77,                             // EXPR
+        S_NOCOMMA_EXPR = 78,                     // NOCOMMA_EXPR
+        S_LOGICAL_OR_EXPR = 79,                  // LOGICAL_OR_EXPR
+        S_LOGICAL_AND_EXPR = 80,                 // LOGICAL_AND_EXPR
+        S_EQUALITY_EXPR = 81,                    // EQUALITY_EXPR
+        S_RELATIONAL_EXPR = 82,                  // RELATIONAL_EXPR
+        S_ADDSUB_EXPR = 83,                      // ADDSUB_EXPR
+        S_MULDIV_EXPR = 84,                      // MULDIV_EXPR
+        S_UNARY_EXPR = 85,                       // UNARY_EXPR
+        S_BASIC_EXPR = 86,                       // BASIC_EXPR
+        S_FUNC_CALL_EXPR = 87,                   // FUNC_CALL_EXPR
+        S_ARRAY_DIMENSION_EXPR = 88,             // ARRAY_DIMENSION_EXPR
+        S_ARRAY_DIMENSION_EXPR_LIST = 89,        // ARRAY_DIMENSION_EXPR_LIST
+        S_LEFT_VAL_EXPR = 90,                    // LEFT_VAL_EXPR
+        S_LITERAL_EXPR = 91,                     // LITERAL_EXPR
+        S_TYPE = 92,                             // TYPE
+        S_UNARY_OP = 93                          // UNARY_OP
+      };
+    };
+
+    /// (Internal) symbol kind.
+    typedef symbol_kind::symbol_kind_type symbol_kind_type;
+
+    /// The number of tokens.
+    static const symbol_kind_type YYNTOKENS = symbol_kind::YYNTOKENS;
+
+    /// A complete symbol.
+    ///
+    /// Expects its Base type to provide access to the symbol kind
+    /// via kind ().
+    ///
+    /// Provide access to semantic value and location.
+    template <typename Base>
+    struct basic_symbol : Base
+    {
+      /// Alias to Base.
+      typedef Base super_type;
+
+      /// Default constructor.
+      basic_symbol () YY_NOEXCEPT
+        : value ()
+        , location ()
+      {}
+
+#if 201103L <= YY_CPLUSPLUS
+      /// Move constructor.
+      basic_symbol (basic_symbol&& that)
+        : Base (std::move (that))
+        , value ()
+        , location (std::move (that.location))
+      {
+        switch (this->kind ())
+    {
+      case symbol_kind::S_ASSIGN_EXPR: // ASSIGN_EXPR
+      case symbol_kind::S_EXPR: // EXPR
+      case symbol_kind::S_NOCOMMA_EXPR: // NOCOMMA_EXPR
+      case symbol_kind::S_LOGICAL_OR_EXPR: // LOGICAL_OR_EXPR
+      case symbol_kind::S_LOGICAL_AND_EXPR: // LOGICAL_AND_EXPR
+      case symbol_kind::S_EQUALITY_EXPR: // EQUALITY_EXPR
+      case symbol_kind::S_RELATIONAL_EXPR: // RELATIONAL_EXPR
+      case symbol_kind::S_ADDSUB_EXPR: // ADDSUB_EXPR
+      case symbol_kind::S_MULDIV_EXPR: // MULDIV_EXPR
+      case symbol_kind::S_UNARY_EXPR: // UNARY_EXPR
+      case symbol_kind::S_BASIC_EXPR: // BASIC_EXPR
+      case symbol_kind::S_FUNC_CALL_EXPR: // FUNC_CALL_EXPR
+      case symbol_kind::S_ARRAY_DIMENSION_EXPR: // ARRAY_DIMENSION_EXPR
+      case symbol_kind::S_LEFT_VAL_EXPR: // LEFT_VAL_EXPR
+      case symbol_kind::S_LITERAL_EXPR: // LITERAL_EXPR
+        value.move< FE::AST::ExprNode* > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_INITIALIZER: // INITIALIZER
+        value.move< FE::AST::InitDecl* > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_UNARY_OP: // UNARY_OP
+        value.move< FE::AST::Operator > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_PARAM_DECLARATOR: // PARAM_DECLARATOR
+        value.move< FE::AST::ParamDeclarator* > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_PROGRAM: // PROGRAM
+        value.move< FE::AST::Root* > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_EXPR_LIST: // EXPR_LIST
+      case symbol_kind::S_ARRAY_DIMENSION_EXPR_LIST: // ARRAY_DIMENSION_EXPR_LIST
+        value.move< FE::AST::Span<FE::AST::ExprNode*>* > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_INITIALIZER_LIST: // INITIALIZER_LIST
+        value.move< FE::AST::Span<FE::AST::InitDecl*>* > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_PARAM_DECLARATOR_LIST: // PARAM_DECLARATOR_LIST
+        value.move< FE::AST::Span<FE::AST::ParamDeclarator*>* > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_TOP_STMT_LIST: // TOP_STMT_LIST
+      case symbol_kind::S_STMT_LIST: // STMT_LIST
+        value.move< FE::AST::Span<FE::AST::StmtNode*>* > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_VAR_DECLARATOR_LIST: // VAR_DECLARATOR_LIST
+        value.move< FE::AST::Span<FE::AST::VarDeclarator*>* > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_STMT: // STMT
+      case symbol_kind::S_CONTINUE_STMT: // CONTINUE_STMT
+      case symbol_kind::S_EXPR_STMT: // EXPR_STMT
+      case symbol_kind::S_VAR_DECL_STMT: // VAR_DECL_STMT
+      case symbol_kind::S_FUNC_BODY: // FUNC_BODY
+      case symbol_kind::S_FUNC_DECL_STMT: // FUNC_DECL_STMT
+      case symbol_kind::S_FOR_STMT: // FOR_STMT
+      case symbol_kind::S_IF_STMT: // IF_STMT
+      case symbol_kind::S_BREAK_STMT: // BREAK_STMT
+      case symbol_kind::S_RETURN_STMT: // RETURN_STMT
+      case symbol_kind::S_WHILE_STMT: // WHILE_STMT
+      case symbol_kind::S_BLOCK_STMT: // BLOCK_STMT
+        value.move< FE::AST::StmtNode* > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_TYPE: // TYPE
+        value.move< FE::AST::Type* > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_VAR_DECLARATION: // VAR_DECLARATION
+        value.move< FE::AST::VarDeclaration* > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_VAR_DECLARATOR: // VAR_DECLARATOR
+        value.move< FE::AST::VarDeclarator* > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_FLOAT_CONST: // FLOAT_CONST
+        value.move< float > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_INT_CONST: // INT_CONST
+        value.move< int > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_LL_CONST: // LL_CONST
+        value.move< long long > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_STR_CONST: // STR_CONST
+      case symbol_kind::S_ERR_TOKEN: // ERR_TOKEN
+      case symbol_kind::S_SLASH_COMMENT: // SLASH_COMMENT
+      case symbol_kind::S_IDENT: // IDENT
+        value.move< std::string > (std::move (that.value));
+        break;
+
+      default:
+        break;
+    }
+
+      }
+#endif
+
+      /// Copy constructor.
+      basic_symbol (const basic_symbol& that);
+
+      /// Constructors for typed symbols.
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, location_type&& l)
+        : Base (t)
+        , location (std::move (l))
+      {}
+#else
+      basic_symbol (typename Base::kind_type t, const location_type& l)
+        : Base (t)
+        , location (l)
+      {}
+#endif
+
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, FE::AST::ExprNode*&& v, location_type&& l)
+        : Base (t)
+        , value (std::move (v))
+        , location (std::move (l))
+      {}
+#else
+      basic_symbol (typename Base::kind_type t, const FE::AST::ExprNode*& v, const location_type& l)
+        : Base (t)
+        , value (v)
+        , location (l)
+      {}
+#endif
+
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, FE::AST::InitDecl*&& v, location_type&& l)
+        : Base (t)
+        , value (std::move (v))
+        , location (std::move (l))
+      {}
+#else
+      basic_symbol (typename Base::kind_type t, const FE::AST::InitDecl*& v, const location_type& l)
+        : Base (t)
+        , value (v)
+        , location (l)
+      {}
+#endif
+
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, FE::AST::Operator&& v, location_type&& l)
+        : Base (t)
+        , value (std::move (v))
+        , location (std::move (l))
+      {}
+#else
+      basic_symbol (typename Base::kind_type t, const FE::AST::Operator& v, const location_type& l)
+        : Base (t)
+        , value (v)
+        , location (l)
+      {}
+#endif
+
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, FE::AST::ParamDeclarator*&& v, location_type&& l)
+        : Base (t)
+        , value (std::move (v))
+        , location (std::move (l))
+      {}
+#else
+      basic_symbol (typename Base::kind_type t, const FE::AST::ParamDeclarator*& v, const location_type& l)
+        : Base (t)
+        , value (v)
+        , location (l)
+      {}
+#endif
+
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, FE::AST::Root*&& v, location_type&& l)
+        : Base (t)
+        , value (std::move (v))
+        , location (std::move (l))
+      {}
+#else
+      basic_symbol (typename Base::kind_type t, const FE::AST::Root*& v, const location_type& l)
+        : Base (t)
+        , value (v)
+        , location (l)
+      {}
+#endif
+
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, FE::AST::Span<FE::AST::ExprNode*>*&& v, location_type&& l)
+        : Base (t)
+        , value (std::move (v))
+        , location (std::move (l))
+      {}
+#else
+      basic_symbol (typename Base::kind_type t, const FE::AST::Span<FE::AST::ExprNode*>*& v, const location_type& l)
+        : Base (t)
+        , value (v)
+        , location (l)
+      {}
+#endif
+
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, FE::AST::Span<FE::AST::InitDecl*>*&& v, location_type&& l)
+        : Base (t)
+        , value (std::move (v))
+        , location (std::move (l))
+      {}
+#else
+      basic_symbol (typename Base::kind_type t, const FE::AST::Span<FE::AST::InitDecl*>*& v, const location_type& l)
+        : Base (t)
+        , value (v)
+        , location (l)
+      {}
+#endif
+
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, FE::AST::Span<FE::AST::ParamDeclarator*>*&& v, location_type&& l)
+        : Base (t)
+        , value (std::move (v))
+        , location (std::move (l))
+      {}
+#else
+      basic_symbol (typename Base::kind_type t, const FE::AST::Span<FE::AST::ParamDeclarator*>*& v, const location_type& l)
+        : Base (t)
+        , value (v)
+        , location (l)
+      {}
+#endif
+
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, FE::AST::Span<FE::AST::StmtNode*>*&& v, location_type&& l)
+        : Base (t)
+        , value (std::move (v))
+        , location (std::move (l))
+      {}
+#else
+      basic_symbol (typename Base::kind_type t, const FE::AST::Span<FE::AST::StmtNode*>*& v, const location_type& l)
+        : Base (t)
+        , value (v)
+        , location (l)
+      {}
+#endif
+
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, FE::AST::Span<FE::AST::VarDeclarator*>*&& v, location_type&& l)
+        : Base (t)
+        , value (std::move (v))
+        , location (std::move (l))
+      {}
+#else
+      basic_symbol (typename Base::kind_type t, const FE::AST::Span<FE::AST::VarDeclarator*>*& v, const location_type& l)
+        : Base (t)
+        , value (v)
+        , location (l)
+      {}
+#endif
+
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, FE::AST::StmtNode*&& v, location_type&& l)
+        : Base (t)
+        , value (std::move (v))
+        , location (std::move (l))
+      {}
+#else
+      basic_symbol (typename Base::kind_type t, const FE::AST::StmtNode*& v, const location_type& l)
+        : Base (t)
+        , value (v)
+        , location (l)
+      {}
+#endif
+
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, FE::AST::Type*&& v, location_type&& l)
+        : Base (t)
+        , value (std::move (v))
+        , location (std::move (l))
+      {}
+#else
+      basic_symbol (typename Base::kind_type t, const FE::AST::Type*& v, const location_type& l)
+        : Base (t)
+        , value (v)
+        , location (l)
+      {}
+#endif
+
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, FE::AST::VarDeclaration*&& v, location_type&& l)
+        : Base (t)
+        , value (std::move (v))
+        , location (std::move (l))
+      {}
+#else
+      basic_symbol (typename Base::kind_type t, const FE::AST::VarDeclaration*& v, const location_type& l)
+        : Base (t)
+        , value (v)
+        , location (l)
+      {}
+#endif
+
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, FE::AST::VarDeclarator*&& v, location_type&& l)
+        : Base (t)
+        , value (std::move (v))
+        , location (std::move (l))
+      {}
+#else
+      basic_symbol (typename Base::kind_type t, const FE::AST::VarDeclarator*& v, const location_type& l)
+        : Base (t)
+        , value (v)
+        , location (l)
+      {}
+#endif
+
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, float&& v, location_type&& l)
+        : Base (t)
+        , value (std::move (v))
+        , location (std::move (l))
+      {}
+#else
+      basic_symbol (typename Base::kind_type t, const float& v, const location_type& l)
+        : Base (t)
+        , value (v)
+        , location (l)
+      {}
+#endif
+
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, int&& v, location_type&& l)
+        : Base (t)
+        , value (std::move (v))
+        , location (std::move (l))
+      {}
+#else
+      basic_symbol (typename Base::kind_type t, const int& v, const location_type& l)
+        : Base (t)
+        , value (v)
+        , location (l)
+      {}
+#endif
+
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, long long&& v, location_type&& l)
+        : Base (t)
+        , value (std::move (v))
+        , location (std::move (l))
+      {}
+#else
+      basic_symbol (typename Base::kind_type t, const long long& v, const location_type& l)
+        : Base (t)
+        , value (v)
+        , location (l)
+      {}
+#endif
+
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, std::string&& v, location_type&& l)
+        : Base (t)
+        , value (std::move (v))
+        , location (std::move (l))
+      {}
+#else
+      basic_symbol (typename Base::kind_type t, const std::string& v, const location_type& l)
+        : Base (t)
+        , value (v)
+        , location (l)
+      {}
+#endif
+
+      /// Destroy the symbol.
+      ~basic_symbol ()
+      {
+        clear ();
+      }
+
+
+
+      /// Destroy contents, and record that is empty.
+      void clear () YY_NOEXCEPT
+      {
+        // User destructor.
+        symbol_kind_type yykind = this->kind ();
+        basic_symbol<Base>& yysym = *this;
+        (void) yysym;
+        switch (yykind)
+        {
+       default:
+          break;
+        }
+
+        // Value type destructor.
+switch (yykind)
+    {
+      case symbol_kind::S_ASSIGN_EXPR: // ASSIGN_EXPR
+      case symbol_kind::S_EXPR: // EXPR
+      case symbol_kind::S_NOCOMMA_EXPR: // NOCOMMA_EXPR
+      case symbol_kind::S_LOGICAL_OR_EXPR: // LOGICAL_OR_EXPR
+      case symbol_kind::S_LOGICAL_AND_EXPR: // LOGICAL_AND_EXPR
+      case symbol_kind::S_EQUALITY_EXPR: // EQUALITY_EXPR
+      case symbol_kind::S_RELATIONAL_EXPR: // RELATIONAL_EXPR
+      case symbol_kind::S_ADDSUB_EXPR: // ADDSUB_EXPR
+      case symbol_kind::S_MULDIV_EXPR: // MULDIV_EXPR
+      case symbol_kind::S_UNARY_EXPR: // UNARY_EXPR
+      case symbol_kind::S_BASIC_EXPR: // BASIC_EXPR
+      case symbol_kind::S_FUNC_CALL_EXPR: // FUNC_CALL_EXPR
+      case symbol_kind::S_ARRAY_DIMENSION_EXPR: // ARRAY_DIMENSION_EXPR
+      case symbol_kind::S_LEFT_VAL_EXPR: // LEFT_VAL_EXPR
+      case symbol_kind::S_LITERAL_EXPR: // LITERAL_EXPR
+        value.template destroy< FE::AST::ExprNode* > ();
+        break;
+
+      case symbol_kind::S_INITIALIZER: // INITIALIZER
+        value.template destroy< FE::AST::InitDecl* > ();
+        break;
+
+      case symbol_kind::S_UNARY_OP: // UNARY_OP
+        value.template destroy< FE::AST::Operator > ();
+        break;
+
+      case symbol_kind::S_PARAM_DECLARATOR: // PARAM_DECLARATOR
+        value.template destroy< FE::AST::ParamDeclarator* > ();
+        break;
+
+      case symbol_kind::S_PROGRAM: // PROGRAM
+        value.template destroy< FE::AST::Root* > ();
+        break;
+
+      case symbol_kind::S_EXPR_LIST: // EXPR_LIST
+      case symbol_kind::S_ARRAY_DIMENSION_EXPR_LIST: // ARRAY_DIMENSION_EXPR_LIST
+        value.template destroy< FE::AST::Span<FE::AST::ExprNode*>* > ();
+        break;
+
+      case symbol_kind::S_INITIALIZER_LIST: // INITIALIZER_LIST
+        value.template destroy< FE::AST::Span<FE::AST::InitDecl*>* > ();
+        break;
+
+      case symbol_kind::S_PARAM_DECLARATOR_LIST: // PARAM_DECLARATOR_LIST
+        value.template destroy< FE::AST::Span<FE::AST::ParamDeclarator*>* > ();
+        break;
+
+      case symbol_kind::S_TOP_STMT_LIST: // TOP_STMT_LIST
+      case symbol_kind::S_STMT_LIST: // STMT_LIST
+        value.template destroy< FE::AST::Span<FE::AST::StmtNode*>* > ();
+        break;
+
+      case symbol_kind::S_VAR_DECLARATOR_LIST: // VAR_DECLARATOR_LIST
+        value.template destroy< FE::AST::Span<FE::AST::VarDeclarator*>* > ();
+        break;
+
+      case symbol_kind::S_STMT: // STMT
+      case symbol_kind::S_CONTINUE_STMT: // CONTINUE_STMT
+      case symbol_kind::S_EXPR_STMT: // EXPR_STMT
+      case symbol_kind::S_VAR_DECL_STMT: // VAR_DECL_STMT
+      case symbol_kind::S_FUNC_BODY: // FUNC_BODY
+      case symbol_kind::S_FUNC_DECL_STMT: // FUNC_DECL_STMT
+      case symbol_kind::S_FOR_STMT: // FOR_STMT
+      case symbol_kind::S_IF_STMT: // IF_STMT
+      case symbol_kind::S_BREAK_STMT: // BREAK_STMT
+      case symbol_kind::S_RETURN_STMT: // RETURN_STMT
+      case symbol_kind::S_WHILE_STMT: // WHILE_STMT
+      case symbol_kind::S_BLOCK_STMT: // BLOCK_STMT
+        value.template destroy< FE::AST::StmtNode* > ();
+        break;
+
+      case symbol_kind::S_TYPE: // TYPE
+        value.template destroy< FE::AST::Type* > ();
+        break;
+
+      case symbol_kind::S_VAR_DECLARATION: // VAR_DECLARATION
+        value.template destroy< FE::AST::VarDeclaration* > ();
+        break;
+
+      case symbol_kind::S_VAR_DECLARATOR: // VAR_DECLARATOR
+        value.template destroy< FE::AST::VarDeclarator* > ();
+        break;
+
+      case symbol_kind::S_FLOAT_CONST: // FLOAT_CONST
+        value.template destroy< float > ();
+        break;
+
+      case symbol_kind::S_INT_CONST: // INT_CONST
+        value.template destroy< int > ();
+        break;
+
+      case symbol_kind::S_LL_CONST: // LL_CONST
+        value.template destroy< long long > ();
+        break;
+
+      case symbol_kind::S_STR_CONST: // STR_CONST
+      case symbol_kind::S_ERR_TOKEN: // ERR_TOKEN
+      case symbol_kind::S_SLASH_COMMENT: // SLASH_COMMENT
+      case symbol_kind::S_IDENT: // IDENT
+        value.template destroy< std::string > ();
+        break;
+
+      default:
+        break;
+    }
+
+        Base::clear ();
+      }
+
+      /// The user-facing name of this symbol.
+      std::string name () const YY_NOEXCEPT
+      {
+        return  YaccParser ::symbol_name (this->kind ());
+      }
+
+      /// Backward compatibility (Bison 3.6).
+      symbol_kind_type type_get () const YY_NOEXCEPT;
+
+      /// Whether empty.
+      bool empty () const YY_NOEXCEPT;
+
+      /// Destructive move, \a s is emptied into this.
+      void move (basic_symbol& s);
+
+      /// The semantic value.
+      value_type value;
+
+      /// The location.
+      location_type location;
+
+    private:
+#if YY_CPLUSPLUS < 201103L
+      /// Assignment operator.
+      basic_symbol& operator= (const basic_symbol& that);
+#endif
+    };
+
+    /// Type access provider for token (enum) based symbols.
+    struct by_kind
+    {
+      /// The symbol kind as needed by the constructor.
+      typedef token_kind_type kind_type;
+
+      /// Default constructor.
+      by_kind () YY_NOEXCEPT;
+
+#if 201103L <= YY_CPLUSPLUS
+      /// Move constructor.
+      by_kind (by_kind&& that) YY_NOEXCEPT;
+#endif
+
+      /// Copy constructor.
+      by_kind (const by_kind& that) YY_NOEXCEPT;
+
+      /// Constructor from (external) token numbers.
+      by_kind (kind_type t) YY_NOEXCEPT;
+
+
+
+      /// Record that this symbol is empty.
+      void clear () YY_NOEXCEPT;
+
+      /// Steal the symbol kind from \a that.
+      void move (by_kind& that);
+
+      /// The (internal) type number (corresponding to \a type).
+      /// \a empty when empty.
+      symbol_kind_type kind () const YY_NOEXCEPT;
+
+      /// Backward compatibility (Bison 3.6).
+      symbol_kind_type type_get () const YY_NOEXCEPT;
+
+      /// The symbol kind.
+      /// \a S_YYEMPTY when empty.
+      symbol_kind_type kind_;
+    };
+
+    /// Backward compatibility for a private implementation detail (Bison 3.6).
+    typedef by_kind by_type;
+
+    /// "External" symbols: returned by the scanner.
+    struct symbol_type : basic_symbol<by_kind>
+    {
+      /// Superclass.
+      typedef basic_symbol<by_kind> super_type;
+
+      /// Empty symbol.
+      symbol_type () YY_NOEXCEPT {}
+
+      /// Constructor for valueless symbols, and symbols from each type.
+#if 201103L <= YY_CPLUSPLUS
+      symbol_type (int tok, location_type l)
+        : super_type (token_kind_type (tok), std::move (l))
+#else
+      symbol_type (int tok, const location_type& l)
+        : super_type (token_kind_type (tok), l)
+#endif
+      {
+#if !defined _MSC_VER || defined __clang__
+        YY_ASSERT (tok == token::TOKEN_YYEOF
+                   || (token::TOKEN_YYerror <= tok && tok <= token::TOKEN_YYUNDEF)
+                   || (token::TOKEN_PLUS <= tok && tok <= token::TOKEN_THEN));
+#endif
+      }
+#if 201103L <= YY_CPLUSPLUS
+      symbol_type (int tok, float v, location_type l)
+        : super_type (token_kind_type (tok), std::move (v), std::move (l))
+#else
+      symbol_type (int tok, const float& v, const location_type& l)
+        : super_type (token_kind_type (tok), v, l)
+#endif
+      {
+#if !defined _MSC_VER || defined __clang__
+        YY_ASSERT (tok == token::TOKEN_FLOAT_CONST);
+#endif
+      }
+#if 201103L <= YY_CPLUSPLUS
+      symbol_type (int tok, int v, location_type l)
+        : super_type (token_kind_type (tok), std::move (v), std::move (l))
+#else
+      symbol_type (int tok, const int& v, const location_type& l)
+        : super_type (token_kind_type (tok), v, l)
+#endif
+      {
+#if !defined _MSC_VER || defined __clang__
+        YY_ASSERT (tok == token::TOKEN_INT_CONST);
+#endif
+      }
+#if 201103L <= YY_CPLUSPLUS
+      symbol_type (int tok, long long v, location_type l)
+        : super_type (token_kind_type (tok), std::move (v), std::move (l))
+#else
+      symbol_type (int tok, const long long& v, const location_type& l)
+        : super_type (token_kind_type (tok), v, l)
+#endif
+      {
+#if !defined _MSC_VER || defined __clang__
+        YY_ASSERT (tok == token::TOKEN_LL_CONST);
+#endif
+      }
+#if 201103L <= YY_CPLUSPLUS
+      symbol_type (int tok, std::string v, location_type l)
+        : super_type (token_kind_type (tok), std::move (v), std::move (l))
+#else
+      symbol_type (int tok, const std::string& v, const location_type& l)
+        : super_type (token_kind_type (tok), v, l)
+#endif
+      {
+#if !defined _MSC_VER || defined __clang__
+        YY_ASSERT ((token::TOKEN_STR_CONST <= tok && tok <= token::TOKEN_IDENT));
+#endif
+      }
+    };
+
+    /// Build a parser object.
+     YaccParser  (FE::Scanner& scanner_yyarg, FE::Parser& parser_yyarg);
+    virtual ~ YaccParser  ();
+
+#if 201103L <= YY_CPLUSPLUS
+    /// Non copyable.
+     YaccParser  (const  YaccParser &) = delete;
+    /// Non copyable.
+     YaccParser & operator= (const  YaccParser &) = delete;
+#endif
+
+    /// Parse.  An alias for parse ().
+    /// \returns  0 iff parsing succeeded.
+    int operator() ();
+
+    /// Parse.
+    /// \returns  0 iff parsing succeeded.
+    virtual int parse ();
+
+#if YYDEBUG
+    /// The current debugging stream.
+    std::ostream& debug_stream () const YY_ATTRIBUTE_PURE;
+    /// Set the current debugging stream.
+    void set_debug_stream (std::ostream &);
+
+    /// Type for debugging levels.
+    typedef int debug_level_type;
+    /// The current debugging level.
+    debug_level_type debug_level () const YY_ATTRIBUTE_PURE;
+    /// Set the current debugging level.
+    void set_debug_level (debug_level_type l);
+#endif
+
+    /// Report a syntax error.
+    /// \param loc    where the syntax error is found.
+    /// \param msg    a description of the syntax error.
+    virtual void error (const location_type& loc, const std::string& msg);
+
+    /// Report a syntax error.
+    void error (const syntax_error& err);
+
+    /// The user-facing name of the symbol whose (internal) number is
+    /// YYSYMBOL.  No bounds checking.
+    static std::string symbol_name (symbol_kind_type yysymbol);
+
+    // Implementation of make_symbol for each token kind.
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_YYEOF (location_type l)
+      {
+        return symbol_type (token::TOKEN_YYEOF, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_YYEOF (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_YYEOF, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_YYerror (location_type l)
+      {
+        return symbol_type (token::TOKEN_YYerror, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_YYerror (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_YYerror, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_YYUNDEF (location_type l)
+      {
+        return symbol_type (token::TOKEN_YYUNDEF, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_YYUNDEF (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_YYUNDEF, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_INT_CONST (int v, location_type l)
+      {
+        return symbol_type (token::TOKEN_INT_CONST, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_INT_CONST (const int& v, const location_type& l)
+      {
+        return symbol_type (token::TOKEN_INT_CONST, v, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_LL_CONST (long long v, location_type l)
+      {
+        return symbol_type (token::TOKEN_LL_CONST, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_LL_CONST (const long long& v, const location_type& l)
+      {
+        return symbol_type (token::TOKEN_LL_CONST, v, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_FLOAT_CONST (float v, location_type l)
+      {
+        return symbol_type (token::TOKEN_FLOAT_CONST, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_FLOAT_CONST (const float& v, const location_type& l)
+      {
+        return symbol_type (token::TOKEN_FLOAT_CONST, v, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_STR_CONST (std::string v, location_type l)
+      {
+        return symbol_type (token::TOKEN_STR_CONST, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_STR_CONST (const std::string& v, const location_type& l)
+      {
+        return symbol_type (token::TOKEN_STR_CONST, v, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_ERR_TOKEN (std::string v, location_type l)
+      {
+        return symbol_type (token::TOKEN_ERR_TOKEN, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_ERR_TOKEN (const std::string& v, const location_type& l)
+      {
+        return symbol_type (token::TOKEN_ERR_TOKEN, v, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SLASH_COMMENT (std::string v, location_type l)
+      {
+        return symbol_type (token::TOKEN_SLASH_COMMENT, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SLASH_COMMENT (const std::string& v, const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SLASH_COMMENT, v, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_IDENT (std::string v, location_type l)
+      {
+        return symbol_type (token::TOKEN_IDENT, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_IDENT (const std::string& v, const location_type& l)
+      {
+        return symbol_type (token::TOKEN_IDENT, v, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_PLUS (location_type l)
+      {
+        return symbol_type (token::TOKEN_PLUS, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_PLUS (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_PLUS, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_MINUS (location_type l)
+      {
+        return symbol_type (token::TOKEN_MINUS, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_MINUS (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_MINUS, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_STAR (location_type l)
+      {
+        return symbol_type (token::TOKEN_STAR, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_STAR (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_STAR, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SLASH (location_type l)
+      {
+        return symbol_type (token::TOKEN_SLASH, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SLASH (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SLASH, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_ASSIGN (location_type l)
+      {
+        return symbol_type (token::TOKEN_ASSIGN, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_ASSIGN (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_ASSIGN, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_PERCENT (location_type l)
+      {
+        return symbol_type (token::TOKEN_PERCENT, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_PERCENT (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_PERCENT, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_LT (location_type l)
+      {
+        return symbol_type (token::TOKEN_LT, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_LT (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_LT, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_GT (location_type l)
+      {
+        return symbol_type (token::TOKEN_GT, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_GT (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_GT, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_LE (location_type l)
+      {
+        return symbol_type (token::TOKEN_LE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_LE (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_LE, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_GE (location_type l)
+      {
+        return symbol_type (token::TOKEN_GE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_GE (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_GE, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_EQ (location_type l)
+      {
+        return symbol_type (token::TOKEN_EQ, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_EQ (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_EQ, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_NEQ (location_type l)
+      {
+        return symbol_type (token::TOKEN_NEQ, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_NEQ (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_NEQ, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_AND (location_type l)
+      {
+        return symbol_type (token::TOKEN_AND, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_AND (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_AND, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_OR (location_type l)
+      {
+        return symbol_type (token::TOKEN_OR, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_OR (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_OR, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_NOT (location_type l)
+      {
+        return symbol_type (token::TOKEN_NOT, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_NOT (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_NOT, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_INT (location_type l)
+      {
+        return symbol_type (token::TOKEN_INT, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_INT (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_INT, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_FLOAT (location_type l)
+      {
+        return symbol_type (token::TOKEN_FLOAT, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_FLOAT (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_FLOAT, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_VOID (location_type l)
+      {
+        return symbol_type (token::TOKEN_VOID, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_VOID (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_VOID, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_CHAR (location_type l)
+      {
+        return symbol_type (token::TOKEN_CHAR, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_CHAR (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_CHAR, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_LONG_LONG (location_type l)
+      {
+        return symbol_type (token::TOKEN_LONG_LONG, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_LONG_LONG (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_LONG_LONG, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_IF (location_type l)
+      {
+        return symbol_type (token::TOKEN_IF, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_IF (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_IF, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_ELSE (location_type l)
+      {
+        return symbol_type (token::TOKEN_ELSE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_ELSE (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_ELSE, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_FOR (location_type l)
+      {
+        return symbol_type (token::TOKEN_FOR, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_FOR (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_FOR, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_WHILE (location_type l)
+      {
+        return symbol_type (token::TOKEN_WHILE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_WHILE (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_WHILE, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_CONTINUE (location_type l)
+      {
+        return symbol_type (token::TOKEN_CONTINUE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_CONTINUE (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_CONTINUE, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_BREAK (location_type l)
+      {
+        return symbol_type (token::TOKEN_BREAK, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_BREAK (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_BREAK, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SWITCH (location_type l)
+      {
+        return symbol_type (token::TOKEN_SWITCH, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SWITCH (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SWITCH, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_CASE (location_type l)
+      {
+        return symbol_type (token::TOKEN_CASE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_CASE (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_CASE, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_GOTO (location_type l)
+      {
+        return symbol_type (token::TOKEN_GOTO, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_GOTO (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_GOTO, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_DO (location_type l)
+      {
+        return symbol_type (token::TOKEN_DO, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_DO (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_DO, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_RETURN (location_type l)
+      {
+        return symbol_type (token::TOKEN_RETURN, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_RETURN (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_RETURN, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_CONST (location_type l)
+      {
+        return symbol_type (token::TOKEN_CONST, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_CONST (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_CONST, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SEMICOLON (location_type l)
+      {
+        return symbol_type (token::TOKEN_SEMICOLON, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SEMICOLON (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SEMICOLON, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_COMMA (location_type l)
+      {
+        return symbol_type (token::TOKEN_COMMA, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_COMMA (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_COMMA, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_LPAREN (location_type l)
+      {
+        return symbol_type (token::TOKEN_LPAREN, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_LPAREN (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_LPAREN, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_RPAREN (location_type l)
+      {
+        return symbol_type (token::TOKEN_RPAREN, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_RPAREN (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_RPAREN, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_LBRACKET (location_type l)
+      {
+        return symbol_type (token::TOKEN_LBRACKET, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_LBRACKET (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_LBRACKET, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_RBRACKET (location_type l)
+      {
+        return symbol_type (token::TOKEN_RBRACKET, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_RBRACKET (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_RBRACKET, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_LBRACE (location_type l)
+      {
+        return symbol_type (token::TOKEN_LBRACE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_LBRACE (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_LBRACE, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_RBRACE (location_type l)
+      {
+        return symbol_type (token::TOKEN_RBRACE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_RBRACE (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_RBRACE, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_END (location_type l)
+      {
+        return symbol_type (token::TOKEN_END, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_END (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_END, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_THEN (location_type l)
+      {
+        return symbol_type (token::TOKEN_THEN, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_THEN (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_THEN, l);
+      }
+#endif
+
+
+    class context
+    {
+    public:
+      context (const  YaccParser & yyparser, const symbol_type& yyla);
+      const symbol_type& lookahead () const YY_NOEXCEPT { return yyla_; }
+      symbol_kind_type token () const YY_NOEXCEPT { return yyla_.kind (); }
+      const location_type& location () const YY_NOEXCEPT { return yyla_.location; }
+
+      /// Put in YYARG at most YYARGN of the expected tokens, and return the
+      /// number of tokens stored in YYARG.  If YYARG is null, return the
+      /// number of expected tokens (guaranteed to be less than YYNTOKENS).
+      int expected_tokens (symbol_kind_type yyarg[], int yyargn) const;
+
+    private:
+      const  YaccParser & yyparser_;
+      const symbol_type& yyla_;
+    };
+
+  private:
+#if YY_CPLUSPLUS < 201103L
+    /// Non copyable.
+     YaccParser  (const  YaccParser &);
+    /// Non copyable.
+     YaccParser & operator= (const  YaccParser &);
+#endif
+
+
+    /// Stored state numbers (used for stacks).
+    typedef unsigned char state_type;
+
+    /// The arguments of the error message.
+    int yy_syntax_error_arguments_ (const context& yyctx,
+                                    symbol_kind_type yyarg[], int yyargn) const;
+
+    /// Generate an error message.
+    /// \param yyctx     the context in which the error occurred.
+    virtual std::string yysyntax_error_ (const context& yyctx) const;
+    /// Compute post-reduction state.
+    /// \param yystate   the current state
+    /// \param yysym     the nonterminal to push on the stack
+    static state_type yy_lr_goto_state_ (state_type yystate, int yysym);
+
+    /// Whether the given \c yypact_ value indicates a defaulted state.
+    /// \param yyvalue   the value to check
+    static bool yy_pact_value_is_default_ (int yyvalue) YY_NOEXCEPT;
+
+    /// Whether the given \c yytable_ value indicates a syntax error.
+    /// \param yyvalue   the value to check
+    static bool yy_table_value_is_error_ (int yyvalue) YY_NOEXCEPT;
+
+    static const signed char yypact_ninf_;
+    static const signed char yytable_ninf_;
+
+    /// Convert a scanner token kind \a t to a symbol kind.
+    /// In theory \a t should be a token_kind_type, but character literals
+    /// are valid, yet not members of the token_kind_type enum.
+    static symbol_kind_type yytranslate_ (int t) YY_NOEXCEPT;
+
+    /// Convert the symbol name \a n to a form suitable for a diagnostic.
+    static std::string yytnamerr_ (const char *yystr);
+
+    /// For a symbol, its name in clear.
+    static const char* const yytname_[];
+
+
+    // Tables.
+    // YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
+    // STATE-NUM.
+    static const short yypact_[];
+
+    // YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
+    // Performed when YYTABLE does not specify something else to do.  Zero
+    // means the default is an error.
+    static const signed char yydefact_[];
+
+    // YYPGOTO[NTERM-NUM].
+    static const short yypgoto_[];
+
+    // YYDEFGOTO[NTERM-NUM].
+    static const unsigned char yydefgoto_[];
+
+    // YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
+    // positive, shift that token.  If negative, reduce the rule whose
+    // number is the opposite.  If YYTABLE_NINF, syntax error.
+    static const unsigned char yytable_[];
+
+    static const short yycheck_[];
+
+    // YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
+    // state STATE-NUM.
+    static const signed char yystos_[];
+
+    // YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.
+    static const signed char yyr1_[];
+
+    // YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.
+    static const signed char yyr2_[];
+
+
+#if YYDEBUG
+    // YYRLINE[YYN] -- Source line where rule number YYN was defined.
+    static const short yyrline_[];
+    /// Report on the debug stream that the rule \a r is going to be reduced.
+    virtual void yy_reduce_print_ (int r) const;
+    /// Print the state stack on the debug stream.
+    virtual void yy_stack_print_ () const;
+
+    /// Debugging level.
+    int yydebug_;
+    /// Debug stream.
+    std::ostream* yycdebug_;
+
+    /// \brief Display a symbol kind, value and location.
+    /// \param yyo    The output stream.
+    /// \param yysym  The symbol.
+    template <typename Base>
+    void yy_print_ (std::ostream& yyo, const basic_symbol<Base>& yysym) const;
+#endif
+
+    /// \brief Reclaim the memory associated to a symbol.
+    /// \param yymsg     Why this token is reclaimed.
+    ///                  If null, print nothing.
+    /// \param yysym     The symbol.
+    template <typename Base>
+    void yy_destroy_ (const char* yymsg, basic_symbol<Base>& yysym) const;
+
+  private:
+    /// Type access provider for state based symbols.
+    struct by_state
+    {
+      /// Default constructor.
+      by_state () YY_NOEXCEPT;
+
+      /// The symbol kind as needed by the constructor.
+      typedef state_type kind_type;
+
+      /// Constructor.
+      by_state (kind_type s) YY_NOEXCEPT;
+
+      /// Copy constructor.
+      by_state (const by_state& that) YY_NOEXCEPT;
+
+      /// Record that this symbol is empty.
+      void clear () YY_NOEXCEPT;
+
+      /// Steal the symbol kind from \a that.
+      void move (by_state& that);
+
+      /// The symbol kind (corresponding to \a state).
+      /// \a symbol_kind::S_YYEMPTY when empty.
+      symbol_kind_type kind () const YY_NOEXCEPT;
+
+      /// The state number used to denote an empty symbol.
+      /// We use the initial state, as it does not have a value.
+      enum { empty_state = 0 };
+
+      /// The state.
+      /// \a empty when empty.
+      state_type state;
+    };
+
+    /// "Internal" symbol: element of the stack.
+    struct stack_symbol_type : basic_symbol<by_state>
+    {
+      /// Superclass.
+      typedef basic_symbol<by_state> super_type;
+      /// Construct an empty symbol.
+      stack_symbol_type ();
+      /// Move or copy construction.
+      stack_symbol_type (YY_RVREF (stack_symbol_type) that);
+      /// Steal the contents from \a sym to build this.
+      stack_symbol_type (state_type s, YY_MOVE_REF (symbol_type) sym);
+#if YY_CPLUSPLUS < 201103L
+      /// Assignment, needed by push_back by some old implementations.
+      /// Moves the contents of that.
+      stack_symbol_type& operator= (stack_symbol_type& that);
+
+      /// Assignment, needed by push_back by other implementations.
+      /// Needed by some other old implementations.
+      stack_symbol_type& operator= (const stack_symbol_type& that);
+#endif
+    };
+
+    /// A stack with random access from its top.
+    template <typename T, typename S = std::vector<T> >
+    class stack
+    {
+    public:
+      // Hide our reversed order.
+      typedef typename S::iterator iterator;
+      typedef typename S::const_iterator const_iterator;
+      typedef typename S::size_type size_type;
+      typedef typename std::ptrdiff_t index_type;
+
+      stack (size_type n = 200) YY_NOEXCEPT
+        : seq_ (n)
+      {}
+
+#if 201103L <= YY_CPLUSPLUS
+      /// Non copyable.
+      stack (const stack&) = delete;
+      /// Non copyable.
+      stack& operator= (const stack&) = delete;
+#endif
+
+      /// Random access.
+      ///
+      /// Index 0 returns the topmost element.
+      const T&
+      operator[] (index_type i) const
+      {
+        return seq_[size_type (size () - 1 - i)];
+      }
+
+      /// Random access.
+      ///
+      /// Index 0 returns the topmost element.
+      T&
+      operator[] (index_type i)
+      {
+        return seq_[size_type (size () - 1 - i)];
+      }
+
+      /// Steal the contents of \a t.
+      ///
+      /// Close to move-semantics.
+      void
+      push (YY_MOVE_REF (T) t)
+      {
+        seq_.push_back (T ());
+        operator[] (0).move (t);
+      }
+
+      /// Pop elements from the stack.
+      void
+      pop (std::ptrdiff_t n = 1) YY_NOEXCEPT
+      {
+        for (; 0 < n; --n)
+          seq_.pop_back ();
+      }
+
+      /// Pop all elements from the stack.
+      void
+      clear () YY_NOEXCEPT
+      {
+        seq_.clear ();
+      }
+
+      /// Number of elements on the stack.
+      index_type
+      size () const YY_NOEXCEPT
+      {
+        return index_type (seq_.size ());
+      }
+
+      /// Iterator on top of the stack (going downwards).
+      const_iterator
+      begin () const YY_NOEXCEPT
+      {
+        return seq_.begin ();
+      }
+
+      /// Bottom of the stack.
+      const_iterator
+      end () const YY_NOEXCEPT
+      {
+        return seq_.end ();
+      }
+
+      /// Present a slice of the top of a stack.
+      class slice
+      {
+      public:
+        slice (const stack& stack, index_type range) YY_NOEXCEPT
+          : stack_ (stack)
+          , range_ (range)
+        {}
+
+        const T&
+        operator[] (index_type i) const
+        {
+          return stack_[range_ - i];
+        }
+
+      private:
+        const stack& stack_;
+        index_type range_;
+      };
+
+    private:
+#if YY_CPLUSPLUS < 201103L
+      /// Non copyable.
+      stack (const stack&);
+      /// Non copyable.
+      stack& operator= (const stack&);
+#endif
+      /// The wrapped container.
+      S seq_;
+    };
+
+
+    /// Stack type.
+    typedef stack<stack_symbol_type> stack_type;
+
+    /// The stack.
+    stack_type yystack_;
+
+    /// Push a new state on the stack.
+    /// \param m    a debug message to display
+    ///             if null, no trace is output.
+    /// \param sym  the symbol
+    /// \warning the contents of \a s.value is stolen.
+    void yypush_ (const char* m, YY_MOVE_REF (stack_symbol_type) sym);
+
+    /// Push a new look ahead token on the state on the stack.
+    /// \param m    a debug message to display
+    ///             if null, no trace is output.
+    /// \param s    the state
+    /// \param sym  the symbol (for its value and location).
+    /// \warning the contents of \a sym.value is stolen.
+    void yypush_ (const char* m, state_type s, YY_MOVE_REF (symbol_type) sym);
+
+    /// Pop \a n symbols from the stack.
+    void yypop_ (int n = 1) YY_NOEXCEPT;
+
+    /// Constants.
+    enum
+    {
+      yylast_ = 478,     ///< Last index in yytable_.
+      yynnts_ = 42,  ///< Number of nonterminal symbols.
+      yyfinal_ = 69 ///< Termination state number.
+    };
+
+
+    // User arguments.
+    FE::Scanner& scanner;
+    FE::Parser& parser;
+
+  };
+
+  inline
+   YaccParser ::symbol_kind_type
+   YaccParser ::yytranslate_ (int t) YY_NOEXCEPT
+  {
+    // YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to
+    // TOKEN-NUM as returned by yylex.
+    static
+    const signed char
+    translate_table[] =
+    {
+       0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     1,     2,     3,     4,
+       5,     6,     7,     8,     9,    10,    11,    12,    13,    14,
+      15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
+      25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
+      35,    36,    37,    38,    39,    40,    41,    42,    43,    44,
+      45,    46,    47,    48,    49,    50,    51
+    };
+    // Last valid token kind.
+    const int code_max = 306;
+
+    if (t <= 0)
+      return symbol_kind::S_YYEOF;
+    else if (t <= code_max)
+      return static_cast <symbol_kind_type> (translate_table[t]);
+    else
+      return symbol_kind::S_YYUNDEF;
+  }
+
+  // basic_symbol.
+  template <typename Base>
+   YaccParser ::basic_symbol<Base>::basic_symbol (const basic_symbol& that)
+    : Base (that)
+    , value ()
+    , location (that.location)
+  {
+    switch (this->kind ())
+    {
+      case symbol_kind::S_ASSIGN_EXPR: // ASSIGN_EXPR
+      case symbol_kind::S_EXPR: // EXPR
+      case symbol_kind::S_NOCOMMA_EXPR: // NOCOMMA_EXPR
+      case symbol_kind::S_LOGICAL_OR_EXPR: // LOGICAL_OR_EXPR
+      case symbol_kind::S_LOGICAL_AND_EXPR: // LOGICAL_AND_EXPR
+      case symbol_kind::S_EQUALITY_EXPR: // EQUALITY_EXPR
+      case symbol_kind::S_RELATIONAL_EXPR: // RELATIONAL_EXPR
+      case symbol_kind::S_ADDSUB_EXPR: // ADDSUB_EXPR
+      case symbol_kind::S_MULDIV_EXPR: // MULDIV_EXPR
+      case symbol_kind::S_UNARY_EXPR: // UNARY_EXPR
+      case symbol_kind::S_BASIC_EXPR: // BASIC_EXPR
+      case symbol_kind::S_FUNC_CALL_EXPR: // FUNC_CALL_EXPR
+      case symbol_kind::S_ARRAY_DIMENSION_EXPR: // ARRAY_DIMENSION_EXPR
+      case symbol_kind::S_LEFT_VAL_EXPR: // LEFT_VAL_EXPR
+      case symbol_kind::S_LITERAL_EXPR: // LITERAL_EXPR
+        value.copy< FE::AST::ExprNode* > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_INITIALIZER: // INITIALIZER
+        value.copy< FE::AST::InitDecl* > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_UNARY_OP: // UNARY_OP
+        value.copy< FE::AST::Operator > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_PARAM_DECLARATOR: // PARAM_DECLARATOR
+        value.copy< FE::AST::ParamDeclarator* > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_PROGRAM: // PROGRAM
+        value.copy< FE::AST::Root* > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_EXPR_LIST: // EXPR_LIST
+      case symbol_kind::S_ARRAY_DIMENSION_EXPR_LIST: // ARRAY_DIMENSION_EXPR_LIST
+        value.copy< FE::AST::Span<FE::AST::ExprNode*>* > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_INITIALIZER_LIST: // INITIALIZER_LIST
+        value.copy< FE::AST::Span<FE::AST::InitDecl*>* > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_PARAM_DECLARATOR_LIST: // PARAM_DECLARATOR_LIST
+        value.copy< FE::AST::Span<FE::AST::ParamDeclarator*>* > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_TOP_STMT_LIST: // TOP_STMT_LIST
+      case symbol_kind::S_STMT_LIST: // STMT_LIST
+        value.copy< FE::AST::Span<FE::AST::StmtNode*>* > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_VAR_DECLARATOR_LIST: // VAR_DECLARATOR_LIST
+        value.copy< FE::AST::Span<FE::AST::VarDeclarator*>* > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_STMT: // STMT
+      case symbol_kind::S_CONTINUE_STMT: // CONTINUE_STMT
+      case symbol_kind::S_EXPR_STMT: // EXPR_STMT
+      case symbol_kind::S_VAR_DECL_STMT: // VAR_DECL_STMT
+      case symbol_kind::S_FUNC_BODY: // FUNC_BODY
+      case symbol_kind::S_FUNC_DECL_STMT: // FUNC_DECL_STMT
+      case symbol_kind::S_FOR_STMT: // FOR_STMT
+      case symbol_kind::S_IF_STMT: // IF_STMT
+      case symbol_kind::S_BREAK_STMT: // BREAK_STMT
+      case symbol_kind::S_RETURN_STMT: // RETURN_STMT
+      case symbol_kind::S_WHILE_STMT: // WHILE_STMT
+      case symbol_kind::S_BLOCK_STMT: // BLOCK_STMT
+        value.copy< FE::AST::StmtNode* > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_TYPE: // TYPE
+        value.copy< FE::AST::Type* > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_VAR_DECLARATION: // VAR_DECLARATION
+        value.copy< FE::AST::VarDeclaration* > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_VAR_DECLARATOR: // VAR_DECLARATOR
+        value.copy< FE::AST::VarDeclarator* > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_FLOAT_CONST: // FLOAT_CONST
+        value.copy< float > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_INT_CONST: // INT_CONST
+        value.copy< int > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_LL_CONST: // LL_CONST
+        value.copy< long long > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_STR_CONST: // STR_CONST
+      case symbol_kind::S_ERR_TOKEN: // ERR_TOKEN
+      case symbol_kind::S_SLASH_COMMENT: // SLASH_COMMENT
+      case symbol_kind::S_IDENT: // IDENT
+        value.copy< std::string > (YY_MOVE (that.value));
+        break;
+
+      default:
+        break;
+    }
+
+  }
+
+
+
+
+  template <typename Base>
+   YaccParser ::symbol_kind_type
+   YaccParser ::basic_symbol<Base>::type_get () const YY_NOEXCEPT
+  {
+    return this->kind ();
+  }
+
+
+  template <typename Base>
+  bool
+   YaccParser ::basic_symbol<Base>::empty () const YY_NOEXCEPT
+  {
+    return this->kind () == symbol_kind::S_YYEMPTY;
+  }
+
+  template <typename Base>
+  void
+   YaccParser ::basic_symbol<Base>::move (basic_symbol& s)
+  {
+    super_type::move (s);
+    switch (this->kind ())
+    {
+      case symbol_kind::S_ASSIGN_EXPR: // ASSIGN_EXPR
+      case symbol_kind::S_EXPR: // EXPR
+      case symbol_kind::S_NOCOMMA_EXPR: // NOCOMMA_EXPR
+      case symbol_kind::S_LOGICAL_OR_EXPR: // LOGICAL_OR_EXPR
+      case symbol_kind::S_LOGICAL_AND_EXPR: // LOGICAL_AND_EXPR
+      case symbol_kind::S_EQUALITY_EXPR: // EQUALITY_EXPR
+      case symbol_kind::S_RELATIONAL_EXPR: // RELATIONAL_EXPR
+      case symbol_kind::S_ADDSUB_EXPR: // ADDSUB_EXPR
+      case symbol_kind::S_MULDIV_EXPR: // MULDIV_EXPR
+      case symbol_kind::S_UNARY_EXPR: // UNARY_EXPR
+      case symbol_kind::S_BASIC_EXPR: // BASIC_EXPR
+      case symbol_kind::S_FUNC_CALL_EXPR: // FUNC_CALL_EXPR
+      case symbol_kind::S_ARRAY_DIMENSION_EXPR: // ARRAY_DIMENSION_EXPR
+      case symbol_kind::S_LEFT_VAL_EXPR: // LEFT_VAL_EXPR
+      case symbol_kind::S_LITERAL_EXPR: // LITERAL_EXPR
+        value.move< FE::AST::ExprNode* > (YY_MOVE (s.value));
+        break;
+
+      case symbol_kind::S_INITIALIZER: // INITIALIZER
+        value.move< FE::AST::InitDecl* > (YY_MOVE (s.value));
+        break;
+
+      case symbol_kind::S_UNARY_OP: // UNARY_OP
+        value.move< FE::AST::Operator > (YY_MOVE (s.value));
+        break;
+
+      case symbol_kind::S_PARAM_DECLARATOR: // PARAM_DECLARATOR
+        value.move< FE::AST::ParamDeclarator* > (YY_MOVE (s.value));
+        break;
+
+      case symbol_kind::S_PROGRAM: // PROGRAM
+        value.move< FE::AST::Root* > (YY_MOVE (s.value));
+        break;
+
+      case symbol_kind::S_EXPR_LIST: // EXPR_LIST
+      case symbol_kind::S_ARRAY_DIMENSION_EXPR_LIST: // ARRAY_DIMENSION_EXPR_LIST
+        value.move< FE::AST::Span<FE::AST::ExprNode*>* > (YY_MOVE (s.value));
+        break;
+
+      case symbol_kind::S_INITIALIZER_LIST: // INITIALIZER_LIST
+        value.move< FE::AST::Span<FE::AST::InitDecl*>* > (YY_MOVE (s.value));
+        break;
+
+      case symbol_kind::S_PARAM_DECLARATOR_LIST: // PARAM_DECLARATOR_LIST
+        value.move< FE::AST::Span<FE::AST::ParamDeclarator*>* > (YY_MOVE (s.value));
+        break;
+
+      case symbol_kind::S_TOP_STMT_LIST: // TOP_STMT_LIST
+      case symbol_kind::S_STMT_LIST: // STMT_LIST
+        value.move< FE::AST::Span<FE::AST::StmtNode*>* > (YY_MOVE (s.value));
+        break;
+
+      case symbol_kind::S_VAR_DECLARATOR_LIST: // VAR_DECLARATOR_LIST
+        value.move< FE::AST::Span<FE::AST::VarDeclarator*>* > (YY_MOVE (s.value));
+        break;
+
+      case symbol_kind::S_STMT: // STMT
+      case symbol_kind::S_CONTINUE_STMT: // CONTINUE_STMT
+      case symbol_kind::S_EXPR_STMT: // EXPR_STMT
+      case symbol_kind::S_VAR_DECL_STMT: // VAR_DECL_STMT
+      case symbol_kind::S_FUNC_BODY: // FUNC_BODY
+      case symbol_kind::S_FUNC_DECL_STMT: // FUNC_DECL_STMT
+      case symbol_kind::S_FOR_STMT: // FOR_STMT
+      case symbol_kind::S_IF_STMT: // IF_STMT
+      case symbol_kind::S_BREAK_STMT: // BREAK_STMT
+      case symbol_kind::S_RETURN_STMT: // RETURN_STMT
+      case symbol_kind::S_WHILE_STMT: // WHILE_STMT
+      case symbol_kind::S_BLOCK_STMT: // BLOCK_STMT
+        value.move< FE::AST::StmtNode* > (YY_MOVE (s.value));
+        break;
+
+      case symbol_kind::S_TYPE: // TYPE
+        value.move< FE::AST::Type* > (YY_MOVE (s.value));
+        break;
+
+      case symbol_kind::S_VAR_DECLARATION: // VAR_DECLARATION
+        value.move< FE::AST::VarDeclaration* > (YY_MOVE (s.value));
+        break;
+
+      case symbol_kind::S_VAR_DECLARATOR: // VAR_DECLARATOR
+        value.move< FE::AST::VarDeclarator* > (YY_MOVE (s.value));
+        break;
+
+      case symbol_kind::S_FLOAT_CONST: // FLOAT_CONST
+        value.move< float > (YY_MOVE (s.value));
+        break;
+
+      case symbol_kind::S_INT_CONST: // INT_CONST
+        value.move< int > (YY_MOVE (s.value));
+        break;
+
+      case symbol_kind::S_LL_CONST: // LL_CONST
+        value.move< long long > (YY_MOVE (s.value));
+        break;
+
+      case symbol_kind::S_STR_CONST: // STR_CONST
+      case symbol_kind::S_ERR_TOKEN: // ERR_TOKEN
+      case symbol_kind::S_SLASH_COMMENT: // SLASH_COMMENT
+      case symbol_kind::S_IDENT: // IDENT
+        value.move< std::string > (YY_MOVE (s.value));
+        break;
+
+      default:
+        break;
+    }
+
+    location = YY_MOVE (s.location);
+  }
+
+  // by_kind.
+  inline
+   YaccParser ::by_kind::by_kind () YY_NOEXCEPT
+    : kind_ (symbol_kind::S_YYEMPTY)
+  {}
+
+#if 201103L <= YY_CPLUSPLUS
+  inline
+   YaccParser ::by_kind::by_kind (by_kind&& that) YY_NOEXCEPT
+    : kind_ (that.kind_)
+  {
+    that.clear ();
+  }
+#endif
+
+  inline
+   YaccParser ::by_kind::by_kind (const by_kind& that) YY_NOEXCEPT
+    : kind_ (that.kind_)
+  {}
+
+  inline
+   YaccParser ::by_kind::by_kind (token_kind_type t) YY_NOEXCEPT
+    : kind_ (yytranslate_ (t))
+  {}
+
+
+
+  inline
+  void
+   YaccParser ::by_kind::clear () YY_NOEXCEPT
+  {
+    kind_ = symbol_kind::S_YYEMPTY;
+  }
+
+  inline
+  void
+   YaccParser ::by_kind::move (by_kind& that)
+  {
+    kind_ = that.kind_;
+    that.clear ();
+  }
+
+  inline
+   YaccParser ::symbol_kind_type
+   YaccParser ::by_kind::kind () const YY_NOEXCEPT
+  {
+    return kind_;
+  }
+
+
+  inline
+   YaccParser ::symbol_kind_type
+   YaccParser ::by_kind::type_get () const YY_NOEXCEPT
+  {
+    return this->kind ();
+  }
+
+
+#line 5 "frontend/parser/yacc.y"
+} //  FE 
+#line 2950 "frontend/parser/yacc.h"
+
+
+
+
+#endif // !YY_YY_FRONTEND_PARSER_YACC_H_INCLUDED
@@ -99,12 +99,12 @@
 %nterm <FE::AST::Operator> UNARY_OP
 %nterm <FE::AST::Type*> TYPE
 %nterm <FE::AST::InitDecl*> INITIALIZER
-%nterm <std::vector<FE::AST::InitDecl*>*> INITIALIZER_LIST
+%nterm <FE::AST::Span<FE::AST::InitDecl*>*> INITIALIZER_LIST
 %nterm <FE::AST::VarDeclarator*> VAR_DECLARATOR
-%nterm <std::vector<FE::AST::VarDeclarator*>*> VAR_DECLARATOR_LIST
+%nterm <FE::AST::Span<FE::AST::VarDeclarator*>*> VAR_DECLARATOR_LIST
 %nterm <FE::AST::VarDeclaration*> VAR_DECLARATION
 %nterm <FE::AST::ParamDeclarator*> PARAM_DECLARATOR
-%nterm <std::vector<FE::AST::ParamDeclarator*>*> PARAM_DECLARATOR_LIST
+%nterm <FE::AST::Span<FE::AST::ParamDeclarator*>*> PARAM_DECLARATOR_LIST
 
 %nterm <FE::AST::ExprNode*> LITERAL_EXPR
 %nterm <FE::AST::ExprNode*> BASIC_EXPR
@@ -119,10 +119,10 @@
 %nterm <FE::AST::ExprNode*> ASSIGN_EXPR
 %nterm <FE::AST::ExprNode*> NOCOMMA_EXPR
 %nterm <FE::AST::ExprNode*> EXPR
-%nterm <std::vector<FE::AST::ExprNode*>*> EXPR_LIST
+%nterm <FE::AST::Span<FE::AST::ExprNode*>*> EXPR_LIST
 
 %nterm <FE::AST::ExprNode*> ARRAY_DIMENSION_EXPR
-%nterm <std::vector<FE::AST::ExprNode*>*> ARRAY_DIMENSION_EXPR_LIST
+%nterm <FE::AST::Span<FE::AST::ExprNode*>*> ARRAY_DIMENSION_EXPR_LIST
 %nterm <FE::AST::ExprNode*> LEFT_VAL_EXPR
 
 %nterm <FE::AST::StmtNode*> EXPR_STMT
@@ -138,7 +138,7 @@
 %nterm <FE::AST::StmtNode*> FUNC_BODY
 %nterm <FE::AST::StmtNode*> STMT
 
-%nterm <std::vector<FE::AST::StmtNode*>*> STMT_LIST
+%nterm <FE::AST::Span<FE::AST::StmtNode*>*> STMT_LIST TOP_STMT_LIST
 %nterm <FE::AST::Root*> PROGRAM
 
 %start PROGRAM
@@ -158,8 +158,8 @@
 //语法树匹配从这里开始
 // 起始符号
 PROGRAM: 
-    STMT_LIST {
-        $$ = new Root($1);
+    TOP_STMT_LIST {
+        $$ = parser.make<Root>($1);
         parser.ast = $$;
     }
     | PROGRAM END { // 当读到END时，表示输入结束
@@ -167,15 +167,25 @@ PROGRAM:
     }
     ;
 
+// 顶层语句列表：与块内的 STMT_LIST 分开，以便流式编译时逐条交给 parser.onTopLevel 处理
+TOP_STMT_LIST:
+    STMT {
+        $$ = parser.addTopLevel(nullptr, $1);
+    }
+    | TOP_STMT_LIST STMT {
+        $$ = parser.addTopLevel($1, $2);
+    }
+    ;
+
 // 语句列表
 STMT_LIST:
     STMT { // 若只匹配到一个语句，则创建一个新的语句列表
-        $$ = new std::vector<StmtNode*>();
-        if ($1) $$->push_back($1);
+        $$ = parser.makeList<StmtNode*>();
+        if ($1) $$->push_back(parser.astArena, $1);
     }
     | STMT_LIST STMT { // 若已有语句列表，则将新语句加入列表
         $$ = $1;
-        if ($2) $$->push_back($2);
+        if ($2) $$->push_back(parser.astArena, $2);
     }
     ;
 
@@ -225,24 +235,24 @@ STMT:
 // 匹配continue
 CONTINUE_STMT:
     CONTINUE SEMICOLON {
-        $$ = new ContinueStmt(@1.begin.line, @1.begin.column);
+        $$ = parser.make<ContinueStmt>(@1.begin.line, @1.begin.column);
     }
     ;
 
 // 表达式语句
 EXPR_STMT:
     EXPR SEMICOLON {
-        $$ = new ExprStmt($1, @1.begin.line, @1.begin.column);
+        $$ = parser.make<ExprStmt>($1, @1.begin.line, @1.begin.column);
     }
     ;
 
 // 描述一个“变量声明结构”的语法规则（短语级别）
 VAR_DECLARATION:
     TYPE VAR_DECLARATOR_LIST {
-        $$ = new VarDeclaration($1, $2, false, @1.begin.line, @1.begin.column);
+        $$ = parser.make<VarDeclaration>($1, $2, false, @1.begin.line, @1.begin.column);
     }
     | CONST TYPE VAR_DECLARATOR_LIST {
-        $$ = new VarDeclaration($2, $3, true, @1.begin.line, @1.begin.column);
+        $$ = parser.make<VarDeclaration>($2, $3, true, @1.begin.line, @1.begin.column);
     }
     ;
 
@@ -251,7 +261,7 @@ VAR_DECL_STMT:
     /* TODO(Lab2): Implement variable declaration statement rule */
     // 2313546
     VAR_DECLARATION SEMICOLON {
-        $$ = new VarDeclStmt($1, @1.begin.line, @1.begin.column);
+        $$ = parser.make<VarDeclStmt>($1, @1.begin.line, @1.begin.column);
     }
     ;
 
@@ -261,17 +271,9 @@ FUNC_BODY:
         $$ = nullptr;
     }
     | LBRACE STMT_LIST RBRACE {
-        if (!$2 || $2->empty())
-        {
-            $$ = nullptr;
-            delete $2;
-        }
-        else if ($2->size() == 1)
-        {
-            $$ = (*$2)[0];
-            delete $2;
-        }
-        else $$ = new BlockStmt($2, @1.begin.line, @1.begin.column);
+        if (!$2 || $2->empty()) $$ = nullptr;
+        else if ($2->size() == 1) $$ = (*$2)[0];
+        else $$ = parser.make<BlockStmt>($2, @1.begin.line, @1.begin.column);
     }
     ;
 
@@ -279,19 +281,19 @@ FUNC_BODY:
 FUNC_DECL_STMT:
     TYPE IDENT LPAREN PARAM_DECLARATOR_LIST RPAREN FUNC_BODY {
         Entry* entry = Entry::getEntry($2);
-        $$ = new FuncDeclStmt($1, entry, $4, $6, @1.begin.line, @1.begin.column);
+        $$ = parser.make<FuncDeclStmt>($1, entry, $4, $6, @1.begin.line, @1.begin.column);
     }
     ;
 
 // 两种形式的for语句（第一种形式含有变量声明，第二种形式不含变量声明）
 FOR_STMT:
     FOR LPAREN VAR_DECLARATION SEMICOLON EXPR SEMICOLON EXPR RPAREN STMT {
-        VarDeclStmt* initStmt = new VarDeclStmt($3, @3.begin.line, @3.begin.column);
-        $$ = new ForStmt(initStmt, $5, $7, $9, @1.begin.line, @1.begin.column);
+        VarDeclStmt* initStmt = parser.make<VarDeclStmt>($3, @3.begin.line, @3.begin.column);
+        $$ = parser.make<ForStmt>(initStmt, $5, $7, $9, @1.begin.line, @1.begin.column);
     }
     | FOR LPAREN EXPR SEMICOLON EXPR SEMICOLON EXPR RPAREN STMT {
-        StmtNode* initStmt = new ExprStmt($3, $3->line_num, $3->col_num);
-        $$ = new ForStmt(initStmt, $5, $7, $9, @1.begin.line, @1.begin.column);
+        StmtNode* initStmt = parser.make<ExprStmt>($3, $3->line_num, $3->col_num);
+        $$ = parser.make<ForStmt>(initStmt, $5, $7, $9, @1.begin.line, @1.begin.column);
     }
     ;
 
@@ -300,10 +302,10 @@ IF_STMT:
     /* TODO(Lab2): Implement if statement rule */
     // 2313546
     IF LPAREN EXPR RPAREN STMT %prec THEN { // 注意定义优先级
-        $$ = new IfStmt($3, $5, nullptr, @1.begin.line, @1.begin.column);
+        $$ = parser.make<IfStmt>($3, $5, nullptr, @1.begin.line, @1.begin.column);
     }
     | IF LPAREN EXPR RPAREN STMT ELSE STMT {
-        $$ = new IfStmt($3, $5, $7, @1.begin.line, @1.begin.column);
+        $$ = parser.make<IfStmt>($3, $5, $7, @1.begin.line, @1.begin.column);
     }
     ;
 
@@ -312,33 +314,33 @@ IF_STMT:
 //BREAK语句
 BREAK_STMT:
     BREAK SEMICOLON {
-        $$ = new BreakStmt(@1.begin.line, @1.begin.column);
+        $$ = parser.make<BreakStmt>(@1.begin.line, @1.begin.column);
     }
     ;
 //两种return语句：有返回值和无返回值
 RETURN_STMT:
     RETURN SEMICOLON {  // 无返回值：return;
-        $$ = new ReturnStmt(nullptr, @1.begin.line, @1.begin.column);
+        $$ = parser.make<ReturnStmt>(nullptr, @1.begin.line, @1.begin.column);
     }
     | RETURN EXPR SEMICOLON {  // 有返回值：return expression;
-        $$ = new ReturnStmt($2, @1.begin.line, @1.begin.column);
+        $$ = parser.make<ReturnStmt>($2, @1.begin.line, @1.begin.column);
     }
     ;
 
 //while语句，包含条件和循环体两个子节点
 WHILE_STMT:
     WHILE LPAREN EXPR RPAREN STMT {
-        $$ = new WhileStmt($3, $5, @1.begin.line, @1.begin.column);
+        $$ = parser.make<WhileStmt>($3, $5, @1.begin.line, @1.begin.column);
     }
     ;
 
 //块语句，处理代码块
 BLOCK_STMT:
     LBRACE STMT_LIST RBRACE {
-        $$ = new BlockStmt($2, @1.begin.line, @1.begin.column);
+        $$ = parser.make<BlockStmt>($2, @1.begin.line, @1.begin.column);
     }
     | LBRACE RBRACE { // 空语句块
-        $$ = new BlockStmt(new std::vector<StmtNode*>(), @1.begin.line, @1.begin.column);
+        $$ = parser.make<BlockStmt>(parser.makeList<StmtNode*>(), @1.begin.line, @1.begin.column);
     }
     ;
 
@@ -346,42 +348,42 @@ BLOCK_STMT:
 PARAM_DECLARATOR:
     TYPE IDENT {
         Entry* entry = Entry::getEntry($2);
-        $$ = new ParamDeclarator($1, entry, nullptr, @1.begin.line, @1.begin.column);
+        $$ = parser.make<ParamDeclarator>($1, entry, nullptr, @1.begin.line, @1.begin.column);
     }
     | TYPE IDENT LBRACKET RBRACKET {
-        std::vector<ExprNode*>* dim = new std::vector<ExprNode*>();
-        dim->emplace_back(new LiteralExpr(-1, @3.begin.line, @3.begin.column));
+        Span<ExprNode*>* dim = parser.makeList<ExprNode*>();
+        dim->push_back(parser.astArena, parser.make<LiteralExpr>(-1, @3.begin.line, @3.begin.column));
         Entry* entry = Entry::getEntry($2);
-        $$ = new ParamDeclarator($1, entry, dim, @1.begin.line, @1.begin.column);
+        $$ = parser.make<ParamDeclarator>($1, entry, dim, @1.begin.line, @1.begin.column);
     }
     //TODO(Lab2)：考虑函数形参更多情况
     // 2313546
     | TYPE IDENT LBRACKET RBRACKET ARRAY_DIMENSION_EXPR_LIST {
-        std::vector<ExprNode*>* dim = $5;
-        dim->insert(dim->begin(), new LiteralExpr(-1, @3.begin.line, @3.begin.column));
+        Span<ExprNode*>* dim = $5;
+        dim->push_front(parser.astArena, parser.make<LiteralExpr>(-1, @3.begin.line, @3.begin.column));
         Entry* entry = Entry::getEntry($2);
-        $$ = new ParamDeclarator($1, entry, dim, @1.begin.line, @1.begin.column);
+        $$ = parser.make<ParamDeclarator>($1, entry, dim, @1.begin.line, @1.begin.column);
     }
     | TYPE IDENT ARRAY_DIMENSION_EXPR_LIST {
         Entry* entry = Entry::getEntry($2);
-        $$ = new ParamDeclarator($1, entry, $3, @1.begin.line, @1.begin.column);
+        $$ = parser.make<ParamDeclarator>($1, entry, $3, @1.begin.line, @1.begin.column);
     }
     ;
 
 // 函数参数列表（可能为空）
 PARAM_DECLARATOR_LIST:
     /* empty */ {
-        $$ = new std::vector<ParamDeclarator*>();
+        $$ = parser.makeList<ParamDeclarator*>();
     }
     //TODO(Lab2)：考虑函数形参列表的构成情况
     // 2313546
     | PARAM_DECLARATOR { // 形式1：单个参数
-        $$ = new std::vector<ParamDeclarator*>();
-        $$->push_back($1);
+        $$ = parser.makeList<ParamDeclarator*>();
+        $$->push_back(parser.astArena, $1);
     }
     | PARAM_DECLARATOR_LIST COMMA PARAM_DECLARATOR { // 形式2：多个参数
         $$ = $1;
-        $$->push_back($3);
+        $$->push_back(parser.astArena, $3);
     }
     ;
 
@@ -392,62 +394,62 @@ VAR_DECLARATOR:
     // 1.普通变量，如 a
     IDENT {
         Entry* entry = Entry::getEntry($1);
-        ExprNode* lval = new LeftValExpr(entry, nullptr, @1.begin.line, @1.begin.column);
-        $$ = new VarDeclarator(lval, nullptr, @1.begin.line, @1.begin.column);
+        ExprNode* lval = parser.make<LeftValExpr>(entry, nullptr, @1.begin.line, @1.begin.column);
+        $$ = parser.make<VarDeclarator>(lval, nullptr, @1.begin.line, @1.begin.column);
     }
 
     // 2.普通变量 + 初始化，如 a = 10
     | IDENT ASSIGN INITIALIZER {
         Entry* entry = Entry::getEntry($1);
-        ExprNode* lval = new LeftValExpr(entry, nullptr, @1.begin.line, @1.begin.column);
-        $$ = new VarDeclarator(lval, $3, @1.begin.line, @1.begin.column);
+        ExprNode* lval = parser.make<LeftValExpr>(entry, nullptr, @1.begin.line, @1.begin.column);
+        $$ = parser.make<VarDeclarator>(lval, $3, @1.begin.line, @1.begin.column);
     }
 
     // 3.普通数组，如 a[10][20]
     | IDENT ARRAY_DIMENSION_EXPR_LIST {
         Entry* entry = Entry::getEntry($1);
-        ExprNode* lval = new LeftValExpr(entry, $2, @1.begin.line, @1.begin.column);
-        $$ = new VarDeclarator(lval, nullptr, @1.begin.line, @1.begin.column);
+        ExprNode* lval = parser.make<LeftValExpr>(entry, $2, @1.begin.line, @1.begin.column);
+        $$ = parser.make<VarDeclarator>(lval, nullptr, @1.begin.line, @1.begin.column);
     }
 
     // 4.普通数组 + 初始化，如 a[10][20] = { ... }
     | IDENT ARRAY_DIMENSION_EXPR_LIST ASSIGN INITIALIZER {
         Entry* entry = Entry::getEntry($1);
-        ExprNode* lval = new LeftValExpr(entry, $2, @1.begin.line, @1.begin.column);
-        $$ = new VarDeclarator(lval, $4, @1.begin.line, @1.begin.column);
+        ExprNode* lval = parser.make<LeftValExpr>(entry, $2, @1.begin.line, @1.begin.column);
+        $$ = parser.make<VarDeclarator>(lval, $4, @1.begin.line, @1.begin.column);
     }
 
     // 5.不定长数组：IDENT [] [维度] [维度]...，如 a[]
     | IDENT LBRACKET RBRACKET {
         Entry* entry = Entry::getEntry($1);
-        ExprNode* lval = new LeftValExpr(entry, nullptr, @1.begin.line, @1.begin.column);
-        $$ = new VarDeclarator(lval, nullptr, @1.begin.line, @1.begin.column);
+        ExprNode* lval = parser.make<LeftValExpr>(entry, nullptr, @1.begin.line, @1.begin.column);
+        $$ = parser.make<VarDeclarator>(lval, nullptr, @1.begin.line, @1.begin.column);
     }
 
     // 6.不定长数组 + 维度 + 初始化，如 a[] [10] [20]
     | IDENT LBRACKET RBRACKET ARRAY_DIMENSION_EXPR_LIST {
         Entry* entry = Entry::getEntry($1);
-        ExprNode* lval = new LeftValExpr(entry, $4, @1.begin.line, @1.begin.column);
-        $$ = new VarDeclarator(lval, nullptr, @1.begin.line, @1.begin.column);
+        ExprNode* lval = parser.make<LeftValExpr>(entry, $4, @1.begin.line, @1.begin.column);
+        $$ = parser.make<VarDeclarator>(lval, nullptr, @1.begin.line, @1.begin.column);
     }
 
     // 7.不定长数组 + 维度 + 初始化，如 a[] [10] [20] = { ... }
     | IDENT LBRACKET RBRACKET ARRAY_DIMENSION_EXPR_LIST ASSIGN INITIALIZER {
         Entry* entry = Entry::getEntry($1);
-        ExprNode* lval = new LeftValExpr(entry, $4, @1.begin.line, @1.begin.column);
-        $$ = new VarDeclarator(lval, $6, @1.begin.line, @1.begin.column);
+        ExprNode* lval = parser.make<LeftValExpr>(entry, $4, @1.begin.line, @1.begin.column);
+        $$ = parser.make<VarDeclarator>(lval, $6, @1.begin.line, @1.begin.column);
     }
     ;
 
 // 变量声明列表
 VAR_DECLARATOR_LIST:
     VAR_DECLARATOR {
-        $$ = new std::vector<VarDeclarator*>();
-        $$->push_back($1);
+        $$ = parser.makeList<VarDeclarator*>();
+        $$->push_back(parser.astArena, $1);
     }
     | VAR_DECLARATOR_LIST COMMA VAR_DECLARATOR {
         $$ = $1;
-        $$->push_back($3);
+        $$->push_back(parser.astArena, $3);
     }
     ;
 
@@ -456,30 +458,30 @@ INITIALIZER:
     /* TODO(Lab2): Implement variable initializer rule */
     // 2313546
     NOCOMMA_EXPR {
-        $$ = new Initializer($1, @1.begin.line, @1.begin.column);
+        $$ = parser.make<Initializer>($1, @1.begin.line, @1.begin.column);
     }
     | LBRACE INITIALIZER_LIST RBRACE {
-        $$ = new InitializerList($2, @1.begin.line, @1.begin.column);
+        $$ = parser.make<InitializerList>($2, @1.begin.line, @1.begin.column);
     }
     /* 允许尾随逗号的初始化列表，例如 {1,2,} */
     | LBRACE INITIALIZER_LIST COMMA RBRACE {
-        $$ = new InitializerList($2, @1.begin.line, @1.begin.column);
+        $$ = parser.make<InitializerList>($2, @1.begin.line, @1.begin.column);
     }
     | LBRACE RBRACE {
         // 空初始化列表 {}
-        $$ = new InitializerList(new std::vector<InitDecl*>(), @1.begin.line, @1.begin.column);
+        $$ = parser.make<InitializerList>(parser.makeList<InitDecl*>(), @1.begin.line, @1.begin.column);
     }
     ;
 
 // 变量初始化列表
 INITIALIZER_LIST:
     INITIALIZER {
-        $$ = new std::vector<InitDecl*>();
-        $$->push_back($1);
+        $$ = parser.makeList<InitDecl*>();
+        $$->push_back(parser.astArena, $1);
     }
     | INITIALIZER_LIST COMMA INITIALIZER {
         $$ = $1;
-        $$->push_back($3);
+        $$->push_back(parser.astArena, $3);
     }
     ;
 
@@ -488,19 +490,19 @@ ASSIGN_EXPR:
     // TODO(Lab2): 完成赋值表达式的处理
     // 2313546
     LEFT_VAL_EXPR ASSIGN NOCOMMA_EXPR { // 左值表达式=右值表达式
-        $$ = new BinaryExpr(Operator::ASSIGN, $1, $3, @2.begin.line, @2.begin.column);
+        $$ = parser.make<BinaryExpr>(Operator::ASSIGN, $1, $3, @2.begin.line, @2.begin.column);
     }
     ;
 
 // 表达式列表
 EXPR_LIST:
     NOCOMMA_EXPR {
-        $$ = new std::vector<ExprNode*>();
-        $$->push_back($1);
+        $$ = parser.makeList<ExprNode*>();
+        $$->push_back(parser.astArena, $1);
     }
     | EXPR_LIST COMMA NOCOMMA_EXPR {
         $$ = $1;
-        $$->push_back($3);
+        $$->push_back(parser.astArena, $3);
     }
     ;
 
@@ -512,13 +514,13 @@ EXPR:
     | EXPR COMMA NOCOMMA_EXPR {
         if ($1->isCommaExpr()) {
             CommaExpr* ce = static_cast<CommaExpr*>($1);
-            ce->exprs->push_back($3);
+            ce->exprs->push_back(parser.astArena, $3);
             $$ = ce;
         } else {
-            auto vec = new std::vector<ExprNode*>();
-            vec->push_back($1);
-            vec->push_back($3);
-            $$ = new CommaExpr(vec, $1->line_num, $1->col_num);
+            auto vec = parser.makeList<ExprNode*>();
+            vec->push_back(parser.astArena, $1);
+            vec->push_back(parser.astArena, $3);
+            $$ = parser.make<CommaExpr>(vec, $1->line_num, $1->col_num);
         }
     }
     ;
@@ -541,7 +543,7 @@ LOGICAL_OR_EXPR:
         $$ = $1;
     }
     | LOGICAL_OR_EXPR OR LOGICAL_AND_EXPR {
-    $$ = new BinaryExpr(Operator::OR, $1, $3, @2.begin.line, @2.begin.column);
+    $$ = parser.make<BinaryExpr>(Operator::OR, $1, $3, @2.begin.line, @2.begin.column);
     }
     ;
 
@@ -553,7 +555,7 @@ LOGICAL_AND_EXPR:
         $$ = $1;
     }
     | LOGICAL_AND_EXPR AND EQUALITY_EXPR {
-    $$ = new BinaryExpr(Operator::AND, $1, $3, @2.begin.line, @2.begin.column);
+    $$ = parser.make<BinaryExpr>(Operator::AND, $1, $3, @2.begin.line, @2.begin.column);
     }
     ;
 
@@ -565,10 +567,10 @@ EQUALITY_EXPR:
         $$ = $1;
     }
     | EQUALITY_EXPR EQ RELATIONAL_EXPR {
-    $$ = new BinaryExpr(Operator::EQ, $1, $3, @2.begin.line, @2.begin.column);
+    $$ = parser.make<BinaryExpr>(Operator::EQ, $1, $3, @2.begin.line, @2.begin.column);
     }
     | EQUALITY_EXPR NEQ RELATIONAL_EXPR {
-    $$ = new BinaryExpr(Operator::NEQ, $1, $3, @2.begin.line, @2.begin.column);
+    $$ = parser.make<BinaryExpr>(Operator::NEQ, $1, $3, @2.begin.line, @2.begin.column);
     }
     ;
 
@@ -582,19 +584,19 @@ RELATIONAL_EXPR:
     // 递归/组合情况：一个关系表达式，后接关系运算符和另一个加减表达式
     | RELATIONAL_EXPR LT ADDSUB_EXPR {
         // < (小于)
-        $$ = new BinaryExpr(Operator::LT, $1, $3, @2.begin.line, @2.begin.column);
+        $$ = parser.make<BinaryExpr>(Operator::LT, $1, $3, @2.begin.line, @2.begin.column);
     }
     | RELATIONAL_EXPR GT ADDSUB_EXPR {
         // > (大于)
-        $$ = new BinaryExpr(Operator::GT, $1, $3, @2.begin.line, @2.begin.column);
+        $$ = parser.make<BinaryExpr>(Operator::GT, $1, $3, @2.begin.line, @2.begin.column);
     }
     | RELATIONAL_EXPR LE ADDSUB_EXPR {
         // <= (小于等于)
-        $$ = new BinaryExpr(Operator::LE, $1, $3, @2.begin.line, @2.begin.column);
+        $$ = parser.make<BinaryExpr>(Operator::LE, $1, $3, @2.begin.line, @2.begin.column);
     }
     | RELATIONAL_EXPR GE ADDSUB_EXPR {
         // >= (大于等于)
-        $$ = new BinaryExpr(Operator::GE, $1, $3, @2.begin.line, @2.begin.column);
+        $$ = parser.make<BinaryExpr>(Operator::GE, $1, $3, @2.begin.line, @2.begin.column);
     }
     ;
 
@@ -608,10 +610,10 @@ ADDSUB_EXPR:
         $$=$1;
     }
     | ADDSUB_EXPR PLUS MULDIV_EXPR{
-        $$=new BinaryExpr(Operator::ADD, $1, $3, @2.begin.line, @2.begin.column);
+        $$=parser.make<BinaryExpr>(Operator::ADD, $1, $3, @2.begin.line, @2.begin.column);
     }
     | ADDSUB_EXPR MINUS MULDIV_EXPR{
-        $$=new BinaryExpr(Operator::SUB, $1, $3, @2.begin.line, @2.begin.column);
+        $$=parser.make<BinaryExpr>(Operator::SUB, $1, $3, @2.begin.line, @2.begin.column);
     }
     ;
 
@@ -623,13 +625,13 @@ MULDIV_EXPR:
         $$=$1;
     }
     | MULDIV_EXPR STAR UNARY_EXPR {
-        $$ = new BinaryExpr(Operator::MUL, $1, $3, @2.begin.line, @2.begin.column);
+        $$ = parser.make<BinaryExpr>(Operator::MUL, $1, $3, @2.begin.line, @2.begin.column);
     }
     | MULDIV_EXPR SLASH UNARY_EXPR {
-        $$ = new BinaryExpr(Operator::DIV, $1, $3, @2.begin.line, @2.begin.column);
+        $$ = parser.make<BinaryExpr>(Operator::DIV, $1, $3, @2.begin.line, @2.begin.column);
     }
     | MULDIV_EXPR PERCENT UNARY_EXPR {
-        $$ = new BinaryExpr(Operator::MOD, $1, $3, @2.begin.line, @2.begin.column);
+        $$ = parser.make<BinaryExpr>(Operator::MOD, $1, $3, @2.begin.line, @2.begin.column);
     }
     ;
 //一元表达式，处理一元表达式
@@ -638,7 +640,7 @@ UNARY_EXPR:
         $$ = $1;
     }
     | UNARY_OP UNARY_EXPR {
-        $$ = new UnaryExpr($1, $2, $2->line_num, $2->col_num);
+        $$ = parser.make<UnaryExpr>($1, $2, $2->line_num, $2->col_num);
     }
     ;
 //处理最基本的表达式单元，是语法树的叶子节点
@@ -664,21 +666,21 @@ FUNC_CALL_EXPR:
         {
             //普通函数调用
             Entry* entry = Entry::getEntry(funcName);
-            $$ = new CallExpr(entry, nullptr, @1.begin.line, @1.begin.column);
+            $$ = parser.make<CallExpr>(entry, nullptr, @1.begin.line, @1.begin.column);
         }
         else
         {   
             //特殊系统函数处理 
             funcName = "_sysy_" + funcName;
-            std::vector<ExprNode*>* args = new std::vector<ExprNode*>();
+            Span<ExprNode*>* args = parser.makeList<ExprNode*>();
             //自动添加行号作为参数
-            args->emplace_back(new LiteralExpr(static_cast<int>(@1.begin.line), @1.begin.line, @1.begin.column));
-            $$ = new CallExpr(Entry::getEntry(funcName), args, @1.begin.line, @1.begin.column);
+            args->push_back(parser.astArena, parser.make<LiteralExpr>(static_cast<int>(@1.begin.line), @1.begin.line, @1.begin.column));
+            $$ = parser.make<CallExpr>(Entry::getEntry(funcName), args, @1.begin.line, @1.begin.column);
         }
     }
     | IDENT LPAREN EXPR_LIST RPAREN {//有参数函数调用
         Entry* entry = Entry::getEntry($1);
-        $$ = new CallExpr(entry, $3, @1.begin.line, @1.begin.column);
+        $$ = parser.make<CallExpr>(entry, $3, @1.begin.line, @1.begin.column);
     }
     ;
 
@@ -696,12 +698,12 @@ ARRAY_DIMENSION_EXPR_LIST:
     //2313247
     ARRAY_DIMENSION_EXPR {
         // 创建表达式列表
-        auto* list = new std::vector<ExprNode*>();
-        list->push_back($1);
+        auto* list = parser.makeList<ExprNode*>();
+        list->push_back(parser.astArena, $1);
         $$ = list;
     }
     | ARRAY_DIMENSION_EXPR_LIST ARRAY_DIMENSION_EXPR {
-        $1->push_back($2);
+        $1->push_back(parser.astArena, $2);
         $$ = $1;
     }
     ;
@@ -710,29 +712,29 @@ ARRAY_DIMENSION_EXPR_LIST:
 LEFT_VAL_EXPR:
     IDENT {
         Entry* entry = Entry::getEntry($1);
-        $$ = new LeftValExpr(entry, nullptr, @1.begin.line, @1.begin.column);
+        $$ = parser.make<LeftValExpr>(entry, nullptr, @1.begin.line, @1.begin.column);
     }
     | IDENT ARRAY_DIMENSION_EXPR_LIST {
         Entry* entry = Entry::getEntry($1);
-        $$ = new LeftValExpr(entry, $2, @1.begin.line, @1.begin.column);
+        $$ = parser.make<LeftValExpr>(entry, $2, @1.begin.line, @1.begin.column);
     }
     ;
 
 //字面值表达式
 LITERAL_EXPR:
     INT_CONST {//整型常量
-        $$ = new LiteralExpr($1, @1.begin.line, @1.begin.column);
+        $$ = parser.make<LiteralExpr>($1, @1.begin.line, @1.begin.column);
     }
     //TODO(Lab2): 处理更多字面量
     //2313247
     //LONG LONG类型的整型常量
     | LL_CONST {
         // $1 的类型为 long long
-        $$ = new LiteralExpr($1, @1.begin.line, @1.begin.column);
+        $$ = parser.make<LiteralExpr>($1, @1.begin.line, @1.begin.column);
     }
     | FLOAT_CONST {
         // 浮点数常量 (例如: 3.14)
-        $$ = new LiteralExpr($1, @1.begin.line, @1.begin.column);
+        $$ = parser.make<LiteralExpr>($1, @1.begin.line, @1.begin.column);
     }
     ;
 
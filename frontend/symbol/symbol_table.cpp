@@ -4,14 +4,18 @@
 namespace FE::Sym
 {
     // 初始化 thread_local 静态成员变量
-    thread_local std::vector<std::map<Entry*, FE::AST::VarAttr>> SymTable::scopeChain;
+    thread_local std::deque<SymTable::Binding>   SymTable::bindings;
+    thread_local std::vector<SymTable::Binding*> SymTable::visible;
+    thread_local std::vector<size_t>             SymTable::scopeMarks;
 
     void SymTable::reset_impl()
     {
         //TODO("Lab3-1: Reset symbol table");
         //重置符号表状态
-        // 清空整个作用域链，回到初始状态
-        scopeChain.clear();
+        // 清空全部声明与作用域，回到初始状态
+        bindings.clear();
+        visible.clear();
+        scopeMarks.clear();
         // 进入全局作用域
         enterScope_impl();
     }
@@ -19,19 +23,25 @@ namespace FE::Sym
     void SymTable::enterScope_impl()
     {
         //TODO("Lab3-1: Enter new scope");
-        // 创建新的作用域（新的符号表）并压入作用域栈
-        scopeChain.push_back(std::map<Entry*, FE::AST::VarAttr>());
+        // 记录本层作用域的起点
+        scopeMarks.push_back(bindings.size());
     }
 
     void SymTable::exitScope_impl()
     {
         //TODO("Lab3-1: Exit current scope");
-        // 从作用域栈中移除最内层的作用域
+        // 逆序弹出本层声明并恢复被遮蔽的外层声明，代价只与本层声明数相关
         // 注意：不应该移除全局作用域，除非显式调用 reset
         //防止将全局作用域移除
-        if (scopeChain.size() > 1)
+        if (scopeMarks.size() <= 1) return;
+
+        size_t mark = scopeMarks.back();
+        scopeMarks.pop_back();
+        while (bindings.size() > mark)
         {
-            scopeChain.pop_back();
+            Binding& b                = bindings.back();
+            visible[b.entry->getId()] = b.shadowed;
+            bindings.pop_back();
         }
     }
 
@@ -39,51 +49,44 @@ namespace FE::Sym
     {
         //TODO("Lab3-1: Add symbol to current scope");
         // 将符号添加到当前（最内层）作用域中
-        if (scopeChain.empty()) enterScope_impl();
-        auto& cur = scopeChain.back();
-        if (cur.count(entry))
+        if (scopeMarks.empty()) enterScope_impl();
+
+        uint32_t id = entry->getId();
+        if (id >= visible.size()) visible.resize(Entry::count(), nullptr);
+
+        // 可见声明位于本层作用域之内即为重定义
+        Binding* prev  = visible[id];
+        int      depth = static_cast<int>(scopeMarks.size());
+        if (prev && prev->depth == depth)
         {
             ERROR("redefinition");
             return;
         }
-        cur[entry] = attr;
-        /*
-        if (!scopeChain.empty())
-        {
-            scopeChain.back()[entry] = attr;
-        }
-            */
+        bindings.push_back({entry, attr, prev, depth});
+        visible[id] = &bindings.back();
     }
 
     FE::AST::VarAttr* SymTable::getSymbol_impl(Entry* entry)
     {
         //TODO("Lab3-1: Get symbol from symbol table");
-        // 从内到外搜索作用域链，找到符号则返回其指针
+        // 直接取该标识符最内层的可见声明
         // 这实现了作用域的遮蔽规则（inner scope hides outer scope）
-        if (scopeChain.empty()) return nullptr;
-        for (auto it = scopeChain.rbegin(); it != scopeChain.rend(); ++it)
-        {
-            auto found = it->find(entry);
-            if (found != it->end())
-            {
-                return &found->second;
-            }
-        }
-        // 未找到
-        return nullptr;
+        uint32_t id = entry->getId();
+        if (id >= visible.size() || !visible[id]) return nullptr;
+        return &visible[id]->attr;
     }
 
     bool SymTable::isGlobalScope_impl()
     {
         //TODO("Lab3-1: Check if current scope is global scope");
         // 当作用域深度为 1 时，即处于全局作用域
-        return scopeChain.size() == 1;
+        return scopeMarks.size() == 1;
     }
 
     int SymTable::getScopeDepth_impl()
     {
         //TODO("Lab3-1: Get current scope depth");
         // 返回当前作用域深度（1 表示全局，2 表示局部，依此类推）
-        return static_cast<int>(scopeChain.size());
+        return static_cast<int>(scopeMarks.size());
     }
 }  // namespace FE::Sym
@@ -3,7 +3,7 @@
 
 #include <frontend/symbol/isymbol_table.h>
 #include <frontend/ast/ast_defs.h>
-#include <map>
+#include <deque>
 #include <vector>
 
 namespace FE::Sym
@@ -12,9 +12,21 @@ namespace FE::Sym
     {
         friend iSymTable<SymTable>;
 
-        // 作用域链：每个元素是当前作用域的符号表（Entry* -> VarAttr）
-        // 使用 thread_local 保证线程安全
-        thread_local static std::vector<std::map<Entry*, FE::AST::VarAttr>> scopeChain;
+        // 一次声明：shadowed 指向被它遮蔽的同名外层声明，构成每个标识符各自的遮蔽栈
+        struct Binding
+        {
+            Entry*           entry;
+            FE::AST::VarAttr attr;
+            Binding*         shadowed;
+            int              depth;  // 所在作用域深度
+        };
+
+        // 按声明顺序排列的全部有效声明；deque 只在尾部增删，已有元素地址不变，getSymbol 返回的指针在其作用域内一直有效
+        thread_local static std::deque<Binding> bindings;
+        // 以 Entry id 为下标：该标识符当前可见的（最内层）声明，查找为 O(1)
+        thread_local static std::vector<Binding*> visible;
+        // 每层作用域进入时 bindings 的长度，退出时只需弹出本层新增的声明
+        thread_local static std::vector<size_t> scopeMarks;
 
         void reset_impl();
 
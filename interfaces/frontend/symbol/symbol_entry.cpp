@@ -2,28 +2,33 @@
 using namespace std;
 using namespace FE::Sym;
 
-unordered_map<string, Entry*> Entry::entryMap;
+unordered_map<string_view, Entry*> Entry::entryMap;
+vector<Entry*>                     Entry::entries;
+Arena                              Entry::arena;
 
 void Entry::clear()
 {
-    for (auto& [name, entry] : entryMap)
-    {
-        if (!entry) continue;
-        delete entry;
-        entry = nullptr;
-    }
     entryMap.clear();
+    // Entry 的析构函数为私有，arena 无法代为调用，故在此逐个析构后整块归还
+    for (Entry* entry : entries) entry->~Entry();
+    entries.clear();
+    arena.reset();
 }
 
-Entry* Entry::getEntry(string name)
+Entry* Entry::getEntry(string_view name)
 {
-    if (entryMap.find(name) == entryMap.end()) entryMap[name] = new Entry(name);
-    return entryMap[name];
-}
+    auto it = entryMap.find(name);
+    if (it != entryMap.end()) return it->second;
 
-Entry::Entry(string name) : name(name) {}
+    uint32_t id    = static_cast<uint32_t>(entries.size());
+    Entry*   entry = new (arena.allocate(sizeof(Entry), alignof(Entry))) Entry(name, id);
+    entries.push_back(entry);
+    // 键引用 entry 自身持有的名字，Entry 在 arena 中地址固定，键随之稳定
+    entryMap.emplace(entry->name, entry);
+    return entry;
+}
 
-const string& Entry::getName() { return name; }
+Entry::Entry(string_view name, uint32_t id) : name(name), id(id) {}
 
 EntryDeleter::EntryDeleter() {}
 EntryDeleter::~EntryDeleter() { Entry::clear(); }
@@ -1,29 +1,46 @@
 #ifndef __FRONTEND_SYMBOL_SYMBOL_ENTRY_H__
 #define __FRONTEND_SYMBOL_SYMBOL_ENTRY_H__
 
+#include <arena.h>
+#include <cstdint>
 #include <string>
+#include <string_view>
 #include <unordered_map>
+#include <vector>
 
 namespace FE::Sym
 {
+    /*
+     * Entry：驻留（intern）后的标识符
+     * - 同名标识符全局唯一，可直接按指针比较
+     * - 对象本身从 arena 顺序分配，并按创建顺序编号为稠密 id（0, 1, 2, ...），
+     *   符号表等可用 id 直接下标访问，无需再做哈希或树查找
+     * - 驻留表以指向 Entry 内部名字的 string_view 为键，查找已存在的名字不会产生临时 std::string
+     */
     class Entry
     {
         friend class EntryDeleter;
 
       private:
-        static std::unordered_map<std::string, Entry*> entryMap;
-        static void                                    clear();
+        static std::unordered_map<std::string_view, Entry*> entryMap;
+        static std::vector<Entry*>                          entries;  // 下标即 id
+        static Arena                                        arena;
+        static void                                         clear();
 
       public:
-        static Entry* getEntry(std::string name);
+        static Entry* getEntry(std::string_view name);
+        // 已驻留的标识符个数，即当前最大 id + 1
+        static uint32_t count() { return static_cast<uint32_t>(entries.size()); }
 
       private:
-        Entry(std::string name = "NULL");
+        Entry(std::string_view name, uint32_t id);
         ~Entry() = default;
         std::string name;
+        uint32_t    id;
 
       public:
-        const std::string& getName();
+        const std::string& getName() { return name; }
+        uint32_t           getId() const { return id; }
     };
 
     class EntryDeleter
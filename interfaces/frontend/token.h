@@ -2,15 +2,16 @@
 #define __INTERFACES_FRONTEND_TOKEN_H__
 
 #include <string>
+#include <string_view>
 
 namespace FE
 {
     struct Token
     {
-        std::string token_name;     ///< 词法分析中使用的 token 名称
-        std::string lexeme;         ///< 该 token 的原始文本内容
-        int         line_number;    ///< 该 token 所在的行号
-        int         column_number;  ///< 该 token 所在的列号
+        std::string_view token_name;     ///< 词法分析中使用的 token 名称（指向 bison 的静态名字表）
+        std::string_view lexeme;         ///< 该 token 的原始文本内容（指向源文件缓冲区，不单独分配）
+        int              line_number;    ///< 该 token 所在的行号
+        int              column_number;  ///< 该 token 所在的列号
 
         enum class TokenType
         {
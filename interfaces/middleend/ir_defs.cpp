@@ -1,49 +1,54 @@
 #include <middleend/ir_defs.h>
 
-std::ostream& operator<<(std::ostream& os, ME::DataType dt)
+const char* toCString(ME::DataType dt)
 {
     switch (dt)
     {
 #define X(name, str, val) \
-    case ME::DataType::name: return os << #str;
+    case ME::DataType::name: return #str;
         IR_DATATYPE
 #undef X
-        default: return os << "unknown";
+        default: return "unknown";
     }
 }
 
-std::ostream& operator<<(std::ostream& os, ME::Operator op)
+const char* toCString(ME::Operator op)
 {
     switch (op)
     {
 #define X(name, str, val) \
-    case ME::Operator::name: return os << #str;
+    case ME::Operator::name: return #str;
         IR_OPCODE
 #undef X
-        default: return os << "unknown";
+        default: return "unknown";
     }
 }
 
-std::ostream& operator<<(std::ostream& os, ME::ICmpOp cop)
+const char* toCString(ME::ICmpOp cop)
 {
     switch (cop)
     {
 #define X(name, str, val) \
-    case ME::ICmpOp::name: return os << #str;
+    case ME::ICmpOp::name: return #str;
         IR_ICMP
 #undef X
-        default: return os << "unknown";
+        default: return "unknown";
     }
 }
 
-std::ostream& operator<<(std::ostream& os, ME::FCmpOp cop)
+const char* toCString(ME::FCmpOp cop)
 {
     switch (cop)
     {
 #define X(name, str, val) \
-    case ME::FCmpOp::name: return os << #str;
+    case ME::FCmpOp::name: return #str;
         IR_FCMP
 #undef X
-        default: return os << "unknown";
+        default: return "unknown";
     }
 }
+
+std::ostream& operator<<(std::ostream& os, ME::DataType dt) { return os << toCString(dt); }
+std::ostream& operator<<(std::ostream& os, ME::Operator op) { return os << toCString(op); }
+std::ostream& operator<<(std::ostream& os, ME::ICmpOp cop) { return os << toCString(cop); }
+std::ostream& operator<<(std::ostream& os, ME::FCmpOp cop) { return os << toCString(cop); }
@@ -129,6 +129,12 @@ namespace ME
     using LabelMap = std::map<size_t, size_t>;
 }  // namespace ME
 
+// 枚举对应的 IR 文本，均为静态字符串
+const char* toCString(ME::DataType dt);
+const char* toCString(ME::Operator op);
+const char* toCString(ME::ICmpOp cop);
+const char* toCString(ME::FCmpOp cop);
+
 std::ostream& operator<<(std::ostream& os, ME::DataType dt);
 std::ostream& operator<<(std::ostream& os, ME::Operator op);
 std::ostream& operator<<(std::ostream& os, ME::ICmpOp cop);
@@ -1,11 +1,43 @@
 #include <middleend/pass.h>
 #include <middleend/module/ir_module.h>
 #include <middleend/module/ir_function.h>
+#include <middleend/pass/analysis/analysis_manager.h>
+#include <thread_pool.h>
+#include <vector>
 
 namespace ME
 {
-    void FunctionPass::runOnModule(Module& module)
+    bool FunctionPass::runOnModule(Module& module)
     {
-        for (auto* function : module.functions) runOnFunction(*function);
+        prepareModule(module);
+        bool changed = false;
+        for (auto* function : module.functions)
+        {
+            PreservedAnalyses pa = runOnFunction(*function);
+            if (pa.areAllPreserved()) continue;
+
+            Analysis::AM.invalidate(*function, pa);
+            changed = true;
+        }
+        return changed;
+    }
+
+    bool FunctionPass::runOnModule(Module& module, ThreadPool& pool)
+    {
+        prepareModule(module);
+        std::vector<char>               changed(module.functions.size(), 0);
+        OperandFactory::ConcurrentScope scope(module.getOperandFactory());
+        pool.parallelFor(module.functions.size(), [&](size_t i) {
+            Function&         function = *module.functions[i];
+            PreservedAnalyses pa       = runOnFunction(function);
+            if (pa.areAllPreserved()) return;
+
+            Analysis::AM.invalidate(function, pa);
+            changed[i] = 1;
+        });
+
+        for (char c : changed)
+            if (c) return true;
+        return false;
     }
 }  // namespace ME
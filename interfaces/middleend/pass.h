@@ -1,6 +1,11 @@
 #ifndef __INTERFACES_MIDDLEEND_PASS_H__
 #define __INTERFACES_MIDDLEEND_PASS_H__
 
+#include <type_utils.h>
+#include <set>
+
+class ThreadPool;
+
 namespace ME
 {
     class Module;
@@ -9,12 +14,48 @@ namespace ME
 
 namespace ME
 {
+    /*
+     * pass 运行后仍然有效的分析集合
+     * - 以分析类的 TID 标识，如 pa.preserve<Analysis::CFG>()
+     * - all() 表示 pass 没有修改 IR；none() 表示所有分析都需要重新计算
+     * - DomInfo、LoopInfo 依赖 CFG：CFG 失效时一并失效
+     */
+    class PreservedAnalyses
+    {
+      private:
+        bool             allPreserved;
+        std::set<size_t> preserved;
+
+        explicit PreservedAnalyses(bool all) : allPreserved(all), preserved() {}
+
+      public:
+        static PreservedAnalyses all() { return PreservedAnalyses(true); }
+        static PreservedAnalyses none() { return PreservedAnalyses(false); }
+
+        template <typename Analysis>
+        PreservedAnalyses& preserve()
+        {
+            preserved.insert(Analysis::TID);
+            return *this;
+        }
+
+        template <typename Analysis>
+        bool isPreserved() const
+        {
+            return isPreserved(Analysis::TID);
+        }
+        bool isPreserved(size_t tid) const { return allPreserved || preserved.count(tid); }
+        bool areAllPreserved() const { return allPreserved; }
+    };
+
     class Pass
     {
       public:
-        virtual ~Pass()                                = default;
-        virtual void runOnModule(Module& module)       = 0;
-        virtual void runOnFunction(Function& function) = 0;
+        virtual ~Pass()                                             = default;
+        virtual const char*       getName() const                   = 0;
+        // 返回 IR 是否被修改；FunctionPass 的默认实现会按返回的 PreservedAnalyses 使分析失效
+        virtual bool              runOnModule(Module& module)       = 0;
+        virtual PreservedAnalyses runOnFunction(Function& function) = 0;
     };
 
     class ModulePass : public Pass
@@ -22,17 +63,24 @@ namespace ME
        * 全局优化Pass的基类
        */
       public:
-        virtual void runOnModule(Module& module) override       = 0;
-        virtual void runOnFunction(Function& function) override = 0;
+        virtual bool              runOnModule(Module& module) override       = 0;
+        virtual PreservedAnalyses runOnFunction(Function& function) override = 0;
     };
 
     class FunctionPass : public Pass
     { /*
        * 过程内优化Pass的基类
+       * runOnFunction 只能读写传入的函数（及模块的操作数工厂），因此各函数可以并行处理
        */
       public:
-        virtual void runOnModule(Module& module) override;
-        virtual void runOnFunction(Function& function) override = 0;
+        virtual bool              runOnModule(Module& module) override;
+        // 在线程池上并行处理各函数，结果与串行执行一致
+        bool                      runOnModule(Module& module, ThreadPool& pool);
+        virtual PreservedAnalyses runOnFunction(Function& function) override = 0;
+
+      protected:
+        // 两种 runOnModule 在处理各函数之前于调用线程上执行一次，用于收集 runOnFunction 只读的模块级信息
+        virtual void prepareModule(Module& module) {}
     };
 }  // namespace ME
 
@@ -6,23 +6,28 @@
 
 #include <middleend/visitor/codegen/ast_codegen.h>
 #include <middleend/visitor/printer/module_printer.h>
+#include <middleend/visitor/binary/ir_binary.h>
 #include <middleend/module/ir_module.h>
-#include <middleend/pass/unify_return.h>
 // 新增
-#include <middleend/pass/eli_unreachable_bb.h>
-#include <middleend/pass/basic_mem2reg.h>
-#include <middleend/pass/mem2reg.h>
-#include <middleend/pass/adce.h>
-#include <middleend/pass/cse.h>
-#include <middleend/pass/sccp.h>
+#include <middleend/pass/pass_manager.h>
+#include <middleend/pass/loop_unroll.h>
 
 #include <backend/mir/m_module.h>
 #include <backend/target/registry.h>
 #include <backend/target/target.h>
 
+#include <stats.h>
+#include <thread_pool.h>
+#include <compile_cache.h>
+#include <mapped_file.h>
+
 #include <fstream>
 #include <iostream>
 #include <iomanip>
+#include <sstream>
+#include <cstdlib>
+#include <cctype>
+#include <memory>
 
 /* 如果你简化了框架的实现, 或者解决了框架现存的问题
    或者是用现代C++特性对框架进行了重构, 并且有效地简化了代码或者提高了代码的复用性
@@ -46,10 +51,234 @@
 
 using namespace std;
 
-string truncateString(const string& str, size_t width)
+string truncateString(string_view str, size_t width)
+{
+    if (str.length() > width) return string(str.substr(0, width - 3)) + "...";
+    return string(str);
+}
+
+static Stats::IRSize irSize(ME::Module& m)
+{
+    Stats::IRSize size{0, 0};
+    for (auto* func : m.functions)
+    {
+        size.blocks += func->blocks.size();
+        for (auto* block : func->blocks) size.insts += block->insts.size();
+    }
+    return size;
+}
+
+/*
+ * -fmem-report：各阶段结束时统计的对象个数与字节数，随所统计的对象一起创建和销毁
+ * 未打开 -fmem-report 时 Gauge 不做任何事
+ */
+struct IRGauges
+{
+    Stats::Gauge insts, bytes, operands, operandBytes, analyses;
+
+    explicit IRGauges(ME::Module& m)
+        : insts("ir insts", [&m]() { return irSize(m).insts; }),
+          bytes("ir bytes",
+              [&m]() {
+                  long n = m.bytesAllocated();
+                  for (auto* func : m.functions) n += func->bytesAllocated();
+                  return n;
+              }),
+          operands("operands", [&m]() { return (long)m.getOperandFactory().size(); }),
+          operandBytes("operand bytes", [&m]() { return (long)m.getOperandFactory().bytesAllocated(); }),
+          analyses("analyses", [&m]() {
+              long n = 0;
+              for (auto* func : m.functions)
+                  for (auto& slot : func->getAnalysisSlots()) n += slot.result != nullptr;
+              return n;
+          })
+    {}
+};
+
+struct BackendGauges
+{
+    Stats::Gauge insts, dagNodes;
+
+    BackendGauges(BE::Module& m, BE::Targeting::BackendTarget* tgt)
+        : insts("mir insts",
+              [&m]() {
+                  long n = 0;
+                  for (auto* func : m.functions)
+                      for (auto& [id, block] : func->blocks) n += block->insts.size();
+                  return n;
+              }),
+          dagNodes("dag nodes", [tgt]() {
+              long n = 0;
+              for (auto& [block, dag] : tgt->block_dags) n += dag ? dag->getNodes().size() : 0;
+              return n;
+          })
+    {}
+};
+
+/*
+ * -load-ir-bin：跳过前端与中端，直接从二进制 IR 重建模块后打印 IR 或运行后端
+ * 二进制 IR 由 -emit-ir-bin 在中端流水线结束后写出，因此这里不再运行任何 pass
+ */
+static int runFromIRBinary(const string& irFile, const string& step, const string& march, ThreadPool* pool,
+    ostream* outStream)
 {
-    if (str.length() > width) return str.substr(0, width - 3) + "...";
-    return str;
+    ME::Module m;
+    IRGauges   irGauges(m);
+    {
+        Stats::Scope     scope("ir binary input", [&m]() { return irSize(m); });
+        ME::IRBinReader  reader;
+        string           err;
+        if (!reader.read(irFile, m, err))
+        {
+            cerr << "Error: " << err << endl;
+            return 1;
+        }
+    }
+
+    if (step == "-llvm")
+    {
+        Stats::Scope  scope("ir output");
+        ME::IRPrinter printer;
+        printer.print(m, *outStream);
+        return 0;
+    }
+    if (step != "-S")
+    {
+        cerr << "Error: -load-ir-bin only supports -llvm and -S" << endl;
+        return 1;
+    }
+
+    BE::Module backendModule;
+    auto*      tgt = BE::Targeting::TargetRegistry::getTarget(march);
+    if (!tgt)
+    {
+        cerr << "Unknown target: " << march << endl;
+        return 1;
+    }
+
+    BackendGauges beGauges(backendModule, tgt);
+    Stats::Scope  scope("backend");
+    tgt->setThreadPool(pool);
+    tgt->runPipeline(&m, &backendModule, outStream);
+    return 0;
+}
+
+/*
+ * -fstream：流式编译，用于限制大输入的峰值内存
+ * 每归约出一条顶层语句就立即完成语义检查与 IR 生成；函数定义随后走完中端流水线与后端（-llvm 时直接打印）并输出，
+ * 之后释放它的 AST、IR 与 MIR。全局变量与函数签名一直保留，供之后的语句使用。
+ * 出现语义错误后只继续检查以报告全部错误，此前已输出的内容作废。tgt 为空表示输出 IR
+ */
+static int runStreaming(FE::Parser& parser, BE::Targeting::BackendTarget* tgt, ME::PassManager* passManager,
+    ostream* outStream)
+{
+    FE::AST::ASTChecker checker;
+    ME::ASTCodeGen      codegen(checker.getGlbSymbols(), checker.getFuncDecls());
+    ME::Module          m;
+    BE::Module          backendModule;
+    ME::IRPrinter       printer;
+    auto                meSize = [&m]() { return irSize(m); };
+
+    // -llvm 时没有后端，不统计 MIR
+    IRGauges                  irGauges(m);
+    unique_ptr<BackendGauges> beGauges;
+    if (tgt) beGauges = make_unique<BackendGauges>(backendModule, tgt);
+
+    bool   ok         = true;
+    bool   firstFunc  = true;
+    size_t numGlobals = 0;  // printHeader 时已输出的全局变量个数
+
+    // 每个函数都会重复经过各阶段，计时合并到同名记录上
+    Stats::mergeRepeated(true);
+    checker.beginCheck();
+    codegen.beginModule(&m);
+    if (tgt) tgt->beginStream(&m, &backendModule, outStream);
+
+    parser.onTopLevel = [&](FE::AST::StmtNode* stmt) {
+        {
+            Stats::Scope scope("semantic check");
+            if (!checker.checkTopLevel(stmt)) ok = false;
+        }
+
+        auto* funcDecl = dynamic_cast<FE::AST::FuncDeclStmt*>(stmt);
+        if (ok)
+        {
+            {
+                Stats::Scope scope("ir generation", meSize);
+                codegen.genTopLevel(stmt, &m);
+            }
+
+            if (funcDecl && !m.functions.empty())
+            {
+                ME::Function* func = m.functions.back();
+                if (passManager)
+                {
+                    Stats::Scope scope("optimization", meSize);
+                    passManager->run(m, meSize);
+                }
+
+                if (tgt)
+                {
+                    Stats::Scope scope("backend");
+                    tgt->runFunction(func);
+                }
+                else
+                {
+                    Stats::Scope scope("ir output");
+                    if (firstFunc)
+                    {
+                        printer.printHeader(m, *outStream);
+                        numGlobals = m.globalVars.size();
+                    }
+                    printer.printFunction(*func, firstFunc, *outStream);
+                }
+                firstFunc = false;
+
+                func->release();
+                m.functions.pop_back();
+            }
+        }
+
+        // 全局变量的属性已复制进检查器的符号表，函数只需保留签名，该语句的 AST 可以释放
+        if (funcDecl) checker.detachFuncBody(funcDecl);
+        return true;
+    };
+
+    FE::AST::Node* ast = nullptr;
+    {
+        Stats::Scope scope("streaming compilation");
+        ast = parser.parseAST();
+    }
+    parser.onTopLevel = nullptr;
+    Stats::mergeRepeated(false);
+
+    if (!ast)
+    {
+        cerr << "Parsing failed." << endl;
+        return 1;
+    }
+    if (!checker.finishCheck()) ok = false;
+    if (!ok)
+    {
+        cerr << "Semantic check failed with " << checker.errors.size() << " errors." << endl;
+        for (const auto& err : checker.errors) cerr << "Error: " << err << endl;
+        return 1;
+    }
+
+    if (tgt)
+    {
+        Stats::Scope scope("backend");
+        tgt->endStream();
+    }
+    else
+    {
+        Stats::Scope scope("ir output");
+        if (firstFunc)
+            printer.printHeader(m, *outStream);
+        else
+            printer.printLateGlobals(m, numGlobals, *outStream);
+    }
+    return 0;
 }
 
 int main(int argc, char** argv)
@@ -59,6 +288,14 @@ int main(int argc, char** argv)
     string   step          = "-llvm";
     string   march         = "riscv64";
     int      optimizeLevel = 0;
+    string   passPipeline  = "";
+    size_t   numThreads    = 1;
+    string   emitIRBinFile = "";
+    string   loadIRBinFile = "";
+    string   cacheDir      = "";
+    uint64_t cacheMaxBytes = CompileCache::kDefaultMaxBytes;
+    bool     streamCompile = false;
+    unsigned unrollFactor  = ME::LoopUnrollPass::kDefaultFactor;
     ostream* outStream     = &cout;
     ofstream outFile;
 
@@ -87,10 +324,48 @@ int main(int argc, char** argv)
                 return 1;
             }
         }
+        else if (arg == "-emit-ir-bin" || arg == "-load-ir-bin")
+        {
+            if (i + 1 < argc)
+                (arg == "-emit-ir-bin" ? emitIRBinFile : loadIRBinFile) = argv[++i];
+            else
+            {
+                cerr << "Error: " << arg << " option requires a filename" << endl;
+                return 1;
+            }
+        }
         else if (arg == "-O" || arg == "-O1") { optimizeLevel = 1; }
         else if (arg == "-O0") { optimizeLevel = 0; }
         else if (arg == "-O2") { optimizeLevel = 2; }
         else if (arg == "-O3") { optimizeLevel = 3; }
+        else if (arg.rfind("-passes=", 0) == 0) { passPipeline = arg.substr(8); }
+        else if (arg.rfind("-fthreads=", 0) == 0) { numThreads = std::strtoul(arg.c_str() + 10, nullptr, 10); }
+        else if (arg == "-fcache") { cacheDir = ".sycache"; }
+        else if (arg.rfind("-fcache-dir=", 0) == 0) { cacheDir = arg.substr(12); }
+        else if (arg.rfind("-fcache-size=", 0) == 0)
+        {
+            cacheMaxBytes = std::strtoull(arg.c_str() + 13, nullptr, 10) << 20;
+        }
+        else if (arg == "-fstream") { streamCompile = true; }
+        else if (arg.rfind("-funroll-factor=", 0) == 0)
+        {
+            // 只接受不超过 kMaxFactor 的十进制非负整数；strtoul 会接受负号与空串，需先检查字符
+            const char*   value = arg.c_str() + 16;
+            char*         end   = nullptr;
+            unsigned long n     = std::strtoul(value, &end, 10);
+            if (!std::isdigit((unsigned char)*value) || *end != '\0' || n > ME::LoopUnrollPass::kMaxFactor)
+            {
+                cerr << "Error: -funroll-factor= requires an integer from 0 to " << ME::LoopUnrollPass::kMaxFactor
+                     << endl;
+                return 1;
+            }
+            unrollFactor = static_cast<unsigned>(n);
+        }
+        else if (arg == "-ftime-report") { Stats::enable(true, false); }
+        else if (arg == "-stats") { Stats::enable(false, true); }
+        else if (arg == "-ftime-report=json" || arg == "-stats=json") { Stats::enable(true, true, Stats::Format::JSON); }
+        else if (arg == "-fmem-report") { Stats::enableMemory(); }
+        else if (arg == "-fmem-report=json") { Stats::enableMemory(Stats::Format::JSON); }
         else if (arg[0] != '-') { inputFile = arg; }
         else
         {
@@ -99,13 +374,38 @@ int main(int argc, char** argv)
         }
     }
 
-    if (inputFile.empty())
+    if (inputFile.empty() && loadIRBinFile.empty())
     {
         cerr << "Error: No input file specified" << endl;
-        cerr << "Usage: " << argv[0] << " [-lexer|-parser|-llvm|-S] [-o output_file] input_file [-O]" << endl;
+        cerr << "Usage: " << argv[0] << " [-lexer|-parser|-llvm|-S] [-o output_file] input_file [-O]"
+             << " [-passes=p1,p2,...] [-fthreads=N] [-ftime-report|-stats|-stats=json] [-fmem-report[=json]]"
+             << " [-emit-ir-bin file] [-load-ir-bin file] [-fcache|-fcache-dir=DIR] [-fcache-size=MB] [-fstream]"
+             << " [-funroll-factor=N]" << endl;
         return 1;
     }
 
+    // -funroll-factor=N：loop-unroll 部分展开时的复制份数，N 不超过 1 时只做完全展开
+    if (unrollFactor != ME::LoopUnrollPass::kDefaultFactor)
+        ME::PassRegistry::registerPassFactory(
+            "loop-unroll", [unrollFactor] { return new ME::LoopUnrollPass(unrollFactor); });
+
+    // 未指定 -passes= 时使用 -O 等级对应的默认流水线；流水线有误时在读入源文件前报错
+    ME::PassManager passManager;
+    {
+        string pipeline = passPipeline.empty() ? ME::PassManager::defaultPipeline(optimizeLevel) : passPipeline;
+        string err;
+        if (!pipeline.empty() && !passManager.parse(pipeline, err))
+        {
+            cerr << "Error: invalid -passes pipeline: " << err << endl;
+            return 1;
+        }
+    }
+
+    // -fthreads=N：中端 pass 与后端流程共用一个线程池，N 为 0 时使用全部硬件线程
+    unique_ptr<ThreadPool> threadPool;
+    if (numThreads != 1) threadPool = make_unique<ThreadPool>(numThreads);
+    passManager.setThreadPool(threadPool.get());
+
     if (!outputFile.empty())
     {
         outFile.open(outputFile);
@@ -117,23 +417,67 @@ int main(int argc, char** argv)
         outStream = &outFile;
     }
 
-    cout << "Input file: " << inputFile << endl;
+    cout << "Input file: " << (loadIRBinFile.empty() ? inputFile : loadIRBinFile) << endl;
     cout << "Step: " << step << endl;
     cout << "Output: " << (outputFile.empty() ? "standard output" : outputFile) << endl;
     cout << "Optimize level: " << optimizeLevel << endl;
 
-    ifstream       in(inputFile);
-    istream*       inStream = &in;
-    FE::AST::Node* ast      = nullptr;
-    int            ret      = 0;
+    if (!loadIRBinFile.empty())
+    {
+        int ret = runFromIRBinary(loadIRBinFile, step, march, threadPool.get(), outStream);
+        if (outFile.is_open()) outFile.close();
+        Stats::report(cerr);
+        return ret;
+    }
 
-    if (!in)
+    // 源文件整体映射到内存：词法分析直接从映射区取字符，Token 的 lexeme 也指向这里
+    MappedFile               source(inputFile);
+    FE::AST::Node*           ast = nullptr;
+    int                      ret = 0;
+    unique_ptr<CompileCache> cache;
+    string                   cacheKey;
+    ostringstream            cacheBuf;
+    ostream*                 finalStream = outStream;
+
+    if (!source.ok())
     {
         cerr << "Cannot open input file " << inputFile << endl;
         ret = 1;
         goto cleanup_outfile;
     }
 
+    /*
+     * -fcache：以源码、目标、优化选项、步骤与编译器构建标识为键查找缓存
+     * -fstream 计入优化选项：流式编译跳过 ModulePass，输出与整模块编译不一定相同
+     * 命中时直接输出缓存的结果；未命中时输出先收集到 cacheBuf，结束时写出，编译成功则存入缓存
+     */
+    if (!cacheDir.empty() && (step == "-llvm" || step == "-S") && emitIRBinFile.empty())
+    {
+        cache = make_unique<CompileCache>(cacheDir, cacheMaxBytes);
+        if (!cache->usable())
+            cache.reset();
+        else
+        {
+            string cached;
+            bool   hit;
+            {
+                Stats::Scope scope("cache lookup");
+                string       opt = to_string(optimizeLevel) + (streamCompile ? "/stream" : "") +
+                             (unrollFactor != ME::LoopUnrollPass::kDefaultFactor ? "/unroll" + to_string(unrollFactor)
+                                                                                 : "");
+                cacheKey         = cache->makeKey({source.view(), step, march, opt, passPipeline});
+                hit              = cache->lookup(cacheKey, cached);
+            }
+            if (hit)
+            {
+                outStream->write(cached.data(), cached.size());
+                cache.reset();
+                goto cleanup_outfile;
+            }
+            outStream = &cacheBuf;
+        }
+    }
+
     /*
      * Lab 1: 词法分析
      *
@@ -159,11 +503,17 @@ int main(int argc, char** argv)
      * 在 `testcase/lexer/` 目录下提供了一些测试用例以及它们的预期输出，可以自行查看。
      */
     {
-        FE::Parser parser(inStream, outStream);
+        FE::Parser   parser(source.view(), outStream);
+        Stats::Gauge astNodes("ast nodes", [&parser]() { return (long)parser.nodeCount(); });
+        Stats::Gauge astBytes("ast bytes", [&parser]() { return (long)parser.astArena.bytesAllocated(); });
 
         if (step == "-lexer")
         {
-            auto tokens = parser.parseTokens();
+            std::vector<FE::Token> tokens;
+            {
+                Stats::Scope scope("lexer");
+                tokens = parser.parseTokens();
+            }
 
             *outStream << left;
             *outStream << setw(STR_PW) << "Token" << setw(STR_PW) << "Lexeme" << setw(STR_PW) << "Property"
@@ -191,7 +541,31 @@ int main(int argc, char** argv)
             }
 
             ret = 0;
-            goto cleanup_files;
+            goto cleanup_ast;
+        }
+
+        // -fstream：-emit-ir-bin 需要完整的模块，不支持流式编译的目标也只能整模块处理，这两种情况给出警告后
+        // 仍走下面的流程；流水线中的 ModulePass 需要看到全部函数，流式编译时跳过它们
+        if (streamCompile && (step == "-llvm" || step == "-S"))
+        {
+            auto* tgt = step == "-S" ? BE::Targeting::TargetRegistry::getTarget(march) : nullptr;
+            if (!emitIRBinFile.empty())
+                cerr << "Warning: -fstream is ignored with -emit-ir-bin, which needs the whole module" << endl;
+            else if (step == "-S" && !(tgt && tgt->supportsStreaming()))
+                cerr << "Warning: -fstream is ignored, target '" << march << "' does not support streaming" << endl;
+            else
+            {
+                auto dropped = passManager.dropModulePasses();
+                if (!dropped.empty())
+                {
+                    cerr << "Warning: -fstream skips whole-module passes:";
+                    for (auto& name : dropped) cerr << " " << name;
+                    cerr << endl;
+                }
+                ret = runStreaming(parser, tgt, optimizeLevel > 0 || !passPipeline.empty() ? &passManager : nullptr,
+                    outStream);
+                goto cleanup_ast;
+            }
         }
 
         /*
@@ -223,12 +597,15 @@ int main(int argc, char** argv)
          * 期望输出示例:
          * 在 `testcase/parser/` 目录下提供了一些测试用例以及它们的预期输出，可以自行查看。
          */
-        ast = parser.parseAST();
+        {
+            Stats::Scope scope("parser");
+            ast = parser.parseAST();
+        }
         if (!ast)
         {
             cerr << "Parsing failed." << endl;
             ret = 1;
-            goto cleanup_files;
+            goto cleanup_ast;
         }
 
         if (step == "-parser")
@@ -273,7 +650,11 @@ int main(int argc, char** argv)
          * 因此框架中保留了较为简单的几个 `visit` 方法的实现作为示例，你可以参考它们来实现其他节点的检查逻辑。
          */
         FE::AST::ASTChecker checker;
-        bool                accept = apply(checker, *ast);
+        bool                accept = false;
+        {
+            Stats::Scope scope("semantic check");
+            accept = apply(checker, *ast);
+        }
         if (!accept)
         {
             cerr << "Semantic check failed with " << checker.errors.size() << " errors." << endl;
@@ -312,10 +693,15 @@ int main(int argc, char** argv)
          */
         ME::ASTCodeGen codegen(checker.getGlbSymbols(), checker.getFuncDecls());
         ME::Module     m;
+        auto           meSize = [&m]() { return irSize(m); };
+        IRGauges       irGauges(m);
 
-        apply(codegen, *ast, &m);
+        {
+            Stats::Scope scope("ir generation", meSize);
+            apply(codegen, *ast, &m);
+        }
 
-        if (optimizeLevel > 0)
+        if (optimizeLevel > 0 || !passPipeline.empty())
         {
             /*
              * Lab 4: 中间代码优化
@@ -329,60 +715,32 @@ int main(int argc, char** argv)
              * - 激进死代码消除（基于控制依赖图，需删除死循环）
              * - 难度不低于上述 pass 的其它优化
              */
-            // 下面这个 pass 可以作为参考，主要是示范如何通过cache获取分析pass的结果
-            // ME::UnifyReturnPass unifyReturnPass;
-            // unifyReturnPass.runOnModule(m);
-
-            // 在此处添加更多的优化 pass
-            // 示例：
-            // 改了一下顺序
-            // ME::SomeOtherPass someOtherPass;
-            // someOtherPass.runOnModule(m);
-
-            ME::EliminateUnreachableBBPass eliPass;
-            eliPass.runOnModule(m);
-
-            // 改到这里了
-            ME::UnifyReturnPass unifyReturnPass;
-            unifyReturnPass.runOnModule(m);
-
-            // 简易版 mem2reg（仅标量、同块 def/use）
-            ME::BasicMem2RegPass basicMem2Reg;
-            basicMem2Reg.runOnModule(m);
-
-            // // 完整版 mem2reg
-            // ME::Mem2RegPass mem2reg;
-            // mem2reg.runOnModule(m);
-
-            // 稀疏条件常量传播（简化版）
-            ME::SCCPPass sccp;
-            sccp.runOnModule(m);
-
-            // 公共子表达式消除（CSE）
-            ME::CSEPass cse;
-            cse.runOnModule(m);
-
-            // 激进死代码消除（ADCE）
-            ME::ADCEPass adce;
-            adce.runOnModule(m);
-
-            // 完整版 mem2reg
-            ME::Mem2RegPass mem2reg;
-            mem2reg.runOnModule(m);
-
-            // // 激进死代码消除（ADCE）
-            // ME::ADCEPass adce;
-            // adce.runOnModule(m);
+            Stats::Scope scope("optimization", meSize);
+            passManager.run(m, meSize);
+        }
 
-            // ME::ADCEPass adce1;
-            // adce1.runOnModule(m);
+        // -emit-ir-bin：保存中端的最终结果，之后可用 -load-ir-bin 从这里直接进入后端
+        if (!emitIRBinFile.empty())
+        {
+            Stats::Scope    scope("ir binary output");
+            ME::IRBinWriter writer;
+            string          err;
+            if (!writer.write(m, emitIRBinFile, err))
+            {
+                cerr << "Error: " << err << endl;
+                ret = 1;
+                goto cleanup_ast;
+            }
         }
 
         if (step == "-llvm")
         {
             // 这一部分的打印有完整实现提供，如果你未对 IR 结构有改动，可以直接使用
-            ME::IRPrinter printer;
-            printer.visit(m, *outStream);
+            {
+                Stats::Scope  scope("ir output");
+                ME::IRPrinter printer;
+                printer.print(m, *outStream);
+            }
             ret = 0;
             goto cleanup_ast;
         }
@@ -442,20 +800,34 @@ int main(int argc, char** argv)
             goto cleanup_ast;
         }
 
-        tgt->runPipeline(&m, &backendModule, outStream);
+        {
+            BackendGauges beGauges(backendModule, tgt);
+            Stats::Scope  scope("backend");
+            tgt->setThreadPool(threadPool.get());
+            tgt->runPipeline(&m, &backendModule, outStream);
+        }
 
         ret = 0;
     }
 
 cleanup_ast:
-    delete ast;
+    // AST 已随 parser 的 arena 在离开上面的作用域时整块释放
     ast = nullptr;
 
-cleanup_files:
-    if (in.is_open()) in.close();
-
 cleanup_outfile:
+    if (cache)
+    {
+        string text = cacheBuf.str();
+        finalStream->write(text.data(), text.size());
+        if (ret == 0)
+        {
+            Stats::Scope scope("cache store");
+            cache->store(cacheKey, text);
+        }
+    }
     if (outFile.is_open()) outFile.close();
 
+    Stats::report(cerr);
+
     return ret;
 }
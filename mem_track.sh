@@ -1,5 +1,7 @@
 #!/bin/bash
 # 你可以使用这个脚本来检查内存泄漏
+# 中端 IR 默认从 arena 整块分配，valgrind 难以定位到单个节点；
+# 检查前建议使用 make clean && make IR_HEAP=1 重新构建，让 IR 节点走逐个 new/delete 的堆分配路径
 
 INPUT_FILE="${1:-test.sy}"
 STAGE="${2:-S}"
@@ -2,15 +2,8 @@
 
 namespace ME
 {
-    Block::~Block()
-    {
-        for (auto inst : insts)
-        {
-            delete inst;
-            inst = nullptr;
-        }
-        insts.clear();
-    }
+    // 指令由所属 Function 的 arena 管理，这里不逐条释放
+    Block::~Block() {}
 
     void Block::insertFront(Instruction* inst) { insts.push_front(inst); }
     void Block::insertBack(Instruction* inst) { insts.push_back(inst); }
@@ -2,35 +2,41 @@
 #define __MIDDLEEND_MODULE_IR_BLOCK_H__
 
 #include <middleend/module/ir_instruction.h>
-#include <deque>
+#include <ilist.h>
+#include <vector>
 
 #define ENABLE_IRBLOCK_COMMENT
 
 namespace ME
 {
-    class Block : public Visitable
+    // 基本块通过 IListNode 挂在所属 Function 的布局链表上
+    class Block : public Visitable, public IListNode<Block>
     {
       public:
-        std::deque<Instruction*> insts;
-        size_t                   blockId;
+        // 侵入式链表：任意位置增删 O(1)，增删其它指令不影响已有迭代器
+        IList<Instruction> insts;
+        size_t             blockId;
 
       public:
 #ifndef ENABLE_IRBLOCK_COMMENT
-        Block(size_t id = 0, const std::string& c = "") : blockId(id) {}
-        void        setComment(const std::string& c) {}
+        Block(size_t id = 0, const char* c = "") : blockId(id) {}
+        void        setComment(const char* c) {}
         std::string getComment() const { return ""; }
 #else
-        std::string comment;
-        Block(size_t id = 0, const std::string& c = "") : blockId(id), comment(c) {}
-        void        setComment(const std::string& c) { comment = c; }
+        const char* comment;  // 只引用字符串字面量，不持有内存
+        Block(size_t id = 0, const char* c = "") : blockId(id), comment(c) {}
+        void        setComment(const char* c) { comment = c; }
         std::string getComment() const
         {
-            if (comment.empty()) return "";
-            return " ; " + comment;
+            if (!*comment) return "";
+            return std::string(" ; ") + comment;
         }
 #endif
         ~Block();
 
+        // 与指令相同，块不持有 arena 之外的内存，arena 无需逐个析构
+        static constexpr bool kArenaSkipDtor = true;
+
       public:
         virtual void accept(Visitor& visitor) override { visitor.visit(*this); }
 
@@ -38,6 +44,65 @@ namespace ME
         void insertBack(Instruction* inst);
         void insert(Instruction* inst) { insertBack(inst); }
     };
+
+    /*
+     * 函数的基本块集合
+     * - 以 blockId 为下标稠密存储，按 id 查找为 O(1)
+     * - 另以侵入式链表维护布局顺序（即打印与指令选择的顺序），遍历时按布局顺序给出 Block*
+     * - 新块默认追加到末尾，因此不调整布局时布局顺序即 id 递增顺序
+     */
+    class BlockList
+    {
+      private:
+        std::vector<Block*> byId;
+        IList<Block>        layout;
+
+      public:
+        using iterator = IList<Block>::iterator;
+
+        iterator begin() { return layout.begin(); }
+        iterator end() { return layout.end(); }
+
+        size_t size() const { return layout.size(); }
+        bool   empty() const { return layout.empty(); }
+        Block* front() const { return layout.front(); }
+        Block* back() const { return layout.back(); }
+
+        Block* get(size_t id) const { return id < byId.size() ? byId[id] : nullptr; }
+        bool   contains(size_t id) const { return get(id) != nullptr; }
+
+        void push_back(Block* block)
+        {
+            if (block->blockId >= byId.size()) byId.resize(block->blockId + 1, nullptr);
+            byId[block->blockId] = block;
+            layout.push_back(block);
+        }
+        // 在布局中把 block 放到 pos 之后
+        void insertAfter(Block* pos, Block* block)
+        {
+            if (block->blockId >= byId.size()) byId.resize(block->blockId + 1, nullptr);
+            byId[block->blockId] = block;
+            layout.insertAfter(pos, block);
+        }
+        // 在布局中把 block 放到 pos 之前
+        void insertBefore(Block* pos, Block* block)
+        {
+            if (block->blockId >= byId.size()) byId.resize(block->blockId + 1, nullptr);
+            byId[block->blockId] = block;
+            layout.insertBefore(pos, block);
+        }
+        iterator erase(iterator pos)
+        {
+            byId[pos->blockId] = nullptr;
+            return layout.erase(pos);
+        }
+        void remove(Block* block) { erase(layout.iteratorTo(block)); }
+        void clear()
+        {
+            byId.clear();
+            layout.clear();
+        }
+    };
 }  // namespace ME
 
 #endif  // __MIDDLEEND_MODULE_IR_BLOCK_H__
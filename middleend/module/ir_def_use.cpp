@@ -0,0 +1,119 @@
+#include <middleend/module/ir_def_use.h>
+#include <middleend/module/ir_function.h>
+#include <algorithm>
+
+namespace ME
+{
+    static inline bool isReg(Operand* op) { return op && op->getType() == OperandType::REG; }
+
+    void DefUseChain::build(Function& func)
+    {
+        clear();
+        defs.resize(func.getMaxReg() + 1, nullptr);
+        uses.resize(func.getMaxReg() + 1);
+
+        for (auto* block : func.blocks)
+        {
+            for (auto* inst : block->insts) addInst(inst);
+        }
+    }
+
+    void DefUseChain::clear()
+    {
+        defs.clear();
+        uses.clear();
+    }
+
+    void DefUseChain::ensure(size_t reg)
+    {
+        if (reg < defs.size()) return;
+        defs.resize(reg + 1, nullptr);
+        uses.resize(reg + 1);
+    }
+
+    void DefUseChain::addInst(Instruction* inst)
+    {
+        Operand* def = inst->getDefOperand();
+        if (isReg(def))
+        {
+            ensure(def->getRegNum());
+            defs[def->getRegNum()] = inst;
+        }
+
+        std::vector<Operand**> slots;
+        inst->getUseSlots(slots);
+        for (auto** slot : slots) addUse(inst, slot);
+    }
+
+    void DefUseChain::addUse(Instruction* user, Operand** slot)
+    {
+        if (!isReg(*slot)) return;
+        size_t reg = (*slot)->getRegNum();
+        ensure(reg);
+        uses[reg].push_back({user, slot});
+    }
+
+    void DefUseChain::removeUse(Instruction* user, Operand** slot)
+    {
+        if (!isReg(*slot) || (*slot)->getRegNum() >= uses.size()) return;
+        auto& list = uses[(*slot)->getRegNum()];
+        list.erase(std::remove_if(list.begin(), list.end(),
+                       [&](const Use& u) { return u.user == user && u.slot == slot; }),
+            list.end());
+    }
+
+    void DefUseChain::removeInst(Instruction* inst) { removeInsts({inst}); }
+
+    void DefUseChain::removeInsts(const std::unordered_set<Instruction*>& insts)
+    {
+        std::unordered_set<size_t> touched;
+        std::vector<Operand**>     slots;
+
+        for (auto* inst : insts)
+        {
+            Operand* def = inst->getDefOperand();
+            if (isReg(def) && def->getRegNum() < defs.size() && defs[def->getRegNum()] == inst)
+                defs[def->getRegNum()] = nullptr;
+
+            slots.clear();
+            inst->getUseSlots(slots);
+            for (auto** slot : slots)
+            {
+                if (isReg(*slot)) touched.insert((*slot)->getRegNum());
+            }
+        }
+
+        for (size_t reg : touched)
+        {
+            if (reg >= uses.size()) continue;
+            auto& list = uses[reg];
+            list.erase(std::remove_if(list.begin(), list.end(), [&](const Use& u) { return insts.count(u.user); }),
+                list.end());
+        }
+    }
+
+    Instruction* DefUseChain::getDef(size_t reg) const { return reg < defs.size() ? defs[reg] : nullptr; }
+
+    const std::vector<DefUseChain::Use>& DefUseChain::getUses(size_t reg) const
+    {
+        static const std::vector<Use> empty;
+        return reg < uses.size() ? uses[reg] : empty;
+    }
+
+    bool DefUseChain::hasUses(size_t reg) const { return reg < uses.size() && !uses[reg].empty(); }
+
+    void DefUseChain::replaceAllUsesWith(size_t reg, Operand* to)
+    {
+        if (reg >= uses.size() || uses[reg].empty()) return;
+        if (isReg(to) && to->getRegNum() == reg) return;
+
+        std::vector<Use> moved;
+        moved.swap(uses[reg]);
+        for (auto& u : moved) *u.slot = to;
+
+        if (!isReg(to)) return;
+        ensure(to->getRegNum());
+        auto& dst = uses[to->getRegNum()];
+        dst.insert(dst.end(), moved.begin(), moved.end());
+    }
+}  // namespace ME
@@ -0,0 +1,62 @@
+#ifndef __MIDDLEEND_MODULE_IR_DEF_USE_H__
+#define __MIDDLEEND_MODULE_IR_DEF_USE_H__
+
+#include <middleend/module/ir_instruction.h>
+#include <type_utils.h>
+#include <unordered_set>
+#include <vector>
+
+namespace ME
+{
+    class Function;
+
+    /*
+     * 函数级 def-use 链
+     * - 以寄存器号为下标稠密存储：defs[r] 为定义 r 的指令，uses[r] 为所有使用 r 的 (指令, 槽位)
+     * - 槽位即指令中保存该操作数指针的成员地址，替换时直接改写槽位，
+     *   因此 replaceAllUsesWith 的代价只与使用次数成正比，无需扫描整个函数
+     * - 由 Function 持有并按需构建。通过本类接口修改 IR 的 pass 会同步维护它；
+     *   直接改写操作数/增删指令的 pass 需调用 Function::invalidateDefUse()（AM.invalidate 也会使其失效）
+     */
+    class DefUseChain
+    {
+      public:
+        static inline const size_t TID = getTID<DefUseChain>();
+
+        struct Use
+        {
+            Instruction* user;
+            Operand**    slot;
+        };
+
+      private:
+        std::vector<Instruction*>     defs;
+        std::vector<std::vector<Use>> uses;
+
+      public:
+        void build(Function& func);
+        void clear();
+
+        // 登记一条新指令的定义与全部使用
+        void addInst(Instruction* inst);
+        // 登记单个使用槽位，如 phi 新增的 incoming
+        void addUse(Instruction* user, Operand** slot);
+        // 注销单个使用槽位，须在改写槽位中的操作数之前调用
+        void removeUse(Instruction* user, Operand** slot);
+        // 注销指令，须在指令被 destroy 之前调用；批量版本对每个寄存器只过滤一次使用列表
+        void removeInst(Instruction* inst);
+        void removeInsts(const std::unordered_set<Instruction*>& insts);
+
+        Instruction*            getDef(size_t reg) const;
+        const std::vector<Use>& getUses(size_t reg) const;
+        bool                    hasUses(size_t reg) const;
+
+        // 将寄存器 reg 的所有使用改写为 to，若 to 为寄存器则使用记录随之迁移
+        void replaceAllUsesWith(size_t reg, Operand* to);
+
+      private:
+        void ensure(size_t reg);
+    };
+}  // namespace ME
+
+#endif  // __MIDDLEEND_MODULE_IR_DEF_USE_H__
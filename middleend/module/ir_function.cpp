@@ -1,40 +1,73 @@
 #include <middleend/module/ir_function.h>
+#include <cstring>
 
 namespace ME
 {
-    Function::Function(FuncDefInst* fd)
-        : funcDef(fd), blocks(), maxLabel(0), maxReg(0), loopStartLabel(0), loopEndLabel(0)
+    Function::Function(FuncDefInst* fd, OperandFactory& operands)
+        : funcDef(fd),
+          blocks(),
+          arena(),
+          operands(operands),
+          maxLabel(0),
+          maxReg(0),
+          defUseValid(false),
+          loopStartLabel(0),
+          loopEndLabel(0)
     {}
-    Function::~Function()
-    {
-        if (funcDef)
-        {
-            delete funcDef;
-            funcDef = nullptr;
-        }
-        for (auto& [label, block] : blocks)
-        {
-            delete block;
-            block = nullptr;
-        }
-    }
+    // funcDef 属于所在 Module 的 arena，Block 与指令随本函数的 arena 整体释放
+    Function::~Function() {}
 
     Block* Function::createBlock()
     {
-        Block* newBlock  = new Block(maxLabel);
-        blocks[maxLabel] = newBlock;
+        Block* newBlock = arena.create<Block>(maxLabel);
+        blocks.push_back(newBlock);
 
         maxLabel++;
         return newBlock;
     }
     Block* Function::getBlock(size_t label)
     {
-        if (blocks.find(label) != blocks.end()) return blocks[label];
-        return nullptr;
+        return blocks.get(label);
     }
-    void   Function::setMaxReg(size_t reg) { maxReg = reg; }
-    size_t Function::getMaxReg() { return maxReg; }
+    void   Function::setMaxReg(size_t reg) { maxReg.store(reg, std::memory_order_relaxed); }
+    size_t Function::getMaxReg() { return maxReg.load(std::memory_order_relaxed); }
     void   Function::setMaxLabel(size_t label) { maxLabel = label; }
     size_t Function::getMaxLabel() { return maxLabel; }
-    size_t Function::getNewRegId() { return ++maxReg; }
+    size_t Function::getNewRegId() { return maxReg.fetch_add(1, std::memory_order_relaxed) + 1; }
+
+    const char* Function::copyString(std::string_view s)
+    {
+        char* copy = static_cast<char*>(arena.allocate(s.size() + 1, 1));
+        std::memcpy(copy, s.data(), s.size());
+        copy[s.size()] = '\0';
+        return copy;
+    }
+
+    void Function::release()
+    {
+        invalidateDefUse();
+        analyses.clear();
+        blocks.clear();
+        arena.reset();
+    }
+
+    DefUseChain& Function::getDefUse()
+    {
+        if (!defUseValid)
+        {
+            defUse.build(*this);
+            defUseValid = true;
+        }
+        return defUse;
+    }
+    void Function::invalidateDefUse()
+    {
+        defUse.clear();
+        defUseValid = false;
+    }
+    void Function::replaceAllUsesWith(Operand* from, Operand* to)
+    {
+        ASSERT(from && from->getType() == OperandType::REG && "replaceAllUsesWith expects a register operand");
+        getDefUse().replaceAllUsesWith(from->getRegNum(), to);
+    }
 }  // namespace ME
@@ -2,7 +2,12 @@
 #define __MIDDLEEND_MODULE_IR_FUNCTION_H__
 
 #include <middleend/module/ir_block.h>
+#include <middleend/module/ir_def_use.h>
+#include <middleend/pass/analysis/analysis_result.h>
+#include <arena.h>
+#include <atomic>
 #include <map>
+#include <string_view>
 
 namespace ME
 {
@@ -10,18 +15,25 @@ namespace ME
     {
       public:
         FuncDefInst*             funcDef;
-        std::map<size_t, Block*> blocks;
+        BlockList                blocks;
 
       private:
-        size_t maxLabel;
-        size_t maxReg;
+        Arena               arena;     // 本函数的 Block 与 Instruction 均从此分配，随函数整体释放
+        OperandFactory&     operands;  // 所属 Module 的操作数驻留表
+        size_t              maxLabel;
+        std::atomic<size_t> maxReg;  // 并行优化时 getNewRegId 可能在工作线程上调用
+
+        DefUseChain defUse;
+        bool        defUseValid;
+
+        Analysis::SlotTable analyses;  // AM 缓存的分析结果，随函数析构
 
       public: /*以下2个变量与循环优化相关，如果你正在做Lab3，可以暂时忽略它们 */
         size_t loopStartLabel;
         size_t loopEndLabel;
 
       public:
-        Function(FuncDefInst* fd);
+        Function(FuncDefInst* fd, OperandFactory& operands);
         ~Function();
 
       public:
@@ -34,6 +46,36 @@ namespace ME
         void   setMaxLabel(size_t label);
         size_t getMaxLabel();
         size_t getNewRegId();
+
+        OperandFactory& getOperandFactory() { return operands; }
+
+        template <typename T, typename... Args>
+        T* create(Args&&... args)
+        {
+            return arena.create<T>(std::forward<Args>(args)...);
+        }
+        // 从 IR 中摘除后调用；arena 模式下内存延迟到函数析构时统一回收
+        void destroy(Instruction* inst) { arena.destroy(inst); }
+        void destroy(Block* block) { arena.destroy(block); }
+        // 流式编译中函数输出完毕后调用：析构全部 Block 与指令并归还 arena 的内存，之后函数体为空
+        void release();
+        // 在本函数 arena 上复制一份以 NUL 结尾的字符串，供块注释等只引用不持有的字段使用
+        const char* copyString(std::string_view s);
+        // 本函数 arena 已分配的字节数
+        size_t bytesAllocated() const { return arena.bytesAllocated(); }
+
+        // def-use 链按需构建，IR 被绕开它修改后需调用 invalidateDefUse
+        DefUseChain& getDefUse();
+        void         invalidateDefUse();
+        void         replaceAllUsesWith(Operand* from, Operand* to);
+
+        // 供 AM 使用：按分析的 SLOT 取缓存槽位，表按需增长
+        Analysis::Slot& getAnalysisSlot(size_t slot)
+        {
+            if (slot >= analyses.size()) analyses.resize(slot + 1);
+            return analyses[slot];
+        }
+        Analysis::SlotTable& getAnalysisSlots() { return analyses; }
     };
 }  // namespace ME
 
@@ -5,7 +5,12 @@
 #include <middleend/ir_visitor.h>
 #include <middleend/module/ir_operand.h>
 #include <frontend/ast/ast_defs.h>
+#include <ilist.h>
+#include <map>
+#include <memory>
+#include <memory_resource>
 #include <string>
+#include <string_view>
 #include <vector>
 #include <utility>
 
@@ -17,34 +22,44 @@ namespace ME
    * 根据AST构建这些指令实例。
    * 你可以根据需要自行添加成员变量和函数，辅助你完成实验。
    */
-    class Instruction : public Visitable, public InsVisitable
+    // 指令通过 IListNode 挂在所属 Block 的 insts 链表上
+    class Instruction : public Visitable, public InsVisitable, public IListNode<Instruction>
     {
       public:
         Operator opcode;
 
       public:
 #ifndef ENABLE_IRINST_COMMENT
-        Instruction(Operator op, const std::string& c = "") : opcode(op) {}
-        void        setComment(const std::string& c) {}
+        Instruction(Operator op, const char* c = "") : opcode(op) {}
+        void        setComment(const char* c) {}
         std::string getComment() const
         {
-            if (comment.empty()) return "";
-            return " ; " + comment;
+            if (!*comment) return "";
+            return std::string(" ; ") + comment;
         }
 #else
-        std::string comment;
-        Instruction(Operator op, const std::string& c = "") : opcode(op), comment(c) {}
-        void        setComment(const std::string& c) { comment = c; }
+        const char* comment;  // 只引用字符串字面量，不持有内存
+        Instruction(Operator op, const char* c = "") : opcode(op), comment(c) {}
+        void        setComment(const char* c) { comment = c; }
         std::string getComment() const { return ""; }
 #endif
         virtual ~Instruction() = default;
 
+        // 函数体内的指令不持有 arena 之外的内存（变长成员经 allocator_type 取自所属函数的 arena），
+        // arena 无需逐条析构；模块级的声明类指令持有 std::string 等，需改回 false
+        static constexpr bool kArenaSkipDtor = true;
+
       public:
         virtual std::string toString() const                     = 0;
         virtual void        accept(Visitor& visitor) override    = 0;
         virtual void        accept(InsVisitor& visitor) override = 0;
 
         virtual bool isTerminator() const = 0;
+
+        // def-use 相关：返回本指令定义的寄存器操作数（无则为 nullptr）
+        virtual Operand* getDefOperand() const { return nullptr; }
+        // 收集本指令所有“使用”操作数所在的槽位，不含定义位与跳转目标标签
+        virtual void getUseSlots(std::vector<Operand**>& slots) {}
     };
 
     class LoadInst : public Instruction
@@ -55,7 +70,7 @@ namespace ME
         Operand* res;
 
       public:
-        LoadInst(DataType t, Operand* p, Operand* d, const std::string& c = "")
+        LoadInst(DataType t, Operand* p, Operand* d, const char* c = "")
             : Instruction(Operator::LOAD, c), dt(t), ptr(p), res(d)
         {}
         ~LoadInst() override = default;
@@ -65,6 +80,9 @@ namespace ME
         virtual void        accept(Visitor& visitor) override { visitor.visit(*this); }
         virtual void        accept(InsVisitor& visitor) override { visitor.visit(*this); }
 
+        virtual Operand* getDefOperand() const override { return res; }
+        virtual void     getUseSlots(std::vector<Operand**>& slots) override { slots.push_back(&ptr); }
+
         virtual bool isTerminator() const override { return false; }
     };
 
@@ -76,7 +94,7 @@ namespace ME
         Operand* val;
 
       public:
-        StoreInst(DataType t, Operand* v, Operand* p, const std::string& c = "")
+        StoreInst(DataType t, Operand* v, Operand* p, const char* c = "")
             : Instruction(Operator::STORE, c), dt(t), ptr(p), val(v)
         {}
         ~StoreInst() override = default;
@@ -86,6 +104,12 @@ namespace ME
         virtual void        accept(Visitor& visitor) override { visitor.visit(*this); }
         virtual void        accept(InsVisitor& visitor) override { visitor.visit(*this); }
 
+        virtual void     getUseSlots(std::vector<Operand**>& slots) override
+        {
+            slots.push_back(&val);
+            slots.push_back(&ptr);
+        }
+
         virtual bool isTerminator() const override { return false; }
     };
 
@@ -98,7 +122,7 @@ namespace ME
         Operand* res;
 
       public:
-        ArithmeticInst(Operator op, DataType t, Operand* l, Operand* r, Operand* d, const std::string& c = "")
+        ArithmeticInst(Operator op, DataType t, Operand* l, Operand* r, Operand* d, const char* c = "")
             : Instruction(op, c), dt(t), lhs(l), rhs(r), res(d)
         {}
         ~ArithmeticInst() override = default;
@@ -108,6 +132,13 @@ namespace ME
         virtual void        accept(Visitor& visitor) override { visitor.visit(*this); }
         virtual void        accept(InsVisitor& visitor) override { visitor.visit(*this); }
 
+        virtual Operand* getDefOperand() const override { return res; }
+        virtual void     getUseSlots(std::vector<Operand**>& slots) override
+        {
+            slots.push_back(&lhs);
+            slots.push_back(&rhs);
+        }
+
         virtual bool isTerminator() const override { return false; }
     };
 
@@ -131,6 +162,13 @@ namespace ME
         virtual void        accept(Visitor& visitor) override { visitor.visit(*this); }
         virtual void        accept(InsVisitor& visitor) override { visitor.visit(*this); }
 
+        virtual Operand* getDefOperand() const override { return res; }
+        virtual void     getUseSlots(std::vector<Operand**>& slots) override
+        {
+            slots.push_back(&lhs);
+            slots.push_back(&rhs);
+        }
+
         virtual bool isTerminator() const override { return false; }
     };
 
@@ -154,19 +192,35 @@ namespace ME
         virtual void        accept(Visitor& visitor) override { visitor.visit(*this); }
         virtual void        accept(InsVisitor& visitor) override { visitor.visit(*this); }
 
+        virtual Operand* getDefOperand() const override { return res; }
+        virtual void     getUseSlots(std::vector<Operand**>& slots) override
+        {
+            slots.push_back(&lhs);
+            slots.push_back(&rhs);
+        }
+
         virtual bool isTerminator() const override { return false; }
     };
 
     class AllocaInst : public Instruction
     {
       public:
-        DataType         dt;
-        Operand*         res;
-        std::vector<int> dims;
+        using allocator_type = std::pmr::polymorphic_allocator<std::byte>;
+
+        DataType              dt;
+        Operand*              res;
+        std::pmr::vector<int> dims;
 
       public:
-        AllocaInst(DataType t, Operand* r, std::vector<int> d = {}, const std::string& c = "")
-            : Instruction(Operator::ALLOCA, c), dt(t), res(r), dims(d)
+        template <typename Dims = std::vector<int>>
+        AllocaInst(DataType t, Operand* r, const Dims& d = {}, const char* c = "")
+            : AllocaInst(std::allocator_arg, {}, t, r, d, c)
+        {}
+        // 由 Arena::create 调用，dims 改从所属函数的 arena 分配
+        template <typename Dims = std::vector<int>>
+        AllocaInst(std::allocator_arg_t, const allocator_type& a, DataType t, Operand* r, const Dims& d = {},
+            const char* c = "")
+            : Instruction(Operator::ALLOCA, c), dt(t), res(r), dims(d.begin(), d.end(), a)
         {}
         ~AllocaInst() override = default;
 
@@ -175,6 +229,8 @@ namespace ME
         virtual void        accept(Visitor& visitor) override { visitor.visit(*this); }
         virtual void        accept(InsVisitor& visitor) override { visitor.visit(*this); }
 
+        virtual Operand* getDefOperand() const override { return res; }
+
         virtual bool isTerminator() const override { return false; }
     };
 
@@ -186,7 +242,7 @@ namespace ME
         Operand* falseTar;
 
       public:
-        BrCondInst(Operand* c, Operand* t, Operand* f, const std::string& cm = "")
+        BrCondInst(Operand* c, Operand* t, Operand* f, const char* cm = "")
             : Instruction(Operator::BR_COND, cm), cond(c), trueTar(t), falseTar(f)
         {}
         ~BrCondInst() override = default;
@@ -196,6 +252,8 @@ namespace ME
         virtual void        accept(Visitor& visitor) override { visitor.visit(*this); }
         virtual void        accept(InsVisitor& visitor) override { visitor.visit(*this); }
 
+        virtual void     getUseSlots(std::vector<Operand**>& slots) override { slots.push_back(&cond); }
+
         virtual bool isTerminator() const override { return true; }
     };
 
@@ -205,7 +263,7 @@ namespace ME
         Operand* target;
 
       public:
-        BrUncondInst(Operand* t, const std::string& c = "") : Instruction(Operator::BR_UNCOND, c), target(t) {}
+        BrUncondInst(Operand* t, const char* c = "") : Instruction(Operator::BR_UNCOND, c), target(t) {}
         ~BrUncondInst() override = default;
 
       public:
@@ -219,6 +277,8 @@ namespace ME
     class GlbVarDeclInst : public Instruction
     {
       public:
+        static constexpr bool kArenaSkipDtor = false;
+
         DataType         dt;
         std::string      name;
         Operand*         init;
@@ -244,22 +304,35 @@ namespace ME
     class CallInst : public Instruction
     {
       public:
-        DataType    retType;
-        std::string funcName;
+        using allocator_type = std::pmr::polymorphic_allocator<std::byte>;
+
+        DataType         retType;
+        std::pmr::string funcName;
 
         using argType = DataType;
         using argOp   = Operand*;
         using argPair = std::pair<argType, argOp>;
         using argList = std::vector<argPair>;
-        argList  args;
-        Operand* res;
+        std::pmr::vector<argPair> args;
+        Operand*                  res;
 
       public:
-        CallInst(DataType rt, const std::string& fn, Operand* r = nullptr, const std::string& c = "")
-            : Instruction(Operator::CALL, c), retType(rt), funcName(fn), args({}), res(r)
+        CallInst(DataType rt, std::string_view fn, Operand* r = nullptr, const char* c = "")
+            : CallInst(std::allocator_arg, {}, rt, fn, argList{}, r, c)
         {}
-        CallInst(DataType rt, const std::string& fn, argList a, Operand* r = nullptr, const std::string& c = "")
-            : Instruction(Operator::CALL, c), retType(rt), funcName(fn), args(a), res(r)
+        template <typename Args, typename = decltype(std::declval<const Args&>().begin())>
+        CallInst(DataType rt, std::string_view fn, const Args& al, Operand* r = nullptr, const char* c = "")
+            : CallInst(std::allocator_arg, {}, rt, fn, al, r, c)
+        {}
+        // 由 Arena::create 调用，函数名与实参表改从所属函数的 arena 分配
+        CallInst(std::allocator_arg_t, const allocator_type& a, DataType rt, std::string_view fn, Operand* r = nullptr,
+            const char* c = "")
+            : CallInst(std::allocator_arg, a, rt, fn, argList{}, r, c)
+        {}
+        template <typename Args, typename = decltype(std::declval<const Args&>().begin())>
+        CallInst(std::allocator_arg_t, const allocator_type& a, DataType rt, std::string_view fn, const Args& al,
+            Operand* r = nullptr, const char* c = "")
+            : Instruction(Operator::CALL, c), retType(rt), funcName(fn, a), args(al.begin(), al.end(), a), res(r)
         {}
         ~CallInst() override = default;
 
@@ -268,6 +341,12 @@ namespace ME
         virtual void        accept(Visitor& visitor) override { visitor.visit(*this); }
         virtual void        accept(InsVisitor& visitor) override { visitor.visit(*this); }
 
+        virtual Operand* getDefOperand() const override { return res; }
+        virtual void     getUseSlots(std::vector<Operand**>& slots) override
+        {
+            for (auto& arg : args) slots.push_back(&arg.second);
+        }
+
         virtual bool isTerminator() const override { return false; }
     };
 
@@ -278,7 +357,7 @@ namespace ME
         Operand* res;
 
       public:
-        RetInst(DataType t, Operand* r = nullptr, const std::string& c = "")
+        RetInst(DataType t, Operand* r = nullptr, const char* c = "")
             : Instruction(Operator::RET, c), rt(t), res(r)
         {}
         ~RetInst() override = default;
@@ -288,12 +367,16 @@ namespace ME
         virtual void        accept(Visitor& visitor) override { visitor.visit(*this); }
         virtual void        accept(InsVisitor& visitor) override { visitor.visit(*this); }
 
+        virtual void     getUseSlots(std::vector<Operand**>& slots) override { slots.push_back(&res); }
+
         virtual bool isTerminator() const override { return true; }
     };
 
     class FuncDeclInst : public Instruction
     {
       public:
+        static constexpr bool kArenaSkipDtor = false;
+
         DataType              retType;
         std::string           funcName;
         std::vector<DataType> argTypes;
@@ -301,7 +384,7 @@ namespace ME
 
       public:
         FuncDeclInst(DataType rt, const std::string& fn, std::vector<DataType> at = {}, bool is_va = false,
-            const std::string& c = "")
+            const char* c = "")
             : Instruction(Operator::FUNCDECL, c), retType(rt), funcName(fn), argTypes(at), isVarArg(is_va)
         {}
         ~FuncDeclInst() override = default;
@@ -317,6 +400,8 @@ namespace ME
     class FuncDefInst : public Instruction
     {
       public:
+        static constexpr bool kArenaSkipDtor = false;
+
         DataType    retType;
         std::string funcName;
 
@@ -327,7 +412,7 @@ namespace ME
         argList argRegs;
 
       public:
-        FuncDefInst(DataType rt, const std::string& fn, argList ar = {}, const std::string& c = "")
+        FuncDefInst(DataType rt, const std::string& fn, argList ar = {}, const char* c = "")
             : Instruction(Operator::FUNCDEF, c), retType(rt), funcName(fn), argRegs(ar)
         {}
         ~FuncDefInst() override = default;
@@ -343,17 +428,31 @@ namespace ME
     class GEPInst : public Instruction
     {
       public:
-        DataType              dt;
-        DataType              idxType;
-        Operand*              basePtr;
-        Operand*              res;
-        std::vector<int>      dims;
-        std::vector<Operand*> idxs;
+        using allocator_type = std::pmr::polymorphic_allocator<std::byte>;
+
+        DataType                   dt;
+        DataType                   idxType;
+        Operand*                   basePtr;
+        Operand*                   res;
+        std::pmr::vector<int>      dims;
+        std::pmr::vector<Operand*> idxs;
 
       public:
-        GEPInst(
-            DataType t, DataType it, Operand* bp, Operand* r, std::vector<int> d = {}, std::vector<Operand*> is = {})
-            : Instruction(Operator::GETELEMENTPTR), dt(t), idxType(it), basePtr(bp), res(r), dims(d), idxs(is)
+        template <typename Dims = std::vector<int>, typename Idxs = std::vector<Operand*>>
+        GEPInst(DataType t, DataType it, Operand* bp, Operand* r, const Dims& d = {}, const Idxs& is = {})
+            : GEPInst(std::allocator_arg, {}, t, it, bp, r, d, is)
+        {}
+        // 由 Arena::create 调用，dims 与 idxs 改从所属函数的 arena 分配
+        template <typename Dims = std::vector<int>, typename Idxs = std::vector<Operand*>>
+        GEPInst(std::allocator_arg_t, const allocator_type& a, DataType t, DataType it, Operand* bp, Operand* r,
+            const Dims& d = {}, const Idxs& is = {})
+            : Instruction(Operator::GETELEMENTPTR),
+              dt(t),
+              idxType(it),
+              basePtr(bp),
+              res(r),
+              dims(d.begin(), d.end(), a),
+              idxs(is.begin(), is.end(), a)
         {}
         ~GEPInst() override = default;
 
@@ -362,6 +461,13 @@ namespace ME
         virtual void        accept(Visitor& visitor) override { visitor.visit(*this); }
         virtual void        accept(InsVisitor& visitor) override { visitor.visit(*this); }
 
+        virtual Operand* getDefOperand() const override { return res; }
+        virtual void     getUseSlots(std::vector<Operand**>& slots) override
+        {
+            slots.push_back(&basePtr);
+            for (auto& idx : idxs) slots.push_back(&idx);
+        }
+
         virtual bool isTerminator() const override { return false; }
     };
 
@@ -380,6 +486,9 @@ namespace ME
         virtual void        accept(Visitor& visitor) override { visitor.visit(*this); }
         virtual void        accept(InsVisitor& visitor) override { visitor.visit(*this); }
 
+        virtual Operand* getDefOperand() const override { return dest; }
+        virtual void     getUseSlots(std::vector<Operand**>& slots) override { slots.push_back(&src); }
+
         virtual bool isTerminator() const override { return false; }
     };
 
@@ -398,6 +507,9 @@ namespace ME
         virtual void        accept(Visitor& visitor) override { visitor.visit(*this); }
         virtual void        accept(InsVisitor& visitor) override { visitor.visit(*this); }
 
+        virtual Operand* getDefOperand() const override { return dest; }
+        virtual void     getUseSlots(std::vector<Operand**>& slots) override { slots.push_back(&src); }
+
         virtual bool isTerminator() const override { return false; }
     };
 
@@ -420,6 +532,9 @@ namespace ME
         virtual void        accept(Visitor& visitor) override { visitor.visit(*this); }
         virtual void        accept(InsVisitor& visitor) override { visitor.visit(*this); }
 
+        virtual Operand* getDefOperand() const override { return dest; }
+        virtual void     getUseSlots(std::vector<Operand**>& slots) override { slots.push_back(&src); }
+
         virtual bool isTerminator() const override { return false; }
     };
 
@@ -431,12 +546,26 @@ namespace ME
 
         using ValOp   = Operand*;
         using LabelOp = Operand*;
-        std::map<LabelOp, ValOp> incomingVals;  // label -> value
+
+        // 按标签编号排序：遍历顺序只取决于 IR 本身，与操作数的分配地址无关（如从二进制 IR 读入后）
+        struct LabelLess
+        {
+            bool operator()(const Operand* a, const Operand* b) const
+            {
+                return static_cast<const LabelOperand*>(a)->lnum < static_cast<const LabelOperand*>(b)->lnum;
+            }
+        };
+        using IncomingMap    = std::pmr::map<LabelOp, ValOp, LabelLess>;
+        using allocator_type = std::pmr::polymorphic_allocator<std::byte>;
+
+        IncomingMap incomingVals;  // label -> value
 
       public:
         // 注意这里的参数顺序：类型、结果寄存器、可选注释
-        PhiInst(DataType t, Operand* r, const std::string& c = "")
-            : Instruction(Operator::PHI, c), dt(t), res(r), incomingVals({})
+        PhiInst(DataType t, Operand* r, const char* c = "") : PhiInst(std::allocator_arg, {}, t, r, c) {}
+        // 由 Arena::create 调用，incoming 表改从所属函数的 arena 分配
+        PhiInst(std::allocator_arg_t, const allocator_type& a, DataType t, Operand* r, const char* c = "")
+            : Instruction(Operator::PHI, c), dt(t), res(r), incomingVals(a)
         {}
         ~PhiInst() override = default;
 
@@ -454,6 +583,12 @@ namespace ME
             incomingVals[l] = v;
         }
 
+        virtual Operand* getDefOperand() const override { return res; }
+        virtual void     getUseSlots(std::vector<Operand**>& slots) override
+        {
+            for (auto& [label, val] : incomingVals) slots.push_back(&val);
+        }
+
         virtual bool isTerminator() const override { return false; }
     };
 }  // namespace ME
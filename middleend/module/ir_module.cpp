@@ -2,23 +2,7 @@
 
 namespace ME
 {
-    Module::Module() : globalVars(), funcDecls(), functions() {}
-    Module::~Module()
-    {
-        for (auto& p : globalVars)
-        {
-            delete p;
-            p = nullptr;
-        }
-        for (auto& p : funcDecls)
-        {
-            delete p;
-            p = nullptr;
-        }
-        for (auto& p : functions)
-        {
-            delete p;
-            p = nullptr;
-        }
-    }
+    Module::Module() : operands(), arena(), globalVars(), funcDecls(), functions() {}
+    // 所有节点由 arena 统一析构并整块释放
+    Module::~Module() {}
 }  // namespace ME
@@ -7,6 +7,10 @@ namespace ME
 {
     class Module : public Visitable
     {
+      private:
+        OperandFactory operands;  // 本模块的操作数驻留表
+        Arena          arena;     // 全局变量、函数声明/定义及 Function 对象本身
+
       public:
         std::vector<GlbVarDeclInst*> globalVars;
         std::vector<FuncDeclInst*>   funcDecls;
@@ -18,6 +22,16 @@ namespace ME
 
       public:
         virtual void accept(Visitor& visitor) override { visitor.visit(*this); }
+
+        OperandFactory& getOperandFactory() { return operands; }
+        // 模块自身 arena 已分配的字节数，不含各函数与操作数工厂
+        size_t bytesAllocated() const { return arena.bytesAllocated(); }
+
+        template <typename T, typename... Args>
+        T* create(Args&&... args)
+        {
+            return arena.create<T>(std::forward<Args>(args)...);
+        }
     };
 }  // namespace ME
 
@@ -1,84 +1,184 @@
 #include <middleend/module/ir_operand.h>
+#include <algorithm>
+#include <cstring>
 
 namespace ME
 {
+    // Fibonacci 散列：表容量始终为 2 的幂，取乘积的高 log2(容量) 位
+    // 低位只由键的低位决定，按步长递增的常量（4 的倍数、2 的幂）会挤在少数槽位里
+    static inline size_t hashImme(uint32_t key, unsigned shift) { return (size_t)((key * 0x9E3779B9u) >> shift); }
+
+    Operand* OperandFactory::ImmeTable::find(uint32_t key) const
+    {
+        if (vals.empty()) return nullptr;
+        size_t mask = vals.size() - 1;
+        for (size_t i = hashImme(key, shift);; i = (i + 1) & mask)
+        {
+            if (!vals[i]) return nullptr;
+            if (keys[i] == key) return vals[i];
+        }
+    }
+
+    void OperandFactory::ImmeTable::insert(uint32_t key, Operand* op)
+    {
+        // 装载因子保持在 1/2 以下
+        if ((count + 1) * 2 > vals.size()) grow();
+        size_t mask = vals.size() - 1;
+        size_t i    = hashImme(key, shift);
+        while (vals[i]) i = (i + 1) & mask;
+        keys[i] = key;
+        vals[i] = op;
+        ++count;
+    }
+
+    void OperandFactory::ImmeTable::grow()
+    {
+        std::vector<uint32_t> oldKeys;
+        std::vector<Operand*> oldVals;
+        oldKeys.swap(keys);
+        oldVals.swap(vals);
+
+        size_t cap = oldVals.empty() ? 64 : oldVals.size() * 2;
+        keys.assign(cap, 0);
+        vals.assign(cap, nullptr);
+        count = 0;
+        shift = 32;
+        for (size_t c = cap; c > 1; c >>= 1) --shift;
+        for (size_t i = 0; i < oldVals.size(); ++i)
+        {
+            if (oldVals[i]) insert(oldKeys[i], oldVals[i]);
+        }
+    }
+
     OperandFactory::~OperandFactory()
     {
-        for (auto& [k, v] : ImmeI32OperandMap) delete v;
-        for (auto& [k, v] : ImmeF32OperandMap) delete v;
-        for (auto& [k, v] : RegOperandMap) delete v;
-        for (auto& [k, v] : LabelOperandMap) delete v;
-        for (auto& [k, v] : GlobalOperandMap) delete v;
+        // 仅 GlobalOperand 持有堆内存，其余操作数随 arena 整块释放
+        for (auto& [name, op] : globals) op->~GlobalOperand();
+    }
+
+    RegOperand* OperandFactory::internReg(size_t id)
+    {
+        if (id >= regs.size()) regs.resize(std::max(id + 1, regs.size() * 2), nullptr);
+        if (!regs[id])
+        {
+            regs[id] = new (arena.allocate(sizeof(RegOperand), alignof(RegOperand))) RegOperand(id);
+            ++numOperands;
+        }
+        return regs[id];
+    }
+
+    ImmeI32Operand* OperandFactory::internImmeI32(uint32_t key, int value)
+    {
+        if (auto* op = immeI32s.find(key)) return static_cast<ImmeI32Operand*>(op);
+
+        auto* op = new (arena.allocate(sizeof(ImmeI32Operand), alignof(ImmeI32Operand))) ImmeI32Operand(value);
+        immeI32s.insert(key, op);
+        ++numOperands;
+        return op;
+    }
+
+    ImmeF32Operand* OperandFactory::internImmeF32(uint32_t key, float value)
+    {
+        if (auto* op = immeF32s.find(key)) return static_cast<ImmeF32Operand*>(op);
+
+        auto* op = new (arena.allocate(sizeof(ImmeF32Operand), alignof(ImmeF32Operand))) ImmeF32Operand(value);
+        immeF32s.insert(key, op);
+        ++numOperands;
+        return op;
+    }
+
+    GlobalOperand* OperandFactory::internGlobal(const std::string& name)
+    {
+        auto it = globals.find(name);
+        if (it != globals.end()) return it->second;
+
+        auto* op      = new (arena.allocate(sizeof(GlobalOperand), alignof(GlobalOperand))) GlobalOperand(name);
+        globals[name] = op;
+        ++numOperands;
+        return op;
+    }
+
+    LabelOperand* OperandFactory::internLabel(size_t num)
+    {
+        if (num >= labels.size()) labels.resize(std::max(num + 1, labels.size() * 2), nullptr);
+        if (!labels[num])
+        {
+            labels[num] = new (arena.allocate(sizeof(LabelOperand), alignof(LabelOperand))) LabelOperand(num);
+            ++numOperands;
+        }
+        return labels[num];
     }
 
     RegOperand* OperandFactory::getRegOperand(size_t id)
     {
-        auto it = RegOperandMap.find(id);
-        if (it == RegOperandMap.end())
+        if (!concurrent) return internReg(id);
         {
-            RegOperand* op    = new RegOperand(id);
-            RegOperandMap[id] = op;
-            return op;
+            std::shared_lock<std::shared_mutex> lock(mtx);
+            if (id < regs.size() && regs[id]) return regs[id];
         }
-        return it->second;
+        std::unique_lock<std::shared_mutex> lock(mtx);
+        return internReg(id);
     }
 
     ImmeI32Operand* OperandFactory::getImmeI32Operand(int value)
     {
-        auto it = ImmeI32OperandMap.find(value);
-        if (it == ImmeI32OperandMap.end())
+        uint32_t key = (uint32_t)value;
+        if (!concurrent) return internImmeI32(key, value);
         {
-            ImmeI32Operand* op       = new ImmeI32Operand(value);
-            ImmeI32OperandMap[value] = op;
-            return op;
+            std::shared_lock<std::shared_mutex> lock(mtx);
+            if (auto* op = immeI32s.find(key)) return static_cast<ImmeI32Operand*>(op);
         }
-        return it->second;
+        std::unique_lock<std::shared_mutex> lock(mtx);
+        return internImmeI32(key, value);
     }
 
     ImmeF32Operand* OperandFactory::getImmeF32Operand(float value)
     {
-        auto it = ImmeF32OperandMap.find(value);
-        if (it == ImmeF32OperandMap.end())
+        // 按位驻留：0.0 与 -0.0 是不同的立即数
+        uint32_t key;
+        std::memcpy(&key, &value, sizeof(key));
+        if (!concurrent) return internImmeF32(key, value);
         {
-            ImmeF32Operand* op       = new ImmeF32Operand(value);
-            ImmeF32OperandMap[value] = op;
-            return op;
+            std::shared_lock<std::shared_mutex> lock(mtx);
+            if (auto* op = immeF32s.find(key)) return static_cast<ImmeF32Operand*>(op);
         }
-        return it->second;
+        std::unique_lock<std::shared_mutex> lock(mtx);
+        return internImmeF32(key, value);
     }
 
     GlobalOperand* OperandFactory::getGlobalOperand(const std::string& name)
     {
-        auto it = GlobalOperandMap.find(name);
-        if (it == GlobalOperandMap.end())
+        if (!concurrent) return internGlobal(name);
         {
-            GlobalOperand* op      = new GlobalOperand(name);
-            GlobalOperandMap[name] = op;
-            return op;
+            std::shared_lock<std::shared_mutex> lock(mtx);
+            auto                                it = globals.find(name);
+            if (it != globals.end()) return it->second;
         }
-        return it->second;
+        std::unique_lock<std::shared_mutex> lock(mtx);
+        return internGlobal(name);
     }
 
     LabelOperand* OperandFactory::getLabelOperand(size_t num)
     {
-        auto it = LabelOperandMap.find(num);
-        if (it == LabelOperandMap.end())
+        if (!concurrent) return internLabel(num);
         {
-            LabelOperand* op     = new LabelOperand(num);
-            LabelOperandMap[num] = op;
-            return op;
+            std::shared_lock<std::shared_mutex> lock(mtx);
+            if (num < labels.size() && labels[num]) return labels[num];
         }
-        return it->second;
+        std::unique_lock<std::shared_mutex> lock(mtx);
+        return internLabel(num);
     }
 
-    OperandFactory& ofInstance = OperandFactory::getInstance();
-}  // namespace ME
+    size_t OperandFactory::size() const { return numOperands; }
 
-ME::RegOperand*     getRegOperand(size_t id) { return ME::ofInstance.getRegOperand(id); }
-ME::ImmeI32Operand* getImmeI32Operand(int value) { return ME::ofInstance.getImmeI32Operand(value); }
-ME::ImmeF32Operand* getImmeF32Operand(float value) { return ME::ofInstance.getImmeF32Operand(value); }
-ME::GlobalOperand*  getGlobalOperand(const std::string& name) { return ME::ofInstance.getGlobalOperand(name); }
-ME::LabelOperand*   getLabelOperand(size_t num) { return ME::ofInstance.getLabelOperand(num); }
+    size_t OperandFactory::bytesAllocated() const
+    {
+        // 全局变量表只计表项指针，其节点与名字的堆内存不计入
+        size_t tables = (regs.capacity() + labels.capacity() + globals.size()) * sizeof(void*) +
+                        (immeI32s.capacity() + immeF32s.capacity()) * (sizeof(uint32_t) + sizeof(Operand*));
+        return arena.bytesAllocated() + tables;
+    }
+}  // namespace ME
 
 std::ostream& operator<<(std::ostream& os, const ME::Operand* op)
 {
@@ -4,9 +4,14 @@
 #include <middleend/ir_defs.h>
 #include <transfer.h>
 #include <debug.h>
+#include <arena.h>
+#include <cstdint>
+#include <mutex>
+#include <shared_mutex>
 #include <string>
 #include <sstream>
-#include <map>
+#include <unordered_map>
+#include <vector>
 
 namespace ME
 {
@@ -112,39 +117,86 @@ namespace ME
         virtual size_t      getRegNum() const override { ERROR("LabelOperand does not have a register"); }
     };
 
+    /*
+     * 操作数驻留工厂，由 Module 持有，同一模块内相同的操作数只创建一次
+     * - RegOperand / LabelOperand：按编号稠密存放于 vector，O(1) 下标访问
+     * - 立即数：以 32 位取值为键的开放寻址哈希表（线性探测）
+     * - 全局变量：按名字驻留
+     * 所有操作数从工厂自己的 arena 分配，随模块一起整块释放。
+     * 没有全局的当前工厂：代码生成经 Module、优化遍经 Function::getOperandFactory 取得所属模块的工厂。
+     * 串行时直接查表，不加锁；FunctionPass 并行处理各函数期间由 ConcurrentScope 打开加锁，
+     * 此时查找持共享锁，未命中时持独占锁再查一次并创建。
+     */
     class OperandFactory
     {
       private:
-        std::map<int, ImmeI32Operand*>        ImmeI32OperandMap;
-        std::map<float, ImmeF32Operand*>      ImmeF32OperandMap;
-        std::map<size_t, RegOperand*>         RegOperandMap;
-        std::map<size_t, LabelOperand*>       LabelOperandMap;
-        std::map<std::string, GlobalOperand*> GlobalOperandMap;
+        class ImmeTable
+        {
+          private:
+            std::vector<uint32_t> keys;
+            std::vector<Operand*> vals;
+            size_t                count = 0;
+            unsigned              shift = 32;  // 32 - log2(容量)，散列取乘积的高位
+
+          public:
+            Operand* find(uint32_t key) const;
+            void     insert(uint32_t key, Operand* op);
+            size_t   capacity() const { return keys.capacity(); }
+
+          private:
+            void grow();
+        };
+
+        Arena                                           arena;
+        std::vector<RegOperand*>                        regs;
+        std::vector<LabelOperand*>                      labels;
+        ImmeTable                                       immeI32s;
+        ImmeTable                                       immeF32s;
+        std::unordered_map<std::string, GlobalOperand*> globals;
+        size_t                                          numOperands = 0;
+        std::shared_mutex                               mtx;
+        bool                                            concurrent = false;
+
+        // 查表，未命中则创建；调用方负责在并行期间持独占锁
+        RegOperand*     internReg(size_t id);
+        ImmeI32Operand* internImmeI32(uint32_t key, int value);
+        ImmeF32Operand* internImmeF32(uint32_t key, float value);
+        GlobalOperand*  internGlobal(const std::string& name);
+        LabelOperand*   internLabel(size_t num);
 
+      public:
         OperandFactory() = default;
         ~OperandFactory();
 
-      public:
+        OperandFactory(const OperandFactory&)            = delete;
+        OperandFactory& operator=(const OperandFactory&) = delete;
+
         RegOperand*     getRegOperand(size_t id);
         ImmeI32Operand* getImmeI32Operand(int value);
         ImmeF32Operand* getImmeF32Operand(float value);
         GlobalOperand*  getGlobalOperand(const std::string& name);
         LabelOperand*   getLabelOperand(size_t num);
 
-        static OperandFactory& getInstance()
+        // 供 -fmem-report 使用：已驻留的操作数个数，以及 arena 与各驻留表占用的字节数；只在串行阶段调用
+        size_t size() const;
+        size_t bytesAllocated() const;
+
+        // 作用域内各线程可能同时驻留操作数，查表改为加锁；进出作用域须在串行阶段
+        class ConcurrentScope
         {
-            static OperandFactory instance;
-            return instance;
-        }
+          private:
+            OperandFactory& factory;
+
+          public:
+            explicit ConcurrentScope(OperandFactory& f) : factory(f) { factory.concurrent = true; }
+            ~ConcurrentScope() { factory.concurrent = false; }
+
+            ConcurrentScope(const ConcurrentScope&)            = delete;
+            ConcurrentScope& operator=(const ConcurrentScope&) = delete;
+        };
     };
 }  // namespace ME
 
-ME::RegOperand*     getRegOperand(size_t id);
-ME::ImmeI32Operand* getImmeI32Operand(int value);
-ME::ImmeF32Operand* getImmeF32Operand(float value);
-ME::GlobalOperand*  getGlobalOperand(const std::string& name);
-ME::LabelOperand*   getLabelOperand(size_t num);
-
 std::ostream& operator<<(std::ostream& os, const ME::Operand* op);
 
 #endif  // __MIDDLEEND_MODULE_IR_OPERAND_H__
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <interfaces/middleend/pass.h>
 #include <unordered_set>
 #include <queue>
 
@@ -9,14 +10,15 @@ namespace ME
     class Function;
     class Instruction;
     class Operand;
+    class DefUseChain;
 
     // Aggressive Dead Code Elimination Pass
     // 激进死代码消除：删除所有对程序输出无影响的指令
-    class ADCEPass
+    class ADCEPass : public FunctionPass
     {
       public:
-        void runOnModule(Module& module);
-        void runOnFunction(Function& function);
+        const char*       getName() const override { return "adce"; }
+        PreservedAnalyses runOnFunction(Function& function) override;
 
       private:
         // 判断指令是否关键（有副作用）
@@ -27,7 +29,7 @@ namespace ME
         
         // 添加操作数依赖到工作列表
         void addOperandDeps(Operand* op, std::queue<Instruction*>& worklist, 
-                           std::unordered_set<Instruction*>& liveSet, Function& function);
+                           std::unordered_set<Instruction*>& liveSet, DefUseChain& du);
     };
 
 }  // namespace ME
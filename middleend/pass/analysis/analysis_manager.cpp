@@ -1,36 +1,57 @@
 #include <middleend/pass/analysis/analysis_manager.h>
+#include <middleend/pass/analysis/cfg.h>
+#include <middleend/module/ir_function.h>
 
 namespace ME::Analysis
 {
     Manager& AM = Manager::getInstance();
 
-    Manager::~Manager()
-    {
-        for (auto& funcCachePair : analysisCache)
-        {
-            for (auto& analysisPair : funcCachePair.second)
-            {
-                auto deleterIt = deleterMap.find(analysisPair.first);
-                if (deleterIt != deleterMap.end()) deleterIt->second(analysisPair.second);
-            }
-        }
-    }
-
     Manager& Manager::getInstance()
     {
         static Manager instance;
         return instance;
     }
 
+    std::vector<size_t>& Manager::slotTIDs()
+    {
+        static std::vector<size_t> tids;
+        return tids;
+    }
+
+    size_t Manager::registerAnalysis(size_t tid)
+    {
+        auto& tids = slotTIDs();
+        for (size_t i = 0; i < tids.size(); ++i)
+            if (tids[i] == tid) return i;
+        tids.push_back(tid);
+        return tids.size() - 1;
+    }
+
     void Manager::invalidate(Function& func)
     {
-        auto it = analysisCache.find(&func);
-        if (it == analysisCache.end()) return;
-        for (auto& analysisPair : it->second)
+        func.invalidateDefUse();
+        for (auto& slot : func.getAnalysisSlots()) slot.valid = false;
+    }
+
+    void Manager::invalidate(Function& func, const PreservedAnalyses& pa)
+    {
+        if (pa.areAllPreserved()) return;
+        if (!pa.isPreserved<DefUseChain>()) func.invalidateDefUse();
+
+        // 其余分析均建立在 CFG 之上，CFG 失效时全部丢弃
+        bool  cfgKept = pa.isPreserved<CFG>();
+        auto& slots   = func.getAnalysisSlots();
+        auto& tids    = slotTIDs();
+        for (size_t i = 0; i < slots.size(); ++i)
         {
-            auto deleterIt = deleterMap.find(analysisPair.first);
-            if (deleterIt != deleterMap.end()) deleterIt->second(analysisPair.second);
+            if (cfgKept && pa.isPreserved(tids[i])) continue;
+            slots[i].valid = false;
         }
-        analysisCache.erase(it);
+    }
+
+    void Manager::release(Function& func)
+    {
+        func.invalidateDefUse();
+        func.getAnalysisSlots().clear();
     }
 }  // namespace ME::Analysis
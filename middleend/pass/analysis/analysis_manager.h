@@ -1,10 +1,11 @@
 #ifndef __INTERFACES_MIDDLEEND_ANALYSIS_MANAGER_H__
 #define __INTERFACES_MIDDLEEND_ANALYSIS_MANAGER_H__
 
-#include <functional>
-#include <set>
+#include <interfaces/middleend/pass.h>
+#include <middleend/module/ir_function.h>
+#include <middleend/pass/analysis/analysis_result.h>
+#include <memory>
 #include <type_utils.h>
-#include <unordered_map>
 #include <vector>
 
 /*
@@ -13,16 +14,25 @@
  * 用法速览:
  * - 注册/获取分析: 通过 AM.get<YourAnalysis>(function) 获得并缓存某函数上的分析结果。
  * - 缓存失效: 当函数 IR 发生改变后，调用 AM.invalidate(function) 使相关分析失效。
- * - 分析类需定义静态常量 TID = getTID<AP>()，用于唯一标识。
- *   该标识实际上是 getTID<AP>() 实例化后的函数地址。不同实例的 getTID<AP>()
+ *   Function 持有的 def-use 链也会一并失效。
+ *   FunctionPass 返回 PreservedAnalyses，由 FunctionPass::runOnModule 调用
+ *   AM.invalidate(function, pa)，只丢弃未被保留的分析。
+ * - 分析类继承 Analysis::Result，并定义:
+ *     static inline const size_t TID  = getTID<AP>();                  // 唯一标识，PreservedAnalyses 使用
+ *     static inline const size_t SLOT = Manager::registerAnalysis(TID); // 注册时分配的稠密槽位号
+ *   TID 实际上是 getTID<AP>() 实例化后的函数地址。不同实例的 getTID<AP>()
  *   所在地址不同，因此我们可以将它用作每个类的唯一 ID
- * - 参考已有示例: CFG、DomInfo 的 get<> 特化与调用方式。
+ * - 结果存放在 Function 自身的槽位表中，get 只是一次下标访问；结果由槽位的 unique_ptr 持有，随函数析构。
+ * - 失效只把槽位标记为过期，对象保留，下次 get 时调用 compute 原地重新计算；
+ *   release(function) 则直接释放该函数的全部结果。
+ * - 参考已有示例: CFG、DomInfo 的 compute<> 特化与调用方式。
+ * - 并行优化时各线程处理不同的函数，槽位表属于各自的函数，因此无需加锁；
+ *   同一函数的分析同一时刻只允许一个线程访问。
  */
 
 namespace ME
 {
     class Module;
-    class Function;
     class Block;
 
     namespace Analysis
@@ -30,52 +40,39 @@ namespace ME
         class Manager
         {
           private:
-            // 此处使用 utils/type_utils.h 的 getTID 来为每个分析类生成一个唯一的 ID
-            // 类型为 uintptr_t(函数地址) -> size_t
-            using AnalysisMap = std::unordered_map<size_t, void*>;
-            std::unordered_map<Function*, AnalysisMap> analysisCache;
+            // 槽位号 -> 分析的 TID，仅在静态初始化阶段写入
+            static std::vector<size_t>& slotTIDs();
 
-            using Deleter = void (*)(void*);
-            std::unordered_map<size_t, Deleter> deleterMap;
-
-            Manager() = default;
-            ~Manager();
+            Manager()  = default;
+            ~Manager() = default;
 
           public:
             static Manager& getInstance();
 
-            template <typename Target>
-            Target* get(Function& func);
-
-            void invalidate(Function& func);
+            // 为分析类分配槽位号，由各分析类的 SLOT 静态成员在初始化时调用
+            static size_t registerAnalysis(size_t tid);
 
-          private:
             template <typename Target>
-            void registerDeleter()
+            Target* get(Function& func)
             {
-                size_t tid = Target::TID;
-                if (deleterMap.find(tid) == deleterMap.end())
+                Slot& slot = func.getAnalysisSlot(Target::SLOT);
+                if (!slot.valid)
                 {
-                    deleterMap[tid] = [](void* p) { delete static_cast<Target*>(p); };
+                    if (!slot.result) slot.result = std::make_unique<Target>();
+                    compute<Target>(func, static_cast<Target&>(*slot.result));
+                    slot.valid = true;
                 }
+                return static_cast<Target*>(slot.result.get());
             }
 
-            template <typename Target>
-            void cache(Function& func, Target* analysis)
-            {
-                analysisCache[&func][Target::TID] = analysis;
-            }
+            void invalidate(Function& func);
+            void invalidate(Function& func, const PreservedAnalyses& pa);
+            void release(Function& func);
 
+          private:
+            // 每个分析特化此函数，在 result 上（重新）计算 func 的分析结果
             template <typename Target>
-            Target* getCached(Function& func)
-            {
-                if (analysisCache.count(&func))
-                {
-                    auto& funcCache = analysisCache.at(&func);
-                    if (funcCache.count(Target::TID)) return static_cast<Target*>(funcCache.at(Target::TID));
-                }
-                return nullptr;
-            }
+            void compute(Function& func, Target& result);
         };
 
         extern Manager& AM;
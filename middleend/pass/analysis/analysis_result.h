@@ -0,0 +1,27 @@
+#ifndef __MIDDLEEND_PASS_ANALYSIS_ANALYSIS_RESULT_H__
+#define __MIDDLEEND_PASS_ANALYSIS_ANALYSIS_RESULT_H__
+
+#include <memory>
+#include <vector>
+
+namespace ME::Analysis
+{
+    // 所有由 AM 缓存的分析结果的基类，槽位通过它持有并析构结果
+    class Result
+    {
+      public:
+        virtual ~Result() = default;
+    };
+
+    // 函数上某个分析的缓存槽位；失效后保留对象，下次访问时原地重新计算
+    struct Slot
+    {
+        std::unique_ptr<Result> result;
+        bool                    valid = false;
+    };
+
+    // 每个函数持有一张，以注册时分配的 SLOT 为下标
+    using SlotTable = std::vector<Slot>;
+}  // namespace ME::Analysis
+
+#endif  // __MIDDLEEND_PASS_ANALYSIS_ANALYSIS_RESULT_H__
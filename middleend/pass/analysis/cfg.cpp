@@ -12,21 +12,21 @@ namespace ME::Analysis
 
     void CFG::build(ME::Function& function)
     {
+        // 失效后 AM 会在同一对象上重新 build，先清空上次的结果
         func = &function;
         id2block.clear();
+        G.clear();
+        invG.clear();
+        G_id.clear();
+        invG_id.clear();
 
-        for (auto& [blockId, block] : function.blocks) id2block[blockId] = block;
+        for (auto* block : function.blocks) id2block[block->blockId] = block;
 
         if (id2block.empty()) return;
 
         size_t maxBlockId = 0;
         for (auto& [blockId, block] : id2block) maxBlockId = std::max(maxBlockId, blockId);
 
-        G.clear();
-        invG.clear();
-        G_id.clear();
-        invG_id.clear();
-
         G.resize(maxBlockId + 1);
         invG.resize(maxBlockId + 1);
         G_id.resize(maxBlockId + 1);
@@ -35,14 +35,17 @@ namespace ME::Analysis
         std::map<size_t, bool> visited;
         buildFromBlock(0, visited);
 
-        auto blocks_temp = func->blocks;
-        func->blocks.clear();
-
-        for (auto& [blockId, block] : blocks_temp)
-            if (visited[blockId]) func->blocks[blockId] = block;
+        // 从函数的块表中摘除不可达块，其余块的布局顺序不变
+        for (auto it = func->blocks.begin(); it != func->blocks.end();)
+        {
+            if (visited[it->blockId])
+                ++it;
+            else
+                it = func->blocks.erase(it);
+        }
 
         id2block.clear();
-        for (auto& [blockId, block] : func->blocks) id2block[blockId] = block;
+        for (auto* block : func->blocks) id2block[block->blockId] = block;
 
         for (size_t i = 0; i <= maxBlockId; ++i)
         {
@@ -139,13 +142,8 @@ namespace ME::Analysis
     }
 
     template <>
-    CFG* Manager::get<CFG>(Function& func)
+    void Manager::compute<CFG>(Function& func, CFG& cfg)
     {
-        if (auto* cached = getCached<CFG>(func)) return cached;
-
-        auto* cfg = new CFG();
-        cfg->build(func);
-        cache<CFG>(func, cfg);
-        return cfg;
+        cfg.build(func);
     }
 }  // namespace ME::Analysis
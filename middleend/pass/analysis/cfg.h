@@ -21,10 +21,11 @@ namespace ME
 
 namespace ME::Analysis
 {
-    class CFG
+    class CFG : public Result
     {
       public:
-        static inline const size_t TID = getTID<CFG>();
+        static inline const size_t TID  = getTID<CFG>();
+        static inline const size_t SLOT = Manager::registerAnalysis(TID);
 
         ME::Function*                func;
         std::map<size_t, ME::Block*> id2block;
@@ -37,14 +38,14 @@ namespace ME::Analysis
 
       public:
         CFG();
-        ~CFG() = default;
+        ~CFG() override = default;
 
         void build(ME::Function& function);
         void buildFromBlock(size_t blockId, std::map<size_t, bool>& visited);
     };
 
     template <>
-    CFG* Manager::get<CFG>(Function& func);
+    void Manager::compute<CFG>(Function& func, CFG& cfg);
 }  // namespace ME::Analysis
 
 #endif  // __INTERFACES_MIDDLEEND_ANALYSIS_CFG_H__
@@ -37,15 +37,8 @@ namespace ME::Analysis
     }
 
     template <>
-    DomInfo* Manager::get<DomInfo>(Function& func)
+    void Manager::compute<DomInfo>(Function& func, DomInfo& domInfo)
     {
-        if (auto* cached = getCached<DomInfo>(func)) return cached;
-
-        auto* cfg = get<CFG>(func);
-
-        auto* domInfo = new DomInfo();
-        domInfo->build(*cfg);
-        cache<DomInfo>(func, domInfo);
-        return domInfo;
+        domInfo.build(*get<CFG>(func));
     }
 }  // namespace ME::Analysis
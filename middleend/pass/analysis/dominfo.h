@@ -7,16 +7,17 @@
 
 namespace ME::Analysis
 {
-    class DomInfo
+    class DomInfo : public Result
     {
       public:
-        static inline const size_t TID = getTID<DomInfo>();
+        static inline const size_t TID  = getTID<DomInfo>();
+        static inline const size_t SLOT = Manager::registerAnalysis(TID);
 
         DomAnalyzer* domAnalyzer;
 
       public:
         DomInfo();
-        ~DomInfo();
+        ~DomInfo() override;
 
         void build(CFG& cfg);
 
@@ -26,7 +27,7 @@ namespace ME::Analysis
     };
 
     template <>
-    DomInfo* Manager::get<DomInfo>(Function& func);
+    void Manager::compute<DomInfo>(Function& func, DomInfo& domInfo);
 }  // namespace ME::Analysis
 
 #endif  // __INTERFACES_MIDDLEEND_ANALYSIS_DOMINFO_H__
@@ -0,0 +1,163 @@
+#include <middleend/pass/analysis/loop_info.h>
+#include <middleend/pass/analysis/analysis_manager.h>
+#include <middleend/module/ir_block.h>
+#include <algorithm>
+#include <map>
+#include <utility>
+
+namespace ME::Analysis
+{
+    void LoopInfo::build(CFG& cfg, DomInfo& domInfo)
+    {
+        // 失效后 AM 会在同一对象上重新 build，先清空上次的结果
+        loops.clear();
+        topLevel.clear();
+        size_t n = cfg.G_id.size();
+        innermost.assign(n, nullptr);
+        domIn.assign(n, -1);
+        domOut.assign(n, -1);
+        if (cfg.id2block.empty()) return;
+
+        // 支配树先序编号：a 支配 b 当且仅当 b 的区间落在 a 的区间内
+        const auto&                         domTree = domInfo.getDomTree();
+        std::vector<std::pair<size_t, size_t>> stack = {{0, 0}};
+        int                                 clock = 0;
+        domIn[0]                                  = clock++;
+        while (!stack.empty())
+        {
+            auto& [node, next] = stack.back();
+            if (node < domTree.size() && next < domTree[node].size())
+            {
+                size_t child = (size_t)domTree[node][next++];
+                if (child >= n || domIn[child] >= 0) continue;
+                domIn[child] = clock++;
+                stack.emplace_back(child, 0);
+                continue;
+            }
+            domOut[node] = clock++;
+            stack.pop_back();
+        }
+
+        // 按循环头收集回边，同一循环头的回边属于同一个循环
+        std::map<size_t, std::vector<size_t>> latchesOf;
+        for (auto& [blockId, block] : cfg.id2block)
+        {
+            for (size_t succ : cfg.G_id[blockId])
+            {
+                if (!dominates(succ, blockId)) continue;
+                auto& latches = latchesOf[succ];
+                if (std::find(latches.begin(), latches.end(), blockId) == latches.end()) latches.push_back(blockId);
+            }
+        }
+
+        // 自然循环体：从回边源块沿反向边回溯到循环头
+        std::vector<size_t> mark(n, 0);
+        size_t              stamp = 0;
+        for (auto& [header, latches] : latchesOf)
+        {
+            auto loop       = std::make_unique<Loop>();
+            loop->header    = header;
+            loop->latches   = latches;
+            loop->preheader = Loop::npos;
+
+            ++stamp;
+            mark[header] = stamp;
+            loop->blocks.push_back(header);
+            std::vector<size_t> worklist(latches.begin(), latches.end());
+            while (!worklist.empty())
+            {
+                size_t b = worklist.back();
+                worklist.pop_back();
+                if (mark[b] == stamp) continue;
+                mark[b] = stamp;
+                loop->blocks.push_back(b);
+                for (size_t pred : cfg.invG_id[b])
+                    if (mark[pred] != stamp) worklist.push_back(pred);
+            }
+            std::sort(loop->blocks.begin(), loop->blocks.end());
+            loops.push_back(std::move(loop));
+        }
+
+        // 自然循环要么互不相交、要么相互嵌套，按块数降序处理时外层循环总是先于内层循环
+        std::stable_sort(loops.begin(), loops.end(), [](const auto& a, const auto& b) {
+            return a->blocks.size() > b->blocks.size();
+        });
+        for (auto& loop : loops)
+        {
+            loop->parent = innermost[loop->header];
+            if (loop->parent)
+            {
+                loop->parent->subLoops.push_back(loop.get());
+                loop->depth = loop->parent->depth + 1;
+            }
+            else
+                topLevel.push_back(loop.get());
+            for (size_t b : loop->blocks) innermost[b] = loop.get();
+        }
+
+        for (auto& loop : loops)
+        {
+            for (size_t b : loop->blocks)
+            {
+                bool isExiting = false;
+                for (size_t succ : cfg.G_id[b])
+                {
+                    if (contains(loop.get(), succ)) continue;
+                    isExiting = true;
+                    if (std::find(loop->exits.begin(), loop->exits.end(), succ) == loop->exits.end())
+                        loop->exits.push_back(succ);
+                }
+                if (isExiting) loop->exiting.push_back(b);
+            }
+
+            size_t outside = Loop::npos;
+            int    count   = 0;
+            for (size_t pred : cfg.invG_id[loop->header])
+            {
+                if (contains(loop.get(), pred) || pred == outside) continue;
+                outside = pred;
+                ++count;
+            }
+            if (count == 1 && cfg.G_id[outside].size() == 1) loop->preheader = outside;
+        }
+    }
+
+    std::vector<Loop*> LoopInfo::getLoopsInnermostFirst() const
+    {
+        std::vector<Loop*> order;
+        order.reserve(loops.size());
+        for (auto it = loops.rbegin(); it != loops.rend(); ++it) order.push_back(it->get());
+        return order;
+    }
+
+    int LoopInfo::getLoopDepth(size_t blockId) const
+    {
+        Loop* loop = getLoopFor(blockId);
+        return loop ? loop->depth : 0;
+    }
+
+    bool LoopInfo::contains(const Loop* loop, size_t blockId) const
+    {
+        for (Loop* l = getLoopFor(blockId); l; l = l->parent)
+            if (l == loop) return true;
+        return false;
+    }
+
+    bool LoopInfo::isLoopHeader(size_t blockId) const
+    {
+        Loop* loop = getLoopFor(blockId);
+        return loop && loop->header == blockId;
+    }
+
+    bool LoopInfo::dominates(size_t a, size_t b) const
+    {
+        if (a >= domIn.size() || b >= domIn.size() || domIn[a] < 0 || domIn[b] < 0) return false;
+        return domIn[a] <= domIn[b] && domOut[b] <= domOut[a];
+    }
+
+    template <>
+    void Manager::compute<LoopInfo>(Function& func, LoopInfo& loopInfo)
+    {
+        loopInfo.build(*get<CFG>(func), *get<DomInfo>(func));
+    }
+}  // namespace ME::Analysis
@@ -0,0 +1,76 @@
+#ifndef __INTERFACES_MIDDLEEND_ANALYSIS_LOOP_INFO_H__
+#define __INTERFACES_MIDDLEEND_ANALYSIS_LOOP_INFO_H__
+
+#include <middleend/pass/analysis/analysis_manager.h>
+#include <middleend/pass/analysis/cfg.h>
+#include <middleend/pass/analysis/dominfo.h>
+#include <memory>
+#include <vector>
+
+/*
+ * LoopInfo (自然循环) 分析
+ * - 通过 Analysis::AM.get<LoopInfo>(function) 构建并缓存，建立在 CFG 与 DomInfo 之上。
+ * - 回边 b -> h 要求 h 支配 b；同一循环头的所有回边合并为一个循环，不可归约的环不视为循环。
+ * - 循环之间形成嵌套树：顶层循环的 depth 为 1，不在任何循环中的块深度为 0。
+ * - 与其它分析一样，CFG 失效时一并失效；只改写指令、不改控制流的 pass 可以保留它。
+ */
+
+namespace ME::Analysis
+{
+    class Loop
+    {
+      public:
+        size_t              header;
+        std::vector<size_t> blocks;   // 含循环头与全部子循环的块，按 blockId 升序
+        std::vector<size_t> latches;  // 回边的源块
+        std::vector<size_t> exiting;  // 有后继在循环外的循环内块
+        std::vector<size_t> exits;    // 循环外的后继块，去重
+        // 循环头在循环外的唯一前驱，且该前驱只跳转到循环头；没有时为 npos
+        size_t preheader;
+
+        Loop*              parent = nullptr;
+        std::vector<Loop*> subLoops;
+        int                depth = 1;
+
+        static constexpr size_t npos = static_cast<size_t>(-1);
+
+      public:
+        bool hasPreheader() const { return preheader != npos; }
+    };
+
+    class LoopInfo : public Result
+    {
+      public:
+        static inline const size_t TID  = getTID<LoopInfo>();
+        static inline const size_t SLOT = Manager::registerAnalysis(TID);
+
+      private:
+        std::vector<std::unique_ptr<Loop>> loops;      // 外层循环在前
+        std::vector<Loop*>                 topLevel;   // 不被其它循环包含的循环
+        std::vector<Loop*>                 innermost;  // blockId -> 包含它的最内层循环
+        std::vector<int>                   domIn, domOut;  // 支配树先序区间，用于 O(1) 判断支配关系
+
+      public:
+        LoopInfo()           = default;
+        ~LoopInfo() override = default;
+
+        void build(CFG& cfg, DomInfo& domInfo);
+
+        const std::vector<Loop*>& getTopLevelLoops() const { return topLevel; }
+        // 所有循环，内层循环先于外层循环，便于由内向外处理
+        std::vector<Loop*> getLoopsInnermostFirst() const;
+
+        Loop* getLoopFor(size_t blockId) const { return blockId < innermost.size() ? innermost[blockId] : nullptr; }
+        int   getLoopDepth(size_t blockId) const;
+        bool  contains(const Loop* loop, size_t blockId) const;
+        bool  isLoopHeader(size_t blockId) const;
+        // 支配树上 a 是否支配 b（块自身支配自身）
+        bool  dominates(size_t a, size_t b) const;
+        bool  empty() const { return loops.empty(); }
+    };
+
+    template <>
+    void Manager::compute<LoopInfo>(Function& func, LoopInfo& loopInfo);
+}  // namespace ME::Analysis
+
+#endif  // __INTERFACES_MIDDLEEND_ANALYSIS_LOOP_INFO_H__
@@ -1,17 +1,16 @@
 #include <middleend/pass/basic_mem2reg.h>
 #include <middleend/module/ir_operand.h>
+#include <middleend/pass/analysis/cfg.h>
+#include <middleend/pass/analysis/dominfo.h>
+#include <middleend/pass/analysis/loop_info.h>
+#include <stats.h>
 
 #include <utility>
 #include <algorithm>
 
 namespace ME
 {
-    void BasicMem2RegPass::runOnModule(Module& module)
-    {
-        for (auto* func : module.functions) runOnFunction(*func);
-    }
-
-    void BasicMem2RegPass::runOnFunction(Function& function)
+    PreservedAnalyses BasicMem2RegPass::runOnFunction(Function& function)
     {
         // 收集信息（一次遍历）
         std::unordered_map<RegId, AllocaInfo> infos;
@@ -68,15 +67,20 @@ namespace ME
             }
         }
 
+        if (renameMap.empty() && delSet.empty()) return PreservedAnalyses::all();
+
         // 常数次遍历：应用寄存器替换，删除标记指令
         applySrcRegRename(function, renameMap);
         applyBatchDelete(function, delSet);
+
+        // 只改写操作数、删除块内指令，控制流不变；def-use 链未同步维护
+        return PreservedAnalyses::none().preserve<Analysis::CFG>().preserve<Analysis::DomInfo>().preserve<Analysis::LoopInfo>();
     }
 
     void BasicMem2RegPass::collectFunctionAllocaInfos(Function& function, std::unordered_map<RegId, AllocaInfo>& infos)
     {
         // 一次遍历所有基本块与指令，收集标量 alloca 与其直接 load/store
-        for (auto& [bid, block] : function.blocks)
+        for (auto* block : function.blocks)
         {
             for (auto* inst : block->insts)
             {
@@ -210,9 +214,9 @@ namespace ME
         // 消除链式重命名：将 k->v（若 v 也在映射中）折叠为 k->final
         flattenRegRenameMap(renameMap);
 
-        SrcRegRename renamer;
+        SrcRegRename renamer(function.getOperandFactory());
 
-        for (auto& [bid, block] : function.blocks)
+        for (auto* block : function.blocks)
         {
             for (auto* inst : block->insts) { apply(renamer, *inst, renameMap); }
         }
@@ -221,23 +225,21 @@ namespace ME
     void BasicMem2RegPass::applyBatchDelete(Function& function, const std::unordered_set<Instruction*>& delSet)
     {
         if (delSet.empty()) return;
+        Stats::bump("memory ops removed", delSet.size());
 
-        for (auto& [bid, block] : function.blocks)
+        for (auto* block : function.blocks)
         {
-            std::deque<Instruction*> newInsts;
-            newInsts.resize(0);
-            newInsts.clear();
-
-            for (auto* inst : block->insts)
+            for (auto it = block->insts.begin(); it != block->insts.end();)
             {
-                if (delSet.find(inst) == delSet.end()) { newInsts.push_back(inst); }
-                else
+                Instruction* inst = *it;
+                if (delSet.find(inst) == delSet.end())
                 {
-                    delete inst;
+                    ++it;
+                    continue;
                 }
+                it = block->insts.erase(it);
+                function.destroy(inst);
             }
-
-            block->insts.swap(newInsts);
         }
     }
 
@@ -15,14 +15,14 @@
 namespace ME
 {
     // 简易版 mem2reg：仅处理标量 alloca，且 load/store 直接作用于该 alloca 产生的指针
-    class BasicMem2RegPass : public ModulePass
+    class BasicMem2RegPass : public FunctionPass
     {
       public:
         BasicMem2RegPass()  = default;
         ~BasicMem2RegPass() = default;
 
-        void runOnModule(Module& module) override;
-        void runOnFunction(Function& function) override;
+        const char*       getName() const override { return "basic-mem2reg"; }
+        PreservedAnalyses runOnFunction(Function& function) override;
 
       private:
         struct AllocaInfo
@@ -4,8 +4,12 @@
 #include <middleend/module/ir_block.h>
 #include <middleend/module/ir_instruction.h>
 #include <middleend/module/ir_operand.h>
-#include <middleend/visitor/utils/rename_visitor.h>
+#include <middleend/module/ir_def_use.h>
+#include <middleend/pass/analysis/cfg.h>
+#include <middleend/pass/analysis/dominfo.h>
+#include <middleend/pass/analysis/loop_info.h>
 #include <interfaces/middleend/ir_defs.h>
+#include <stats.h>
 
 #include <unordered_map>
 #include <unordered_set>
@@ -13,22 +17,15 @@
 
 namespace ME
 {
-    void CSEPass::runOnModule(Module& module)
-    {
-        for (auto* func : module.functions)
-        {
-            runOnFunction(*func);
-        }
-    }
-
-    void CSEPass::runOnFunction(Function& function)
+    PreservedAnalyses CSEPass::runOnFunction(Function& function)
     {
         // 记录每个基本块内的表达式
         std::unordered_map<size_t, Instruction*> exprMap;
-        RegMap renameMap;
+        std::vector<std::pair<Operand*, Operand*>> replaceList;  // 冗余结果 -> 保留的结果
         std::unordered_set<Instruction*> toDelete;
+        std::vector<std::pair<Block*, Instruction*>> deleteSites;  // 冗余指令及其所在块
 
-        for (auto& [bid, block] : function.blocks)
+        for (auto* block : function.blocks)
         {
             // 每个基本块独立处理（局部CSE）
             exprMap.clear();
@@ -73,27 +70,17 @@ namespace ME
                     Instruction* prevInst = it->second;
                     if (areInstructionsEquivalent(inst, prevInst))
                     {
-                        // 记录重命名：当前指令的结果 -> 之前指令的结果
-                        Operand* currRes = nullptr;
-                        Operand* prevRes = nullptr;
-
-                        if (inst->opcode >= Operator::ADD && inst->opcode <= Operator::LSHR)
-                        {
-                            currRes = static_cast<ArithmeticInst*>(inst)->res;
-                            prevRes = static_cast<ArithmeticInst*>(prevInst)->res;
-                        }
-                        else if (inst->opcode == Operator::ICMP || inst->opcode == Operator::FCMP)
-                        {
-                            currRes = static_cast<IcmpInst*>(inst)->res;
-                            prevRes = static_cast<IcmpInst*>(prevInst)->res;
-                        }
+                        // 记录替换：当前指令的结果 -> 之前指令的结果
+                        Operand* currRes = inst->getDefOperand();
+                        Operand* prevRes = prevInst->getDefOperand();
 
                         if (currRes && prevRes && 
                             currRes->getType() == OperandType::REG && 
                             prevRes->getType() == OperandType::REG)
                         {
-                            renameMap[currRes->getRegNum()] = prevRes->getRegNum();
+                            replaceList.emplace_back(currRes, prevRes);
                             toDelete.insert(inst);
+                            deleteSites.emplace_back(block, inst);
                         }
                     }
                 }
@@ -105,39 +92,27 @@ namespace ME
             }
         }
 
-        // 应用重命名
-        if (!renameMap.empty())
-        {
-            RegRename renamer;
-            for (auto& [bid, block] : function.blocks)
-            {
-                for (auto* inst : block->insts)
-                {
-                    apply(renamer, *inst, renameMap);
-                }
-            }
-        }
+        if (toDelete.empty()) return PreservedAnalyses::all();
+        Stats::bump("exprs eliminated", toDelete.size());
+
+        // 沿 def-use 链替换冗余结果的所有使用，代价只与使用次数相关
+        auto& du = function.getDefUse();
+        for (auto& [currRes, prevRes] : replaceList) function.replaceAllUsesWith(currRes, prevRes);
+        du.removeInsts(toDelete);
 
-        // 删除冗余指令
-        if (!toDelete.empty())
+        // 删除冗余指令：直接从所在块的链表中摘除，无需重建指令序列
+        for (auto& [block, inst] : deleteSites)
         {
-            for (auto& [bid, block] : function.blocks)
-            {
-                std::deque<Instruction*> newInsts;
-                for (auto* inst : block->insts)
-                {
-                    if (toDelete.find(inst) == toDelete.end())
-                    {
-                        newInsts.push_back(inst);
-                    }
-                    else
-                    {
-                        delete inst;
-                    }
-                }
-                block->insts.swap(newInsts);
-            }
+            block->insts.remove(inst);
+            function.destroy(inst);
         }
+
+        // 只删除块内的纯计算指令，def-use 链已同步维护
+        return PreservedAnalyses::none()
+            .preserve<Analysis::CFG>()
+            .preserve<Analysis::DomInfo>()
+            .preserve<Analysis::LoopInfo>()
+            .preserve<DefUseChain>();
     }
 
     size_t CSEPass::hashInstruction(Instruction* inst) const
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <interfaces/middleend/pass.h>
 #include <cstddef>
 #include <unordered_map>
 
@@ -12,11 +13,11 @@ namespace ME
     
     // Common Subexpression Elimination Pass
     // 公共子表达式消除：识别并消除重复计算
-    class CSEPass
+    class CSEPass : public FunctionPass
     {
       public:
-        void runOnModule(Module& module);
-        void runOnFunction(Function& function);
+        const char*       getName() const override { return "cse"; }
+        PreservedAnalyses runOnFunction(Function& function) override;
 
       private:
         // 计算指令的哈希值（用于识别相同的表达式）
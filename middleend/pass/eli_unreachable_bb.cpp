@@ -5,6 +5,7 @@
 #include <middleend/module/ir_function.h>
 #include <middleend/module/ir_block.h>
 #include <middleend/module/ir_instruction.h>
+#include <stats.h>
 
 #include <unordered_set>
 #include <vector>
@@ -12,22 +13,18 @@
 namespace ME
 {
 
-    void EliminateUnreachableBBPass::runOnModule(Module& module)
+    PreservedAnalyses EliminateUnreachableBBPass::runOnFunction(Function& function)
     {
-        for (auto* func : module.functions)
-        {
-            if (func) runOnFunction(*func);
-        }
-    }
+        // CFG::build 本身也会丢弃不可达块，因此以块数变化判断是否修改了函数
+        size_t blocksBefore = function.blocks.size();
+        bool   pruned       = false;
 
-    void EliminateUnreachableBBPass::runOnFunction(Function& function)
-    {
         // 构建/获取 CFG（该实现已从入口块 0 做到达性分析）
         auto* cfg = Analysis::AM.get<Analysis::CFG>(function);
-        if (!cfg) return;
+        if (!cfg) return PreservedAnalyses::all();
 
         // 若入口块不存在则不处理
-        if (cfg->id2block.find(0) == cfg->id2block.end()) return;
+        if (cfg->id2block.find(0) == cfg->id2block.end()) return PreservedAnalyses::all();
 
         // 用 CFG 的 G_id 做一次 DFS，仅对首次访问到的块执行剪除终止指令之后的死代码
         std::unordered_set<size_t> visited;
@@ -45,7 +42,7 @@ namespace ME
             if (itBlk == cfg->id2block.end() || !itBlk->second) continue;
 
             Block* blk = itBlk->second;
-            pruneAfterTerminator(blk);
+            pruned |= pruneAfterTerminator(function, blk);
 
             if (bid < cfg->G_id.size())
             {
@@ -57,46 +54,44 @@ namespace ME
         }
 
         // 删除不可达基本块（防御性实现；CFG::build 已经基于 visited 过滤过 blocks）
-        std::vector<size_t> toRemove;
-        for (auto& [blockId, block] : function.blocks)
+        std::vector<Block*> toRemove;
+        for (auto* block : function.blocks)
         {
-            if (!visited.count(blockId)) toRemove.push_back(blockId);
+            if (!visited.count(block->blockId)) toRemove.push_back(block);
         }
-        for (size_t blockId : toRemove)
+        for (Block* blk : toRemove)
         {
-            Block* blk = function.blocks[blockId];
-            if (blk)
+            function.blocks.remove(blk);
+            for (auto it = blk->insts.begin(); it != blk->insts.end();)
             {
-                for (auto* inst : blk->insts) delete inst;
-                blk->insts.clear();
-                delete blk;
+                Instruction* inst = *it;
+                it                = blk->insts.erase(it);
+                function.destroy(inst);
             }
-            function.blocks.erase(blockId);
+            function.destroy(blk);
         }
+        Stats::bump("blocks removed", toRemove.size());
 
-        // 控制流/指令已改变，失效当前函数的分析缓存
-        Analysis::AM.invalidate(function);
+        if (!pruned && function.blocks.size() == blocksBefore) return PreservedAnalyses::all();
+        // 控制流/指令已改变，由 pass 管理器失效当前函数的分析缓存
+        return PreservedAnalyses::none();
     }
 
-    void EliminateUnreachableBBPass::pruneAfterTerminator(Block* block)
+    bool EliminateUnreachableBBPass::pruneAfterTerminator(Function& function, Block* block)
     {
-        if (!block) return;
+        if (!block) return false;
 
-        int termIdx = -1;
-        for (int i = 0; i < static_cast<int>(block->insts.size()); ++i)
-        {
-            if (block->insts[i] && block->insts[i]->isTerminator())
-            {
-                termIdx = i;
-                break;
-            }
-        }
+        auto it = block->insts.begin();
+        while (it != block->insts.end() && !it->isTerminator()) ++it;
+        if (it == block->insts.end() || ++it == block->insts.end()) return false;
 
-        if (termIdx >= 0 && termIdx + 1 < static_cast<int>(block->insts.size()))
+        while (it != block->insts.end())
         {
-            for (int i = termIdx + 1; i < static_cast<int>(block->insts.size()); ++i) { delete block->insts[i]; }
-            block->insts.erase(block->insts.begin() + termIdx + 1, block->insts.end());
+            Instruction* inst = *it;
+            it                = block->insts.erase(it);
+            function.destroy(inst);
         }
+        return true;
     }
 
 }  // namespace ME
\ No newline at end of file
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <interfaces/middleend/pass.h>
 #include <vector>
 #include <unordered_set>
 
@@ -11,15 +12,15 @@ namespace ME
     class Block;
     class Instruction;
 
-    class EliminateUnreachableBBPass
+    class EliminateUnreachableBBPass : public FunctionPass
     {
       public:
-        void runOnModule(Module& module);
-        void runOnFunction(Function& function);
+        const char*       getName() const override { return "eli-unreachable-bb"; }
+        PreservedAnalyses runOnFunction(Function& function) override;
 
       private:
-        // 删除块内第一个终止指令之后的所有指令（若存在）
-        void pruneAfterTerminator(Block* block);
+        // 删除块内第一个终止指令之后的所有指令（若存在），返回是否删除了指令
+        bool pruneAfterTerminator(Function& function, Block* block);
 
         // // 判断是否为终止指令（ret / branch）
         // bool isTerminator(Instruction* inst) const;
@@ -0,0 +1,301 @@
+#include <middleend/pass/gvn.h>
+#include <middleend/pass/analysis/analysis_manager.h>
+#include <middleend/pass/analysis/cfg.h>
+#include <middleend/pass/analysis/dominfo.h>
+#include <middleend/pass/analysis/loop_info.h>
+#include <middleend/module/ir_module.h>
+#include <middleend/module/ir_function.h>
+#include <middleend/module/ir_block.h>
+#include <middleend/module/ir_instruction.h>
+#include <middleend/module/ir_operand.h>
+#include <middleend/module/ir_def_use.h>
+#include <stats.h>
+#include <functional>
+#include <unordered_set>
+
+namespace ME
+{
+    namespace
+    {
+        ICmpOp swapped(ICmpOp cond)
+        {
+            switch (cond)
+            {
+                case ICmpOp::UGT: return ICmpOp::ULT;
+                case ICmpOp::UGE: return ICmpOp::ULE;
+                case ICmpOp::ULT: return ICmpOp::UGT;
+                case ICmpOp::ULE: return ICmpOp::UGE;
+                case ICmpOp::SGT: return ICmpOp::SLT;
+                case ICmpOp::SGE: return ICmpOp::SLE;
+                case ICmpOp::SLT: return ICmpOp::SGT;
+                case ICmpOp::SLE: return ICmpOp::SGE;
+                default: return cond;  // eq、ne 对称
+            }
+        }
+
+        FCmpOp swapped(FCmpOp cond)
+        {
+            switch (cond)
+            {
+                case FCmpOp::OGT: return FCmpOp::OLT;
+                case FCmpOp::OGE: return FCmpOp::OLE;
+                case FCmpOp::OLT: return FCmpOp::OGT;
+                case FCmpOp::OLE: return FCmpOp::OGE;
+                case FCmpOp::UGT: return FCmpOp::ULT;
+                case FCmpOp::UGE: return FCmpOp::ULE;
+                case FCmpOp::ULT: return FCmpOp::UGT;
+                case FCmpOp::ULE: return FCmpOp::UGE;
+                default: return cond;  // 相等、不等与有序性判断对称
+            }
+        }
+
+        bool isCommutative(Operator op)
+        {
+            switch (op)
+            {
+                case Operator::ADD:
+                case Operator::MUL:
+                case Operator::FADD:
+                case Operator::FMUL:
+                case Operator::BITXOR:
+                case Operator::BITAND: return true;
+                default: return false;
+            }
+        }
+
+        // 指针是否沿 GEP 指向本函数 alloca 出的局部数组
+        bool isLocalAddress(Operand* ptr, DefUseChain& du)
+        {
+            while (ptr && ptr->getType() == OperandType::REG)
+            {
+                Instruction* def = du.getDef(ptr->getRegNum());
+                if (!def) return false;  // 指针形参
+                if (def->opcode == Operator::ALLOCA) return true;
+                if (def->opcode != Operator::GETELEMENTPTR) return false;
+                ptr = static_cast<GEPInst*>(def)->basePtr;
+            }
+            return false;
+        }
+    }  // namespace
+
+    size_t GVNPass::ExprKeyHash::operator()(const ExprKey& key) const
+    {
+        size_t h = key.words.size();
+        for (uintptr_t w : key.words) h ^= std::hash<uintptr_t>{}(w) + 0x9e3779b97f4a7c15ULL + (h << 6) + (h >> 2);
+        return h;
+    }
+
+    void GVNPass::prepareModule(Module& module)
+    {
+        // 先假设本模块中只访问局部数组的函数都是纯的，再反复剔除调用了非纯函数的，支持（互）递归
+        std::unordered_map<std::string_view, std::vector<std::string_view>> callees;
+        for (auto* function : module.functions) pureFunctions.erase(function->funcDef->funcName);
+
+        std::vector<Function*> candidates;
+        for (auto* function : module.functions)
+        {
+            auto& du    = function->getDefUse();
+            bool  clean = true;
+            auto& calls = callees[function->funcDef->funcName];
+            for (auto* block : function->blocks)
+            {
+                for (auto* inst : block->insts)
+                {
+                    if (inst->opcode == Operator::LOAD)
+                        clean &= isLocalAddress(static_cast<LoadInst*>(inst)->ptr, du);
+                    else if (inst->opcode == Operator::STORE)
+                        clean &= isLocalAddress(static_cast<StoreInst*>(inst)->ptr, du);
+                    else if (inst->opcode == Operator::CALL)
+                    {
+                        // 局部数组初始化时生成的 memset 只写本函数的栈空间
+                        auto* call = static_cast<CallInst*>(inst);
+                        if (std::string_view(call->funcName).substr(0, 11) == "llvm.memset" && !call->args.empty() &&
+                            isLocalAddress(call->args[0].second, du))
+                            continue;
+                        calls.push_back(call->funcName);
+                    }
+                }
+                if (!clean) break;
+            }
+            if (clean) candidates.push_back(function);
+        }
+
+        std::unordered_set<std::string_view> pure;
+        for (auto* function : candidates) pure.insert(function->funcDef->funcName);
+        auto isPure = [&](std::string_view name) {
+            return pure.count(name) || pureFunctions.count(name);
+        };
+        for (bool changed = true; changed;)
+        {
+            changed = false;
+            for (auto* function : candidates)
+            {
+                std::string_view name = function->funcDef->funcName;
+                if (!pure.count(name)) continue;
+                for (auto callee : callees[name])
+                {
+                    if (isPure(callee)) continue;
+                    pure.erase(name);
+                    changed = true;
+                    break;
+                }
+            }
+        }
+        for (auto name : pure) pureFunctions.emplace(name);
+    }
+
+    bool GVNPass::makeKey(Instruction* inst, const Leaders& leaders, ExprKey& key) const
+    {
+        auto leader = [&](Operand* op) {
+            auto it = leaders.find(op);
+            return (uintptr_t)(it == leaders.end() ? op : it->second);
+        };
+        auto& w = key.words;
+        w.clear();
+        w.push_back((uintptr_t)inst->opcode);
+
+        switch (inst->opcode)
+        {
+            case Operator::ADD:
+            case Operator::SUB:
+            case Operator::MUL:
+            case Operator::DIV:
+            case Operator::MOD:
+            case Operator::FADD:
+            case Operator::FSUB:
+            case Operator::FMUL:
+            case Operator::FDIV:
+            case Operator::BITXOR:
+            case Operator::BITAND:
+            case Operator::SHL:
+            case Operator::ASHR:
+            case Operator::LSHR: {
+                auto*     ai  = static_cast<ArithmeticInst*>(inst);
+                uintptr_t lhs = leader(ai->lhs), rhs = leader(ai->rhs);
+                if (isCommutative(inst->opcode) && rhs < lhs) std::swap(lhs, rhs);
+                w.insert(w.end(), {(uintptr_t)ai->dt, lhs, rhs});
+                return true;
+            }
+            case Operator::ICMP: {
+                auto*     ci   = static_cast<IcmpInst*>(inst);
+                uintptr_t lhs  = leader(ci->lhs), rhs = leader(ci->rhs);
+                ICmpOp    cond = ci->cond;
+                if (rhs < lhs) std::swap(lhs, rhs), cond = swapped(cond);
+                w.insert(w.end(), {(uintptr_t)ci->dt, (uintptr_t)cond, lhs, rhs});
+                return true;
+            }
+            case Operator::FCMP: {
+                auto*     ci   = static_cast<FcmpInst*>(inst);
+                uintptr_t lhs  = leader(ci->lhs), rhs = leader(ci->rhs);
+                FCmpOp    cond = ci->cond;
+                if (rhs < lhs) std::swap(lhs, rhs), cond = swapped(cond);
+                w.insert(w.end(), {(uintptr_t)ci->dt, (uintptr_t)cond, lhs, rhs});
+                return true;
+            }
+            case Operator::GETELEMENTPTR: {
+                auto* gep = static_cast<GEPInst*>(inst);
+                w.insert(w.end(), {(uintptr_t)gep->dt, (uintptr_t)gep->idxType, leader(gep->basePtr), gep->dims.size()});
+                for (int d : gep->dims) w.push_back((uintptr_t)d);
+                for (auto* idx : gep->idxs) w.push_back(leader(idx));
+                return true;
+            }
+            case Operator::ZEXT: {
+                auto* zi = static_cast<ZextInst*>(inst);
+                w.insert(w.end(), {(uintptr_t)zi->from, (uintptr_t)zi->to, leader(zi->src)});
+                return true;
+            }
+            case Operator::SITOFP: w.push_back(leader(static_cast<SI2FPInst*>(inst)->src)); return true;
+            case Operator::FPTOSI: w.push_back(leader(static_cast<FP2SIInst*>(inst)->src)); return true;
+            case Operator::CALL: {
+                auto* call = static_cast<CallInst*>(inst);
+                if (!call->res) return false;
+                // 以集合中名字的地址标识被调函数；集合只在 prepareModule 中修改，处理函数期间地址稳定
+                auto it = pureFunctions.find(std::string_view(call->funcName));
+                if (it == pureFunctions.end()) return false;
+                w.insert(w.end(), {(uintptr_t)call->retType, (uintptr_t)&*it});
+                for (auto& [type, arg] : call->args) w.insert(w.end(), {(uintptr_t)type, leader(arg)});
+                return true;
+            }
+            default: return false;
+        }
+    }
+
+    PreservedAnalyses GVNPass::runOnFunction(Function& function)
+    {
+        auto* cfg = Analysis::AM.get<Analysis::CFG>(function);
+        auto* dom = Analysis::AM.get<Analysis::DomInfo>(function);
+
+        std::unordered_map<ExprKey, Operand*, ExprKeyHash> table;
+        std::vector<const ExprKey*>                        scopeUndo;  // 按插入顺序记录，离开子树时撤销
+        Leaders                                            leaders;
+        std::vector<std::pair<Operand*, Operand*>>         replaceList;
+        std::unordered_set<Instruction*>                   toDelete;
+        std::vector<std::pair<Block*, Instruction*>>       deleteSites;
+        size_t                                             callsEliminated = 0;
+
+        // 迭代地先序遍历支配树：进入块时记录表中已有的条目数，访问完整棵子树后撤销块内新增的条目
+        const auto&                            domTree = dom->getDomTree();
+        std::vector<std::pair<size_t, size_t>> stack;  // (块号, 下一个待访问的孩子)
+        std::vector<size_t>                    scopeMark;
+        stack.emplace_back(0, 0);
+        ExprKey key;
+        while (!stack.empty())
+        {
+            auto& [b, next] = stack.back();
+            if (next == 0)
+            {
+                scopeMark.push_back(scopeUndo.size());
+                Block* block = cfg->id2block[b];
+                for (auto* inst : block->insts)
+                {
+                    if (!makeKey(inst, leaders, key)) continue;
+                    Operand* res = inst->getDefOperand();
+                    if (!res || res->getType() != OperandType::REG) continue;
+
+                    auto [it, inserted] = table.try_emplace(key, res);
+                    if (inserted)
+                    {
+                        scopeUndo.push_back(&it->first);
+                        continue;
+                    }
+                    leaders[res] = it->second;
+                    replaceList.emplace_back(res, it->second);
+                    toDelete.insert(inst);
+                    deleteSites.emplace_back(block, inst);
+                    if (inst->opcode == Operator::CALL) ++callsEliminated;
+                }
+            }
+            if (b < domTree.size() && next < domTree[b].size())
+            {
+                size_t child = domTree[b][next++];
+                stack.emplace_back(child, 0);
+                continue;
+            }
+            for (size_t mark = scopeMark.back(); scopeUndo.size() > mark; scopeUndo.pop_back())
+                table.erase(*scopeUndo.back());
+            scopeMark.pop_back();
+            stack.pop_back();
+        }
+
+        if (toDelete.empty()) return PreservedAnalyses::all();
+        Stats::bump("exprs eliminated", toDelete.size() - callsEliminated);
+        if (callsEliminated) Stats::bump("calls eliminated", callsEliminated);
+
+        // 表中只存首个计算的结果，替换目标不会再被消除
+        auto& du = function.getDefUse();
+        for (auto& [res, leader] : replaceList) function.replaceAllUsesWith(res, leader);
+        du.removeInsts(toDelete);
+        for (auto& [block, inst] : deleteSites)
+        {
+            block->insts.remove(inst);
+            function.destroy(inst);
+        }
+
+        // 只删除纯计算与纯函数调用，不改变控制流，def-use 链已同步维护
+        return PreservedAnalyses::none()
+            .preserve<Analysis::CFG>()
+            .preserve<Analysis::DomInfo>()
+            .preserve<Analysis::LoopInfo>()
+            .preserve<DefUseChain>();
+    }
+}  // namespace ME
@@ -0,0 +1,53 @@
+#ifndef __MIDDLEEND_PASS_GVN_H__
+#define __MIDDLEEND_PASS_GVN_H__
+
+#include <interfaces/middleend/pass.h>
+#include <cstdint>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace ME
+{
+    class Instruction;
+    class Operand;
+
+    // Global Value Numbering
+    // 沿支配树先序遍历，以作用域哈希表记录支配当前块的表达式：同一表达式被支配它的等价表达式算过时，
+    // 用先前的结果替换并删除它。操作数已在模块内驻留，相同的值就是同一个 Operand*，表达式可直接按指针比较。
+    class GVNPass : public FunctionPass
+    {
+      public:
+        GVNPass()  = default;
+        ~GVNPass() = default;
+
+        const char*       getName() const override { return "gvn"; }
+        PreservedAnalyses runOnFunction(Function& function) override;
+
+      protected:
+        // 找出不读写内存、也不做输入输出的函数，对它们的调用可以参与编号
+        void prepareModule(Module& module) override;
+
+      private:
+        // 表达式的规范形式：操作码、类型等属性与（已替换为首个等价值的）操作数依次编码
+        struct ExprKey
+        {
+            std::vector<uintptr_t> words;
+            bool                   operator==(const ExprKey& other) const { return words == other.words; }
+        };
+        struct ExprKeyHash
+        {
+            size_t operator()(const ExprKey& key) const;
+        };
+        using Leaders = std::unordered_map<Operand*, Operand*>;  // 被消除的结果 -> 替换它的值
+
+        // 按函数名记录；流式编译时每次只看到一个函数，已处理过的函数的结论保留下来供之后的调用者使用
+        std::set<std::string, std::less<>> pureFunctions;
+
+        // 为可编号的指令构造 key，不可编号（有副作用、读内存或不定义寄存器）时返回 false
+        bool makeKey(Instruction* inst, const Leaders& leaders, ExprKey& key) const;
+    };
+}  // namespace ME
+
+#endif  // __MIDDLEEND_PASS_GVN_H__
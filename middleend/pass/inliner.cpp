@@ -0,0 +1,343 @@
+#include <middleend/pass/inliner.h>
+#include <middleend/pass/analysis/analysis_manager.h>
+#include <middleend/pass/analysis/cfg.h>
+#include <middleend/pass/analysis/loop_info.h>
+#include <middleend/module/ir_module.h>
+#include <middleend/module/ir_function.h>
+#include <middleend/module/ir_block.h>
+#include <middleend/module/ir_instruction.h>
+#include <middleend/module/ir_operand.h>
+#include <middleend/visitor/utils/clone_visitor.h>
+#include <stats.h>
+#include <algorithm>
+#include <functional>
+#include <unordered_set>
+
+namespace ME
+{
+    namespace
+    {
+        bool isClonable(Operator op)
+        {
+            switch (op)
+            {
+                case Operator::LOAD: case Operator::STORE:
+                case Operator::ADD: case Operator::SUB: case Operator::MUL: case Operator::DIV:
+                case Operator::MOD: case Operator::BITXOR: case Operator::BITAND:
+                case Operator::SHL: case Operator::ASHR: case Operator::LSHR:
+                case Operator::FADD: case Operator::FSUB: case Operator::FMUL: case Operator::FDIV:
+                case Operator::ICMP: case Operator::FCMP: case Operator::ALLOCA:
+                case Operator::BR_COND: case Operator::BR_UNCOND: case Operator::RET:
+                case Operator::CALL: case Operator::GETELEMENTPTR:
+                case Operator::SITOFP: case Operator::FPTOSI: case Operator::ZEXT: case Operator::PHI: return true;
+                default: return false;
+            }
+        }
+
+        // 块中的第一条终结指令，与 CFG 的取法一致
+        Instruction* terminatorOf(Block* block)
+        {
+            for (auto* inst : block->insts)
+                if (inst->isTerminator()) return inst;
+            return nullptr;
+        }
+    }  // namespace
+
+    bool InlinePass::runOnModule(Module& module)
+    {
+        std::unordered_map<std::string_view, Function*> functions;
+        for (auto* function : module.functions) functions[function->funcDef->funcName] = function;
+
+        auto                                  sccs = bottomUpSCCs(module, functions);
+        std::unordered_map<Function*, size_t> sccOf;
+        for (size_t i = 0; i < sccs.size(); ++i)
+            for (auto* function : sccs[i]) sccOf[function] = i;
+
+        // 被调函数所在的分量先处理完，之后不再改变，其信息算一次即可
+        std::unordered_map<Function*, CalleeInfo> infos;
+        size_t                                    inlined = 0;
+
+        struct Site
+        {
+            CallInst* call;
+            Block*    block;
+            Function* callee;
+            size_t    depth;  // 调用点所在循环的深度
+        };
+
+        for (auto& scc : sccs)
+        {
+            for (Function* caller : scc)
+            {
+                auto*             loops      = Analysis::AM.get<Analysis::LoopInfo>(*caller);
+                size_t            callerSize = 0;
+                std::vector<Site> sites;
+                for (auto* block : caller->blocks)
+                {
+                    for (auto* inst : block->insts)
+                    {
+                        if (inst->opcode != Operator::ALLOCA) ++callerSize;
+                        if (inst->opcode != Operator::CALL) continue;
+                        auto* call = static_cast<CallInst*>(inst);
+                        auto  it   = functions.find(std::string_view(call->funcName));
+                        // 同一分量内的调用（递归）不内联：被内联的副本中对递归函数的调用不会再被展开，递归只展开一层
+                        if (it == functions.end() || sccOf[it->second] == sccOf[caller]) continue;
+                        sites.push_back({call, block, it->second, (size_t)std::max(0, loops->getLoopDepth(block->blockId))});
+                    }
+                }
+
+                ValueMap results;
+                size_t   inlinedHere      = 0;
+                size_t   addedAllocaBytes = 0;  // 内联带入调用者入口块的 alloca 字节数
+                for (size_t i = 0; i < sites.size(); ++i)
+                {
+                    Site& site = sites[i];
+                    auto  it   = infos.find(site.callee);
+                    if (it == infos.end()) it = infos.emplace(site.callee, analyzeCallee(*site.callee)).first;
+                    const CalleeInfo& info = it->second;
+                    if (!info.inlinable || info.allocaBytes > kMaxAllocaBytes) continue;
+
+                    size_t constArgs = 0;
+                    for (auto& [type, arg] : site.call->args)
+                        if (arg->getType() == OperandType::IMMEI32 || arg->getType() == OperandType::IMMEF32)
+                            ++constArgs;
+                    size_t threshold = kBaseThreshold + kConstArgBonus * constArgs +
+                                       kLoopDepthBonus * std::min(site.depth, kMaxLoopDepthBonus);
+                    if (info.size > threshold || callerSize + info.size > kMaxCallerSize) continue;
+                    if (addedAllocaBytes + info.allocaBytes > kMaxCallerAllocaBytes) continue;
+
+                    // 同一块中其后的调用点随 call 之后的指令一起移到了新的后继块
+                    Block* cont = inlineCall(*caller, site.block, site.call, *site.callee, results);
+                    for (size_t j = i + 1; j < sites.size(); ++j)
+                        if (sites[j].block == site.block) sites[j].block = cont;
+                    callerSize += info.size;
+                    addedAllocaBytes += info.allocaBytes;
+                    ++inlinedHere;
+                }
+                if (!inlinedHere) continue;
+
+                // 调用结果改为被调函数的返回值；实参可能是先前被内联的调用的结果，沿替换链找到最终的值
+                auto resolve = [&](Operand* op) {
+                    for (auto it = results.find(op); it != results.end(); it = results.find(op)) op = it->second;
+                    return op;
+                };
+                std::vector<Operand**> slots;
+                for (auto* block : caller->blocks)
+                {
+                    for (auto* inst : block->insts)
+                    {
+                        slots.clear();
+                        inst->getUseSlots(slots);
+                        for (auto* slot : slots)
+                            if (*slot) *slot = resolve(*slot);
+                    }
+                }
+                Analysis::AM.invalidate(*caller);
+                inlined += inlinedHere;
+            }
+        }
+
+        if (inlined) Stats::bump("calls inlined", inlined);
+        return inlined > 0;
+    }
+
+    std::vector<std::vector<Function*>> InlinePass::bottomUpSCCs(
+        Module& module, const std::unordered_map<std::string_view, Function*>& functions)
+    {
+        std::unordered_map<Function*, std::vector<Function*>> callees;
+        for (auto* function : module.functions)
+        {
+            auto& out = callees[function];
+            for (auto* block : function->blocks)
+                for (auto* inst : block->insts)
+                    if (inst->opcode == Operator::CALL)
+                    {
+                        auto it = functions.find(std::string_view(static_cast<CallInst*>(inst)->funcName));
+                        if (it != functions.end()) out.push_back(it->second);
+                    }
+        }
+
+        // Tarjan：分量在其可达的分量全部弹出之后才弹出，弹出顺序即自底向上的顺序
+        std::vector<std::vector<Function*>>   sccs;
+        std::unordered_map<Function*, size_t> index, low;
+        std::unordered_set<Function*>         onStack;
+        std::vector<Function*>                stack;
+        size_t                                counter = 0;
+
+        std::function<void(Function*)> connect = [&](Function* f) {
+            index[f] = low[f] = counter++;
+            stack.push_back(f);
+            onStack.insert(f);
+            for (Function* g : callees[f])
+            {
+                if (!index.count(g))
+                {
+                    connect(g);
+                    low[f] = std::min(low[f], low[g]);
+                }
+                else if (onStack.count(g))
+                    low[f] = std::min(low[f], index[g]);
+            }
+            if (low[f] != index[f]) return;
+            sccs.emplace_back();
+            Function* g = nullptr;
+            do {
+                g = stack.back();
+                stack.pop_back();
+                onStack.erase(g);
+                sccs.back().push_back(g);
+            } while (g != f);
+        };
+        for (auto* function : module.functions)
+            if (!index.count(function)) connect(function);
+        return sccs;
+    }
+
+    InlinePass::CalleeInfo InlinePass::analyzeCallee(Function& callee)
+    {
+        CalleeInfo info;
+        auto*      cfg = Analysis::AM.get<Analysis::CFG>(callee);
+        // 入口块有前驱时（循环回到块 0），跳入副本的新边需要补 phi，这种函数不内联
+        if (callee.blocks.empty() || callee.blocks.front()->blockId != 0) return info;
+        if (!cfg->invG_id.empty() && !cfg->invG_id[0].empty()) return info;
+
+        for (auto* block : callee.blocks)
+        {
+            for (auto* inst : block->insts)
+            {
+                if (!isClonable(inst->opcode)) return info;
+                if (inst->opcode != Operator::ALLOCA)
+                {
+                    ++info.size;
+                    continue;
+                }
+                size_t bytes = 4;
+                for (int d : static_cast<AllocaInst*>(inst)->dims) bytes *= (size_t)d;
+                info.allocaBytes += bytes;
+            }
+        }
+        info.inlinable = true;
+        return info;
+    }
+
+    Block* InlinePass::inlineCall(Function& caller, Block* block, CallInst* call, Function& callee, ValueMap& results)
+    {
+        auto&  ops   = caller.getOperandFactory();
+        Block* entry = caller.blocks.front();
+
+        // call 之后的指令（含终结指令）移到新块 cont，原后继 phi 中来自 block 的 incoming 改为来自 cont
+        Block* cont = caller.createBlock();
+        cont->setComment("inline.cont");
+        caller.blocks.remove(cont);
+        caller.blocks.insertAfter(block, cont);
+        for (auto it = ++block->insts.iteratorTo(call); it != block->insts.end();)
+        {
+            Instruction* inst = *it;
+            it                = block->insts.erase(it);
+            cont->insertBack(inst);
+        }
+        Operand* blockLabel = ops.getLabelOperand(block->blockId);
+        Operand* contLabel  = ops.getLabelOperand(cont->blockId);
+        std::vector<Operand*> succs;
+        if (Instruction* term = terminatorOf(cont))
+        {
+            if (auto* br = dynamic_cast<BrCondInst*>(term))
+                succs = {br->trueTar, br->falseTar};
+            else if (auto* br = dynamic_cast<BrUncondInst*>(term))
+                succs = {br->target};
+        }
+        for (Operand* succ : succs)
+        {
+            Block* target = caller.getBlock(static_cast<LabelOperand*>(succ)->lnum);
+            if (!target) continue;
+            for (auto* inst : target->insts)
+            {
+                if (inst->opcode != Operator::PHI) break;
+                auto* phi = static_cast<PhiInst*>(inst);
+                auto  in  = phi->incomingVals.find(blockLabel);
+                if (in == phi->incomingVals.end()) continue;
+                Operand* val = in->second;
+                phi->incomingVals.erase(in);
+                phi->addIncoming(val, contLabel);
+            }
+        }
+
+        // 形参映射为实参，被调函数定义的寄存器与块都换成调用者中新分配的编号
+        ValueMap                           vmap;
+        std::unordered_map<size_t, Block*> bmap;
+        auto&                              params = callee.funcDef->argRegs;
+        for (size_t i = 0; i < params.size() && i < call->args.size(); ++i) vmap[params[i].second] = call->args[i].second;
+
+        Block* insertPos = block;
+        for (auto* calleeBlock : callee.blocks)
+        {
+            Block* clone = caller.createBlock();
+            clone->setComment(caller.copyString(calleeBlock->comment));
+            caller.blocks.remove(clone);
+            caller.blocks.insertAfter(insertPos, clone);
+            insertPos                    = clone;
+            bmap[calleeBlock->blockId] = clone;
+            for (auto* inst : calleeBlock->insts)
+                if (Operand* def = inst->getDefOperand(); def && def->getType() == OperandType::REG)
+                    vmap[def] = ops.getRegOperand(caller.getNewRegId());
+        }
+        OperandMapFn map = [&](Operand* op) -> Operand* {
+            if (!op) return nullptr;
+            if (op->getType() == OperandType::LABEL)
+            {
+                auto it = bmap.find(static_cast<LabelOperand*>(op)->lnum);
+                return it == bmap.end() ? nullptr : ops.getLabelOperand(it->second->blockId);
+            }
+            auto it = vmap.find(op);
+            return it == vmap.end() ? op : it->second;
+        };
+
+        // 复制函数体：alloca 提到调用者的入口块，ret 改为跳到 cont 并记下返回值
+        std::vector<std::pair<Block*, Operand*>> returns;  // (返回所在的副本块, 返回值)
+        InstClone                                cloner(caller);
+        for (auto* calleeBlock : callee.blocks)
+        {
+            Block* clone = bmap[calleeBlock->blockId];
+            for (auto* inst : calleeBlock->insts)
+            {
+                if (inst->opcode == Operator::RET)
+                {
+                    returns.emplace_back(clone, map(static_cast<RetInst*>(inst)->res));
+                    clone->insertBack(caller.create<BrUncondInst>(contLabel));
+                    break;
+                }
+                Instruction* copy = apply(cloner, *inst, map);
+                if (inst->opcode == Operator::ALLOCA)
+                {
+                    entry->insertFront(copy);
+                    continue;
+                }
+                clone->insertBack(copy);
+                if (copy->isTerminator()) break;
+            }
+        }
+
+        block->insts.remove(call);
+        block->insertBack(caller.create<BrUncondInst>(ops.getLabelOperand(bmap[callee.blocks.front()->blockId]->blockId)));
+
+        // 多处返回时在 cont 中以 phi 合并返回值；从不返回时调用结果不可达，取 0 即可
+        if (call->res && call->retType != DataType::VOID)
+        {
+            Operand* value = nullptr;
+            if (returns.size() == 1) value = returns[0].second;
+            if (returns.size() > 1)
+            {
+                value    = ops.getRegOperand(caller.getNewRegId());
+                auto* phi = caller.create<PhiInst>(call->retType, value);
+                for (auto& [ret, val] : returns) phi->addIncoming(val, ops.getLabelOperand(ret->blockId));
+                cont->insertFront(phi);
+            }
+            if (!value)
+                value = call->retType == DataType::F32 ? static_cast<Operand*>(ops.getImmeF32Operand(0.0f))
+                                                       : static_cast<Operand*>(ops.getImmeI32Operand(0));
+            results[call->res] = value;
+        }
+        caller.destroy(call);
+        return cont;
+    }
+}  // namespace ME
@@ -0,0 +1,61 @@
+#ifndef __MIDDLEEND_PASS_INLINER_H__
+#define __MIDDLEEND_PASS_INLINER_H__
+
+#include <interfaces/middleend/pass.h>
+#include <cstddef>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace ME
+{
+    class Block;
+    class CallInst;
+    class Operand;
+
+    // Function Inlining
+    // 按调用图自底向上（先被调函数、后调用者）处理各函数，把代价模型认为划算的调用点替换为被调函数体的副本。
+    // 需要同时读写多个函数，因此是 ModulePass，流式编译时不运行
+    class InlinePass : public ModulePass
+    {
+      public:
+        // 代价模型：被调函数的指令数不超过阈值时内联，阈值随常量实参个数与调用点所在循环的深度提高
+        static constexpr size_t kBaseThreshold     = 40;
+        static constexpr size_t kConstArgBonus     = 10;
+        static constexpr size_t kLoopDepthBonus    = 25;
+        static constexpr size_t kMaxLoopDepthBonus = 3;    // 最多按 3 层循环加成
+        static constexpr size_t kMaxCallerSize     = 4000; // 调用者超过该指令数后不再向其中内联
+        static constexpr size_t kMaxAllocaBytes    = 4096; // 局部数组过大的函数不内联，以免调用者的栈帧膨胀
+        // 每个调用点都会把被调函数的 alloca 复制一份到调用者入口块，各调用点之间不复用，
+        // 因此按调用者累计内联带入的栈空间，超过上限后不再内联含局部数组的函数
+        static constexpr size_t kMaxCallerAllocaBytes = 16384;
+
+        InlinePass()  = default;
+        ~InlinePass() = default;
+
+        const char* getName() const override { return "inline"; }
+        bool        runOnModule(Module& module) override;
+        // 单个函数上没有可内联的调用上下文
+        PreservedAnalyses runOnFunction(Function& function) override { return PreservedAnalyses::all(); }
+
+      private:
+        struct CalleeInfo
+        {
+            size_t size        = 0;      // 除 alloca 外的指令数
+            size_t allocaBytes = 0;      // 局部数组占用的栈空间
+            bool   inlinable   = false;  // 有函数体且入口块没有前驱
+        };
+        using ValueMap = std::unordered_map<Operand*, Operand*>;
+
+        // 按 Tarjan 算法求调用图的强连通分量，返回值按逆拓扑序排列（被调函数所在分量在前）
+        static std::vector<std::vector<Function*>> bottomUpSCCs(
+            Module& module, const std::unordered_map<std::string_view, Function*>& functions);
+        static CalleeInfo analyzeCallee(Function& callee);
+
+        // 把 block 中的 call 替换为 callee 函数体的副本；call 之后的指令移到新的后继块，返回该块。
+        // 调用结果的替换值记入 results，由调用者处理完所有调用点后统一改写
+        static Block* inlineCall(Function& caller, Block* block, CallInst* call, Function& callee, ValueMap& results);
+    };
+}  // namespace ME
+
+#endif  // __MIDDLEEND_PASS_INLINER_H__
@@ -0,0 +1,434 @@
+#include <middleend/pass/iv_strength_reduce.h>
+#include <middleend/pass/analysis/analysis_manager.h>
+#include <middleend/pass/analysis/dominfo.h>
+#include <middleend/module/ir_block.h>
+#include <middleend/module/ir_operand.h>
+#include <middleend/module/ir_def_use.h>
+#include <stats.h>
+#include <algorithm>
+#include <climits>
+#include <functional>
+#include <map>
+#include <optional>
+#include <tuple>
+#include <unordered_set>
+
+namespace ME
+{
+    namespace
+    {
+        // 块中的第一条终结指令，与 CFG 的取法一致
+        Instruction* terminatorOf(Block* block)
+        {
+            for (auto* inst : block->insts)
+                if (inst->isTerminator()) return inst;
+            return nullptr;
+        }
+
+        Operand* incomingFrom(PhiInst* phi, Operand* label)
+        {
+            auto it = phi->incomingVals.find(label);
+            return it == phi->incomingVals.end() ? nullptr : it->second;
+        }
+
+        bool fitsI32(long long v) { return v >= INT_MIN && v <= INT_MAX; }
+
+        int immOf(Operand* op) { return static_cast<ImmeI32Operand*>(op)->value; }
+
+        // 各下标在元素个数上的步长，与后端 GEP 的地址计算一致：下标比维度多一个时，第一个下标跨过整个数组
+        std::vector<long long> indexStrides(GEPInst* gep)
+        {
+            size_t                 dims = gep->dims.size(), n = gep->idxs.size();
+            std::vector<long long> strides(n, 1);
+            if (dims == 0) return strides;
+            for (size_t i = 0; i < n; ++i)
+            {
+                size_t pos = i;
+                if (n == dims + 1)
+                {
+                    if (i == 0)
+                    {
+                        for (int d : gep->dims) strides[i] *= d;
+                        continue;
+                    }
+                    pos -= 1;
+                }
+                for (size_t k = pos + 1; k < dims; ++k) strides[i] *= gep->dims[k];
+            }
+            return strides;
+        }
+
+        // 没有副作用、结果不再使用时可以直接删除的指令
+        bool isRemovable(Operator op)
+        {
+            switch (op)
+            {
+                case Operator::ADD: case Operator::SUB: case Operator::MUL:
+                case Operator::BITXOR: case Operator::BITAND:
+                case Operator::SHL: case Operator::ASHR: case Operator::LSHR:
+                case Operator::GETELEMENTPTR: case Operator::ZEXT: return true;
+                default: return false;
+            }
+        }
+
+        bool isPowerOfTwo(long long v) { return v > 0 && (v & (v - 1)) == 0; }
+    }  // namespace
+
+    PreservedAnalyses IVStrengthReducePass::runOnFunction(Function& function)
+    {
+        auto* loops = Analysis::AM.get<Analysis::LoopInfo>(function);
+        if (loops->empty()) return PreservedAnalyses::all();
+        auto* cfg = Analysis::AM.get<Analysis::CFG>(function);
+
+        // 由内向外：内层循环改写后在其前置块中留下的起始地址，是外层归纳变量的仿射函数，可以继续在外层改写
+        Counts counts;
+        for (auto* loop : loops->getLoopsInnermostFirst())
+            if (loop->hasPreheader() && loop->latches.size() == 1) reduceLoop(function, loop, cfg, counts);
+
+        if (!counts.geps && !counts.multiplies && !counts.deadIVs) return PreservedAnalyses::all();
+        if (counts.pointerIVs) Stats::bump("pointer IVs created", counts.pointerIVs);
+        if (counts.geps) Stats::bump("geps reduced", counts.geps);
+        if (counts.multiplies) Stats::bump("multiplies reduced", counts.multiplies);
+        if (counts.deadIVs) Stats::bump("dead IVs removed", counts.deadIVs);
+
+        // 只在已有的块中增删指令，不改变控制流，def-use 链已同步维护
+        return PreservedAnalyses::none()
+            .preserve<Analysis::CFG>()
+            .preserve<Analysis::DomInfo>()
+            .preserve<Analysis::LoopInfo>()
+            .preserve<DefUseChain>();
+    }
+
+    void IVStrengthReducePass::reduceLoop(Function& function, Analysis::Loop* loop, Analysis::CFG* cfg, Counts& counts)
+    {
+        OperandFactory& ops            = function.getOperandFactory();
+        auto&           du             = function.getDefUse();
+        Block*          header         = cfg->id2block[loop->header];
+        Block*          preheader      = cfg->id2block[loop->preheader];
+        Block*          latch          = cfg->id2block[loop->latches[0]];
+        Operand*        preheaderLabel = ops.getLabelOperand(preheader->blockId);
+        Operand*        latchLabel     = ops.getLabelOperand(latch->blockId);
+
+        std::unordered_map<Operand*, Instruction*> defInLoop;
+        std::unordered_map<Instruction*, Block*>   blockOf;
+        for (size_t id : loop->blocks)
+        {
+            Block* block = cfg->id2block[id];
+            for (auto* inst : block->insts)
+            {
+                blockOf[inst] = block;
+                if (Operand* def = inst->getDefOperand(); def && def->getType() == OperandType::REG)
+                    defInLoop[def] = inst;
+            }
+        }
+        auto invariant = [&](Operand* op) { return op->getType() != OperandType::REG || !defInLoop.count(op); };
+
+        // 基本归纳变量：回边上的值由 phi 经若干次加减常量得到
+        std::unordered_map<Operand*, BasicIV> ivs;
+        for (auto* inst : header->insts)
+        {
+            if (inst->opcode != Operator::PHI) break;
+            auto* phi = static_cast<PhiInst*>(inst);
+            if (phi->dt != DataType::I32 || phi->incomingVals.size() != 2) continue;
+            Operand* init = incomingFrom(phi, preheaderLabel);
+            Operand* next = incomingFrom(phi, latchLabel);
+            if (!init || !next) continue;
+
+            std::vector<ArithmeticInst*> incs;
+            long long                    step = 0;
+            Operand*                     cur  = next;
+            while (cur != phi->res && fitsI32(step) && defInLoop.count(cur))
+            {
+                auto* ai = dynamic_cast<ArithmeticInst*>(defInLoop[cur]);
+                if (!ai || ai->dt != DataType::I32) break;
+                if (ai->opcode == Operator::ADD && ai->rhs->getType() == OperandType::IMMEI32)
+                    step += immOf(ai->rhs), cur = ai->lhs;
+                else if (ai->opcode == Operator::ADD && ai->lhs->getType() == OperandType::IMMEI32)
+                    step += immOf(ai->lhs), cur = ai->rhs;
+                else if (ai->opcode == Operator::SUB && ai->rhs->getType() == OperandType::IMMEI32)
+                    step -= immOf(ai->rhs), cur = ai->lhs;
+                else
+                    break;
+                incs.push_back(ai);
+            }
+            if (cur != phi->res || incs.empty() || step == 0 || !fitsI32(step)) continue;
+            std::reverse(incs.begin(), incs.end());
+            ivs.emplace(phi->res, BasicIV{phi, init, std::move(incs), (int)step});
+        }
+        if (ivs.empty()) return;
+
+        // 仿射函数只沿 32 位整数的加减乘与左移追溯，系数或常数项超出 32 位时放弃，保证与原来回绕的计算一致
+        std::unordered_map<Operand*, std::optional<Affine>>   memo;
+        std::function<std::optional<Affine>(Operand*)> affineOf = [&](Operand* op) -> std::optional<Affine> {
+            if (auto it = ivs.find(op); it != ivs.end()) return Affine{&it->second, 1, 0};
+            auto def = defInLoop.find(op);
+            if (def == defInLoop.end()) return std::nullopt;
+            if (auto it = memo.find(op); it != memo.end()) return it->second;
+            memo[op] = std::nullopt;
+
+            std::optional<Affine> result;
+            auto*                 ai = dynamic_cast<ArithmeticInst*>(def->second);
+            if (ai && ai->dt == DataType::I32)
+            {
+                bool lhsImm = ai->lhs->getType() == OperandType::IMMEI32;
+                bool rhsImm = ai->rhs->getType() == OperandType::IMMEI32;
+                switch (ai->opcode)
+                {
+                    case Operator::ADD:
+                        if (rhsImm && (result = affineOf(ai->lhs)))
+                            result->offset += immOf(ai->rhs);
+                        else if (lhsImm && (result = affineOf(ai->rhs)))
+                            result->offset += immOf(ai->lhs);
+                        break;
+                    case Operator::SUB:
+                        if (rhsImm && (result = affineOf(ai->lhs)))
+                            result->offset -= immOf(ai->rhs);
+                        else if (lhsImm && (result = affineOf(ai->rhs)))
+                            result->scale = -result->scale, result->offset = immOf(ai->lhs) - result->offset;
+                        break;
+                    case Operator::MUL:
+                        if (rhsImm && (result = affineOf(ai->lhs)))
+                            result->scale *= immOf(ai->rhs), result->offset *= immOf(ai->rhs);
+                        else if (lhsImm && (result = affineOf(ai->rhs)))
+                            result->scale *= immOf(ai->lhs), result->offset *= immOf(ai->lhs);
+                        break;
+                    case Operator::SHL:
+                        if (rhsImm && immOf(ai->rhs) >= 0 && immOf(ai->rhs) < 31 && (result = affineOf(ai->lhs)))
+                            result->scale *= 1LL << immOf(ai->rhs), result->offset *= 1LL << immOf(ai->rhs);
+                        break;
+                    default: break;
+                }
+            }
+            if (result && (result->scale == 0 || !fitsI32(result->scale) || !fitsI32(result->offset))) result.reset();
+            memo[op] = result;
+            return result;
+        };
+
+        Instruction* preheaderTerm = terminatorOf(preheader);
+        Instruction* latchTerm     = terminatorOf(latch);
+        auto         insertAt      = [&](Block* block, Instruction* pos, Instruction* inst) {
+            block->insts.insertBefore(pos, inst);
+            du.addInst(inst);
+        };
+        // 在前置块中求 scale * init + offset
+        auto valueAtInit = [&](const Affine& a) -> Operand* {
+            Operand* init = a.iv->init;
+            if (init->getType() == OperandType::IMMEI32)
+                return ops.getImmeI32Operand((int)((unsigned)immOf(init) * (unsigned)a.scale + (unsigned)a.offset));
+            Operand* v = init;
+            if (a.scale != 1)
+            {
+                Operand* res = ops.getRegOperand(function.getNewRegId());
+                insertAt(preheader, preheaderTerm, function.create<ArithmeticInst>(Operator::MUL, DataType::I32, v,
+                                                       ops.getImmeI32Operand((int)a.scale), res));
+                v = res;
+            }
+            if (a.offset != 0)
+            {
+                Operand* res = ops.getRegOperand(function.getNewRegId());
+                insertAt(preheader, preheaderTerm, function.create<ArithmeticInst>(Operator::ADD, DataType::I32, v,
+                                                       ops.getImmeI32Operand((int)a.offset), res));
+                v = res;
+            }
+            return v;
+        };
+        // 新建归纳变量：循环头 phi 从前置块取 start，回边上取 phi 加 inc（指针按元素个数前进）
+        auto createIV = [&](DataType dt, Operand* start, int inc, DataType elemType) -> Operand* {
+            Operand* res  = ops.getRegOperand(function.getNewRegId());
+            Operand* next = ops.getRegOperand(function.getNewRegId());
+            auto*    phi  = function.create<PhiInst>(dt, res);
+            phi->addIncoming(start, preheaderLabel);
+            phi->addIncoming(next, latchLabel);
+            header->insertFront(phi);
+            du.addInst(phi);
+            if (dt == DataType::PTR)
+                insertAt(latch, latchTerm, function.create<GEPInst>(elemType, DataType::I32, res, next, std::vector<int>{},
+                                               std::vector<Operand*>{ops.getImmeI32Operand(inc)}));
+            else
+                insertAt(latch, latchTerm,
+                    function.create<ArithmeticInst>(Operator::ADD, DataType::I32, res, ops.getImmeI32Operand(inc), next));
+            return res;
+        };
+
+        // 被替换的指令与因此不再使用的计算一并删除
+        std::unordered_set<Instruction*> removed;
+        auto removeDead = [&](Instruction* root) {
+            std::vector<Instruction*> work{root};
+            std::vector<Operand**>    slots;
+            while (!work.empty())
+            {
+                Instruction* inst = work.back();
+                work.pop_back();
+                if (!removed.insert(inst).second) continue;
+                slots.clear();
+                inst->getUseSlots(slots);
+                std::vector<Instruction*> operands;
+                for (auto* slot : slots)
+                    if (*slot && (*slot)->getType() == OperandType::REG && defInLoop.count(*slot))
+                        operands.push_back(defInLoop[*slot]);
+                du.removeInst(inst);
+                blockOf[inst]->insts.remove(inst);
+                function.destroy(inst);
+                for (auto* def : operands)
+                    if (!removed.count(def) && isRemovable(def->opcode) && !du.hasUses(def->getDefOperand()->getRegNum()))
+                        work.push_back(def);
+            }
+        };
+        size_t created = 0;
+
+        // GEP：基址循环不变，各下标为常量、循环不变量或同一归纳变量的仿射函数时，地址每次迭代前进固定的元素个数。
+        // 基址、不变下标与每次迭代的步长都相同的 GEP 归为一组，共用一个指针归纳变量
+        struct Access
+        {
+            GEPInst*                           gep;
+            long long                          elems;   // 仿射下标的常数项与常量下标贡献的元素个数
+            std::vector<std::optional<Affine>> affine;  // 各下标的仿射形式，非仿射下标为空
+        };
+        struct Group
+        {
+            const BasicIV*      iv;
+            long long           coef;  // iv 每加 1 地址前进的元素个数
+            std::vector<Access> members;
+        };
+        std::map<std::vector<uintptr_t>, size_t> groupIndex;
+        std::vector<Group>                       groups;
+        for (size_t id : loop->blocks)
+        {
+            for (auto* inst : cfg->id2block[id]->insts)
+            {
+                if (inst->opcode != Operator::GETELEMENTPTR) continue;
+                auto* gep = static_cast<GEPInst*>(inst);
+                if (!invariant(gep->basePtr) || gep->idxs.empty()) continue;
+
+                auto                   strides = indexStrides(gep);
+                std::vector<uintptr_t> key{(uintptr_t)gep->basePtr, (uintptr_t)gep->dt, (uintptr_t)gep->idxType,
+                    gep->dims.size()};
+                for (int d : gep->dims) key.push_back((uintptr_t)d);
+                Access         access{gep, 0, {}};
+                const BasicIV* iv   = nullptr;
+                long long      coef = 0;
+                bool           ok   = true;
+                for (size_t i = 0; i < gep->idxs.size() && ok; ++i)
+                {
+                    Operand* idx = gep->idxs[i];
+                    if (idx->getType() == OperandType::IMMEI32)
+                    {
+                        access.elems += strides[i] * immOf(idx);
+                        key.push_back(0);
+                        access.affine.emplace_back();
+                    }
+                    else if (invariant(idx))
+                    {
+                        key.push_back((uintptr_t)idx);
+                        access.affine.emplace_back();
+                    }
+                    else if (auto a = affineOf(idx); a && (!iv || iv == a->iv))
+                    {
+                        iv = a->iv;
+                        coef += strides[i] * a->scale;
+                        access.elems += strides[i] * a->offset;
+                        key.push_back(0);
+                        access.affine.push_back(a);
+                    }
+                    else
+                        ok = false;
+                }
+                if (!ok || !iv || coef == 0 || !fitsI32(access.elems)) continue;
+                key.push_back((uintptr_t)iv);
+                key.push_back((uintptr_t)coef);
+                auto [it, inserted] = groupIndex.try_emplace(key, groups.size());
+                if (inserted) groups.push_back({iv, coef, {}});
+                groups[it->second].members.push_back(std::move(access));
+            }
+        }
+
+        for (auto& group : groups)
+        {
+            if (created == kMaxNewIVsPerLoop) break;
+            long long inc = group.coef * group.iv->step;
+            auto      leader =
+                std::min_element(group.members.begin(), group.members.end(),
+                    [](const Access& a, const Access& b) { return a.elems < b.elems; });
+            bool ok = fitsI32(inc);
+            for (auto& m : group.members) ok &= fitsI32(m.elems - leader->elems);
+            if (!ok) continue;
+
+            // 起始地址：组内常数项最小的 GEP 在首次迭代时的地址
+            GEPInst*              first = leader->gep;
+            std::vector<Operand*> idxs;
+            for (size_t i = 0; i < first->idxs.size(); ++i)
+                idxs.push_back(leader->affine[i] ? valueAtInit(*leader->affine[i]) : first->idxs[i]);
+            Operand* start = ops.getRegOperand(function.getNewRegId());
+            insertAt(preheader, preheaderTerm,
+                function.create<GEPInst>(first->dt, first->idxType, first->basePtr, start, first->dims, idxs));
+            Operand* ptr = createIV(DataType::PTR, start, (int)inc, first->dt);
+
+            for (auto& m : group.members)
+            {
+                Operand* value = ptr;
+                if (long long delta = m.elems - leader->elems)
+                {
+                    value = ops.getRegOperand(function.getNewRegId());
+                    insertAt(blockOf[m.gep], m.gep, function.create<GEPInst>(m.gep->dt, DataType::I32, ptr, value,
+                                                        std::vector<int>{}, std::vector<Operand*>{ops.getImmeI32Operand((int)delta)}));
+                }
+                function.replaceAllUsesWith(m.gep->res, value);
+                removeDead(m.gep);
+            }
+            ++created;
+            ++counts.pointerIVs;
+            counts.geps += group.members.size();
+        }
+
+        // 其余仍被使用的乘法：结果是仿射函数时改为每次迭代加 scale * step 的整数归纳变量。
+        // 乘以 2 的幂会被后端选为移位，与加法代价相同，不改写
+        std::vector<ArithmeticInst*> muls;
+        for (size_t id : loop->blocks)
+            for (auto* inst : cfg->id2block[id]->insts)
+                if (inst->opcode == Operator::MUL && static_cast<ArithmeticInst*>(inst)->dt == DataType::I32)
+                    muls.push_back(static_cast<ArithmeticInst*>(inst));
+        std::map<std::tuple<const BasicIV*, long long, long long>, Operand*> scalarIVs;
+        for (auto* mul : muls)
+        {
+            if (removed.count(mul) || !du.hasUses(mul->res->getRegNum())) continue;
+            auto a = affineOf(mul->res);
+            if (!a || isPowerOfTwo(a->scale) || !fitsI32(a->scale * a->iv->step)) continue;
+
+            auto key = std::make_tuple(a->iv, a->scale, a->offset);
+            auto it  = scalarIVs.find(key);
+            if (it == scalarIVs.end())
+            {
+                if (created == kMaxNewIVsPerLoop) continue;
+                Operand* iv = createIV(DataType::I32, valueAtInit(*a), (int)(a->scale * a->iv->step), DataType::I32);
+                it          = scalarIVs.emplace(key, iv).first;
+                ++created;
+            }
+            function.replaceAllUsesWith(mul->res, it->second);
+            removeDead(mul);
+            ++counts.multiplies;
+        }
+
+        // 只剩自增的原归纳变量：phi 与自增链上的每个值都只被链上的下一条指令（最后一个被 phi）使用
+        for (auto& [res, iv] : ivs)
+        {
+            std::vector<Instruction*> chain{iv.phi};
+            chain.insert(chain.end(), iv.incs.begin(), iv.incs.end());
+            bool dead = true;
+            for (size_t i = 0; i < chain.size() && dead; ++i)
+            {
+                Instruction* user = chain[(i + 1) % chain.size()];
+                dead              = !removed.count(chain[i]);
+                for (auto& use : du.getUses(chain[i]->getDefOperand()->getRegNum())) dead &= use.user == user;
+            }
+            if (!dead) continue;
+            for (Instruction* inst : chain)
+            {
+                removed.insert(inst);
+                du.removeInst(inst);
+                blockOf[inst]->insts.remove(inst);
+                function.destroy(inst);
+            }
+            ++counts.deadIVs;
+        }
+    }
+}  // namespace ME
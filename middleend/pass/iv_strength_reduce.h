@@ -0,0 +1,60 @@
+#ifndef __MIDDLEEND_PASS_IV_STRENGTH_REDUCE_H__
+#define __MIDDLEEND_PASS_IV_STRENGTH_REDUCE_H__
+
+#include <interfaces/middleend/pass.h>
+#include <middleend/module/ir_function.h>
+#include <middleend/module/ir_instruction.h>
+#include <middleend/pass/analysis/cfg.h>
+#include <middleend/pass/analysis/loop_info.h>
+#include <cstddef>
+#include <unordered_map>
+#include <vector>
+
+namespace ME
+{
+    // Induction Variable Strength Reduction
+    // 在有前置块且只有一条回边的循环中，以循环头 phi 每次迭代加常量（可经多次加减）得到基本归纳变量，
+    // 由它经加减常量、乘常量、左移得到的值是它的仿射函数。
+    // 下标是仿射函数、其余部分循环不变的 GEP 改写为每次迭代加常量步长的指针归纳变量（基址与系数相同的 GEP 共用一个，
+    // 彼此只差常量偏移）；仍被使用的乘法改写为整数归纳变量。改写后不再使用的计算与只剩自增的原归纳变量被删除
+    class IVStrengthReducePass : public FunctionPass
+    {
+      public:
+        static constexpr size_t kMaxNewIVsPerLoop = 8;  // 限制新增归纳变量带来的寄存器压力
+
+        IVStrengthReducePass()  = default;
+        ~IVStrengthReducePass() = default;
+
+        const char*       getName() const override { return "iv-sr"; }
+        PreservedAnalyses runOnFunction(Function& function) override;
+
+      private:
+        struct BasicIV
+        {
+            PhiInst*                     phi;
+            Operand*                     init;  // 来自前置块的初值
+            std::vector<ArithmeticInst*> incs;  // 从 phi 到回边上的值依次加减常量的指令，展开后的循环中有多条
+            int                          step;
+        };
+        // 值 = scale * iv + offset
+        struct Affine
+        {
+            const BasicIV* iv;
+            long long      scale;
+            long long      offset;
+        };
+
+        struct Counts
+        {
+            size_t pointerIVs = 0;
+            size_t geps       = 0;
+            size_t multiplies = 0;
+            size_t deadIVs    = 0;
+        };
+
+        // 处理一个循环，修改中同步维护 def-use 链
+        static void reduceLoop(Function& function, Analysis::Loop* loop, Analysis::CFG* cfg, Counts& counts);
+    };
+}  // namespace ME
+
+#endif  // __MIDDLEEND_PASS_IV_STRENGTH_REDUCE_H__
@@ -0,0 +1,337 @@
+#include <middleend/pass/licm.h>
+#include <middleend/pass/analysis/analysis_manager.h>
+#include <middleend/pass/analysis/cfg.h>
+#include <middleend/pass/analysis/dominfo.h>
+#include <middleend/pass/analysis/loop_info.h>
+#include <middleend/module/ir_block.h>
+#include <middleend/module/ir_instruction.h>
+#include <middleend/module/ir_operand.h>
+#include <stats.h>
+#include <algorithm>
+#include <string_view>
+
+namespace ME
+{
+    namespace
+    {
+        // 块中的第一条终结指令，与 CFG 的取法一致
+        Instruction* terminatorOf(Block* block)
+        {
+            for (auto* inst : block->insts)
+                if (inst->isTerminator()) return inst;
+            return nullptr;
+        }
+
+        // sylib 中不写用户可见内存的函数
+        bool isReadOnlyLibCall(std::string_view name)
+        {
+            static const std::string_view readOnly[] = {"getint", "getch", "getfloat", "putint", "putch", "putfloat",
+                "putarray", "putfarray", "putf", "_sysy_starttime", "_sysy_stoptime"};
+            return std::find(std::begin(readOnly), std::end(readOnly), name) != std::end(readOnly);
+        }
+
+        // 地址是基址本身，或以常量下标落在基址数组范围内的 GEP：提前访问不会越界
+        bool isInBoundsAddress(Operand* ptr, Operand* base, DefUseChain& du)
+        {
+            if (ptr == base) return true;
+            if (ptr->getType() != OperandType::REG) return false;
+            auto* gep = dynamic_cast<GEPInst*>(du.getDef(ptr->getRegNum()));
+            if (!gep || gep->basePtr != base || gep->idxs.empty() || gep->idxs.size() > gep->dims.size() + 1)
+                return false;
+            for (size_t k = 0; k < gep->idxs.size(); ++k)
+            {
+                if (gep->idxs[k]->getType() != OperandType::IMMEI32) return false;
+                int idx = static_cast<ImmeI32Operand*>(gep->idxs[k])->value;
+                if (k == 0 ? idx != 0 : idx < 0 || idx >= gep->dims[k - 1]) return false;
+            }
+            return true;
+        }
+
+        // sylib 中只写第一个指针实参所指数组的函数
+        bool writesFirstPointerArg(std::string_view name)
+        {
+            return name == "getarray" || name == "getfarray" || name.substr(0, 11) == "llvm.memset";
+        }
+    }  // namespace
+
+    PreservedAnalyses LICMPass::runOnFunction(Function& function)
+    {
+        auto* loops = Analysis::AM.get<Analysis::LoopInfo>(function);
+        if (loops->empty()) return PreservedAnalyses::all();
+
+        bool changed = false;
+        if (insertPreheaders(function, loops, Analysis::AM.get<Analysis::CFG>(function)))
+        {
+            // 前置块改变了 CFG 与 phi 的 incoming，外提前在新的 CFG 上重新计算各分析
+            Analysis::AM.invalidate(function);
+            changed = true;
+        }
+        changed |= hoistInvariants(function) > 0;
+        if (!changed) return PreservedAnalyses::all();
+
+        // 外提只在块之间移动指令，分析均已在插入前置块后重新计算
+        return PreservedAnalyses::none()
+            .preserve<Analysis::CFG>()
+            .preserve<Analysis::DomInfo>()
+            .preserve<Analysis::LoopInfo>()
+            .preserve<DefUseChain>();
+    }
+
+    bool LICMPass::insertPreheaders(Function& function, Analysis::LoopInfo* loops, Analysis::CFG* cfg)
+    {
+        OperandFactory& ops     = function.getOperandFactory();
+        size_t          created = 0;
+        for (auto* loop : loops->getLoopsInnermostFirst())
+        {
+            // 入口块必须是块 0，以它为头的循环无法在其前插入块
+            if (loop->hasPreheader() || loop->header == 0) continue;
+
+            std::vector<size_t> outside;
+            for (size_t pred : cfg->invG_id[loop->header])
+            {
+                if (loops->contains(loop, pred)) continue;
+                if (std::find(outside.begin(), outside.end(), pred) == outside.end()) outside.push_back(pred);
+            }
+            if (outside.empty()) continue;
+
+            Block* header    = cfg->id2block[loop->header];
+            Block* preheader = function.createBlock();
+            preheader->setComment("loop.preheader");
+            function.blocks.remove(preheader);
+            function.blocks.insertBefore(header, preheader);
+
+            Operand* headerLabel    = ops.getLabelOperand(header->blockId);
+            Operand* preheaderLabel = ops.getLabelOperand(preheader->blockId);
+
+            // 循环外的前驱改为跳到前置块
+            for (size_t pred : outside)
+            {
+                Instruction* term = terminatorOf(cfg->id2block[pred]);
+                if (auto* br = dynamic_cast<BrCondInst*>(term))
+                {
+                    if (br->trueTar == headerLabel) br->trueTar = preheaderLabel;
+                    if (br->falseTar == headerLabel) br->falseTar = preheaderLabel;
+                }
+                else if (auto* br = dynamic_cast<BrUncondInst*>(term))
+                {
+                    if (br->target == headerLabel) br->target = preheaderLabel;
+                }
+            }
+
+            // 循环头的 phi：来自循环外的 incoming 合并为一项来自前置块的 incoming，取值不同时在前置块中新建 phi
+            for (auto* inst : header->insts)
+            {
+                if (inst->opcode != Operator::PHI) break;
+                auto* phi = static_cast<PhiInst*>(inst);
+
+                std::vector<std::pair<Operand*, Operand*>> incoming;  // (值, 前驱标签)
+                for (size_t pred : outside)
+                {
+                    auto it = phi->incomingVals.find(ops.getLabelOperand(pred));
+                    if (it == phi->incomingVals.end()) continue;
+                    incoming.emplace_back(it->second, it->first);
+                    phi->incomingVals.erase(it);
+                }
+                if (incoming.empty()) continue;
+
+                bool same = std::all_of(
+                    incoming.begin(), incoming.end(), [&](const auto& in) { return in.first == incoming[0].first; });
+                Operand* value = incoming[0].first;
+                if (!same)
+                {
+                    value        = ops.getRegOperand(function.getNewRegId());
+                    auto* merged = function.create<PhiInst>(phi->dt, value);
+                    for (auto& [val, label] : incoming) merged->addIncoming(val, label);
+                    preheader->insertBack(merged);
+                }
+                phi->addIncoming(value, preheaderLabel);
+            }
+
+            preheader->insertBack(function.create<BrUncondInst>(headerLabel));
+            ++created;
+        }
+
+        if (created) Stats::bump("preheaders inserted", created);
+        return created > 0;
+    }
+
+    size_t LICMPass::hoistInvariants(Function& function)
+    {
+        auto* cfg   = Analysis::AM.get<Analysis::CFG>(function);
+        auto* dom   = Analysis::AM.get<Analysis::DomInfo>(function);
+        auto* loops = Analysis::AM.get<Analysis::LoopInfo>(function);
+        auto& du    = function.getDefUse();
+
+        size_t maxReg = function.getMaxReg();
+        for (auto* block : function.blocks)
+            for (auto* inst : block->insts)
+                if (Operand* def = inst->getDefOperand(); def && def->getType() == OperandType::REG)
+                    maxReg = std::max(maxReg, def->getRegNum());
+        std::vector<bool> definedInLoop(maxReg + 1, false);
+
+        const auto& domTree = dom->getDomTree();
+        size_t      hoisted = 0;
+        for (auto* loop : loops->getLoopsInnermostFirst())
+        {
+            if (!loop->hasPreheader()) continue;
+            Block*       preheader = cfg->id2block[loop->preheader];
+            Instruction* insertPos = terminatorOf(preheader);
+            if (!insertPos) continue;
+
+            for (size_t b : loop->blocks)
+                for (auto* inst : cfg->id2block[b]->insts)
+                    if (Operand* def = inst->getDefOperand(); def && def->getType() == OperandType::REG)
+                        definedInLoop[def->getRegNum()] = true;
+
+            MemoryEffects mem = collectMemoryEffects(loop, cfg, du);
+
+            // 沿支配树先序访问循环内的块：操作数的定义总是先于使用被访问，一趟即可外提整条不变量链
+            std::vector<size_t> stack = {loop->header};
+            while (!stack.empty())
+            {
+                size_t b = stack.back();
+                stack.pop_back();
+                for (int child : domTree[b])
+                    if (loops->contains(loop, (size_t)child)) stack.push_back((size_t)child);
+
+                // 块支配所有离开循环的块时，它在进入循环后必然执行，可能出错的指令也可以外提
+                bool guaranteed = !loop->exiting.empty();
+                for (size_t e : loop->exiting) guaranteed &= loops->dominates(b, e);
+
+                Block*                    block = cfg->id2block[b];
+                std::vector<Instruction*> insts(block->insts.begin(), block->insts.end());
+                for (auto* inst : insts)
+                {
+                    if (!canHoist(inst, guaranteed, mem, du, definedInLoop)) continue;
+                    block->insts.remove(inst);
+                    preheader->insts.insertBefore(insertPos, inst);
+                    definedInLoop[inst->getDefOperand()->getRegNum()] = false;
+                    ++hoisted;
+                }
+            }
+
+            for (size_t b : loop->blocks)
+                for (auto* inst : cfg->id2block[b]->insts)
+                    if (Operand* def = inst->getDefOperand(); def && def->getType() == OperandType::REG)
+                        definedInLoop[def->getRegNum()] = false;
+        }
+
+        if (hoisted) Stats::bump("insts hoisted", hoisted);
+        return hoisted;
+    }
+
+    LICMPass::MemoryEffects LICMPass::collectMemoryEffects(Analysis::Loop* loop, Analysis::CFG* cfg, DefUseChain& du)
+    {
+        MemoryEffects mem;
+        auto          write = [&](Operand* ptr) {
+            Operand* base = pointerBase(ptr, du);
+            if (base)
+                mem.written.insert(base);
+            else
+                mem.writesUnknown = true;
+        };
+
+        for (size_t b : loop->blocks)
+        {
+            for (auto* inst : cfg->id2block[b]->insts)
+            {
+                if (inst->opcode == Operator::STORE)
+                    write(static_cast<StoreInst*>(inst)->ptr);
+                else if (inst->opcode == Operator::CALL)
+                {
+                    auto* call = static_cast<CallInst*>(inst);
+                    if (isReadOnlyLibCall(call->funcName)) continue;
+                    if (writesFirstPointerArg(call->funcName) && !call->args.empty())
+                        write(call->args[0].second);
+                    else
+                        mem.callsUnknown = true;
+                }
+            }
+        }
+        return mem;
+    }
+
+    bool LICMPass::canHoist(Instruction* inst, bool guaranteed, const MemoryEffects& mem, DefUseChain& du,
+        const std::vector<bool>& definedInLoop)
+    {
+        Operand* def = inst->getDefOperand();
+        if (!def || def->getType() != OperandType::REG) return false;
+
+        switch (inst->opcode)
+        {
+            case Operator::ADD:
+            case Operator::SUB:
+            case Operator::MUL:
+            case Operator::FADD:
+            case Operator::FSUB:
+            case Operator::FMUL:
+            case Operator::FDIV:
+            case Operator::BITXOR:
+            case Operator::BITAND:
+            case Operator::SHL:
+            case Operator::ASHR:
+            case Operator::LSHR:
+            case Operator::ICMP:
+            case Operator::FCMP:
+            case Operator::ZEXT:
+            case Operator::SITOFP:
+            case Operator::FPTOSI:
+            case Operator::GETELEMENTPTR: break;
+            case Operator::DIV:
+            case Operator::MOD: {
+                // 除数为 0 或 INT_MIN / -1 时会出错，只有除数是其它常量或指令必然执行时才能提前
+                Operand* rhs = static_cast<ArithmeticInst*>(inst)->rhs;
+                if (guaranteed) break;
+                if (rhs->getType() != OperandType::IMMEI32) return false;
+                int divisor = static_cast<ImmeI32Operand*>(rhs)->value;
+                if (divisor == 0 || divisor == -1) return false;
+                break;
+            }
+            case Operator::LOAD: {
+                Operand* ptr  = static_cast<LoadInst*>(inst)->ptr;
+                Operand* base = pointerBase(ptr, du);
+                if (mem.callsUnknown) return false;
+                if (!base)
+                {
+                    // 基址未知（如指针形参），循环内没有任何写入时才可外提
+                    if (mem.writesUnknown || !mem.written.empty()) return false;
+                }
+                else
+                {
+                    if (mem.written.count(base)) return false;
+                    // 经形参的写入可能指向任意全局数组，但无法指向本函数的局部数组
+                    if (base->getType() == OperandType::GLOBAL && mem.writesUnknown) return false;
+                }
+                // 越界的地址提前访问可能出错：地址不能确定在范围内时要求 load 必然执行
+                if (!guaranteed && (!base || !isInBoundsAddress(ptr, base, du))) return false;
+                break;
+            }
+            default: return false;
+        }
+
+        std::vector<Operand**> slots;
+        inst->getUseSlots(slots);
+        for (auto** slot : slots)
+        {
+            Operand* op = *slot;
+            if (op && op->getType() == OperandType::REG && op->getRegNum() < definedInLoop.size() &&
+                definedInLoop[op->getRegNum()])
+                return false;
+        }
+        return true;
+    }
+
+    Operand* LICMPass::pointerBase(Operand* ptr, DefUseChain& du)
+    {
+        while (ptr && ptr->getType() == OperandType::REG)
+        {
+            Instruction* def = du.getDef(ptr->getRegNum());
+            if (!def) return nullptr;  // 指针形参
+            if (def->opcode == Operator::ALLOCA) return ptr;
+            if (def->opcode != Operator::GETELEMENTPTR) return nullptr;
+            ptr = static_cast<GEPInst*>(def)->basePtr;
+        }
+        if (ptr && ptr->getType() == OperandType::GLOBAL) return ptr;
+        return nullptr;
+    }
+}  // namespace ME
@@ -0,0 +1,49 @@
+#ifndef __MIDDLEEND_PASS_LICM_H__
+#define __MIDDLEEND_PASS_LICM_H__
+
+#include <interfaces/middleend/pass.h>
+#include <middleend/module/ir_function.h>
+#include <middleend/pass/analysis/cfg.h>
+#include <middleend/pass/analysis/loop_info.h>
+#include <unordered_set>
+#include <vector>
+
+namespace ME
+{
+    // Loop Invariant Code Motion
+    // 循环不变量外提：把每次迭代结果都相同的纯计算与只读内存上的 load 移到循环的前置块中
+    // 各函数可能在不同线程上同时处理，因此 pass 对象不保存逐函数的状态
+    class LICMPass : public FunctionPass
+    {
+      public:
+        LICMPass()  = default;
+        ~LICMPass() = default;
+
+        const char*       getName() const override { return "licm"; }
+        PreservedAnalyses runOnFunction(Function& function) override;
+
+      private:
+        // 循环内对内存的写入，决定哪些 load 可以外提
+        struct MemoryEffects
+        {
+            std::unordered_set<Operand*> written;                // 被写入的全局变量或局部数组（按基址）
+            bool                         writesUnknown = false;  // 有基址无法确定的写入（如经指针形参）
+            bool                         callsUnknown  = false;  // 调用了可能读写任意内存的函数
+        };
+
+        // 为没有前置块的循环插入前置块，返回是否修改了 CFG
+        static bool insertPreheaders(Function& function, Analysis::LoopInfo* loops, Analysis::CFG* cfg);
+        // 由内向外外提各循环中的不变量，返回外提的指令数
+        static size_t hoistInvariants(Function& function);
+
+        static MemoryEffects collectMemoryEffects(Analysis::Loop* loop, Analysis::CFG* cfg, DefUseChain& du);
+        // 指令是否只依赖循环外的值，且提前到前置块执行不会改变程序行为
+        static bool canHoist(Instruction* inst, bool guaranteed, const MemoryEffects& mem, DefUseChain& du,
+            const std::vector<bool>& definedInLoop);
+
+        // 沿 GEP 找到指针的基址：全局变量或 alloca 的结果，无法确定时返回 nullptr
+        static Operand* pointerBase(Operand* ptr, DefUseChain& du);
+    };
+}  // namespace ME
+
+#endif  // __MIDDLEEND_PASS_LICM_H__
@@ -0,0 +1,441 @@
+#include <middleend/pass/loop_unroll.h>
+#include <middleend/pass/analysis/analysis_manager.h>
+#include <middleend/module/ir_block.h>
+#include <middleend/module/ir_operand.h>
+#include <middleend/module/ir_def_use.h>
+#include <middleend/visitor/utils/clone_visitor.h>
+#include <stats.h>
+#include <algorithm>
+#include <climits>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace ME
+{
+    namespace
+    {
+        ICmpOp swapped(ICmpOp cond)
+        {
+            switch (cond)
+            {
+                case ICmpOp::UGT: return ICmpOp::ULT;
+                case ICmpOp::UGE: return ICmpOp::ULE;
+                case ICmpOp::ULT: return ICmpOp::UGT;
+                case ICmpOp::ULE: return ICmpOp::UGE;
+                case ICmpOp::SGT: return ICmpOp::SLT;
+                case ICmpOp::SGE: return ICmpOp::SLE;
+                case ICmpOp::SLT: return ICmpOp::SGT;
+                case ICmpOp::SLE: return ICmpOp::SGE;
+                default: return cond;  // eq、ne 对称
+            }
+        }
+
+        bool compare(ICmpOp cond, int lhs, int rhs)
+        {
+            switch (cond)
+            {
+                case ICmpOp::EQ: return lhs == rhs;
+                case ICmpOp::NE: return lhs != rhs;
+                case ICmpOp::UGT: return (unsigned)lhs > (unsigned)rhs;
+                case ICmpOp::UGE: return (unsigned)lhs >= (unsigned)rhs;
+                case ICmpOp::ULT: return (unsigned)lhs < (unsigned)rhs;
+                case ICmpOp::ULE: return (unsigned)lhs <= (unsigned)rhs;
+                case ICmpOp::SGT: return lhs > rhs;
+                case ICmpOp::SGE: return lhs >= rhs;
+                case ICmpOp::SLT: return lhs < rhs;
+                case ICmpOp::SLE: return lhs <= rhs;
+                default: return false;
+            }
+        }
+
+        // 块中的第一条终结指令，与 CFG 的取法一致
+        Instruction* terminatorOf(Block* block)
+        {
+            for (auto* inst : block->insts)
+                if (inst->isTerminator()) return inst;
+            return nullptr;
+        }
+
+        std::vector<PhiInst*> headerPhis(Block* header)
+        {
+            std::vector<PhiInst*> phis;
+            for (auto* inst : header->insts)
+            {
+                if (inst->opcode != Operator::PHI) break;
+                phis.push_back(static_cast<PhiInst*>(inst));
+            }
+            return phis;
+        }
+
+        Operand* incomingFrom(PhiInst* phi, Operand* label)
+        {
+            auto it = phi->incomingVals.find(label);
+            return it == phi->incomingVals.end() ? nullptr : it->second;
+        }
+
+        void destroyBlock(Function& function, Block* block)
+        {
+            function.blocks.remove(block);
+            for (auto it = block->insts.begin(); it != block->insts.end();)
+            {
+                Instruction* inst = *it;
+                it                = block->insts.erase(it);
+                function.destroy(inst);
+            }
+            function.destroy(block);
+        }
+    }  // namespace
+
+    PreservedAnalyses LoopUnrollPass::runOnFunction(Function& function)
+    {
+        auto* loops = Analysis::AM.get<Analysis::LoopInfo>(function);
+        if (loops->empty()) return PreservedAnalyses::all();
+        auto* cfg = Analysis::AM.get<Analysis::CFG>(function);
+
+        // 只展开最内层循环，它们互不相交：展开一个循环只改写它自己的块与前置块的跳转，不影响其余候选的形状
+        std::vector<LoopShape> shapes;
+        for (auto* loop : loops->getLoopsInnermostFirst())
+        {
+            LoopShape shape;
+            if (loop->subLoops.empty() && analyzeLoop(function, loop, cfg, loops, shape)) shapes.push_back(shape);
+        }
+        if (shapes.empty()) return PreservedAnalyses::all();
+
+        size_t growth = 0, fully = 0, partially = 0;
+        for (auto& shape : shapes)
+        {
+            size_t trip  = 0;
+            bool   known = constantTripCount(shape, kMaxFullUnrollTrip, trip);
+            if (known && trip * shape.bodySize <= kFullUnrollBudget &&
+                growth + trip * shape.bodySize <= kMaxFunctionGrowth)
+            {
+                fullyUnroll(function, shape, trip);
+                growth += trip * shape.bodySize;
+                ++fully;
+                continue;
+            }
+
+            // 部分展开要求 iv 朝边界单调逼近，主循环的条件才能由原条件平移 (count - 1) 个步长得到
+            bool increasing = shape.pred == ICmpOp::SLT || shape.pred == ICmpOp::SLE;
+            bool decreasing = shape.pred == ICmpOp::SGT || shape.pred == ICmpOp::SGE;
+            if (!(increasing && shape.step > 0) && !(decreasing && shape.step < 0)) continue;
+
+            unsigned count = factor;
+            while (count > 1 && count * shape.bodySize > kPartialUnrollBudget) --count;
+            if (count < 2 || growth + count * shape.bodySize > kMaxFunctionGrowth) continue;
+            // 迭代次数已知且不足一轮时展开没有收益
+            if (known && trip < count) continue;
+            long long offset = (long long)(count - 1) * shape.step;
+            if (offset < INT_MIN || offset > INT_MAX) continue;
+            if (shape.bound->getType() == OperandType::IMMEI32)
+            {
+                long long bound = static_cast<ImmeI32Operand*>(shape.bound)->value - offset;
+                if (bound < INT_MIN || bound > INT_MAX) continue;
+            }
+
+            partiallyUnroll(function, shape, count);
+            growth += count * shape.bodySize;
+            ++partially;
+        }
+        if (!fully && !partially) return PreservedAnalyses::all();
+        if (fully) Stats::bump("loops fully unrolled", fully);
+        if (partially) Stats::bump("loops partially unrolled", partially);
+
+        Analysis::AM.invalidate(function);
+        return PreservedAnalyses::none();
+    }
+
+    bool LoopUnrollPass::analyzeLoop(
+        Function& function, Analysis::Loop* loop, Analysis::CFG* cfg, Analysis::LoopInfo* loops, LoopShape& shape)
+    {
+        if (!loop->hasPreheader() || loop->latches.size() != 1 || loop->exits.size() != 1) return false;
+        if (loop->exiting.size() != 1 || loop->exiting[0] != loop->header || loop->latches[0] == loop->header)
+            return false;
+
+        OperandFactory& ops = function.getOperandFactory();
+        shape.header        = cfg->id2block[loop->header];
+        shape.preheader     = cfg->id2block[loop->preheader];
+        shape.exit          = cfg->id2block[loop->exits[0]];
+        shape.latch         = cfg->id2block[loop->latches[0]];
+
+        // 循环头：phi 之后只有一条比较与以它为条件的跳转，条件成立时留在循环内
+        std::vector<Instruction*> rest;
+        for (auto* inst : shape.header->insts)
+            if (inst->opcode != Operator::PHI) rest.push_back(inst);
+        if (rest.size() != 2 || rest[0]->opcode != Operator::ICMP || rest[1]->opcode != Operator::BR_COND) return false;
+        auto* cmp = static_cast<IcmpInst*>(rest[0]);
+        auto* br  = static_cast<BrCondInst*>(rest[1]);
+        if (br->cond != cmp->res || cmp->dt != DataType::I32) return false;
+        if (static_cast<LabelOperand*>(br->falseTar)->lnum != shape.exit->blockId) return false;
+        shape.bodyEntry = cfg->id2block[static_cast<LabelOperand*>(br->trueTar)->lnum];
+        // 比较结果只用于循环头的跳转，副本中不需要它的值
+        auto& du = function.getDefUse();
+        if (cmp->res->getType() != OperandType::REG || du.getUses(cmp->res->getRegNum()).size() != 1) return false;
+
+        // 循环头的 phi 恰好来自前置块与回边各一项
+        Operand* preheaderLabel = ops.getLabelOperand(shape.preheader->blockId);
+        Operand* latchLabel     = ops.getLabelOperand(shape.latch->blockId);
+        auto     phis           = headerPhis(shape.header);
+        for (auto* phi : phis)
+            if (phi->incomingVals.size() != 2 || !incomingFrom(phi, preheaderLabel) || !incomingFrom(phi, latchLabel))
+                return false;
+
+        // 循环体：按函数中的排列顺序收集，入口块不能有 phi，且只含能复制的指令
+        std::unordered_set<Operand*> definedInLoop;
+        shape.bodySize = 0;
+        for (auto* block : function.blocks)
+        {
+            if (!loops->contains(loop, block->blockId)) continue;
+            for (auto* inst : block->insts)
+                if (Operand* def = inst->getDefOperand(); def && def->getType() == OperandType::REG)
+                    definedInLoop.insert(def);
+            if (block == shape.header) continue;
+            shape.body.push_back(block);
+            for (auto* inst : block->insts)
+            {
+                if (inst->opcode == Operator::ALLOCA || inst->opcode == Operator::RET) return false;
+                if (inst->opcode == Operator::PHI && block == shape.bodyEntry) return false;
+                if (inst->opcode != Operator::PHI) ++shape.bodySize;
+            }
+        }
+        if (!loops->contains(loop, shape.bodyEntry->blockId) || shape.bodyEntry == shape.header) return false;
+
+        // 归纳变量：比较一侧的 phi，回边上的值为 iv 加（减）常量；另一侧在循环内不变
+        ICmpOp   pred = cmp->cond;
+        Operand *lhs = cmp->lhs, *rhs = cmp->rhs;
+        auto     isPhi = [&](Operand* op) {
+            return std::find_if(phis.begin(), phis.end(), [&](PhiInst* phi) { return phi->res == op; }) != phis.end();
+        };
+        if (!isPhi(lhs)) std::swap(lhs, rhs), pred = swapped(pred);
+        if (!isPhi(lhs) || definedInLoop.count(rhs)) return false;
+        if (rhs->getType() != OperandType::REG && rhs->getType() != OperandType::IMMEI32) return false;
+        shape.iv    = *std::find_if(phis.begin(), phis.end(), [&](PhiInst* phi) { return phi->res == lhs; });
+        shape.pred  = pred;
+        shape.bound = rhs;
+
+        Operand* next = incomingFrom(shape.iv, latchLabel);
+        if (next->getType() != OperandType::REG) return false;
+        auto* inc = dynamic_cast<ArithmeticInst*>(du.getDef(next->getRegNum()));
+        if (!inc || inc->dt != DataType::I32) return false;
+        auto immOf = [](Operand* op) { return static_cast<ImmeI32Operand*>(op)->value; };
+        if (inc->opcode == Operator::ADD && inc->lhs == lhs && inc->rhs->getType() == OperandType::IMMEI32)
+            shape.step = immOf(inc->rhs);
+        else if (inc->opcode == Operator::ADD && inc->rhs == lhs && inc->lhs->getType() == OperandType::IMMEI32)
+            shape.step = immOf(inc->lhs);
+        else if (inc->opcode == Operator::SUB && inc->lhs == lhs && inc->rhs->getType() == OperandType::IMMEI32 &&
+                 immOf(inc->rhs) != INT_MIN)
+            shape.step = -immOf(inc->rhs);
+        else
+            return false;
+        return shape.step != 0;
+    }
+
+    bool LoopUnrollPass::constantTripCount(const LoopShape& shape, size_t limit, size_t& trip)
+    {
+        Operand* init = nullptr;
+        for (auto& [label, val] : shape.iv->incomingVals)
+            if (static_cast<LabelOperand*>(label)->lnum == shape.preheader->blockId) init = val;
+        if (!init || init->getType() != OperandType::IMMEI32 || shape.bound->getType() != OperandType::IMMEI32)
+            return false;
+
+        // 按 32 位回绕的加法逐次模拟，与生成代码的行为一致
+        int iv    = static_cast<ImmeI32Operand*>(init)->value;
+        int bound = static_cast<ImmeI32Operand*>(shape.bound)->value;
+        for (trip = 0; compare(shape.pred, iv, bound); ++trip)
+        {
+            if (trip == limit) return false;
+            iv = (int)((unsigned)iv + (unsigned)shape.step);
+        }
+        return true;
+    }
+
+    std::pair<Block*, Block*> LoopUnrollPass::cloneBody(Function& function, const LoopShape& shape, size_t count,
+        Block* insertAfter, Block* next, std::vector<Operand*>& values)
+    {
+        OperandFactory& ops         = function.getOperandFactory();
+        Operand*        headerLabel = ops.getLabelOperand(shape.header->blockId);
+        Operand*        latchLabel  = ops.getLabelOperand(shape.latch->blockId);
+        auto            phis        = headerPhis(shape.header);
+        InstClone       cloner(function);
+
+        // 先建好全部副本块，第 k 份跳回循环头的边才能指向第 k + 1 份的入口。
+        // 循环体只有一个块时各份依次放进同一个块，省去相邻副本之间的跳转
+        bool                                            straight = shape.body.size() == 1;
+        std::vector<std::unordered_map<size_t, Block*>> copies(count);
+        Block*                                          pos = insertAfter;
+        for (auto& bmap : copies)
+        {
+            for (auto* block : shape.body)
+            {
+                if (straight && pos != insertAfter)
+                {
+                    bmap[block->blockId] = pos;
+                    continue;
+                }
+                Block* clone = function.createBlock();
+                clone->setComment(function.copyString(block->comment));
+                function.blocks.remove(clone);
+                function.blocks.insertAfter(pos, clone);
+                pos                   = clone;
+                bmap[block->blockId] = clone;
+            }
+        }
+
+        for (size_t k = 0; k < count; ++k)
+        {
+            std::unordered_map<Operand*, Operand*> vmap;
+            for (size_t i = 0; i < phis.size(); ++i) vmap[phis[i]->res] = values[i];
+            for (auto* block : shape.body)
+                for (auto* inst : block->insts)
+                    if (Operand* def = inst->getDefOperand(); def && def->getType() == OperandType::REG)
+                        vmap[def] = ops.getRegOperand(function.getNewRegId());
+
+            Operand*     nextLabel = ops.getLabelOperand(k + 1 < count ? copies[k + 1][shape.bodyEntry->blockId]->blockId
+                                                                        : next->blockId);
+            OperandMapFn map       = [&](Operand* op) -> Operand* {
+                if (!op) return nullptr;
+                if (op->getType() == OperandType::LABEL)
+                {
+                    if (op == headerLabel) return nextLabel;
+                    auto it = copies[k].find(static_cast<LabelOperand*>(op)->lnum);
+                    return it == copies[k].end() ? op : ops.getLabelOperand(it->second->blockId);
+                }
+                auto it = vmap.find(op);
+                return it == vmap.end() ? op : it->second;
+            };
+
+            for (auto* block : shape.body)
+            {
+                Block* clone = copies[k][block->blockId];
+                for (auto* inst : block->insts)
+                {
+                    if (inst->isTerminator() && straight && k + 1 < count) break;
+                    clone->insertBack(apply(cloner, *inst, map));
+                    if (inst->isTerminator()) break;
+                }
+            }
+            for (size_t i = 0; i < phis.size(); ++i) values[i] = map(incomingFrom(phis[i], latchLabel));
+        }
+        return {copies.front()[shape.bodyEntry->blockId], copies.back()[shape.latch->blockId]};
+    }
+
+    void LoopUnrollPass::fullyUnroll(Function& function, const LoopShape& shape, size_t trip)
+    {
+        OperandFactory& ops  = function.getOperandFactory();
+        auto            phis = headerPhis(shape.header);
+
+        std::vector<Operand*> values;
+        Operand*              preheaderLabel = ops.getLabelOperand(shape.preheader->blockId);
+        for (auto* phi : phis) values.push_back(incomingFrom(phi, preheaderLabel));
+
+        // 前置块依次经过 trip 份循环体回到循环头，循环头的 phi 只剩来自最后一份的值，随后直接跳到出口
+        Operand* lastLabel = preheaderLabel;
+        if (trip > 0)
+        {
+            auto [entry, last] = cloneBody(function, shape, trip, shape.preheader, shape.header, values);
+            auto* br           = static_cast<BrUncondInst*>(terminatorOf(shape.preheader));
+            br->target         = ops.getLabelOperand(entry->blockId);
+            lastLabel          = ops.getLabelOperand(last->blockId);
+        }
+        for (size_t i = 0; i < phis.size(); ++i)
+        {
+            phis[i]->incomingVals.clear();
+            phis[i]->addIncoming(values[i], lastLabel);
+        }
+
+        for (auto it = shape.header->insts.begin(); it != shape.header->insts.end();)
+        {
+            Instruction* inst = *it;
+            if (inst->opcode == Operator::PHI)
+            {
+                ++it;
+                continue;
+            }
+            it = shape.header->insts.erase(it);
+            function.destroy(inst);
+        }
+        shape.header->insertBack(function.create<BrUncondInst>(ops.getLabelOperand(shape.exit->blockId)));
+        for (auto* block : shape.body) destroyBlock(function, block);
+    }
+
+    void LoopUnrollPass::partiallyUnroll(Function& function, const LoopShape& shape, unsigned count)
+    {
+        OperandFactory& ops            = function.getOperandFactory();
+        auto            phis           = headerPhis(shape.header);
+        Operand*        preheaderLabel = ops.getLabelOperand(shape.preheader->blockId);
+        Operand*        headerLabel    = ops.getLabelOperand(shape.header->blockId);
+        Instruction*    term           = terminatorOf(shape.preheader);
+
+        // 主循环的边界：iv pred bound - (count - 1) * step 成立时，接下来的 count 次迭代都满足原条件。
+        // 边界是寄存器时在前置块中计算，并在平移溢出时直接进入原循环
+        int      offset = (count - 1) * shape.step;
+        Operand* bound  = nullptr;
+        Operand* guard  = nullptr;
+        if (shape.bound->getType() == OperandType::IMMEI32)
+            bound = ops.getImmeI32Operand(static_cast<ImmeI32Operand*>(shape.bound)->value - offset);
+        else
+        {
+            bound = ops.getRegOperand(function.getNewRegId());
+            guard = ops.getRegOperand(function.getNewRegId());
+            shape.preheader->insts.insertBefore(term, function.create<ArithmeticInst>(Operator::SUB, DataType::I32,
+                                                          shape.bound, ops.getImmeI32Operand(offset), bound));
+            shape.preheader->insts.insertBefore(term, function.create<IcmpInst>(DataType::I32,
+                                                          shape.step > 0 ? ICmpOp::SLE : ICmpOp::SGE, bound,
+                                                          shape.bound, guard));
+        }
+
+        // 主循环头：phi 从前置块取初值，从最后一份循环体取 count 次迭代后的值；条件不成立时进入原循环处理剩余迭代
+        Block* mainHeader = function.createBlock();
+        mainHeader->setComment("unroll.cond");
+        function.blocks.remove(mainHeader);
+        function.blocks.insertBefore(shape.header, mainHeader);
+        Operand* mainLabel = ops.getLabelOperand(mainHeader->blockId);
+
+        // 有溢出检查时前置块同时跳到两个循环，为主循环另建只跳到主循环头的前置块，保持循环的规范形式
+        Block*   entryBlock = shape.preheader;
+        Operand* entryLabel = preheaderLabel;
+        if (guard)
+        {
+            entryBlock = function.createBlock();
+            entryBlock->setComment("unroll.preheader");
+            function.blocks.remove(entryBlock);
+            function.blocks.insertBefore(mainHeader, entryBlock);
+            entryBlock->insertBack(function.create<BrUncondInst>(mainLabel));
+            entryLabel = ops.getLabelOperand(entryBlock->blockId);
+        }
+
+        std::vector<PhiInst*> mainPhis;
+        std::vector<Operand*> values;
+        Operand*              mainIv = nullptr;
+        for (auto* phi : phis)
+        {
+            Operand* res     = ops.getRegOperand(function.getNewRegId());
+            auto*    mainPhi = function.create<PhiInst>(phi->dt, res);
+            mainPhi->addIncoming(incomingFrom(phi, preheaderLabel), entryLabel);
+            mainHeader->insertBack(mainPhi);
+            mainPhis.push_back(mainPhi);
+            values.push_back(res);
+            if (phi == shape.iv) mainIv = res;
+        }
+        Operand* cond = ops.getRegOperand(function.getNewRegId());
+        mainHeader->insertBack(function.create<IcmpInst>(DataType::I32, shape.pred, mainIv, bound, cond));
+
+        auto [entry, last] = cloneBody(function, shape, count, mainHeader, mainHeader, values);
+        mainHeader->insertBack(function.create<BrCondInst>(cond, ops.getLabelOperand(entry->blockId), headerLabel));
+        Operand* lastLabel = ops.getLabelOperand(last->blockId);
+        for (size_t i = 0; i < phis.size(); ++i)
+        {
+            mainPhis[i]->addIncoming(values[i], lastLabel);
+            // 原循环从主循环头进入；没有溢出检查时前置块不再直接跳到原循环
+            if (!guard) phis[i]->incomingVals.erase(preheaderLabel);
+            phis[i]->addIncoming(mainPhis[i]->res, mainLabel);
+        }
+
+        shape.preheader->insts.remove(term);
+        function.destroy(term);
+        if (guard)
+            shape.preheader->insertBack(function.create<BrCondInst>(guard, entryLabel, headerLabel));
+        else
+            shape.preheader->insertBack(function.create<BrUncondInst>(mainLabel));
+    }
+}  // namespace ME
@@ -0,0 +1,72 @@
+#ifndef __MIDDLEEND_PASS_LOOP_UNROLL_H__
+#define __MIDDLEEND_PASS_LOOP_UNROLL_H__
+
+#include <interfaces/middleend/pass.h>
+#include <middleend/module/ir_function.h>
+#include <middleend/module/ir_instruction.h>
+#include <middleend/pass/analysis/cfg.h>
+#include <middleend/pass/analysis/loop_info.h>
+#include <cstddef>
+#include <vector>
+
+namespace ME
+{
+    // Loop Unrolling
+    // 只处理 mem2reg 之后形如 while 的最内层循环：循环头只含 phi、一条比较与条件跳转，比较的一侧是归纳变量 phi
+    // （每次迭代加上常量步长），另一侧是循环不变量，循环只从循环头退出。
+    // 初值、边界与步长都是常量且迭代次数很少时完全展开；否则按展开因子复制循环体，剩余的迭代交给原循环完成
+    class LoopUnrollPass : public FunctionPass
+    {
+      public:
+        static constexpr unsigned kDefaultFactor = 4;
+        static constexpr unsigned kMaxFactor     = 32;  // -funroll-factor= 允许的最大值
+        // 代价模型：完全展开后的指令数不超过 kFullUnrollBudget，部分展开后的循环体不超过 kPartialUnrollBudget，
+        // 展开过程中整个函数新增的指令数不超过 kMaxFunctionGrowth
+        static constexpr size_t kMaxFullUnrollTrip   = 32;
+        static constexpr size_t kFullUnrollBudget    = 256;
+        static constexpr size_t kPartialUnrollBudget = 128;
+        static constexpr size_t kMaxFunctionGrowth   = 2000;
+
+        explicit LoopUnrollPass(unsigned factor = kDefaultFactor) : factor(factor < 2 ? 1 : factor) {}
+        ~LoopUnrollPass() = default;
+
+        const char*       getName() const override { return "loop-unroll"; }
+        PreservedAnalyses runOnFunction(Function& function) override;
+
+      private:
+        unsigned factor;  // 部分展开时的复制份数，为 1 时只做完全展开
+
+        // 可展开循环的形状，在修改函数前对所有候选循环一次收集完
+        struct LoopShape
+        {
+            Block*              header;
+            Block*              preheader;
+            Block*              exit;
+            Block*              latch;
+            Block*              bodyEntry;  // 循环头条件成立时的跳转目标
+            std::vector<Block*> body;       // 除循环头外的循环块，按函数中的排列顺序
+            size_t              bodySize;   // 循环体的指令数，不含 phi
+
+            PhiInst*  iv;     // 归纳变量
+            ICmpOp    pred;   // 把 iv 换到左侧后的谓词，iv pred bound 成立时继续迭代
+            Operand*  bound;  // 循环不变的边界
+            int       step;   // 每次迭代 iv 的增量
+        };
+
+        // 识别循环形状与归纳变量，不满足条件时返回 false
+        static bool analyzeLoop(Function& function, Analysis::Loop* loop, Analysis::CFG* cfg, Analysis::LoopInfo* loops,
+            LoopShape& shape);
+        // 初值、边界与步长都是常量时模拟求迭代次数，超过 limit 次仍未退出时返回 false
+        static bool constantTripCount(const LoopShape& shape, size_t limit, size_t& trip);
+
+        // 把循环体复制 count 份首尾相连，放在 insertAfter 之后：第 k 份中循环头的 phi 取第 k 次迭代开始时的值，
+        // 跳回循环头的边改为跳到下一份，最后一份跳到 next；values 为第 0 份的取值，返回时更新为最后一份之后的值；返回第一份的入口块与最后一份的回边源块
+        static std::pair<Block*, Block*> cloneBody(Function& function, const LoopShape& shape, size_t count,
+            Block* insertAfter, Block* next, std::vector<Operand*>& values);
+
+        static void fullyUnroll(Function& function, const LoopShape& shape, size_t trip);
+        static void partiallyUnroll(Function& function, const LoopShape& shape, unsigned count);
+    };
+}  // namespace ME
+
+#endif  // __MIDDLEEND_PASS_LOOP_UNROLL_H__
@@ -3,7 +3,9 @@
 #include <middleend/pass/analysis/analysis_manager.h>
 #include <middleend/pass/analysis/cfg.h>
 #include <middleend/pass/analysis/dominfo.h>
+#include <middleend/pass/analysis/loop_info.h>
 #include <middleend/module/ir_operand.h>
+#include <stats.h>
 #include <unordered_map>
 #include <unordered_set>
 #include <queue>
@@ -32,112 +34,44 @@ namespace ME
     }
 
     // 获取指定数据类型的默认初始值操作数
-    static inline Operand* defaultValueFor(DataType ty)
+    static inline Operand* defaultValueFor(OperandFactory& ops, DataType ty)
     {
         switch (ty)
         {
-            case DataType::F32: return getImmeF32Operand(0.0f);
-            default: return getImmeI32Operand(0);
-        }
-    }
-
-    void Mem2RegPass::replaceRegUseInInst(Instruction* inst, size_t fromReg, Operand* toOp)
-    {
-        if (!inst || !toOp) return;
-
-        auto repl = [&](Operand*& slot) {
-            if (!slot) return;
-            size_t r = (size_t)-1;
-            if (isRegOperand(slot, r) && r == fromReg) slot = toOp;
-        };
-
-        // 注意：不要替换“定义”的 res 位置，仅替换“使用”的操作数
-        if (auto* I = dynamic_cast<LoadInst*>(inst))
-        {
-            // ptr 是 use，res 是 def
-            repl(I->ptr);
-        }
-        else if (auto* I = dynamic_cast<StoreInst*>(inst))
-        {
-            // val/ptr 全是 use
-            repl(I->val);
-            repl(I->ptr);
-        }
-        else if (auto* I = dynamic_cast<ArithmeticInst*>(inst))
-        {
-            // lhs/rhs 是 use，res 是 def
-            repl(I->lhs);
-            repl(I->rhs);
-        }
-        else if (auto* I = dynamic_cast<IcmpInst*>(inst))
-        {
-            repl(I->lhs);
-            repl(I->rhs);
-        }
-        else if (auto* I = dynamic_cast<FcmpInst*>(inst))
-        {
-            repl(I->lhs);
-            repl(I->rhs);
-        }
-        else if (auto* I = dynamic_cast<ZextInst*>(inst)) { repl(I->src); }
-        else if (auto* I = dynamic_cast<SI2FPInst*>(inst)) { repl(I->src); }
-        else if (auto* I = dynamic_cast<FP2SIInst*>(inst)) { repl(I->src); }
-        else if (auto* I = dynamic_cast<GEPInst*>(inst))
-        {
-            repl(I->basePtr);
-            for (auto*& idx : I->idxs) repl(idx);
-        }
-        else if (auto* I = dynamic_cast<BrCondInst*>(inst)) { repl(I->cond); }
-        else if (auto* I = dynamic_cast<BrUncondInst*>(inst)) { (void)I; }
-        else if (auto* I = dynamic_cast<CallInst*>(inst))
-        {
-            for (auto& p : I->args) repl(p.second);
-        }
-        else if (auto* I = dynamic_cast<PhiInst*>(inst))
-        {
-            // incoming 的 value 是 use，label 键不变
-            for (auto& kv : I->incomingVals) repl(kv.second);
-        }
-        else if (auto* I = dynamic_cast<RetInst*>(inst)) { repl(I->res); }
-        else
-        {
-            (void)inst;
-        }
-    }
-
-    void Mem2RegPass::replaceRegUsesInFunction(Function& func, size_t fromReg, Operand* toOp)
-    {
-        for (auto& [bid, block] : func.blocks)
-        {
-            for (auto* inst : block->insts) { replaceRegUseInInst(inst, fromReg, toOp); }
+            case DataType::F32: return ops.getImmeF32Operand(0.0f);
+            default: return ops.getImmeI32Operand(0);
         }
     }
 
     // Pass 入口
-    void Mem2RegPass::runOnModule(Module& module)
+    PreservedAnalyses Mem2RegPass::runOnFunction(Function& function)
     {
-        for (auto* fn : module.functions) runOnFunction(*fn);
+        if (!promoteInFunction(function)) return PreservedAnalyses::all();
+
+        // 只增删块内指令，控制流不变；phi 与删除的 load/store 已同步到 def-use 链
+        return PreservedAnalyses::none()
+            .preserve<Analysis::CFG>()
+            .preserve<Analysis::DomInfo>()
+            .preserve<Analysis::LoopInfo>()
+            .preserve<DefUseChain>();
     }
 
-    void Mem2RegPass::runOnFunction(Function& function) { promoteInFunction(function); }
-
     // 主流程
-    void Mem2RegPass::promoteInFunction(Function& func)
+    bool Mem2RegPass::promoteInFunction(Function& func)
     {
         auto* cfg = Analysis::AM.get<Analysis::CFG>(func);
         auto* dom = Analysis::AM.get<Analysis::DomInfo>(func);
 
         vector<VarInfo> vars; // 要提升的变量列表
-        collectPromotableAllocas(cfg, vars);
-        if (vars.empty()) return;
+        collectPromotableAllocas(func, cfg, vars);
+        if (vars.empty()) return false;
 
         insertPhi(func, cfg, dom, vars); // 插入phi节点
         renameAndCleanup(func, cfg, dom, vars); // 重命名并清理
-
-        Analysis::AM.invalidate(func);
+        return true;
     }
 
-    void Mem2RegPass::collectPromotableAllocas(Analysis::CFG* cfg, vector<VarInfo>& vars)
+    void Mem2RegPass::collectPromotableAllocas(Function& func, Analysis::CFG* cfg, vector<VarInfo>& vars)
     {
         auto it0 = cfg->id2block.find(0);
         if (it0 == cfg->id2block.end()) return;
@@ -154,83 +88,39 @@ namespace ME
         }
         if (candAllocas.empty()) return;
 
+        // 指令 -> 所在块，用于由 store 的使用记录得到定义块
+        unordered_map<Instruction*, size_t> instBlock;
+        for (auto& [bid, block] : cfg->id2block)
+        {
+            for (auto* inst : block->insts) instBlock[inst] = bid;
+        }
+
+        auto& du = func.getDefUse();
         for (auto* AI : candAllocas)
         {
             size_t ptrReg = 0;
             if (!isRegOperand(AI->res, ptrReg)) continue;
 
+            // 只要 alloca 的地址仅作为 load/store 的 ptr 使用即可提升
             bool     promotable = true;
             set<int> defBlocks;
-
-            for (auto& [bid, block] : cfg->id2block)
+            for (auto& use : du.getUses(ptrReg))
             {
-                for (auto* inst : block->insts)
+                if (auto* LI = dynamic_cast<LoadInst*>(use.user))
                 {
-                    if (auto* LI = dynamic_cast<LoadInst*>(inst))
-                    {
-                        if (isSameReg(LI->ptr, ptrReg)) { /* ok */ }
-                    }
-                    else if (auto* SI = dynamic_cast<StoreInst*>(inst))
-                    {
-                        if (isSameReg(SI->ptr, ptrReg)) { defBlocks.insert((int)bid); }
-                    }
-                    else if (auto* GI = dynamic_cast<GEPInst*>(inst))
-                    {
-                        if (isSameReg(GI->basePtr, ptrReg))
-                        {
-                            promotable = false;
-                            break;
-                        }
-                    }
-                    else if (auto* CI = dynamic_cast<CallInst*>(inst))
-                    {
-                        for (auto& p : CI->args)
-                        {
-                            if (isSameReg(p.second, ptrReg))
-                            {
-                                promotable = false;
-                                break;
-                            }
-                        }
-                        if (!promotable) break;
-                    }
-                    else
+                    if (use.slot == &LI->ptr) continue;
+                }
+                else if (auto* SI = dynamic_cast<StoreInst*>(use.user))
+                {
+                    if (use.slot == &SI->ptr)
                     {
-                        bool bad      = false;
-                        auto checkUse = [&](Operand* op) {
-                            size_t r = (size_t)-1;
-                            if (isRegOperand(op, r) && r == ptrReg) bad = true;
-                        };
-                        if (auto* A = dynamic_cast<ArithmeticInst*>(inst))
-                        {
-                            checkUse(A->lhs);
-                            checkUse(A->rhs);
-                        }
-                        else if (auto* IC = dynamic_cast<IcmpInst*>(inst))
-                        {
-                            checkUse(IC->lhs);
-                            checkUse(IC->rhs);
-                        }
-                        else if (auto* FC = dynamic_cast<FcmpInst*>(inst))
-                        {
-                            checkUse(FC->lhs);
-                            checkUse(FC->rhs);
-                        }
-                        else if (auto* Z = dynamic_cast<ZextInst*>(inst)) { checkUse(Z->src); }
-                        else if (auto* C1 = dynamic_cast<SI2FPInst*>(inst)) { checkUse(C1->src); }
-                        else if (auto* C2 = dynamic_cast<FP2SIInst*>(inst)) { checkUse(C2->src); }
-                        else if (auto* PH = dynamic_cast<PhiInst*>(inst))
-                        {
-                            for (auto& kv : PH->incomingVals) checkUse(kv.second);
-                        }
-                        if (bad)
-                        {
-                            promotable = false;
-                            break;
-                        }
+                        auto itB = instBlock.find(SI);
+                        if (itB != instBlock.end()) defBlocks.insert((int)itB->second);
+                        continue;
                     }
                 }
-                if (!promotable) break;
+                promotable = false;
+                break;
             }
 
             if (promotable && !defBlocks.empty())
@@ -283,14 +173,16 @@ namespace ME
                     Block* B = itBlock->second;
 
                     size_t   newReg = func.getNewRegId();
-                    Operand* resOp  = getRegOperand(newReg);
+                    Operand* resOp  = func.getOperandFactory().getRegOperand(newReg);
 
-                    auto* phi = new PhiInst(var.ty, resOp);
+                    auto* phi = func.create<PhiInst>(var.ty, resOp);
                     // 将phi放在块首
                     B->insts.push_front(phi);
+                    func.getDefUse().addInst(phi);
 
                     var.phiAtBlock[y] = phi;
                     hasPhi.insert(y);
+                    Stats::bump("phis inserted");
 
                     if (!var.defBlocks.count(y) && !inWork.count(y))
                     {
@@ -308,17 +200,24 @@ namespace ME
         unordered_map<size_t, vector<Operand*>> stacks;
         stacks.reserve(vars.size());
 
+        auto&                 du  = func.getDefUse();
+        OperandFactory&       ops = func.getOperandFactory();
+        unordered_set<size_t> promotedPtrRegs;
+        for (auto& v : vars) promotedPtrRegs.insert(v.ptrReg);
+
         struct ToRemove
         {
             vector<LoadInst*>   loads;
             vector<StoreInst*>  stores;
             vector<AllocaInst*> allocas;
+
+            vector<pair<Block*, Instruction*>> sites;  // 待删指令及其所在块
         } garbage;
 
         // 为每个变量的版本栈预置一个“默认值”，保证所有路径上都有可用值
         for (auto& var : vars)
         {
-            Operand* def = defaultValueFor(var.ty);
+            Operand* def = defaultValueFor(ops, var.ty);
             if (def) stacks[var.ptrReg].push_back(def);
         }
 
@@ -373,44 +272,26 @@ namespace ME
                 {
                     size_t ptrR = (size_t)-1;
                     if (!isRegOperand(SI->ptr, ptrR)) continue;
-
-                    bool isPromoted = false;
-                    for (auto& var : vars)
-                    {
-                        if (var.ptrReg == ptrR)
-                        {
-                            isPromoted = true;
-                            break;
-                        }
-                    }
-                    if (!isPromoted) continue;
+                    if (!promotedPtrRegs.count(ptrR)) continue;
 
                     pushVal(ptrR, SI->val);
                     pushedStoreCnt[ptrR]++;
                     garbage.stores.push_back(SI);
+                    garbage.sites.emplace_back(B, SI);
                 }
                 else if (auto* LI = dynamic_cast<LoadInst*>(inst))
                 {
                     size_t ptrR = (size_t)-1;
                     if (!isRegOperand(LI->ptr, ptrR)) continue;
-
-                    bool isPromoted = false;
-                    for (auto& var : vars)
-                    {
-                        if (var.ptrReg == ptrR)
-                        {
-                            isPromoted = true;
-                            break;
-                        }
-                    }
-                    if (!isPromoted) continue;
+                    if (!promotedPtrRegs.count(ptrR)) continue;
 
                     Operand* cur = getTop(ptrR);
                     if (cur)
                     {
                         size_t defReg = 0;
-                        if (isRegOperand(LI->res, defReg)) { replaceRegUsesInFunction(func, defReg, cur); }
+                        if (isRegOperand(LI->res, defReg)) { func.replaceAllUsesWith(LI->res, cur); }
                         garbage.loads.push_back(LI);
+                        garbage.sites.emplace_back(B, LI);
                     }
                 }
             }
@@ -422,15 +303,25 @@ namespace ME
                     auto itBPhi = blockPhi.find((int)succ);
                     if (itBPhi == blockPhi.end()) continue;
 
-                    Operand* predLabel = getLabelOperand((size_t)bid);
+                    Operand* predLabel = ops.getLabelOperand((size_t)bid);
 
                     for (auto& kv : itBPhi->second)
                     {
                         size_t   varPtr = kv.first;
                         PhiInst* PHI    = kv.second;
                         Operand* val    = getTop(varPtr);
-                        if (!val) val = defaultValueFor(PHI->dt);
+                        if (!val) val = defaultValueFor(ops, PHI->dt);
+                        // 已有该前驱的 incoming 时先注销旧值的使用，避免 def-use 链中残留过期记录
+                        auto it = PHI->incomingVals.find(predLabel);
+                        if (it != PHI->incomingVals.end())
+                        {
+                            du.removeUse(PHI, &it->second);
+                            it->second = val;
+                            du.addUse(PHI, &it->second);
+                            continue;
+                        }
                         PHI->addIncoming(val, predLabel);
+                        du.addUse(PHI, &PHI->incomingVals[predLabel]);
                     }
                 }
             }
@@ -451,95 +342,34 @@ namespace ME
         dead.insert(garbage.loads.begin(), garbage.loads.end());
         dead.insert(garbage.stores.begin(), garbage.stores.end());
 
-        for (auto& [bid, block] : cfg->id2block)
-        {
-            deque<Instruction*> rebuilt;
-            rebuilt.resize(0);
-            for (auto* inst : block->insts)
-            {
-                if (dead.count(inst)) continue;
-                rebuilt.push_back(inst);
-            }
-            block->insts.swap(rebuilt);
-        }
+        du.removeInsts(dead);
 
+        // 被提升的 alloca 若已没有任何使用，也一并删除
         auto it0 = cfg->id2block.find(0);
         if (it0 != cfg->id2block.end())
         {
-            Block*                entry = it0->second;
-            unordered_set<size_t> promotedPtrRegs;
-            for (auto& v : vars) promotedPtrRegs.insert(v.ptrReg);
-
-            deque<Instruction*> rebuilt;
-            for (auto* inst : entry->insts)
+            for (auto* inst : it0->second->insts)
             {
-                if (auto* AI = dynamic_cast<AllocaInst*>(inst))
-                {
-                    size_t pr = (size_t)-1;
-                    if (isRegOperand(AI->res, pr) && promotedPtrRegs.count(pr))
-                    {
-                        bool stillUsed = false;
-                        for (auto& [bbid, block] : cfg->id2block)
-                        {
-                            for (auto* I : block->insts)
-                            {
-                                size_t tmp = (size_t)-1;
-                                if (auto* L = dynamic_cast<LoadInst*>(I))
-                                {
-                                    if (isRegOperand(L->ptr, tmp) && tmp == pr)
-                                    {
-                                        stillUsed = true;
-                                        break;
-                                    }
-                                }
-                                else if (auto* S = dynamic_cast<StoreInst*>(I))
-                                {
-                                    if (isRegOperand(S->ptr, tmp) && tmp == pr)
-                                    {
-                                        stillUsed = true;
-                                        break;
-                                    }
-                                }
-                                else if (auto* G = dynamic_cast<GEPInst*>(I))
-                                {
-                                    if (isRegOperand(G->basePtr, tmp) && tmp == pr)
-                                    {
-                                        stillUsed = true;
-                                        break;
-                                    }
-                                }
-                                else if (auto* C = dynamic_cast<CallInst*>(I))
-                                {
-                                    for (auto& p : C->args)
-                                    {
-                                        if (isRegOperand(p.second, tmp) && tmp == pr)
-                                        {
-                                            stillUsed = true;
-                                            break;
-                                        }
-                                    }
-                                }
-                                else if (auto* P = dynamic_cast<PhiInst*>(I))
-                                {
-                                    for (auto& kv : P->incomingVals)
-                                    {
-                                        if (isRegOperand(kv.second, tmp) && tmp == pr)
-                                        {
-                                            stillUsed = true;
-                                            break;
-                                        }
-                                    }
-                                }
-                                if (stillUsed) break;
-                            }
-                            if (stillUsed) break;
-                        }
-                        if (!stillUsed) { continue; }
-                    }
-                }
-                rebuilt.push_back(inst);
+                auto*  AI = dynamic_cast<AllocaInst*>(inst);
+                size_t pr = (size_t)-1;
+                if (!AI || !isRegOperand(AI->res, pr) || !promotedPtrRegs.count(pr)) continue;
+                if (du.hasUses(pr)) continue;
+                garbage.allocas.push_back(AI);
+                garbage.sites.emplace_back(it0->second, AI);
             }
-            entry->insts.swap(rebuilt);
+            du.removeInsts({garbage.allocas.begin(), garbage.allocas.end()});
+            dead.insert(garbage.allocas.begin(), garbage.allocas.end());
+        }
+
+        Stats::bump("loads promoted", garbage.loads.size());
+        Stats::bump("stores removed", garbage.stores.size());
+        Stats::bump("allocas promoted", garbage.allocas.size());
+
+        // 直接从所在块的链表中摘除，无需重建各块的指令序列
+        for (auto& [block, inst] : garbage.sites)
+        {
+            block->insts.remove(inst);
+            func.destroy(inst);
         }
     }
 
@@ -19,14 +19,14 @@
 namespace ME
 {
     // 将基于栈的 Alloca + Load/Store 提升为 SSA
-    class Mem2RegPass : public ModulePass
+    class Mem2RegPass : public FunctionPass
     {
       public:
         Mem2RegPass()  = default;
         ~Mem2RegPass() = default;
 
-        void runOnModule(Module& module) override;
-        void runOnFunction(Function& function) override;
+        const char*       getName() const override { return "mem2reg"; }
+        PreservedAnalyses runOnFunction(Function& function) override;
 
       private:
         struct VarInfo
@@ -39,11 +39,11 @@ namespace ME
             std::unordered_map<int, PhiInst*> phiAtBlock;
         };
 
-        // 入口：对单个函数做 mem2reg
-        void promoteInFunction(Function& func);
+        // 入口：对单个函数做 mem2reg，返回是否提升了变量
+        bool promoteInFunction(Function& func);
 
         // 收集入口块中的可提升 Alloca，并检查其使用是否只在 load/store
-        void collectPromotableAllocas(Analysis::CFG* cfg, std::vector<VarInfo>& vars);
+        void collectPromotableAllocas(Function& func, Analysis::CFG* cfg, std::vector<VarInfo>& vars);
 
         // 基于支配前沿插入 phi，为每个变量填充 VarInfo::phiAtBlock
         void insertPhi(Function& func, Analysis::CFG* cfg, Analysis::DomInfo* dom, std::vector<VarInfo>& vars);
@@ -51,12 +51,6 @@ namespace ME
         // 沿支配树做重命名，删除 load/store，补充 phi incoming
         void renameAndCleanup(Function& func, Analysis::CFG* cfg, Analysis::DomInfo* dom, std::vector<VarInfo>& vars);
 
-        // 工具：在全函数内将 fromReg 的使用替换为 toOp（不替换定义位）
-        void replaceRegUsesInFunction(Function& func, size_t fromReg, Operand* toOp);
-
-        // 工具：对单条指令进行寄存器操作数替换
-        static void replaceRegUseInInst(Instruction* inst, size_t fromReg, Operand* toOp);
-
         // 小工具
         static bool isRegOperand(Operand* op, size_t& outReg);
         static bool isSameReg(Operand* op, size_t reg);
@@ -0,0 +1,185 @@
+#include <middleend/pass/pass_manager.h>
+#include <middleend/pass/eli_unreachable_bb.h>
+#include <middleend/pass/unify_return.h>
+#include <middleend/pass/basic_mem2reg.h>
+#include <middleend/pass/mem2reg.h>
+#include <middleend/pass/sccp.h>
+#include <middleend/pass/cse.h>
+#include <middleend/pass/gvn.h>
+#include <middleend/pass/adce.h>
+#include <middleend/pass/licm.h>
+#include <middleend/pass/inliner.h>
+#include <middleend/pass/loop_unroll.h>
+#include <middleend/pass/iv_strength_reduce.h>
+#include <cctype>
+#include <map>
+
+namespace ME
+{
+    static std::map<std::string, std::function<Pass*()>>& factories()
+    {
+        static std::map<std::string, std::function<Pass*()>> f = {
+            {"eli-unreachable-bb", [] { return new EliminateUnreachableBBPass(); }},
+            {"unify-return", [] { return new UnifyReturnPass(); }},
+            {"basic-mem2reg", [] { return new BasicMem2RegPass(); }},
+            {"mem2reg", [] { return new Mem2RegPass(); }},
+            {"sccp", [] { return new SCCPPass(); }},
+            {"cse", [] { return new CSEPass(); }},
+            {"gvn", [] { return new GVNPass(); }},
+            {"adce", [] { return new ADCEPass(); }},
+            {"licm", [] { return new LICMPass(); }},
+            {"inline", [] { return new InlinePass(); }},
+            {"loop-unroll", [] { return new LoopUnrollPass(); }},
+            {"iv-sr", [] { return new IVStrengthReducePass(); }},
+        };
+        return f;
+    }
+
+    std::unique_ptr<Pass> PassRegistry::createPass(const std::string& name)
+    {
+        auto it = factories().find(name);
+        if (it == factories().end()) return nullptr;
+        return std::unique_ptr<Pass>(it->second());
+    }
+
+    std::vector<std::string> PassRegistry::listPasses()
+    {
+        std::vector<std::string> keys;
+        keys.reserve(factories().size());
+        for (auto& [k, _] : factories()) keys.push_back(k);
+        return keys;
+    }
+
+    void PassRegistry::registerPassFactory(const std::string& name, std::function<Pass*()> factory)
+    {
+        factories()[name] = std::move(factory);
+    }
+
+    std::string PassManager::defaultPipeline(int optimizeLevel)
+    {
+        // -O3 目前没有单独的流水线，显式按 -O2 处理
+        if (optimizeLevel >= 3) optimizeLevel = 2;
+        if (optimizeLevel <= 0) return "";
+        if (optimizeLevel == 1) return "eli-unreachable-bb,unify-return,basic-mem2reg,sccp,gvn,adce,mem2reg";
+        // O2 及以上：完整 mem2reg 并初步化简后内联，再在 SSA 上反复做常量传播、公共子表达式消除、死代码消除与循环不变量外提，
+        // 最后展开最内层循环，把循环中的数组寻址与乘法改写为归纳变量，并清理展开后的副本
+        return "eli-unreachable-bb,unify-return,mem2reg,sccp,adce,inline,fixpoint(sccp,gvn,adce,licm),loop-unroll,"
+               "iv-sr,fixpoint(sccp,gvn,adce)";
+    }
+
+    bool PassManager::parse(const std::string& pipeline, std::string& err)
+    {
+        size_t pos = 0;
+        return parseList(pipeline, pos, nodes, false, err);
+    }
+
+    bool PassManager::parseList(
+        const std::string& text, size_t& pos, std::vector<Node>& out, bool nested, std::string& err)
+    {
+        auto skipSpace = [&]() {
+            while (pos < text.size() && std::isspace((unsigned char)text[pos])) ++pos;
+        };
+
+        while (true)
+        {
+            skipSpace();
+            size_t begin = pos;
+            while (pos < text.size() && (std::isalnum((unsigned char)text[pos]) || text[pos] == '-' || text[pos] == '_'))
+                ++pos;
+            std::string name = text.substr(begin, pos - begin);
+            skipSpace();
+
+            if (name.empty())
+            {
+                err = "expected pass name at offset " + std::to_string(begin);
+                return false;
+            }
+
+            Node node;
+            if (name == "fixpoint" && pos < text.size() && text[pos] == '(')
+            {
+                ++pos;
+                if (!parseList(text, pos, node.group, true, err)) return false;
+                ++pos;  // ')'
+                skipSpace();
+            }
+            else
+            {
+                node.pass = PassRegistry::createPass(name);
+                if (!node.pass)
+                {
+                    err = "unknown pass '" + name + "' (available:";
+                    for (auto& p : PassRegistry::listPasses()) err += " " + p;
+                    err += ")";
+                    return false;
+                }
+            }
+            out.push_back(std::move(node));
+
+            if (pos < text.size() && text[pos] == ',')
+            {
+                ++pos;
+                continue;
+            }
+            if (nested && pos < text.size() && text[pos] == ')') return true;
+            if (!nested && pos == text.size()) return true;
+
+            err = nested ? "missing ')' in fixpoint group" : "unexpected '" + std::string(1, text[pos]) + "' at offset " +
+                                                                 std::to_string(pos);
+            return false;
+        }
+    }
+
+    std::vector<std::string> PassManager::dropModulePasses(std::vector<Node>& list)
+    {
+        std::vector<std::string> dropped;
+        size_t                   out = 0;
+        for (size_t i = 0; i < list.size(); ++i)
+        {
+            Node& node = list[i];
+            bool  keep;
+            if (node.pass)
+            {
+                keep = dynamic_cast<ModulePass*>(node.pass.get()) == nullptr;
+                if (!keep) dropped.push_back(node.pass->getName());
+            }
+            else
+            {
+                auto inner = dropModulePasses(node.group);
+                dropped.insert(dropped.end(), inner.begin(), inner.end());
+                keep = !node.group.empty();
+            }
+            if (!keep) continue;
+            if (out != i) list[out] = std::move(node);
+            ++out;
+        }
+        list.erase(list.begin() + out, list.end());
+        return dropped;
+    }
+
+    bool PassManager::run(Module& module, const Stats::SizeProbe& probe) { return runNodes(nodes, module, probe); }
+
+    bool PassManager::runNodes(std::vector<Node>& list, Module& module, const Stats::SizeProbe& probe)
+    {
+        bool changed = false;
+        for (auto& node : list)
+        {
+            if (node.pass)
+            {
+                Stats::Scope scope(node.pass->getName(), probe);
+                auto*        fp = pool ? dynamic_cast<FunctionPass*>(node.pass.get()) : nullptr;
+                changed |= fp ? fp->runOnModule(module, *pool) : node.pass->runOnModule(module);
+                continue;
+            }
+
+            Stats::Scope scope("fixpoint", probe);
+            for (int iter = 0; iter < kMaxFixpointIters; ++iter)
+            {
+                Stats::bump("iterations");
+                if (!runNodes(node.group, module, probe)) break;
+                changed = true;
+            }
+        }
+        return changed;
+    }
+}  // namespace ME
@@ -0,0 +1,68 @@
+#ifndef __MIDDLEEND_PASS_PASS_MANAGER_H__
+#define __MIDDLEEND_PASS_PASS_MANAGER_H__
+
+#include <interfaces/middleend/pass.h>
+#include <stats.h>
+#include <thread_pool.h>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace ME
+{
+    class PassRegistry
+    {
+      public:
+        // 按名字创建 pass，未注册的名字返回 nullptr
+        static std::unique_ptr<Pass> createPass(const std::string& name);
+        static std::vector<std::string> listPasses();
+
+        static void registerPassFactory(const std::string& name, std::function<Pass*()> factory);
+    };
+
+    /*
+     * 文本描述的 pass 流水线
+     * - 语法：pass 名以逗号分隔，如 "sccp,cse,adce"
+     * - fixpoint(a,b,...) 为一个重复组：反复运行组内 pass，直到一轮中没有 pass 修改 IR（最多 kMaxFixpointIters 轮）
+     * - 各 -O 等级对应的流水线由 defaultPipeline 给出，-O3 目前是 -O2 的别名
+     * - 设置了线程池时，FunctionPass 在线程池上按函数并行运行；pass 之间仍按顺序执行
+     */
+    class PassManager
+    {
+      public:
+        static constexpr int kMaxFixpointIters = 8;
+
+        // 解析流水线文本并追加到当前流水线；失败时返回 false，原因写入 err
+        bool parse(const std::string& pipeline, std::string& err);
+
+        // 依次运行各 pass，返回 IR 是否被修改；每个 pass 单独计时，probe 用于记录前后的 IR 规模
+        bool run(Module& module, const Stats::SizeProbe& probe = nullptr);
+
+        // 流式编译逐个函数运行流水线，需要同时看到全部函数的 ModulePass（如 inline）无法参与：
+        // 从流水线中删去它们（删空的 fixpoint 组一并删去），返回被删去的 pass 名
+        std::vector<std::string> dropModulePasses() { return dropModulePasses(nodes); }
+
+        // 线程池由调用者持有，为空表示串行
+        void setThreadPool(ThreadPool* threadPool) { pool = threadPool; }
+
+        static std::string defaultPipeline(int optimizeLevel);
+
+      private:
+        struct Node
+        {
+            std::unique_ptr<Pass> pass;   // 单个 pass
+            std::vector<Node>     group;  // pass 为空时表示 fixpoint 组
+        };
+
+        std::vector<Node> nodes;
+        ThreadPool*       pool = nullptr;
+
+        static bool parseList(const std::string& text, size_t& pos, std::vector<Node>& out, bool nested,
+            std::string& err);
+        bool        runNodes(std::vector<Node>& list, Module& module, const Stats::SizeProbe& probe);
+        static std::vector<std::string> dropModulePasses(std::vector<Node>& list);
+    };
+}  // namespace ME
+
+#endif  // __MIDDLEEND_PASS_PASS_MANAGER_H__
@@ -4,364 +4,480 @@
 #include <middleend/module/ir_block.h>
 #include <middleend/module/ir_instruction.h>
 #include <middleend/module/ir_operand.h>
+#include <middleend/module/ir_def_use.h>
+#include <middleend/pass/analysis/analysis_manager.h>
+#include <middleend/pass/analysis/cfg.h>
+#include <middleend/pass/analysis/dominfo.h>
+#include <middleend/pass/analysis/loop_info.h>
+#include <stats.h>
 
-#include <vector>
-#include <queue>
+#include <climits>
+#include <cmath>
+#include <cstring>
 #include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 namespace ME
 {
     using LV = SCCPPass::LatticeVal;
     using ValState = SCCPPass::ValState;
 
-    void SCCPPass::runOnModule(Module& module)
+    namespace
     {
-        for (auto* func : module.functions)
-            runOnFunction(*func);
-    }
+        LV constI32(int v)
+        {
+            LV lv;
+            lv.state = ValState::ConstI32;
+            lv.i32   = v;
+            return lv;
+        }
 
-    // 简化的 SCCP：基于迭代的格传播 + 把最终常量替换成立即数
-    void SCCPPass::runOnFunction(Function& function)
-    {
-        std::unordered_map<size_t, LV> lattice; // regNum -> lattice
-        bool changed = true;
+        LV constF32(float v)
+        {
+            LV lv;
+            lv.state = ValState::ConstF32;
+            lv.f32   = v;
+            return lv;
+        }
 
-        // 初始化：所有定义的寄存器为 Unknown
-        for (auto& [bid, block] : function.blocks)
+        LV overdefined()
+        {
+            LV lv;
+            lv.state = ValState::Overdefined;
+            return lv;
+        }
+
+        // 按位比较：0.0 与 -0.0 是不同的常量，NaN 与自身相同
+        bool sameBits(float a, float b) { return std::memcmp(&a, &b, sizeof(float)) == 0; }
+
+        // 块中的第一条终结指令，与 CFG 的取法一致
+        Instruction* terminatorOf(Block* block)
         {
             for (auto* inst : block->insts)
+                if (inst->isTerminator()) return inst;
+            return nullptr;
+        }
+
+        size_t labelId(Operand* label) { return static_cast<LabelOperand*>(label)->lnum; }
+
+        // 与运行时结果一致的 i32 运算；除零、溢出的除法与越界移位不折叠
+        bool foldI32(Operator op, int a, int b, int& out)
+        {
+            unsigned ua = static_cast<unsigned>(a), ub = static_cast<unsigned>(b);
+            switch (op)
             {
-                Operand* def = nullptr;
-                switch (inst->opcode)
-                {
-                    case Operator::LOAD: def = static_cast<LoadInst*>(inst)->res; break;
-                    case Operator::ADD: case Operator::SUB: case Operator::MUL: case Operator::DIV:
-                    case Operator::FADD: case Operator::FSUB: case Operator::FMUL: case Operator::FDIV:
-                    case Operator::MOD: case Operator::BITXOR: case Operator::BITAND:
-                    case Operator::SHL: case Operator::ASHR: case Operator::LSHR:
-                        def = static_cast<ArithmeticInst*>(inst)->res; break;
-                    case Operator::ICMP: case Operator::FCMP:
-                        def = static_cast<IcmpInst*>(inst)->res; break;
-                    case Operator::PHI:
-                        def = static_cast<PhiInst*>(inst)->res; break;
-                    case Operator::CALL:
-                        def = static_cast<CallInst*>(inst)->res; break;
-                    case Operator::GETELEMENTPTR:
-                        def = static_cast<GEPInst*>(inst)->res; break;
-                    case Operator::SITOFP:
-                        def = static_cast<SI2FPInst*>(inst)->dest; break;
-                    case Operator::FPTOSI:
-                        def = static_cast<FP2SIInst*>(inst)->dest; break;
-                    case Operator::ZEXT:
-                        def = static_cast<ZextInst*>(inst)->dest; break;
-                    default:
-                        break;
-                }
+                case Operator::ADD: out = static_cast<int>(ua + ub); return true;
+                case Operator::SUB: out = static_cast<int>(ua - ub); return true;
+                case Operator::MUL: out = static_cast<int>(ua * ub); return true;
+                case Operator::DIV:
+                    if (b == 0 || (a == INT_MIN && b == -1)) return false;
+                    out = a / b;
+                    return true;
+                case Operator::MOD:
+                    if (b == 0 || (a == INT_MIN && b == -1)) return false;
+                    out = a % b;
+                    return true;
+                case Operator::BITXOR: out = a ^ b; return true;
+                case Operator::BITAND: out = a & b; return true;
+                case Operator::SHL:
+                    if (b < 0 || b > 31) return false;
+                    out = static_cast<int>(ua << b);
+                    return true;
+                case Operator::ASHR:
+                    if (b < 0 || b > 31) return false;
+                    out = a >> b;
+                    return true;
+                case Operator::LSHR:
+                    if (b < 0 || b > 31) return false;
+                    out = static_cast<int>(ua >> b);
+                    return true;
+                default: return false;
+            }
+        }
 
-                if (def && def->getType() == OperandType::REG)
-                {
-                    lattice[def->getRegNum()] = LV();
-                }
+        bool foldICmp(ICmpOp cond, int a, int b)
+        {
+            unsigned ua = static_cast<unsigned>(a), ub = static_cast<unsigned>(b);
+            switch (cond)
+            {
+                case ICmpOp::EQ: return a == b;
+                case ICmpOp::NE: return a != b;
+                case ICmpOp::UGT: return ua > ub;
+                case ICmpOp::UGE: return ua >= ub;
+                case ICmpOp::ULT: return ua < ub;
+                case ICmpOp::ULE: return ua <= ub;
+                case ICmpOp::SGT: return a > b;
+                case ICmpOp::SGE: return a >= b;
+                case ICmpOp::SLT: return a < b;
+                case ICmpOp::SLE: return a <= b;
+            }
+            return false;
+        }
+
+        bool foldFCmp(FCmpOp cond, float a, float b)
+        {
+            bool unordered = std::isnan(a) || std::isnan(b);
+            switch (cond)
+            {
+                case FCmpOp::OEQ: return !unordered && a == b;
+                case FCmpOp::OGT: return !unordered && a > b;
+                case FCmpOp::OGE: return !unordered && a >= b;
+                case FCmpOp::OLT: return !unordered && a < b;
+                case FCmpOp::OLE: return !unordered && a <= b;
+                case FCmpOp::ONE: return !unordered && a != b;
+                case FCmpOp::ORD: return !unordered;
+                case FCmpOp::UEQ: return unordered || a == b;
+                case FCmpOp::UGT: return unordered || a > b;
+                case FCmpOp::UGE: return unordered || a >= b;
+                case FCmpOp::ULT: return unordered || a < b;
+                case FCmpOp::ULE: return unordered || a <= b;
+                case FCmpOp::UNE: return unordered || a != b;
+                case FCmpOp::UNO: return unordered;
             }
+            return false;
         }
+    }  // namespace
 
-        // 迭代传播直到不再变化
-        while (changed)
+    PreservedAnalyses SCCPPass::runOnFunction(Function& function)
+    {
+        auto* cfg = Analysis::AM.get<Analysis::CFG>(function);
+        auto& du  = function.getDefUse();
+        auto& ops = function.getOperandFactory();
+        if (cfg->id2block.find(0) == cfg->id2block.end()) return PreservedAnalyses::all();
+
+        // 没有定义的寄存器（形参）始终为 Overdefined，其余寄存器从 Unknown 开始
+        size_t                                   numBlocks = cfg->G_id.size();
+        size_t                                   maxReg    = function.getMaxReg();
+        std::unordered_map<Instruction*, size_t> blockOf;
+        for (auto* block : function.blocks)
         {
-            changed = false;
+            for (auto* inst : block->insts)
+            {
+                blockOf[inst] = block->blockId;
+                if (Operand* def = inst->getDefOperand(); def && def->getType() == OperandType::REG)
+                    maxReg = std::max(maxReg, def->getRegNum());
+            }
+        }
+        std::vector<LV> lattice(maxReg + 1, overdefined());
+        for (auto& [inst, b] : blockOf)
+            if (Operand* def = inst->getDefOperand(); def && def->getType() == OperandType::REG)
+                lattice[def->getRegNum()] = LV();
+
+        std::vector<char>                      executable(numBlocks, 0);
+        std::unordered_set<size_t>             executableEdges;  // from * numBlocks + to
+        std::vector<std::pair<size_t, size_t>> cfgWork;
+        std::vector<size_t>                    ssaWork;
+
+        auto isEdgeExecutable = [&](size_t from, size_t to) {
+            return from < numBlocks && to < numBlocks && executableEdges.count(from * numBlocks + to);
+        };
+        auto markEdge = [&](size_t from, size_t to) {
+            if (to < numBlocks && executableEdges.insert(from * numBlocks + to).second) cfgWork.emplace_back(from, to);
+        };
+        auto update = [&](Operand* def, const LV& v) {
+            if (!def || def->getType() != OperandType::REG) return;
+            if (meet(lattice[def->getRegNum()], v)) ssaWork.push_back(def->getRegNum());
+        };
+
+        auto visit = [&](Instruction* inst, size_t b) {
+            switch (inst->opcode)
+            {
+                case Operator::PHI: {
+                    // 只合并来自可执行边的 incoming
+                    auto* phi = static_cast<PhiInst*>(inst);
+                    LV    v;
+                    for (auto& [label, val] : phi->incomingVals)
+                        if (isEdgeExecutable(labelId(label), b)) meet(v, valueOf(val, lattice));
+                    update(phi->res, v);
+                    break;
+                }
+                case Operator::BR_COND: {
+                    auto* br   = static_cast<BrCondInst*>(inst);
+                    LV    cond = valueOf(br->cond, lattice);
+                    if (cond.state == ValState::ConstI32)
+                        markEdge(b, labelId(cond.i32 ? br->trueTar : br->falseTar));
+                    else if (cond.state != ValState::Unknown)
+                    {
+                        markEdge(b, labelId(br->trueTar));
+                        markEdge(b, labelId(br->falseTar));
+                    }
+                    break;
+                }
+                case Operator::BR_UNCOND: markEdge(b, labelId(static_cast<BrUncondInst*>(inst)->target)); break;
+                default: update(inst->getDefOperand(), evaluate(inst, lattice)); break;
+            }
+        };
 
-            for (auto& [bid, block] : function.blocks)
+        auto solve = [&]() {
+            while (!cfgWork.empty() || !ssaWork.empty())
             {
-                for (auto* inst : block->insts)
+                while (!cfgWork.empty())
                 {
-                    LV out;
-                    if (!evaluateInstructionConst(inst, out))
+                    size_t to = cfgWork.back().second;
+                    cfgWork.pop_back();
+                    Block* block = cfg->id2block[to];
+                    if (!executable[to])
                     {
-                        // 无法得到常量，若定义寄存器则设置为 Overdefined
-                        Operand* def = nullptr;
-                        switch (inst->opcode)
-                        {
-                            case Operator::LOAD:
-                                def = static_cast<LoadInst*>(inst)->res; break;
-                            case Operator::ADD: case Operator::SUB: case Operator::MUL: case Operator::DIV:
-                            case Operator::FADD: case Operator::FSUB: case Operator::FMUL: case Operator::FDIV:
-                            case Operator::MOD: case Operator::BITXOR: case Operator::BITAND:
-                            case Operator::SHL: case Operator::ASHR: case Operator::LSHR:
-                                def = static_cast<ArithmeticInst*>(inst)->res; break;
-                            case Operator::ICMP: case Operator::FCMP:
-                                def = static_cast<IcmpInst*>(inst)->res; break;
-                            case Operator::PHI:
-                                def = static_cast<PhiInst*>(inst)->res; break;
-                            case Operator::CALL:
-                                def = static_cast<CallInst*>(inst)->res; break;
-                            case Operator::GETELEMENTPTR:
-                                def = static_cast<GEPInst*>(inst)->res; break;
-                            case Operator::SITOFP:
-                                def = static_cast<SI2FPInst*>(inst)->dest; break;
-                            case Operator::FPTOSI:
-                                def = static_cast<FP2SIInst*>(inst)->dest; break;
-                            case Operator::ZEXT:
-                                def = static_cast<ZextInst*>(inst)->dest; break;
-                            default:
-                                break;
-                        }
-
-                        if (def && def->getType() == OperandType::REG)
-                        {
-                            size_t r = def->getRegNum();
-                            auto& cur = lattice[r];
-                            if (cur.state != ValState::Overdefined)
-                            {
-                                cur.state = ValState::Overdefined;
-                                changed = true;
-                            }
-                        }
+                        // 块第一次变为可执行：求值其中所有指令
+                        executable[to] = 1;
+                        for (auto* inst : block->insts) visit(inst, to);
+                        continue;
                     }
-                    else
+                    // 已可执行的块多了一条入边：只有 phi 的结果可能改变
+                    for (auto* inst : block->insts)
                     {
-                        // 得到常量 -> 写入 lattice
-                        Operand* def = nullptr;
-                        switch (inst->opcode)
-                        {
-                            case Operator::LOAD: def = static_cast<LoadInst*>(inst)->res; break;
-                            case Operator::ADD: case Operator::SUB: case Operator::MUL: case Operator::DIV:
-                            case Operator::FADD: case Operator::FSUB: case Operator::FMUL: case Operator::FDIV:
-                            case Operator::MOD: case Operator::BITXOR: case Operator::BITAND:
-                            case Operator::SHL: case Operator::ASHR: case Operator::LSHR:
-                                def = static_cast<ArithmeticInst*>(inst)->res; break;
-                            case Operator::ICMP: case Operator::FCMP:
-                                def = static_cast<IcmpInst*>(inst)->res; break;
-                            case Operator::PHI:
-                                def = static_cast<PhiInst*>(inst)->res; break;
-                            case Operator::CALL:
-                                def = static_cast<CallInst*>(inst)->res; break;
-                            case Operator::GETELEMENTPTR:
-                                def = static_cast<GEPInst*>(inst)->res; break;
-                            case Operator::SITOFP:
-                                def = static_cast<SI2FPInst*>(inst)->dest; break;
-                            case Operator::FPTOSI:
-                                def = static_cast<FP2SIInst*>(inst)->dest; break;
-                            case Operator::ZEXT:
-                                def = static_cast<ZextInst*>(inst)->dest; break;
-                            default:
-                                break;
-                        }
-
-                        if (def && def->getType() == OperandType::REG)
-                        {
-                            size_t r = def->getRegNum();
-                            auto& cur = lattice[r];
-                            if (cur.state != out.state || cur.i32 != out.i32 || cur.f32 != out.f32)
-                            {
-                                cur = out;
-                                changed = true;
-                            }
-                        }
+                        if (inst->opcode != Operator::PHI) break;
+                        visit(inst, to);
                     }
                 }
+                while (!ssaWork.empty())
+                {
+                    size_t reg = ssaWork.back();
+                    ssaWork.pop_back();
+                    for (auto& use : du.getUses(reg))
+                    {
+                        auto it = blockOf.find(use.user);
+                        if (it != blockOf.end() && executable[it->second]) visit(use.user, it->second);
+                    }
+                }
+            }
+        };
+
+        executable[0] = 1;
+        for (auto* inst : cfg->id2block[0]->insts) visit(inst, 0);
+        for (bool again = true; again;)
+        {
+            solve();
+            // 可执行块的条件始终为 Unknown 时（条件来自不可达的定义），保守地认为两个后继都可达
+            again = false;
+            for (auto* block : function.blocks)
+            {
+                if (!executable[block->blockId]) continue;
+                auto* br = dynamic_cast<BrCondInst*>(terminatorOf(block));
+                if (!br || valueOf(br->cond, lattice).state != ValState::Unknown) continue;
+                markEdge(block->blockId, labelId(br->trueTar));
+                markEdge(block->blockId, labelId(br->falseTar));
+                again |= !cfgWork.empty();
             }
         }
 
-        // 替换寄存器操作数为立即数（仅 ConstI32/ConstF32）
-        for (auto& [bid, block] : function.blocks)
+        std::unordered_set<Instruction*>             toDelete;
+        std::vector<std::pair<Block*, Instruction*>> deleteSites;
+
+        // 删去后继 succ 中来自 pred 的 phi incoming
+        auto removeIncoming = [&](size_t succ, size_t pred) {
+            auto it = cfg->id2block.find(succ);
+            if (it == cfg->id2block.end()) return;
+            Operand* predLabel = ops.getLabelOperand(pred);
+            for (auto* inst : it->second->insts)
+            {
+                if (inst->opcode != Operator::PHI) break;
+                auto* phi = static_cast<PhiInst*>(inst);
+                auto  in  = phi->incomingVals.find(predLabel);
+                if (in == phi->incomingVals.end()) continue;
+                du.removeUse(phi, &in->second);
+                phi->incomingVals.erase(in);
+            }
+        };
+
+        // 常量寄存器的使用替换为立即数，定义它的指令随之删除
+        size_t folded = 0;
+        for (auto* block : function.blocks)
         {
+            if (!executable[block->blockId]) continue;
             for (auto* inst : block->insts)
             {
-                // 遍历并替换常见的操作数字段
-                auto tryReplace = [&](Operand*& op) {
-                    if (!op) return;
-                    if (op->getType() != OperandType::REG) return;
-                    size_t r = op->getRegNum();
-                    auto it = lattice.find(r);
-                    if (it == lattice.end()) return;
-                    const LV& v = it->second;
-                    if (v.state == ValState::ConstI32)
-                    {
-                        // use OperandFactory helpers (Imme operands are managed by factory)
-                        op = getImmeI32Operand(v.i32);
-                    }
-                    else if (v.state == ValState::ConstF32)
-                    {
-                        op = getImmeF32Operand(v.f32);
-                    }
-                };
+                Operand* def = inst->getDefOperand();
+                if (!def || def->getType() != OperandType::REG) continue;
+                const LV& v = lattice[def->getRegNum()];
+                Operand*  imm = nullptr;
+                if (v.state == ValState::ConstI32)
+                    imm = ops.getImmeI32Operand(v.i32);
+                else if (v.state == ValState::ConstF32)
+                    imm = ops.getImmeF32Operand(v.f32);
+                else
+                    continue;
+                folded += du.getUses(def->getRegNum()).size();
+                function.replaceAllUsesWith(def, imm);
+                toDelete.insert(inst);
+                deleteSites.emplace_back(block, inst);
+            }
+        }
 
-                switch (inst->opcode)
+        // 只有一条出边可执行的条件分支改为无条件跳转
+        size_t branchesFolded = 0;
+        for (auto* block : function.blocks)
+        {
+            if (!executable[block->blockId]) continue;
+            auto* br = dynamic_cast<BrCondInst*>(terminatorOf(block));
+            if (!br || br->trueTar == br->falseTar) continue;
+            bool takeTrue  = isEdgeExecutable(block->blockId, labelId(br->trueTar));
+            bool takeFalse = isEdgeExecutable(block->blockId, labelId(br->falseTar));
+            if (takeTrue == takeFalse) continue;
+
+            removeIncoming(labelId(takeTrue ? br->falseTar : br->trueTar), block->blockId);
+            block->insts.insertBefore(br, function.create<BrUncondInst>(takeTrue ? br->trueTar : br->falseTar));
+            toDelete.insert(br);
+            deleteSites.emplace_back(block, br);
+            ++branchesFolded;
+        }
+
+        // 从未变为可执行的块：先从可执行后继的 phi 中删去它，再整块删除
+        std::vector<Block*> deadBlocks;
+        for (auto* block : function.blocks)
+        {
+            if (executable[block->blockId]) continue;
+            deadBlocks.push_back(block);
+            if (Instruction* term = terminatorOf(block))
+            {
+                if (auto* br = dynamic_cast<BrCondInst*>(term))
                 {
-                    case Operator::ADD: case Operator::SUB: case Operator::MUL: case Operator::DIV:
-                    case Operator::MOD: case Operator::BITXOR: case Operator::BITAND:
-                    case Operator::SHL: case Operator::ASHR: case Operator::LSHR:
-                    case Operator::FADD: case Operator::FSUB: case Operator::FMUL: case Operator::FDIV: {
-                        auto* ai = static_cast<ArithmeticInst*>(inst);
-                        tryReplace(ai->lhs);
-                        tryReplace(ai->rhs);
-                        break;
-                    }
-                    case Operator::ICMP: case Operator::FCMP: {
-                        auto* ci = static_cast<IcmpInst*>(inst);
-                        tryReplace(ci->lhs);
-                        tryReplace(ci->rhs);
-                        break;
-                    }
-                    case Operator::STORE: {
-                        auto* si = static_cast<StoreInst*>(inst);
-                        tryReplace(si->val);
-                        tryReplace(si->ptr);
-                        break;
-                    }
-                    case Operator::LOAD: {
-                        auto* li = static_cast<LoadInst*>(inst);
-                        tryReplace(li->ptr);
-                        break;
-                    }
-                    case Operator::BR_COND: {
-                        auto* br = static_cast<BrCondInst*>(inst);
-                        tryReplace(br->cond);
-                        break;
-                    }
-                    case Operator::PHI: {
-                        auto* phi = static_cast<PhiInst*>(inst);
-                        for (auto& p : phi->incomingVals)
-                        {
-                            tryReplace(p.second);
-                        }
-                        break;
-                    }
-                    case Operator::CALL: {
-                        auto* call = static_cast<CallInst*>(inst);
-                        for (auto& a : call->args) tryReplace(a.second);
-                        break;
-                    }
-                    case Operator::GETELEMENTPTR: {
-                        auto* gep = static_cast<GEPInst*>(inst);
-                        tryReplace(gep->basePtr);
-                        for (auto*& idx : gep->idxs) tryReplace(idx);
-                        break;
-                    }
-                    default:
-                        break;
+                    removeIncoming(labelId(br->trueTar), block->blockId);
+                    removeIncoming(labelId(br->falseTar), block->blockId);
                 }
+                else if (auto* br = dynamic_cast<BrUncondInst*>(term))
+                    removeIncoming(labelId(br->target), block->blockId);
+            }
+            for (auto* inst : block->insts) toDelete.insert(inst);
+        }
+
+        if (toDelete.empty()) return PreservedAnalyses::all();
+        if (folded) Stats::bump("operands folded", folded);
+        if (branchesFolded) Stats::bump("branches folded", branchesFolded);
+        if (!deadBlocks.empty()) Stats::bump("blocks removed", deadBlocks.size());
+
+        du.removeInsts(toDelete);
+        for (auto& [block, inst] : deleteSites)
+        {
+            block->insts.remove(inst);
+            function.destroy(inst);
+        }
+        for (Block* block : deadBlocks)
+        {
+            function.blocks.remove(block);
+            for (auto it = block->insts.begin(); it != block->insts.end();)
+            {
+                Instruction* inst = *it;
+                it                = block->insts.erase(it);
+                function.destroy(inst);
             }
+            function.destroy(block);
+        }
+
+        // def-use 链已同步维护；折叠了分支或删除了块时控制流改变，其余分析需要重新计算
+        if (branchesFolded || !deadBlocks.empty()) return PreservedAnalyses::none().preserve<DefUseChain>();
+        return PreservedAnalyses::none()
+            .preserve<Analysis::CFG>()
+            .preserve<Analysis::DomInfo>()
+            .preserve<Analysis::LoopInfo>()
+            .preserve<DefUseChain>();
+    }
+
+    LV SCCPPass::valueOf(Operand* op, const std::vector<LV>& lattice)
+    {
+        if (!op) return overdefined();
+        switch (op->getType())
+        {
+            case OperandType::IMMEI32: return constI32(static_cast<ImmeI32Operand*>(op)->value);
+            case OperandType::IMMEF32: return constF32(static_cast<ImmeF32Operand*>(op)->value);
+            case OperandType::REG:
+                return op->getRegNum() < lattice.size() ? lattice[op->getRegNum()] : overdefined();
+            default: return overdefined();
         }
     }
 
-    // 尝试对单条指令进行常量求值，能求出常量则返回 true 并填充 out
-    bool SCCPPass::evaluateInstructionConst(Instruction* inst, LV& out)
+    LV SCCPPass::evaluate(Instruction* inst, const std::vector<LV>& lattice)
     {
-        // 只处理常见的算术/比较指令与 PHI
+        // 任一操作数为 Overdefined 则结果为 Overdefined；否则有操作数尚为 Unknown 时结果也为 Unknown
+        auto combine = [](const LV& a, const LV& b, bool& ready) {
+            ready = false;
+            if (a.state == ValState::Overdefined || b.state == ValState::Overdefined) return overdefined();
+            if (a.state == ValState::Unknown || b.state == ValState::Unknown) return LV();
+            ready = true;
+            return LV();
+        };
+
+        bool ready = false;
         switch (inst->opcode)
         {
             case Operator::ADD: case Operator::SUB: case Operator::MUL: case Operator::DIV:
             case Operator::MOD: case Operator::BITXOR: case Operator::BITAND:
             case Operator::SHL: case Operator::ASHR: case Operator::LSHR: {
                 auto* ai = static_cast<ArithmeticInst*>(inst);
-                if (!ai->lhs || !ai->rhs) return false;
-                if (ai->lhs->getType() == OperandType::IMMEI32 && ai->rhs->getType() == OperandType::IMMEI32)
-                {
-                    int a = static_cast<ImmeI32Operand*>(ai->lhs)->value;
-                    int b = static_cast<ImmeI32Operand*>(ai->rhs)->value;
-                    long long res = 0;
-                    switch (inst->opcode)
-                    {
-                        case Operator::ADD: res = (long long)a + b; break;
-                        case Operator::SUB: res = (long long)a - b; break;
-                        case Operator::MUL: res = (long long)a * b; break;
-                        case Operator::DIV: if (b==0) return false; res = a / b; break;
-                        case Operator::MOD: if (b==0) return false; res = a % b; break;
-                        case Operator::BITXOR: res = a ^ b; break;
-                        case Operator::BITAND: res = a & b; break;
-                        case Operator::SHL: res = a << b; break;
-                        case Operator::ASHR: res = a >> b; break;
-                        case Operator::LSHR: res = static_cast<unsigned int>(a) >> b; break;
-                        default: return false;
-                    }
-                    out.state = ValState::ConstI32;
-                    out.i32 = static_cast<int>(res);
-                    return true;
-                }
-                return false;
+                LV    a = valueOf(ai->lhs, lattice), b = valueOf(ai->rhs, lattice);
+                LV    r = combine(a, b, ready);
+                if (!ready) return r;
+                if (a.state != ValState::ConstI32 || b.state != ValState::ConstI32) return overdefined();
+                int res = 0;
+                return foldI32(inst->opcode, a.i32, b.i32, res) ? constI32(res) : overdefined();
             }
             case Operator::FADD: case Operator::FSUB: case Operator::FMUL: case Operator::FDIV: {
                 auto* ai = static_cast<ArithmeticInst*>(inst);
-                if (!ai->lhs || !ai->rhs) return false;
-                if (ai->lhs->getType() == OperandType::IMMEF32 && ai->rhs->getType() == OperandType::IMMEF32)
+                LV    a = valueOf(ai->lhs, lattice), b = valueOf(ai->rhs, lattice);
+                LV    r = combine(a, b, ready);
+                if (!ready) return r;
+                if (a.state != ValState::ConstF32 || b.state != ValState::ConstF32) return overdefined();
+                switch (inst->opcode)
                 {
-                    float a = static_cast<ImmeF32Operand*>(ai->lhs)->value;
-                    float b = static_cast<ImmeF32Operand*>(ai->rhs)->value;
-                    float res = 0.0f;
-                    switch (inst->opcode)
-                    {
-                        case Operator::FADD: res = a + b; break;
-                        case Operator::FSUB: res = a - b; break;
-                        case Operator::FMUL: res = a * b; break;
-                        case Operator::FDIV: if (b==0.0f) return false; res = a / b; break;
-                        default: return false;
-                    }
-                    out.state = ValState::ConstF32;
-                    out.f32 = res;
-                    return true;
+                    case Operator::FADD: return constF32(a.f32 + b.f32);
+                    case Operator::FSUB: return constF32(a.f32 - b.f32);
+                    case Operator::FMUL: return constF32(a.f32 * b.f32);
+                    default: return b.f32 == 0.0f ? overdefined() : constF32(a.f32 / b.f32);
                 }
-                return false;
             }
             case Operator::ICMP: {
                 auto* ci = static_cast<IcmpInst*>(inst);
-                if (!ci->lhs || !ci->rhs) return false;
-                if (ci->lhs->getType() == OperandType::IMMEI32 && ci->rhs->getType() == OperandType::IMMEI32)
-                {
-                    int a = static_cast<ImmeI32Operand*>(ci->lhs)->value;
-                    int b = static_cast<ImmeI32Operand*>(ci->rhs)->value;
-                    bool res = false;
-                    switch (ci->cond)
-                    {
-                        case ICmpOp::EQ: res = (a==b); break;
-                        case ICmpOp::NE: res = (a!=b); break;
-                        case ICmpOp::SGT: res = (a>b); break;
-                        case ICmpOp::SGE: res = (a>=b); break;
-                        case ICmpOp::SLT: res = (a<b); break;
-                        case ICmpOp::SLE: res = (a<=b); break;
-                        default: return false;
-                    }
-                    out.state = ValState::ConstI32;
-                    out.i32 = res ? 1 : 0;
-                    return true;
-                }
-                return false;
+                LV    a = valueOf(ci->lhs, lattice), b = valueOf(ci->rhs, lattice);
+                LV    r = combine(a, b, ready);
+                if (!ready) return r;
+                if (a.state != ValState::ConstI32 || b.state != ValState::ConstI32) return overdefined();
+                return constI32(foldICmp(ci->cond, a.i32, b.i32) ? 1 : 0);
             }
-            case Operator::PHI: {
-                auto* phi = static_cast<PhiInst*>(inst);
-                bool first = true;
-                LV tmp;
-                for (auto& p : phi->incomingVals)
-                {
-                    Operand* v = p.second;
-                    if (!v) return false;
-                    if (v->getType() == OperandType::IMMEI32)
-                    {
-                        LV cur; cur.state = ValState::ConstI32; cur.i32 = static_cast<ImmeI32Operand*>(v)->value;
-                        if (first) { tmp = cur; first = false; }
-                        else if (tmp.state != cur.state || tmp.i32 != cur.i32) return false;
-                    }
-                    else if (v->getType() == OperandType::IMMEF32)
-                    {
-                        LV cur; cur.state = ValState::ConstF32; cur.f32 = static_cast<ImmeF32Operand*>(v)->value;
-                        if (first) { tmp = cur; first = false; }
-                        else if (tmp.state != cur.state || tmp.f32 != cur.f32) return false;
-                    }
-                    else return false;
-                }
-
-                if (!first)
-                {
-                    out = tmp;
-                    return true;
-                }
-                return false;
+            case Operator::FCMP: {
+                auto* ci = static_cast<FcmpInst*>(inst);
+                LV    a = valueOf(ci->lhs, lattice), b = valueOf(ci->rhs, lattice);
+                LV    r = combine(a, b, ready);
+                if (!ready) return r;
+                if (a.state != ValState::ConstF32 || b.state != ValState::ConstF32) return overdefined();
+                return constI32(foldFCmp(ci->cond, a.f32, b.f32) ? 1 : 0);
+            }
+            case Operator::ZEXT: {
+                LV a = valueOf(static_cast<ZextInst*>(inst)->src, lattice);
+                if (a.state == ValState::ConstI32) return constI32(a.i32);
+                return a.state == ValState::Unknown ? LV() : overdefined();
+            }
+            case Operator::SITOFP: {
+                LV a = valueOf(static_cast<SI2FPInst*>(inst)->src, lattice);
+                if (a.state == ValState::ConstI32) return constF32(static_cast<float>(a.i32));
+                return a.state == ValState::Unknown ? LV() : overdefined();
+            }
+            case Operator::FPTOSI: {
+                LV a = valueOf(static_cast<FP2SIInst*>(inst)->src, lattice);
+                // 超出 i32 范围的转换结果依赖目标平台，不折叠
+                if (a.state == ValState::ConstF32 && a.f32 > -2147483904.0f && a.f32 < 2147483648.0f)
+                    return constI32(static_cast<int>(a.f32));
+                return a.state == ValState::Unknown ? LV() : overdefined();
             }
             default:
-                break;
+                // load、call、gep、alloca 等的结果不是编译期常量
+                return overdefined();
         }
+    }
 
-        return false;
+    bool SCCPPass::meet(LV& cur, const LV& v)
+    {
+        if (v.state == ValState::Unknown || cur.state == ValState::Overdefined) return false;
+        if (cur.state == ValState::Unknown)
+        {
+            cur = v;
+            return true;
+        }
+        bool same = cur.state == v.state &&
+                    (cur.state == ValState::ConstI32 ? cur.i32 == v.i32 : sameBits(cur.f32, v.f32));
+        if (same) return false;
+        cur = overdefined();
+        return true;
     }
 
 } // namespace ME
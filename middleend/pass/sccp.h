@@ -1,6 +1,7 @@
 #pragma once
 
-#include <unordered_map>
+#include <interfaces/middleend/pass.h>
+#include <vector>
 
 namespace ME
 {
@@ -9,12 +10,14 @@ namespace ME
     class Instruction;
     class Operand;
 
-    // Sparse Conditional Constant Propagation (简化实现)
-    // 目标：在函数内对标量寄存器做稀疏常量传播/折叠并替换为立即数
-    class SCCPPass
+    // Sparse Conditional Constant Propagation (Wegman–Zadeck)
+    // 从入口块出发，只沿可执行的边传播常量：SSA 工作表处理格值变化的寄存器的使用，CFG 工作表处理新变为可执行的边。
+    // 结束后把常量寄存器替换为立即数，折叠条件恒定的分支，并删除始终不可执行的块
+    class SCCPPass : public FunctionPass
     {
       public:
         // Lattice types made public so implementation files can reference them
+        // Unknown 为格顶（尚未求值），Overdefined 为格底（不是常量）
         enum class ValState { Unknown, ConstI32, ConstF32, Overdefined };
 
         struct LatticeVal
@@ -24,11 +27,16 @@ namespace ME
             float f32 = 0.0f;
         };
 
-        void runOnModule(Module& module);
-        void runOnFunction(Function& function);
+        const char*       getName() const override { return "sccp"; }
+        PreservedAnalyses runOnFunction(Function& function) override;
 
       private:
-        bool evaluateInstructionConst(Instruction* inst, LatticeVal& out);
+        // 操作数当前的格值：立即数为常量，没有定义的寄存器（形参）与其余操作数为 Overdefined
+        static LatticeVal valueOf(Operand* op, const std::vector<LatticeVal>& lattice);
+        // 按操作数的格值求指令结果（phi 与终结指令除外）
+        static LatticeVal evaluate(Instruction* inst, const std::vector<LatticeVal>& lattice);
+        // 把 v 合并进 cur（取两者的交），返回 cur 是否改变
+        static bool meet(LatticeVal& cur, const LatticeVal& v);
     };
 
 } // namespace ME
@@ -2,27 +2,29 @@
 #include <middleend/pass/analysis/analysis_manager.h>
 #include <middleend/pass/analysis/cfg.h>
 #include <middleend/module/ir_operand.h>
+#include <stats.h>
 #include <algorithm>
 #include <iostream>
 
 namespace ME
 {
-    void UnifyReturnPass::runOnModule(Module& module)
+    PreservedAnalyses UnifyReturnPass::runOnFunction(Function& function)
     {
-        for (auto* function : module.functions) unifyFunctionReturns(*function);
+        if (!unifyFunctionReturns(function)) return PreservedAnalyses::all();
+        return PreservedAnalyses::none();
     }
 
-    void UnifyReturnPass::runOnFunction(Function& function) { unifyFunctionReturns(function); }
-
-    void UnifyReturnPass::unifyFunctionReturns(Function& function)
+    bool UnifyReturnPass::unifyFunctionReturns(Function& function)
     {
         auto* cfg = Analysis::AM.get<Analysis::CFG>(function);
 
         auto retInstructions = findReturnInstructions(cfg);
 
-        if (retInstructions.size() <= 1) return;
+        if (retInstructions.size() <= 1) return false;
+        Stats::bump("returns unified", retInstructions.size());
 
-        Block* exitBlock = function.createBlock();
+        OperandFactory& ops       = function.getOperandFactory();
+        Block*          exitBlock = function.createBlock();
 
         std::vector<std::pair<Operand*, Operand*>> returnValues;
         DataType                                   returnType = DataType::VOID;
@@ -34,7 +36,7 @@ namespace ME
 
             returnType = retInst->rt;
 
-            Operand* labelOp = getLabelOperand(containingBlock->blockId);
+            Operand* labelOp = ops.getLabelOperand(containingBlock->blockId);
 
             if (retInst->res)
                 returnValues.push_back({retInst->res, labelOp});
@@ -44,10 +46,11 @@ namespace ME
             auto it = std::find(containingBlock->insts.begin(), containingBlock->insts.end(), retInst);
             if (it != containingBlock->insts.end())
             {
-                Operand* exitLabel  = getLabelOperand(exitBlock->blockId);
-                auto*    branchInst = new BrUncondInst(exitLabel);
-                *it                 = branchInst;
-                delete retInst;
+                Operand* exitLabel  = ops.getLabelOperand(exitBlock->blockId);
+                auto*    branchInst = function.create<BrUncondInst>(exitLabel);
+                containingBlock->insts.insert(it, branchInst);
+                containingBlock->insts.erase(it);
+                function.destroy(retInst);
             }
         }
 
@@ -59,31 +62,31 @@ namespace ME
 
             if (!validValues.empty())
             {
-                Operand* resultReg = getRegOperand(function.getNewRegId());
+                Operand* resultReg = ops.getRegOperand(function.getNewRegId());
 
-                auto* phiInst = new PhiInst(returnType, resultReg);
+                auto* phiInst = function.create<PhiInst>(returnType, resultReg);
                 for (auto& [val, label] : validValues) phiInst->addIncoming(val, label);
                 exitBlock->insertBack(phiInst);
 
-                auto* finalRet = new RetInst(returnType, resultReg);
+                auto* finalRet = function.create<RetInst>(returnType, resultReg);
                 exitBlock->insertBack(finalRet);
             }
             else
             {
-                auto* finalRet = new RetInst(DataType::VOID, nullptr);
+                auto* finalRet = function.create<RetInst>(DataType::VOID, nullptr);
                 exitBlock->insertBack(finalRet);
             }
         }
         else
         {
-            auto* finalRet = new RetInst(DataType::VOID, nullptr);
+            auto* finalRet = function.create<RetInst>(DataType::VOID, nullptr);
             exitBlock->insertBack(finalRet);
         }
 
-        // 由于在 `if (retInstructions.size() <= 1) return;` 处没有退出
+        // 由于在 `if (retInstructions.size() <= 1) return false;` 处没有退出
         // 我们可以确定该 pass 的执行一定向当前函数插入了新的基本块并修改了跳转关系
-        // 因此需要 invalidate 当前函数的 CFG 缓存
-        Analysis::AM.invalidate(function);
+        // 因此返回 true，由 runOnFunction 声明不保留任何分析，使当前函数的 CFG 缓存失效
+        return true;
     }
 
     std::vector<RetInst*> UnifyReturnPass::findReturnInstructions(Analysis::CFG* cfg)
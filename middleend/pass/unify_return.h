@@ -11,17 +11,17 @@
 
 namespace ME
 {
-    class UnifyReturnPass : public ModulePass
+    class UnifyReturnPass : public FunctionPass
     {
       public:
         UnifyReturnPass()  = default;
         ~UnifyReturnPass() = default;
 
-        void runOnModule(Module& module) override;
-        void runOnFunction(Function& function) override;
+        const char*       getName() const override { return "unify-return"; }
+        PreservedAnalyses runOnFunction(Function& function) override;
 
       private:
-        void unifyFunctionReturns(Function& function);
+        bool unifyFunctionReturns(Function& function);
 
         std::vector<RetInst*> findReturnInstructions(Analysis::CFG* cfg);
         Block*                getBlockContaining(Function& function, Instruction* inst);
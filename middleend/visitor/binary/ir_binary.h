@@ -0,0 +1,197 @@
+#ifndef __MIDDLEEND_VISITOR_BINARY_IR_BINARY_H__
+#define __MIDDLEEND_VISITOR_BINARY_IR_BINARY_H__
+
+#include <middleend/ir_visitor.h>
+#include <middleend/module/ir_module.h>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace ME
+{
+    /*
+     * 二进制 IR 格式（-emit-ir-bin / -load-ir-bin）
+     * - 文件头为魔数 "SYIR" 与版本号，随后依次为字符串表、函数声明、全局变量、函数定义
+     * - 整数一律为 LEB128 变长编码，有符号数先做 zigzag；浮点数按 32 位小端原样存放
+     * - 全局变量名、函数名、基本块注释只在字符串表中出现一次，其余位置记录其下标
+     * - 操作数编码为 (载荷 << 3) | OperandType，空操作数为 0；F32 立即数的载荷另以 4 字节跟在后面
+     * - 指令以 Operator 开头，其后按指令类型写各字段；基本块按布局顺序写出，保留 blockId
+     * - 全局数组初值只保存非零元素段，全零数组不随数组大小增长
+     * - 只保存后端与 IR 打印需要的信息：指令注释（不参与输出）与 VarAttr 中 arrayDims / initList 以外的前端属性不保存
+     */
+    namespace IRBinary
+    {
+        constexpr char     kMagic[4] = {'S', 'Y', 'I', 'R'};
+        constexpr uint64_t kVersion  = 2;
+        // 单个函数的寄存器 / 标签编号上限，OperandFactory 按编号稠密建表，超出即视为文件损坏
+        constexpr uint64_t kMaxId    = 1u << 24;
+
+        inline uint64_t zigzag(int64_t v) { return (static_cast<uint64_t>(v) << 1) ^ static_cast<uint64_t>(v >> 63); }
+        inline int64_t  unzigzag(uint64_t v) { return static_cast<int64_t>(v >> 1) ^ -static_cast<int64_t>(v & 1); }
+
+        class Writer
+        {
+          public:
+            void put(uint64_t v)
+            {
+                while (v >= 0x80)
+                {
+                    bytes.push_back(static_cast<char>((v & 0x7f) | 0x80));
+                    v >>= 7;
+                }
+                bytes.push_back(static_cast<char>(v));
+            }
+            void putSigned(int64_t v) { put(zigzag(v)); }
+            void putF32(float v);
+            void putRaw(const char* p, size_t n) { bytes.append(p, n); }
+
+            const std::string& data() const { return bytes; }
+
+          private:
+            std::string bytes;
+        };
+
+        class Reader
+        {
+          public:
+            Reader(const char* begin, const char* end) : cur(begin), end(end) {}
+
+            uint64_t get()
+            {
+                uint64_t v     = 0;
+                unsigned shift = 0;
+                while (cur < end && shift < 64)
+                {
+                    uint8_t b = static_cast<uint8_t>(*cur++);
+                    v |= static_cast<uint64_t>(b & 0x7f) << shift;
+                    if (!(b & 0x80)) return v;
+                    shift += 7;
+                }
+                fail("truncated varint");
+                return 0;
+            }
+            int64_t     getSigned() { return unzigzag(get()); }
+            // 枚举值、编号等取值有上界的字段，越界时报错并返回 0
+            uint64_t    getBounded(uint64_t max, const char* msg)
+            {
+                uint64_t v = get();
+                if (v <= max) return v;
+                fail(msg);
+                return 0;
+            }
+            // 元素个数：每个元素至少占 1 字节，超过剩余长度的个数视为文件损坏
+            size_t getCount()
+            {
+                uint64_t n = get();
+                if (n > static_cast<uint64_t>(end - cur))
+                {
+                    fail("element count exceeds file size");
+                    return 0;
+                }
+                return static_cast<size_t>(n);
+            }
+            float       getF32();
+            const char* getRaw(size_t n);
+
+            // 记录第一处错误，之后的读取均返回 0
+            void fail(const char* msg)
+            {
+                if (!error) error = msg;
+                cur = end;
+            }
+            bool        ok() const { return error == nullptr; }
+            const char* what() const { return error; }
+
+          private:
+            const char* cur;
+            const char* end;
+            const char* error = nullptr;
+        };
+    }  // namespace IRBinary
+
+    using BinWriter_t = Visitor_t<void, IRBinary::Writer&>;
+
+    // 把优化后的模块写成二进制 IR
+    class IRBinWriter : public BinWriter_t
+    {
+      public:
+        bool write(Module& module, const std::string& path, std::string& err);
+
+        void visit(Module& module, IRBinary::Writer& out) override;
+        void visit(Function& func, IRBinary::Writer& out) override;
+        void visit(Block& block, IRBinary::Writer& out) override;
+
+        void visit(LoadInst& inst, IRBinary::Writer& out) override;
+        void visit(StoreInst& inst, IRBinary::Writer& out) override;
+        void visit(ArithmeticInst& inst, IRBinary::Writer& out) override;
+        void visit(IcmpInst& inst, IRBinary::Writer& out) override;
+        void visit(FcmpInst& inst, IRBinary::Writer& out) override;
+        void visit(AllocaInst& inst, IRBinary::Writer& out) override;
+        void visit(BrCondInst& inst, IRBinary::Writer& out) override;
+        void visit(BrUncondInst& inst, IRBinary::Writer& out) override;
+        void visit(GlbVarDeclInst& inst, IRBinary::Writer& out) override;
+        void visit(CallInst& inst, IRBinary::Writer& out) override;
+        void visit(FuncDeclInst& inst, IRBinary::Writer& out) override;
+        void visit(FuncDefInst& inst, IRBinary::Writer& out) override;
+        void visit(RetInst& inst, IRBinary::Writer& out) override;
+        void visit(GEPInst& inst, IRBinary::Writer& out) override;
+        void visit(FP2SIInst& inst, IRBinary::Writer& out) override;
+        void visit(SI2FPInst& inst, IRBinary::Writer& out) override;
+        void visit(ZextInst& inst, IRBinary::Writer& out) override;
+        void visit(PhiInst& inst, IRBinary::Writer& out) override;
+
+      private:
+        std::vector<std::string_view>                strings;
+        std::unordered_map<std::string_view, size_t> stringIds;
+
+        size_t intern(std::string_view s);
+        void   putString(IRBinary::Writer& out, std::string_view s);
+        void   putOperand(IRBinary::Writer& out, const Operand* op);
+
+        // 指令的 dims 与全局变量初值的维度分别是 std::pmr::vector 与 std::vector
+        template <typename Dims>
+        void putDims(IRBinary::Writer& out, const Dims& dims)
+        {
+            out.put(dims.size());
+            for (int d : dims) out.putSigned(d);
+        }
+    };
+
+    /*
+     * 读入二进制 IR，在 module 中重建全部节点
+     * - 文件以 mmap 映射后直接解码，字符串表只记录在映射区中的位置
+     * - 操作数在 module 自己的 OperandFactory 中驻留
+     * - 格式不符、文件被截断或编号越界时返回 false，原因写入 err；读入过程不会因文件内容触发断言
+     */
+    class IRBinReader
+    {
+      public:
+        bool read(const std::string& path, Module& module, std::string& err);
+
+      private:
+        Module*                       module   = nullptr;
+        OperandFactory*               operands = nullptr;
+        std::vector<std::string_view> strings;
+        // 当前函数中寄存器与标签编号的上界（不含）；读全局变量时均为 0，即不允许出现
+        uint64_t                      regLimit   = 0;
+        uint64_t                      labelLimit = 0;
+        // 当前函数中作为操作数出现过的标签，读完函数后检查对应基本块均存在
+        std::vector<size_t>           usedLabels;
+
+        void         readModule(IRBinary::Reader& in);
+        void         readFunction(IRBinary::Reader& in);
+        Instruction* readInst(IRBinary::Reader& in, Function& func);
+
+        std::string      getString(IRBinary::Reader& in);
+        Operand*         getOperand(IRBinary::Reader& in);
+        Operand*         getOperand(IRBinary::Reader& in, OperandType expect);
+        Operand*         getValue(IRBinary::Reader& in);
+        DataType         getType(IRBinary::Reader& in);
+        std::vector<int> getDims(IRBinary::Reader& in);
+        void             readInitList(IRBinary::Reader& in, GlbVarDeclInst& gv);
+    };
+}  // namespace ME
+
+#endif  // __MIDDLEEND_VISITOR_BINARY_IR_BINARY_H__
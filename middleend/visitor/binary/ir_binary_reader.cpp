@@ -0,0 +1,452 @@
+#include <middleend/visitor/binary/ir_binary.h>
+#include <mapped_file.h>
+#include <climits>
+#include <cstring>
+
+namespace ME
+{
+    namespace IRBinary
+    {
+        float Reader::getF32()
+        {
+            const char* p = getRaw(4);
+            if (!p) return 0.0f;
+            uint32_t bits = static_cast<uint32_t>(static_cast<uint8_t>(p[0])) |
+                            static_cast<uint32_t>(static_cast<uint8_t>(p[1])) << 8 |
+                            static_cast<uint32_t>(static_cast<uint8_t>(p[2])) << 16 |
+                            static_cast<uint32_t>(static_cast<uint8_t>(p[3])) << 24;
+            float v;
+            std::memcpy(&v, &bits, sizeof(v));
+            return v;
+        }
+
+        const char* Reader::getRaw(size_t n)
+        {
+            if (static_cast<size_t>(end - cur) < n)
+            {
+                fail("unexpected end of file");
+                return nullptr;
+            }
+            const char* p = cur;
+            cur += n;
+            return p;
+        }
+    }  // namespace IRBinary
+
+    bool IRBinReader::read(const std::string& path, Module& m, std::string& err)
+    {
+        MappedFile file(path);
+        if (!file.ok())
+        {
+            err = "cannot open " + path;
+            return false;
+        }
+
+        IRBinary::Reader in(file.data(), file.data() + file.size());
+        const char*      magic = in.getRaw(sizeof(IRBinary::kMagic));
+        if (!magic || std::memcmp(magic, IRBinary::kMagic, sizeof(IRBinary::kMagic)) != 0)
+        {
+            err = path + " is not a binary IR file";
+            return false;
+        }
+        if (in.get() != IRBinary::kVersion)
+        {
+            err = path + ": unsupported binary IR version";
+            return false;
+        }
+
+        module     = &m;
+        operands   = &m.getOperandFactory();
+        regLimit   = 0;
+        labelLimit = 0;
+        usedLabels.clear();
+        strings.clear();
+
+        // 字符串表直接指向映射区，构造 IR 节点时才复制出 std::string
+        size_t numStrings = in.getCount();
+        strings.reserve(numStrings);
+        for (size_t i = 0; i < numStrings && in.ok(); ++i)
+        {
+            size_t      len = in.getCount();
+            const char* p   = in.getRaw(len);
+            strings.emplace_back(p ? p : "", p ? len : 0);
+        }
+
+        readModule(in);
+        strings.clear();
+
+        if (!in.ok())
+        {
+            err = path + ": " + in.what();
+            return false;
+        }
+        return true;
+    }
+
+    std::string IRBinReader::getString(IRBinary::Reader& in)
+    {
+        size_t idx = in.get();
+        if (idx >= strings.size())
+        {
+            in.fail("string index out of range");
+            return {};
+        }
+        return std::string(strings[idx]);
+    }
+
+    Operand* IRBinReader::getOperand(IRBinary::Reader& in)
+    {
+        uint64_t v = in.get();
+        switch (static_cast<OperandType>(v & 7))
+        {
+            case OperandType::UNKNOWN: return nullptr;
+            case OperandType::REG:
+            {
+                if ((v >> 3) >= regLimit)
+                {
+                    in.fail("register number out of range");
+                    return nullptr;
+                }
+                return operands->getRegOperand(v >> 3);
+            }
+            case OperandType::IMMEI32: return operands->getImmeI32Operand(static_cast<int>(IRBinary::unzigzag(v >> 3)));
+            case OperandType::IMMEF32: return operands->getImmeF32Operand(in.getF32());
+            case OperandType::GLOBAL:
+            {
+                if ((v >> 3) >= strings.size())
+                {
+                    in.fail("string index out of range");
+                    return nullptr;
+                }
+                return operands->getGlobalOperand(std::string(strings[v >> 3]));
+            }
+            case OperandType::LABEL:
+            {
+                if ((v >> 3) >= labelLimit)
+                {
+                    in.fail("label number out of range");
+                    return nullptr;
+                }
+                usedLabels.push_back(v >> 3);
+                return operands->getLabelOperand(v >> 3);
+            }
+            default: in.fail("invalid operand"); return nullptr;
+        }
+    }
+
+    // 指令的源操作数不能为空
+    Operand* IRBinReader::getValue(IRBinary::Reader& in)
+    {
+        Operand* op = getOperand(in);
+        if (!op) in.fail("missing operand");
+        return op;
+    }
+
+    // 结果寄存器、跳转目标等位置只允许一种操作数
+    Operand* IRBinReader::getOperand(IRBinary::Reader& in, OperandType expect)
+    {
+        Operand* op = getOperand(in);
+        if (!op || op->getType() != expect)
+        {
+            in.fail(expect == OperandType::LABEL ? "expected a label operand" : "expected a register operand");
+            return nullptr;
+        }
+        return op;
+    }
+
+    DataType IRBinReader::getType(IRBinary::Reader& in)
+    {
+        return static_cast<DataType>(in.getBounded(static_cast<uint64_t>(DataType::DOUBLE), "invalid data type"));
+    }
+
+    std::vector<int> IRBinReader::getDims(IRBinary::Reader& in)
+    {
+        std::vector<int> dims(in.getCount());
+        for (auto& d : dims)
+        {
+            int64_t v = in.getSigned();
+            if (v < INT_MIN || v > INT_MAX) in.fail("array dimension out of range");
+            d = static_cast<int>(v);
+        }
+        return dims;
+    }
+
+    // 维度须为正且元素总数不超过 INT_MAX（打印与后端均以 int 计算下标），初值表长度须与之相等
+    void IRBinReader::readInitList(IRBinary::Reader& in, GlbVarDeclInst& gv)
+    {
+        auto& attr     = gv.initList;
+        attr.arrayDims = getDims(in);
+        if (attr.arrayDims.empty() || !in.ok()) return;
+
+        uint64_t total = 1;
+        for (int d : attr.arrayDims)
+        {
+            if (d <= 0 || total > static_cast<uint64_t>(INT_MAX) / static_cast<uint64_t>(d))
+            {
+                in.fail("invalid global array dimensions");
+                return;
+            }
+            total *= static_cast<uint64_t>(d);
+        }
+        if (in.get() != total)
+        {
+            in.fail("global initializer size does not match its dimensions");
+            return;
+        }
+
+        bool              isFloat = gv.dt == DataType::F32 || gv.dt == DataType::DOUBLE;
+        bool              isWide  = gv.dt == DataType::I64 || gv.dt == DataType::PTR;
+        FE::AST::VarValue zero    = isFloat  ? FE::AST::VarValue(0.0f)
+                                    : isWide ? FE::AST::VarValue(0LL)
+                                             : FE::AST::VarValue(0);
+        attr.initList.assign(total, zero);
+
+        size_t   runs = in.getCount();
+        uint64_t pos  = 0;
+        for (size_t r = 0; r < runs && in.ok(); ++r)
+        {
+            uint64_t gap = in.get();
+            uint64_t len = in.getCount();
+            if (gap > total - pos || len > total - pos - gap)
+            {
+                in.fail("global initializer run out of range");
+                return;
+            }
+            pos += gap;
+            for (uint64_t k = 0; k < len; ++k, ++pos)
+            {
+                if (isFloat)
+                    attr.initList[pos] = FE::AST::VarValue(in.getF32());
+                else if (isWide)
+                    attr.initList[pos] = FE::AST::VarValue(static_cast<long long>(in.getSigned()));
+                else
+                    attr.initList[pos] = FE::AST::VarValue(static_cast<int>(in.getSigned()));
+            }
+        }
+    }
+
+    void IRBinReader::readModule(IRBinary::Reader& in)
+    {
+        size_t numDecls = in.getCount();
+        for (size_t i = 0; i < numDecls && in.ok(); ++i)
+        {
+            DataType              retType = getType(in);
+            std::string           name    = getString(in);
+            std::vector<DataType> argTypes(in.getCount());
+            for (auto& dt : argTypes) dt = getType(in);
+            bool isVarArg = in.get() != 0;
+            module->funcDecls.push_back(module->create<FuncDeclInst>(retType, name, argTypes, isVarArg));
+        }
+
+        size_t numGlobals = in.getCount();
+        for (size_t i = 0; i < numGlobals && in.ok(); ++i)
+        {
+            DataType    dt   = getType(in);
+            std::string name = getString(in);
+            Operand*    init = getOperand(in);
+            auto*       gv   = module->create<GlbVarDeclInst>(dt, name, init);
+
+            readInitList(in, *gv);
+            module->globalVars.push_back(gv);
+        }
+
+        size_t numFuncs = in.getCount();
+        for (size_t i = 0; i < numFuncs && in.ok(); ++i) readFunction(in);
+    }
+
+    void IRBinReader::readFunction(IRBinary::Reader& in)
+    {
+        size_t maxReg    = in.getBounded(IRBinary::kMaxId, "register count out of range");
+        size_t maxLabel  = in.getBounded(IRBinary::kMaxId, "label count out of range");
+        size_t loopStart = in.get();
+        size_t loopEnd   = in.get();
+        regLimit         = maxReg + 1;
+        labelLimit       = maxLabel;
+
+        DataType             retType = getType(in);
+        std::string          name    = getString(in);
+        FuncDefInst::argList args(in.getCount());
+        for (auto& [dt, reg] : args)
+        {
+            dt  = getType(in);
+            reg = getOperand(in, OperandType::REG);
+        }
+
+        auto* func = module->create<Function>(module->create<FuncDefInst>(retType, name, args), *operands);
+        module->functions.push_back(func);
+
+        func->setMaxReg(maxReg);
+        func->setMaxLabel(maxLabel);
+        func->loopStartLabel = loopStart;
+        func->loopEndLabel   = loopEnd;
+
+        // blockId 同时是 BlockList 的稠密下标，须小于 maxLabel 且互不相同
+        size_t            numBlocks = in.getCount();
+        std::vector<bool> seen(maxLabel, false);
+        for (size_t b = 0; b < numBlocks && in.ok(); ++b)
+        {
+            size_t id = in.get();
+            if (id >= maxLabel || seen[id])
+            {
+                in.fail("invalid block id");
+                break;
+            }
+            seen[id]    = true;
+            auto* block = func->create<Block>(id, func->copyString(getString(in)));
+            func->blocks.push_back(block);
+
+            size_t numInsts = in.getCount();
+            for (size_t k = 0; k < numInsts && in.ok(); ++k)
+            {
+                if (Instruction* inst = readInst(in, *func)) block->insertBack(inst);
+            }
+        }
+
+        // 跳转目标与 phi 前驱须是本函数中真实存在的基本块
+        for (size_t label : usedLabels)
+        {
+            if (in.ok() && !seen[label]) in.fail("branch to a missing block");
+        }
+        usedLabels.clear();
+    }
+
+    // 各字段的读取顺序与 IRBinWriter 中对应 visit 的写出顺序一致；实参求值顺序未定义，故每次调用至多在实参中读取一次
+    Instruction* IRBinReader::readInst(IRBinary::Reader& in, Function& func)
+    {
+        Operator op = static_cast<Operator>(in.getBounded(static_cast<uint64_t>(Operator::FUNCDEF), "invalid opcode"));
+        switch (op)
+        {
+            case Operator::LOAD:
+            {
+                DataType dt  = getType(in);
+                Operand* ptr = getValue(in);
+                Operand* res = getOperand(in, OperandType::REG);
+                return func.create<LoadInst>(dt, ptr, res);
+            }
+            case Operator::STORE:
+            {
+                DataType dt  = getType(in);
+                Operand* val = getValue(in);
+                Operand* ptr = getValue(in);
+                return func.create<StoreInst>(dt, val, ptr);
+            }
+            case Operator::ADD:
+            case Operator::SUB:
+            case Operator::MUL:
+            case Operator::DIV:
+            case Operator::MOD:
+            case Operator::FADD:
+            case Operator::FSUB:
+            case Operator::FMUL:
+            case Operator::FDIV:
+            case Operator::BITXOR:
+            case Operator::BITAND:
+            case Operator::SHL:
+            case Operator::ASHR:
+            case Operator::LSHR:
+            {
+                DataType dt  = getType(in);
+                Operand* lhs = getValue(in);
+                Operand* rhs = getValue(in);
+                Operand* res = getOperand(in, OperandType::REG);
+                return func.create<ArithmeticInst>(op, dt, lhs, rhs, res);
+            }
+            case Operator::ICMP:
+            {
+                DataType dt   = getType(in);
+                ICmpOp   cond = static_cast<ICmpOp>(in.getBounded(static_cast<uint64_t>(ICmpOp::SLE), "invalid icmp"));
+                if (cond == static_cast<ICmpOp>(0)) in.fail("invalid icmp");
+                Operand* lhs  = getValue(in);
+                Operand* rhs  = getValue(in);
+                Operand* res  = getOperand(in, OperandType::REG);
+                return func.create<IcmpInst>(dt, cond, lhs, rhs, res);
+            }
+            case Operator::FCMP:
+            {
+                DataType dt   = getType(in);
+                FCmpOp   cond = static_cast<FCmpOp>(in.getBounded(static_cast<uint64_t>(FCmpOp::UNO), "invalid fcmp"));
+                if (cond == static_cast<FCmpOp>(0)) in.fail("invalid fcmp");
+                Operand* lhs  = getValue(in);
+                Operand* rhs  = getValue(in);
+                Operand* res  = getOperand(in, OperandType::REG);
+                return func.create<FcmpInst>(dt, cond, lhs, rhs, res);
+            }
+            case Operator::ALLOCA:
+            {
+                DataType dt  = getType(in);
+                Operand* res = getOperand(in, OperandType::REG);
+                return func.create<AllocaInst>(dt, res, getDims(in));
+            }
+            case Operator::BR_COND:
+            {
+                Operand* cond = getValue(in);
+                Operand* t    = getOperand(in, OperandType::LABEL);
+                Operand* f    = getOperand(in, OperandType::LABEL);
+                return func.create<BrCondInst>(cond, t, f);
+            }
+            case Operator::BR_UNCOND: return func.create<BrUncondInst>(getOperand(in, OperandType::LABEL));
+            case Operator::CALL:
+            {
+                DataType          retType = getType(in);
+                std::string       name    = getString(in);
+                CallInst::argList args(in.getCount());
+                for (auto& [dt, arg] : args)
+                {
+                    dt  = getType(in);
+                    arg = getValue(in);
+                }
+                // 返回值为 void 时结果为空，否则须为寄存器
+                Operand* res = retType == DataType::VOID ? getOperand(in) : getOperand(in, OperandType::REG);
+                return func.create<CallInst>(retType, name, std::move(args), res);
+            }
+            case Operator::RET:
+            {
+                DataType rt = getType(in);
+                return func.create<RetInst>(rt, rt == DataType::VOID ? getOperand(in) : getValue(in));
+            }
+            case Operator::GETELEMENTPTR:
+            {
+                DataType              dt      = getType(in);
+                DataType              idxType = getType(in);
+                Operand*              base    = getValue(in);
+                Operand*              res     = getOperand(in, OperandType::REG);
+                std::vector<int>      dims    = getDims(in);
+                std::vector<Operand*> idxs(in.getCount());
+                for (auto& idx : idxs) idx = getValue(in);
+                return func.create<GEPInst>(dt, idxType, base, res, std::move(dims), std::move(idxs));
+            }
+            case Operator::FPTOSI:
+            {
+                Operand* src = getValue(in);
+                return func.create<FP2SIInst>(src, getOperand(in, OperandType::REG));
+            }
+            case Operator::SITOFP:
+            {
+                Operand* src = getValue(in);
+                return func.create<SI2FPInst>(src, getOperand(in, OperandType::REG));
+            }
+            case Operator::ZEXT:
+            {
+                DataType from = getType(in);
+                DataType to   = getType(in);
+                Operand* src  = getValue(in);
+                return func.create<ZextInst>(from, to, src, getOperand(in, OperandType::REG));
+            }
+            case Operator::PHI:
+            {
+                DataType dt  = getType(in);
+                auto*    phi = func.create<PhiInst>(dt, getOperand(in, OperandType::REG));
+                size_t   n   = in.getCount();
+                for (size_t i = 0; i < n && in.ok(); ++i)
+                {
+                    Operand* label = getOperand(in, OperandType::LABEL);
+                    Operand* val   = getValue(in);
+                    if (!in.ok()) break;
+                    phi->incomingVals[label] = val;
+                }
+                return phi;
+            }
+            default: in.fail("unexpected instruction opcode"); return nullptr;
+        }
+    }
+}  // namespace ME
@@ -0,0 +1,306 @@
+#include <middleend/visitor/binary/ir_binary.h>
+#include <cstring>
+#include <fstream>
+
+namespace ME
+{
+    namespace IRBinary
+    {
+        void Writer::putF32(float v)
+        {
+            uint32_t bits;
+            std::memcpy(&bits, &v, sizeof(bits));
+            char b[4] = {static_cast<char>(bits), static_cast<char>(bits >> 8), static_cast<char>(bits >> 16),
+                static_cast<char>(bits >> 24)};
+            putRaw(b, sizeof(b));
+        }
+    }  // namespace IRBinary
+
+    static void putType(IRBinary::Writer& out, DataType dt) { out.put(static_cast<uint64_t>(dt)); }
+
+    // 正文先写入内存，字符串表在写正文时同步收集，最后按 头部 / 字符串表 / 正文 的顺序落盘
+    bool IRBinWriter::write(Module& module, const std::string& path, std::string& err)
+    {
+        strings.clear();
+        stringIds.clear();
+
+        IRBinary::Writer body;
+        apply(*this, module, body);
+
+        IRBinary::Writer head;
+        head.putRaw(IRBinary::kMagic, sizeof(IRBinary::kMagic));
+        head.put(IRBinary::kVersion);
+        head.put(strings.size());
+        for (auto s : strings)
+        {
+            head.put(s.size());
+            head.putRaw(s.data(), s.size());
+        }
+
+        std::ofstream os(path, std::ios::binary);
+        if (!os)
+        {
+            err = "cannot open " + path;
+            return false;
+        }
+        os.write(head.data().data(), head.data().size());
+        os.write(body.data().data(), body.data().size());
+        if (!os)
+        {
+            err = "failed to write " + path;
+            return false;
+        }
+        return true;
+    }
+
+    size_t IRBinWriter::intern(std::string_view s)
+    {
+        auto [it, inserted] = stringIds.try_emplace(s, strings.size());
+        if (inserted) strings.push_back(s);
+        return it->second;
+    }
+    void IRBinWriter::putString(IRBinary::Writer& out, std::string_view s) { out.put(intern(s)); }
+
+    void IRBinWriter::putOperand(IRBinary::Writer& out, const Operand* op)
+    {
+        if (!op)
+        {
+            out.put(0);
+            return;
+        }
+
+        uint64_t tag = static_cast<uint64_t>(op->getType());
+        switch (op->getType())
+        {
+            case OperandType::REG: out.put(static_cast<const RegOperand*>(op)->regNum << 3 | tag); break;
+            case OperandType::IMMEI32:
+            {
+                out.put(IRBinary::zigzag(static_cast<const ImmeI32Operand*>(op)->value) << 3 | tag);
+                break;
+            }
+            case OperandType::IMMEF32:
+                out.put(tag);
+                out.putF32(static_cast<const ImmeF32Operand*>(op)->value);
+                break;
+            case OperandType::GLOBAL:
+                out.put(intern(static_cast<const GlobalOperand*>(op)->name) << 3 | tag);
+                break;
+            case OperandType::LABEL: out.put(static_cast<const LabelOperand*>(op)->lnum << 3 | tag); break;
+            default: ERROR("Unsupported operand in binary IR writer");
+        }
+    }
+
+    void IRBinWriter::visit(Module& module, IRBinary::Writer& out)
+    {
+        out.put(module.funcDecls.size());
+        for (auto* fdecl : module.funcDecls) apply(*this, *fdecl, out);
+
+        out.put(module.globalVars.size());
+        for (auto* gdef : module.globalVars) apply(*this, *gdef, out);
+
+        out.put(module.functions.size());
+        for (auto* func : module.functions) apply(*this, *func, out);
+    }
+
+    void IRBinWriter::visit(Function& func, IRBinary::Writer& out)
+    {
+        // 寄存器与标签上界写在最前，读入时据此检查函数内出现的全部编号
+        out.put(func.getMaxReg());
+        out.put(func.getMaxLabel());
+        out.put(func.loopStartLabel);
+        out.put(func.loopEndLabel);
+        apply(*this, *func.funcDef, out);
+
+        out.put(func.blocks.size());
+        for (auto* block : func.blocks) apply(*this, *block, out);
+    }
+
+    void IRBinWriter::visit(Block& block, IRBinary::Writer& out)
+    {
+        out.put(block.blockId);
+#ifdef ENABLE_IRBLOCK_COMMENT
+        putString(out, block.comment);
+#else
+        static const std::string noComment;
+        putString(out, noComment);
+#endif
+        out.put(block.insts.size());
+        for (auto* inst : block.insts)
+        {
+            out.put(static_cast<uint64_t>(inst->opcode));
+            apply(*this, *inst, out);
+        }
+    }
+
+    void IRBinWriter::visit(LoadInst& inst, IRBinary::Writer& out)
+    {
+        putType(out, inst.dt);
+        putOperand(out, inst.ptr);
+        putOperand(out, inst.res);
+    }
+    void IRBinWriter::visit(StoreInst& inst, IRBinary::Writer& out)
+    {
+        putType(out, inst.dt);
+        putOperand(out, inst.val);
+        putOperand(out, inst.ptr);
+    }
+    void IRBinWriter::visit(ArithmeticInst& inst, IRBinary::Writer& out)
+    {
+        putType(out, inst.dt);
+        putOperand(out, inst.lhs);
+        putOperand(out, inst.rhs);
+        putOperand(out, inst.res);
+    }
+    void IRBinWriter::visit(IcmpInst& inst, IRBinary::Writer& out)
+    {
+        putType(out, inst.dt);
+        out.put(static_cast<uint64_t>(inst.cond));
+        putOperand(out, inst.lhs);
+        putOperand(out, inst.rhs);
+        putOperand(out, inst.res);
+    }
+    void IRBinWriter::visit(FcmpInst& inst, IRBinary::Writer& out)
+    {
+        putType(out, inst.dt);
+        out.put(static_cast<uint64_t>(inst.cond));
+        putOperand(out, inst.lhs);
+        putOperand(out, inst.rhs);
+        putOperand(out, inst.res);
+    }
+    void IRBinWriter::visit(AllocaInst& inst, IRBinary::Writer& out)
+    {
+        putType(out, inst.dt);
+        putOperand(out, inst.res);
+        putDims(out, inst.dims);
+    }
+    void IRBinWriter::visit(BrCondInst& inst, IRBinary::Writer& out)
+    {
+        putOperand(out, inst.cond);
+        putOperand(out, inst.trueTar);
+        putOperand(out, inst.falseTar);
+    }
+    void IRBinWriter::visit(BrUncondInst& inst, IRBinary::Writer& out) { putOperand(out, inst.target); }
+
+    // 数组初值表只写出非零元素组成的若干段：段数，随后每段为 (与上一段之间的零元素个数, 段长, 各元素值)
+    // 元素值按 dt 统一编码：F32 / DOUBLE 为 32 位浮点，其余为有符号整数；全零数组只占一个段数 0
+    void IRBinWriter::visit(GlbVarDeclInst& inst, IRBinary::Writer& out)
+    {
+        putType(out, inst.dt);
+        putString(out, inst.name);
+        putOperand(out, inst.init);
+        putDims(out, inst.initList.arrayDims);
+        if (inst.initList.arrayDims.empty()) return;
+
+        const auto& vals    = inst.initList.initList;
+        bool        isFloat = inst.dt == DataType::F32 || inst.dt == DataType::DOUBLE;
+        auto        isZero  = [&](const FE::AST::VarValue& v) {
+            if (v.type == FE::AST::voidType) return true;
+            if (!isFloat) return v.getLL() == 0;
+            float    f = v.getFloat();
+            uint32_t bits;
+            std::memcpy(&bits, &f, sizeof(bits));
+            return bits == 0;
+        };
+
+        std::vector<std::pair<size_t, size_t>> runs;
+        for (size_t i = 0; i < vals.size(); ++i)
+        {
+            if (isZero(vals[i])) continue;
+            if (!runs.empty() && runs.back().second == i)
+                runs.back().second = i + 1;
+            else
+                runs.emplace_back(i, i + 1);
+        }
+
+        out.put(vals.size());
+        out.put(runs.size());
+        size_t prev = 0;
+        for (auto [begin, end] : runs)
+        {
+            out.put(begin - prev);
+            out.put(end - begin);
+            for (size_t i = begin; i < end; ++i)
+            {
+                if (isFloat)
+                    out.putF32(vals[i].getFloat());
+                else
+                    out.putSigned(vals[i].getLL());
+            }
+            prev = end;
+        }
+    }
+    void IRBinWriter::visit(CallInst& inst, IRBinary::Writer& out)
+    {
+        putType(out, inst.retType);
+        putString(out, inst.funcName);
+        out.put(inst.args.size());
+        for (auto& [dt, arg] : inst.args)
+        {
+            putType(out, dt);
+            putOperand(out, arg);
+        }
+        putOperand(out, inst.res);
+    }
+    void IRBinWriter::visit(FuncDeclInst& inst, IRBinary::Writer& out)
+    {
+        putType(out, inst.retType);
+        putString(out, inst.funcName);
+        out.put(inst.argTypes.size());
+        for (auto dt : inst.argTypes) putType(out, dt);
+        out.put(inst.isVarArg);
+    }
+    void IRBinWriter::visit(FuncDefInst& inst, IRBinary::Writer& out)
+    {
+        putType(out, inst.retType);
+        putString(out, inst.funcName);
+        out.put(inst.argRegs.size());
+        for (auto& [dt, reg] : inst.argRegs)
+        {
+            putType(out, dt);
+            putOperand(out, reg);
+        }
+    }
+    void IRBinWriter::visit(RetInst& inst, IRBinary::Writer& out)
+    {
+        putType(out, inst.rt);
+        putOperand(out, inst.res);
+    }
+    void IRBinWriter::visit(GEPInst& inst, IRBinary::Writer& out)
+    {
+        putType(out, inst.dt);
+        putType(out, inst.idxType);
+        putOperand(out, inst.basePtr);
+        putOperand(out, inst.res);
+        putDims(out, inst.dims);
+        out.put(inst.idxs.size());
+        for (auto* idx : inst.idxs) putOperand(out, idx);
+    }
+    void IRBinWriter::visit(FP2SIInst& inst, IRBinary::Writer& out)
+    {
+        putOperand(out, inst.src);
+        putOperand(out, inst.dest);
+    }
+    void IRBinWriter::visit(SI2FPInst& inst, IRBinary::Writer& out)
+    {
+        putOperand(out, inst.src);
+        putOperand(out, inst.dest);
+    }
+    void IRBinWriter::visit(ZextInst& inst, IRBinary::Writer& out)
+    {
+        putType(out, inst.from);
+        putType(out, inst.to);
+        putOperand(out, inst.src);
+        putOperand(out, inst.dest);
+    }
+    void IRBinWriter::visit(PhiInst& inst, IRBinary::Writer& out)
+    {
+        putType(out, inst.dt);
+        putOperand(out, inst.res);
+        out.put(inst.incomingVals.size());
+        for (auto& [label, val] : inst.incomingVals)
+        {
+            putOperand(out, label);
+            putOperand(out, val);
+        }
+    }
+}  // namespace ME
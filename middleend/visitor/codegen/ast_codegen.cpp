@@ -6,46 +6,48 @@ namespace ME
     void ASTCodeGen::libFuncRegister(Module* m)
     {
         auto& decls = m->funcDecls;
+        using ArgTypes = std::vector<DataType>;
 
         // int getint();
-        decls.emplace_back(new FuncDeclInst(DataType::I32, "getint"));
+        decls.emplace_back(m->create<FuncDeclInst>(DataType::I32, "getint"));
 
         // int getch();
-        decls.emplace_back(new FuncDeclInst(DataType::I32, "getch"));
+        decls.emplace_back(m->create<FuncDeclInst>(DataType::I32, "getch"));
 
         // int getarray(int a[]);
-        decls.emplace_back(new FuncDeclInst(DataType::I32, "getarray", {DataType::PTR}));
+        decls.emplace_back(m->create<FuncDeclInst>(DataType::I32, "getarray", ArgTypes{DataType::PTR}));
 
         // float getfloat();
-        decls.emplace_back(new FuncDeclInst(DataType::F32, "getfloat"));
+        decls.emplace_back(m->create<FuncDeclInst>(DataType::F32, "getfloat"));
 
         // int getfarray(float a[]);
-        decls.emplace_back(new FuncDeclInst(DataType::I32, "getfarray", {DataType::PTR}));
+        decls.emplace_back(m->create<FuncDeclInst>(DataType::I32, "getfarray", ArgTypes{DataType::PTR}));
 
         // void putint(int a);
-        decls.emplace_back(new FuncDeclInst(DataType::VOID, "putint", {DataType::I32}));
+        decls.emplace_back(m->create<FuncDeclInst>(DataType::VOID, "putint", ArgTypes{DataType::I32}));
 
         // void putch(int a);
-        decls.emplace_back(new FuncDeclInst(DataType::VOID, "putch", {DataType::I32}));
+        decls.emplace_back(m->create<FuncDeclInst>(DataType::VOID, "putch", ArgTypes{DataType::I32}));
 
         // void putarray(int n, int a[]);
-        decls.emplace_back(new FuncDeclInst(DataType::VOID, "putarray", {DataType::I32, DataType::PTR}));
+        decls.emplace_back(m->create<FuncDeclInst>(DataType::VOID, "putarray", ArgTypes{DataType::I32, DataType::PTR}));
 
         // void putfloat(float a);
-        decls.emplace_back(new FuncDeclInst(DataType::VOID, "putfloat", {DataType::F32}));
+        decls.emplace_back(m->create<FuncDeclInst>(DataType::VOID, "putfloat", ArgTypes{DataType::F32}));
 
         // void putfarray(int n, float a[]);
-        decls.emplace_back(new FuncDeclInst(DataType::VOID, "putfarray", {DataType::I32, DataType::PTR}));
+        decls.emplace_back(
+            m->create<FuncDeclInst>(DataType::VOID, "putfarray", ArgTypes{DataType::I32, DataType::PTR}));
 
         // void starttime(int lineno);
-        decls.emplace_back(new FuncDeclInst(DataType::VOID, "_sysy_starttime", {DataType::I32}));
+        decls.emplace_back(m->create<FuncDeclInst>(DataType::VOID, "_sysy_starttime", ArgTypes{DataType::I32}));
 
         // void stoptime(int lineno);
-        decls.emplace_back(new FuncDeclInst(DataType::VOID, "_sysy_stoptime", {DataType::I32}));
+        decls.emplace_back(m->create<FuncDeclInst>(DataType::VOID, "_sysy_stoptime", ArgTypes{DataType::I32}));
 
         // llvm memset
-        decls.emplace_back(new FuncDeclInst(
-            DataType::VOID, "llvm.memset.p0.i32", {DataType::PTR, DataType::I8, DataType::I32, DataType::I1}));
+        decls.emplace_back(m->create<FuncDeclInst>(
+            DataType::VOID, "llvm.memset.p0.i32", ArgTypes{DataType::PTR, DataType::I8, DataType::I32, DataType::I1}));
     }
 
 
@@ -80,7 +82,7 @@ namespace ME
                         initOp = getImmeI32Operand(initVal.getInt());
                     }
                 }
-                m->globalVars.emplace_back(new GlbVarDeclInst(dt, name, initOp));
+                m->globalVars.emplace_back(m->create<GlbVarDeclInst>(dt, name, initOp));
             }
             else // 数组全局变量
             {
@@ -119,7 +121,7 @@ namespace ME
                     arrayAttr.initList.resize(totalElem, zeroValue);
                 }
 
-                m->globalVars.emplace_back(new GlbVarDeclInst(dt, name, arrayAttr));
+                m->globalVars.emplace_back(m->create<GlbVarDeclInst>(dt, name, arrayAttr));
             }
         }
     }
@@ -182,7 +184,7 @@ namespace ME
     void ASTCodeGen::visit(FE::AST::Root& node, Module* m)
     {
         // 示例：注册库函数
-        libFuncRegister(m);
+        beginModule(m);
 
         // TODO(Lab 3-2): 生成模块级 IR
         // 处理顶层语句：全局变量声明、函数定义等
@@ -193,139 +195,164 @@ namespace ME
         if (!stmts) return;
 
         // 逐个处理根节点的顶层语句，仅允许全局变量声明或函数定义
-        for (auto* stmt : *stmts)
-        {
-            if (!stmt) continue;
+        for (auto* stmt : *stmts) genTopLevel(stmt, m);
+    }
 
-            if (auto* varDecl = dynamic_cast<FE::AST::VarDeclStmt*>(stmt)) { handleGlobalVarDecl(varDecl, m); }
-            else if (auto* funcDecl = dynamic_cast<FE::AST::FuncDeclStmt*>(stmt)) 
-            {
-                apply(*this, *funcDecl, m);  // apply函数简化访问者调用（封装了“根据节点实际类型选择正确 visit 并转发额外参数”的模板工具）
-            }  
-            else
-            {
-                ERROR("Unsupported top-level statement at line %d", stmt->line_num);
-            }
+    void ASTCodeGen::beginModule(Module* m)
+    {
+        operands = &m->getOperandFactory();
+        libFuncRegister(m);
+    }
+
+    void ASTCodeGen::genTopLevel(FE::AST::StmtNode* stmt, Module* m)
+    {
+        if (!stmt) return;
+
+        if (auto* varDecl = dynamic_cast<FE::AST::VarDeclStmt*>(stmt)) { handleGlobalVarDecl(varDecl, m); }
+        else if (auto* funcDecl = dynamic_cast<FE::AST::FuncDeclStmt*>(stmt)) 
+        {
+            apply(*this, *funcDecl, m);  // apply函数简化访问者调用（封装了“根据节点实际类型选择正确 visit 并转发额外参数”的模板工具）
+        }  
+        else
+        {
+            ERROR("Unsupported top-level statement at line %d", stmt->line_num);
         }
     }
 
     LoadInst* ASTCodeGen::createLoadInst(DataType t, Operand* ptr, size_t resReg)
     {
-        return new LoadInst(t, ptr, getRegOperand(resReg));
+        return curFunc->create<LoadInst>(t, ptr, getRegOperand(resReg));
     }
 
     StoreInst* ASTCodeGen::createStoreInst(DataType t, size_t valReg, Operand* ptr)
     {
-        return new StoreInst(t, getRegOperand(valReg), ptr);
+        return curFunc->create<StoreInst>(t, getRegOperand(valReg), ptr);
     }
     StoreInst* ASTCodeGen::createStoreInst(DataType t, Operand* val, Operand* ptr)
     {
-        return new StoreInst(t, val, ptr);
+        return curFunc->create<StoreInst>(t, val, ptr);
     }
 
     ArithmeticInst* ASTCodeGen::createArithmeticI32Inst(Operator op, size_t lhsReg, size_t rhsReg, size_t resReg)
     {
-        return new ArithmeticInst(
+        return curFunc->create<ArithmeticInst>(
             op, DataType::I32, getRegOperand(lhsReg), getRegOperand(rhsReg), getRegOperand(resReg));
     }
     ArithmeticInst* ASTCodeGen::createArithmeticI32Inst_ImmeLeft(Operator op, int lhsVal, size_t rhsReg, size_t resReg)
     {
-        return new ArithmeticInst(
+        return curFunc->create<ArithmeticInst>(
             op, DataType::I32, getImmeI32Operand(lhsVal), getRegOperand(rhsReg), getRegOperand(resReg));
     }
     ArithmeticInst* ASTCodeGen::createArithmeticI32Inst_ImmeAll(Operator op, int lhsVal, int rhsVal, size_t resReg)
     {
-        return new ArithmeticInst(
+        return curFunc->create<ArithmeticInst>(
             op, DataType::I32, getImmeI32Operand(lhsVal), getImmeI32Operand(rhsVal), getRegOperand(resReg));
     }
     ArithmeticInst* ASTCodeGen::createArithmeticF32Inst(Operator op, size_t lhsReg, size_t rhsReg, size_t resReg)
     {
-        return new ArithmeticInst(
+        return curFunc->create<ArithmeticInst>(
             op, DataType::F32, getRegOperand(lhsReg), getRegOperand(rhsReg), getRegOperand(resReg));
     }
     ArithmeticInst* ASTCodeGen::createArithmeticF32Inst_ImmeLeft(
         Operator op, float lhsVal, size_t rhsReg, size_t resReg)
     {
-        return new ArithmeticInst(
+        return curFunc->create<ArithmeticInst>(
             op, DataType::F32, getImmeF32Operand(lhsVal), getRegOperand(rhsReg), getRegOperand(resReg));
     }
     ArithmeticInst* ASTCodeGen::createArithmeticF32Inst_ImmeAll(Operator op, float lhsVal, float rhsVal, size_t resReg)
     {
-        return new ArithmeticInst(
+        return curFunc->create<ArithmeticInst>(
             op, DataType::F32, getImmeF32Operand(lhsVal), getImmeF32Operand(rhsVal), getRegOperand(resReg));
     }
 
     IcmpInst* ASTCodeGen::createIcmpInst(ICmpOp cond, size_t lhsReg, size_t rhsReg, size_t resReg)
     {
-        return new IcmpInst(DataType::I32, cond, getRegOperand(lhsReg), getRegOperand(rhsReg), getRegOperand(resReg));
+        return curFunc->create<IcmpInst>(
+            DataType::I32, cond, getRegOperand(lhsReg), getRegOperand(rhsReg), getRegOperand(resReg));
     }
     IcmpInst* ASTCodeGen::createIcmpInst_ImmeRight(ICmpOp cond, size_t lhsReg, int rhsVal, size_t resReg)
     {
-        return new IcmpInst(
+        return curFunc->create<IcmpInst>(
             DataType::I32, cond, getRegOperand(lhsReg), getImmeI32Operand(rhsVal), getRegOperand(resReg));
     }
     FcmpInst* ASTCodeGen::createFcmpInst(FCmpOp cond, size_t lhsReg, size_t rhsReg, size_t resReg)
     {
-        return new FcmpInst(DataType::F32, cond, getRegOperand(lhsReg), getRegOperand(rhsReg), getRegOperand(resReg));
+        return curFunc->create<FcmpInst>(
+            DataType::F32, cond, getRegOperand(lhsReg), getRegOperand(rhsReg), getRegOperand(resReg));
     }
     FcmpInst* ASTCodeGen::createFcmpInst_ImmeRight(FCmpOp cond, size_t lhsReg, float rhsVal, size_t resReg)
     {
-        return new FcmpInst(
+        return curFunc->create<FcmpInst>(
             DataType::F32, cond, getRegOperand(lhsReg), getImmeF32Operand(rhsVal), getRegOperand(resReg));
     }
 
     FP2SIInst* ASTCodeGen::createFP2SIInst(size_t srcReg, size_t destReg)
     {
-        return new FP2SIInst(getRegOperand(srcReg), getRegOperand(destReg));
+        return curFunc->create<FP2SIInst>(getRegOperand(srcReg), getRegOperand(destReg));
     }
     SI2FPInst* ASTCodeGen::createSI2FPInst(size_t srcReg, size_t destReg)
     {
-        return new SI2FPInst(getRegOperand(srcReg), getRegOperand(destReg));
+        return curFunc->create<SI2FPInst>(getRegOperand(srcReg), getRegOperand(destReg));
     }
     ZextInst* ASTCodeGen::createZextInst(size_t srcReg, size_t destReg, size_t srcBits, size_t destBits)
     {
         ASSERT(srcBits == 1 && destBits == 32 && "Currently only support i1 to i32 zext");
-        return new ZextInst(DataType::I1, DataType::I32, getRegOperand(srcReg), getRegOperand(destReg));
+        return curFunc->create<ZextInst>(DataType::I1, DataType::I32, getRegOperand(srcReg), getRegOperand(destReg));
     }
 
     GEPInst* ASTCodeGen::createGEP_I32Inst(
         DataType t, Operand* ptr, std::vector<int> dims, std::vector<Operand*> is, size_t resReg)
     {
-        return new GEPInst(t, DataType::I32, ptr, getRegOperand(resReg), dims, is);
+        return curFunc->create<GEPInst>(t, DataType::I32, ptr, getRegOperand(resReg), dims, is);
     }
 
     CallInst* ASTCodeGen::createCallInst(DataType t, std::string funcName, CallInst::argList args, size_t resReg)
     {
-        return new CallInst(t, funcName, args, getRegOperand(resReg));
+        return curFunc->create<CallInst>(t, funcName, args, getRegOperand(resReg));
     }
     CallInst* ASTCodeGen::createCallInst(DataType t, std::string funcName, CallInst::argList args)
     {
-        return new CallInst(t, funcName, args);
+        return curFunc->create<CallInst>(t, funcName, args);
     }
     CallInst* ASTCodeGen::createCallInst(DataType t, std::string funcName, size_t resReg)
     {
-        return new CallInst(t, funcName, getRegOperand(resReg));
+        return curFunc->create<CallInst>(t, funcName, getRegOperand(resReg));
+    }
+    CallInst* ASTCodeGen::createCallInst(DataType t, std::string funcName)
+    {
+        return curFunc->create<CallInst>(t, funcName);
     }
-    CallInst* ASTCodeGen::createCallInst(DataType t, std::string funcName) { return new CallInst(t, funcName); }
 
-    RetInst* ASTCodeGen::createRetInst() { return new RetInst(DataType::VOID); }
-    RetInst* ASTCodeGen::createRetInst(DataType t, size_t retReg) { return new RetInst(t, getRegOperand(retReg)); }
-    RetInst* ASTCodeGen::createRetInst(int val) { return new RetInst(DataType::I32, getImmeI32Operand(val)); }
-    RetInst* ASTCodeGen::createRetInst(float val) { return new RetInst(DataType::F32, getImmeF32Operand(val)); }
+    RetInst* ASTCodeGen::createRetInst() { return curFunc->create<RetInst>(DataType::VOID); }
+    RetInst* ASTCodeGen::createRetInst(DataType t, size_t retReg)
+    {
+        return curFunc->create<RetInst>(t, getRegOperand(retReg));
+    }
+    RetInst* ASTCodeGen::createRetInst(int val)
+    {
+        return curFunc->create<RetInst>(DataType::I32, getImmeI32Operand(val));
+    }
+    RetInst* ASTCodeGen::createRetInst(float val)
+    {
+        return curFunc->create<RetInst>(DataType::F32, getImmeF32Operand(val));
+    }
 
     BrCondInst* ASTCodeGen::createBranchInst(size_t condReg, size_t trueTar, size_t falseTar)
     {
-        return new BrCondInst(getRegOperand(condReg), getLabelOperand(trueTar), getLabelOperand(falseTar));
+        return curFunc->create<BrCondInst>(getRegOperand(condReg), getLabelOperand(trueTar), getLabelOperand(falseTar));
+    }
+    BrUncondInst* ASTCodeGen::createBranchInst(size_t tar)
+    {
+        return curFunc->create<BrUncondInst>(getLabelOperand(tar));
     }
-    BrUncondInst* ASTCodeGen::createBranchInst(size_t tar) { return new BrUncondInst(getLabelOperand(tar)); }
 
     AllocaInst* ASTCodeGen::createAllocaInst(DataType t, size_t ptrReg)
     {
-        return new AllocaInst(t, getRegOperand(ptrReg));
+        return curFunc->create<AllocaInst>(t, getRegOperand(ptrReg));
     }
     AllocaInst* ASTCodeGen::createAllocaInst(DataType t, size_t ptrReg, std::vector<int> dims)
     {
-        return new AllocaInst(t, getRegOperand(ptrReg), dims);
+        return curFunc->create<AllocaInst>(t, getRegOperand(ptrReg), dims);
     }
 
     std::list<Instruction*> ASTCodeGen::createTypeConvertInst(DataType from, DataType to, size_t srcReg)
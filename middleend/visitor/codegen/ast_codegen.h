@@ -10,6 +10,7 @@
 #include <middleend/module/ir_module.h>
 #include <debug.h>
 #include <list>
+#include <vector>
 
 /*
  * Lab 3-2: 中间代码生成 (IR Generation)
@@ -47,54 +48,62 @@ namespace ME
       private:
         const std::map<FE::Sym::Entry*, FE::AST::VarAttr>&       glbSymbols;
         const std::map<FE::Sym::Entry*, FE::AST::FuncDeclStmt*>& funcDecls;
+        OperandFactory*                                          operands;  // 当前模块的操作数驻留表
         Function*                                                curFunc;
         Block*                                                   curBlock;
         class RegTab // 符号寄存器映射表
         {
-          public:
-            struct Scope
+          private:
+            // 与 FE::Sym::SymTable 相同的遮蔽栈结构：按 Entry id 直接取最内层绑定，退出作用域只弹出本层绑定
+            struct Binding
             {
-                std::map<FE::Sym::Entry*, size_t> sym2Reg;
-                Scope*                            parent;
-
-                Scope(Scope* parent = nullptr) : sym2Reg(), parent(parent) {}
-                ~Scope() = default;
+                FE::Sym::Entry* entry;
+                size_t          reg;
+                size_t          shadowed;  // 被遮蔽的同名外层绑定下标，npos 表示没有
             };
-            Scope* curScope;
+            static constexpr size_t npos = static_cast<size_t>(-1);
+
+            std::vector<Binding> bindings;
+            std::vector<size_t>  visible;     // Entry id -> bindings 下标
+            std::vector<size_t>  scopeMarks;  // 各层作用域进入时 bindings 的长度
 
           public:
-            RegTab() : curScope(new Scope(nullptr)) {}
-            ~RegTab()
-            {
-                Scope* scope = curScope;
-                while (scope)
-                {
-                    Scope* parent = scope->parent;
-                    delete scope;
-                    scope = parent;
-                }
-            }
+            RegTab() : bindings(), visible(), scopeMarks() {}
 
           public:
-            void   addSymbol(FE::Sym::Entry* entry, size_t reg) { curScope->sym2Reg[entry] = reg; }
+            void addSymbol(FE::Sym::Entry* entry, size_t reg)
+            {
+                uint32_t id = entry->getId();
+                if (id >= visible.size()) visible.resize(FE::Sym::Entry::count(), npos);
+                bindings.push_back({entry, reg, visible[id]});
+                visible[id] = bindings.size() - 1;
+            }
             size_t getReg(FE::Sym::Entry* entry)
             {
-                Scope* scope = curScope;
-                while (scope)
+                uint32_t id = entry->getId();
+                if (id >= visible.size() || visible[id] == npos) return static_cast<size_t>(-1);
+                return bindings[visible[id]].reg;
+            }
+
+            void enterScope() { scopeMarks.push_back(bindings.size()); }
+            void exitScope()
+            {
+                ASSERT(!scopeMarks.empty() && "No scope to exit");
+                size_t mark = scopeMarks.back();
+                scopeMarks.pop_back();
+                while (bindings.size() > mark)
                 {
-                    if (scope->sym2Reg.find(entry) != scope->sym2Reg.end()) return scope->sym2Reg[entry];
-                    scope = scope->parent;
+                    visible[bindings.back().entry->getId()] = bindings.back().shadowed;
+                    bindings.pop_back();
                 }
-                return static_cast<size_t>(-1);
             }
 
-            void enterScope() { curScope = new Scope(curScope); }
-            void exitScope()
+            // 回到只有最外层作用域且其中没有任何绑定的状态
+            void reset()
             {
-                ASSERT(curScope != nullptr && "No scope to exit");
-                Scope* parent = curScope->parent;
-                delete curScope;
-                curScope = parent;
+                for (auto& b : bindings) visible[b.entry->getId()] = npos;
+                bindings.clear();
+                scopeMarks.clear();
             }
         } name2reg;
         std::map<size_t, FE::AST::VarAttr>        reg2attr; // 寄存器属性映射表
@@ -107,6 +116,7 @@ namespace ME
             const std::map<FE::Sym::Entry*, FE::AST::FuncDeclStmt*>&  funcDecls)
             : glbSymbols(glbSymbols),
               funcDecls(funcDecls),
+              operands(nullptr),
               curFunc(nullptr),
               curBlock(nullptr),
               name2reg(),
@@ -116,6 +126,10 @@ namespace ME
               glbAttrCache()
         {}
 
+        // 分步生成，visit(Root) 即依次调用这两步；流式编译时每检查完一条顶层语句就生成一条
+        void beginModule(Module* m);
+        void genTopLevel(FE::AST::StmtNode* stmt, Module* m);
+
       private:
         // Basic AST nodes
         void visit(FE::AST::Root& node, Module* m) override;
@@ -168,6 +182,12 @@ namespace ME
         size_t getNewRegId() { return curFunc->getNewRegId(); }
         void   insert(Instruction* inst) { curBlock->insertBack(inst); }
 
+        RegOperand*     getRegOperand(size_t id) { return operands->getRegOperand(id); }
+        ImmeI32Operand* getImmeI32Operand(int value) { return operands->getImmeI32Operand(value); }
+        ImmeF32Operand* getImmeF32Operand(float value) { return operands->getImmeF32Operand(value); }
+        GlobalOperand*  getGlobalOperand(const std::string& name) { return operands->getGlobalOperand(name); }
+        LabelOperand*   getLabelOperand(size_t num) { return operands->getLabelOperand(num); }
+
       private:
         DataType convert(FE::AST::Type* at);
         void     handleUnaryCalc(FE::AST::ExprNode& node, FE::AST::Operator uop, Block* block, Module* m);
@@ -230,7 +230,7 @@ namespace ME
         // 在汇合块用phi合并结果
         enterBlock(endBlock);
         size_t resReg = getNewRegId();
-        auto* phi = new PhiInst(DataType::I1, getRegOperand(resReg));
+        auto* phi = curFunc->create<PhiInst>(DataType::I1, getRegOperand(resReg));
         // lhs 为假时直接复用 lhsReg（已保证为 i1），避免使用 i32 立即数导致的类型不一致
         auto* lhsLabel = getLabelOperand(lhsBlock->blockId);
         auto* rhsLabel = getLabelOperand(rhsEndBlock->blockId);
@@ -282,7 +282,7 @@ namespace ME
 
         enterBlock(endBlock);
         size_t resReg = getNewRegId();
-        auto* phi = new PhiInst(DataType::I1, getRegOperand(resReg));
+        auto* phi = curFunc->create<PhiInst>(DataType::I1, getRegOperand(resReg));
         // 直接使用 lhs 已经转为 i1 的结果，避免使用 i32 立即数导致类型不匹配
         auto* lhsLabel = getLabelOperand(lhsBlock->blockId);
         auto* rhsLabel = getLabelOperand(rhsEndBlock->blockId);
@@ -17,11 +17,7 @@ namespace ME
         // TODO("Lab3-2: Implement FuncDeclStmt IR generation");
 
         // 清理并初始化函数级环境
-        while (name2reg.curScope && name2reg.curScope->parent) name2reg.exitScope();
-        if (name2reg.curScope)
-            name2reg.curScope->sym2Reg.clear();
-        else
-            name2reg.curScope = new RegTab::Scope(nullptr);
+        name2reg.reset();
         reg2attr.clear();
         paramPtrTab.clear();
         lval2ptr.clear();
@@ -68,8 +64,8 @@ namespace ME
         }
 
         // 创建函数定义与函数对象
-        auto* funcDef = new FuncDefInst(retType, node.entry->getName(), args);
-        auto* func = new Function(funcDef);
+        auto* funcDef = m->create<FuncDefInst>(retType, node.entry->getName(), args);
+        auto* func = m->create<Function>(funcDef, m->getOperandFactory());
         func->setMaxReg(args.size());
         m->functions.push_back(func);
 
@@ -1,95 +1,222 @@
 #include <middleend/visitor/printer/module_printer.h>
+#include <debug.h>
+#include <transfer.h>
+#include <cstring>
+#include <numeric>
 
 namespace ME
 {
-    void IRPrinter::visit(LoadInst& inst, std::ostream& os)
+    // 以下格式与 ir_instruction.cpp / ir_operand.h 中的 toString 保持一致
+
+    static OutBuffer& operator<<(OutBuffer& out, DataType dt) { return out << toCString(dt); }
+    static OutBuffer& operator<<(OutBuffer& out, Operator op) { return out << toCString(op); }
+    static OutBuffer& operator<<(OutBuffer& out, ICmpOp cop) { return out << toCString(cop); }
+    static OutBuffer& operator<<(OutBuffer& out, FCmpOp cop) { return out << toCString(cop); }
+
+    static OutBuffer& printF32(OutBuffer& out, float value)
+    {
+        return out.write("0x", 2).hex((unsigned long long)FLOAT_TO_DOUBLE_BITS(value));
+    }
+
+    static OutBuffer& operator<<(OutBuffer& out, const Operand* op)
+    {
+        switch (op->getType())
+        {
+            case OperandType::REG: return out << "%reg_" << static_cast<const RegOperand*>(op)->regNum;
+            case OperandType::IMMEI32: return out << static_cast<const ImmeI32Operand*>(op)->value;
+            case OperandType::IMMEF32: return printF32(out, static_cast<const ImmeF32Operand*>(op)->value);
+            case OperandType::GLOBAL: return out << '@' << static_cast<const GlobalOperand*>(op)->name;
+            case OperandType::LABEL: return out << "%Block" << static_cast<const LabelOperand*>(op)->lnum;
+            default: return out << op->toString();
+        }
+    }
+
+    // [d0 x [d1 x ... dt]]
+    template <typename Dims>
+    static void printArrayType(OutBuffer& out, DataType dt, const Dims& dims, size_t from = 0)
+    {
+        for (size_t i = from; i < dims.size(); ++i) out << '[' << dims[i] << " x ";
+        out << dt;
+        for (size_t i = from; i < dims.size(); ++i) out << ']';
+    }
+
+    static void printArrayInit(
+        OutBuffer& out, DataType type, const FE::AST::VarAttr& v, size_t dimDph, size_t beginPos, size_t endPos)
+    {
+        if (dimDph == 0)
+        {
+            bool allZero = true;
+            for (auto& initVal : v.initList)
+            {
+                if (initVal.type == FE::AST::boolType || initVal.type == FE::AST::intType ||
+                    initVal.type == FE::AST::llType)
+                {
+                    if (initVal.getInt() != 0) allZero = false;
+                }
+                if (initVal.type == FE::AST::floatType)
+                {
+                    if (initVal.getFloat() != 0.0f) allZero = false;
+                }
+                if (!allZero) break;
+            }
+
+            if (allZero)
+            {
+                printArrayType(out, type, v.arrayDims);
+                out << " zeroinitializer";
+                return;
+            }
+        }
+
+        if (beginPos == endPos)
+        {
+            switch (type)
+            {
+                case DataType::I1:
+                case DataType::I32:
+                case DataType::I64: out << type << ' ' << v.initList[beginPos].getInt(); break;
+                case DataType::F32: printF32(out << type << ' ', v.initList[beginPos].getFloat()); break;
+                default: ERROR("Unsupported data type in global array init");
+            }
+            return;
+        }
+
+        printArrayType(out, type, v.arrayDims, dimDph);
+        out << " [";
+
+        int step = std::accumulate(v.arrayDims.begin() + dimDph + 1, v.arrayDims.end(), 1, std::multiplies<int>());
+        for (int i = 0; i < v.arrayDims[dimDph]; ++i)
+        {
+            if (i != 0) out << ',';
+            printArrayInit(out, type, v, dimDph + 1, beginPos + i * step, beginPos + (i + 1) * step - 1);
+        }
+
+        out << ']';
+    }
+
+    void IRPrinter::visit(LoadInst& inst, OutBuffer& out)
     {
-        (void)inst;
-        os << inst.toString();
+        out << inst.res << " = load " << inst.dt << ", ptr " << inst.ptr << inst.getComment();
     }
-    void IRPrinter::visit(StoreInst& inst, std::ostream& os)
+    void IRPrinter::visit(StoreInst& inst, OutBuffer& out)
     {
-        (void)inst;
-        os << inst.toString();
+        out << "store " << inst.dt << ' ' << inst.val << ", ptr " << inst.ptr << inst.getComment();
     }
-    void IRPrinter::visit(ArithmeticInst& inst, std::ostream& os)
+    void IRPrinter::visit(ArithmeticInst& inst, OutBuffer& out)
     {
-        (void)inst;
-        os << inst.toString();
+        out << inst.res << " = " << inst.opcode << ' ' << inst.dt << ' ' << inst.lhs << ", " << inst.rhs
+            << inst.getComment();
     }
-    void IRPrinter::visit(IcmpInst& inst, std::ostream& os)
+    void IRPrinter::visit(IcmpInst& inst, OutBuffer& out)
     {
-        (void)inst;
-        os << inst.toString();
+        out << inst.res << " = icmp " << inst.cond << ' ' << inst.dt << ' ' << inst.lhs << ", " << inst.rhs
+            << inst.getComment();
     }
-    void IRPrinter::visit(FcmpInst& inst, std::ostream& os)
+    void IRPrinter::visit(FcmpInst& inst, OutBuffer& out)
     {
-        (void)inst;
-        os << inst.toString();
+        out << inst.res << " = fcmp " << inst.cond << ' ' << inst.dt << ' ' << inst.lhs << ", " << inst.rhs
+            << inst.getComment();
     }
-    void IRPrinter::visit(AllocaInst& inst, std::ostream& os)
+    void IRPrinter::visit(AllocaInst& inst, OutBuffer& out)
     {
-        (void)inst;
-        os << inst.toString();
+        out << inst.res << " = alloca ";
+        printArrayType(out, inst.dt, inst.dims);
+        out << inst.getComment();
     }
-    void IRPrinter::visit(BrCondInst& inst, std::ostream& os)
+    void IRPrinter::visit(BrCondInst& inst, OutBuffer& out)
     {
-        (void)inst;
-        os << inst.toString();
+        out << "br i1 " << inst.cond << ", label " << inst.trueTar << ", label " << inst.falseTar
+            << inst.getComment();
     }
-    void IRPrinter::visit(BrUncondInst& inst, std::ostream& os)
+    void IRPrinter::visit(BrUncondInst& inst, OutBuffer& out)
     {
-        (void)inst;
-        os << inst.toString();
+        out << "br label " << inst.target << inst.getComment();
     }
-    void IRPrinter::visit(GlbVarDeclInst& inst, std::ostream& os)
+    void IRPrinter::visit(GlbVarDeclInst& inst, OutBuffer& out)
     {
-        (void)inst;
-        os << inst.toString();
+        out << '@' << inst.name << " = global ";
+        if (inst.initList.arrayDims.empty())
+        {
+            out << inst.dt << ' ';
+            if (inst.init)
+                out << inst.init;
+            else
+                out << "zeroinitializer";
+        }
+        else
+        {
+            size_t step = 1;
+            for (int dim : inst.initList.arrayDims) step *= dim;
+            printArrayInit(out, inst.dt, inst.initList, 0, 0, step - 1);
+        }
+        out << inst.getComment();
     }
-    void IRPrinter::visit(CallInst& inst, std::ostream& os)
+    void IRPrinter::visit(CallInst& inst, OutBuffer& out)
     {
-        (void)inst;
-        os << inst.toString();
+        if (inst.retType != DataType::VOID) out << inst.res << " = ";
+        out << "call " << inst.retType << " @" << inst.funcName << '(';
+        for (auto it = inst.args.begin(); it != inst.args.end(); ++it)
+        {
+            if (it != inst.args.begin()) out << ", ";
+            out << it->first << ' ' << it->second;
+        }
+        out << ')' << inst.getComment();
     }
-    void IRPrinter::visit(FuncDeclInst& inst, std::ostream& os)
+    void IRPrinter::visit(FuncDeclInst& inst, OutBuffer& out)
     {
-        (void)inst;
-        os << inst.toString();
+        out << "declare " << inst.retType << " @" << inst.funcName << '(';
+        for (auto it = inst.argTypes.begin(); it != inst.argTypes.end(); ++it)
+        {
+            if (it != inst.argTypes.begin()) out << ", ";
+            out << *it;
+        }
+        if (inst.isVarArg) out << ", ...";
+        out << ')' << inst.getComment();
     }
-    void IRPrinter::visit(FuncDefInst& inst, std::ostream& os)
+    void IRPrinter::visit(FuncDefInst& inst, OutBuffer& out)
     {
-        (void)inst;
-        os << inst.toString();
+        out << "define " << inst.retType << " @" << inst.funcName << '(';
+        for (auto it = inst.argRegs.begin(); it != inst.argRegs.end(); ++it)
+        {
+            if (it != inst.argRegs.begin()) out << ", ";
+            out << it->first << ' ' << it->second;
+        }
+        out << ')' << inst.getComment();
     }
-    void IRPrinter::visit(RetInst& inst, std::ostream& os)
+    void IRPrinter::visit(RetInst& inst, OutBuffer& out)
     {
-        (void)inst;
-        os << inst.toString();
+        out << "ret " << inst.rt;
+        if (inst.res) out << ' ' << inst.res;
+        out << inst.getComment();
     }
-    void IRPrinter::visit(GEPInst& inst, std::ostream& os)
+    void IRPrinter::visit(GEPInst& inst, OutBuffer& out)
     {
-        (void)inst;
-        os << inst.toString();
+        out << inst.res << " = getelementptr ";
+        printArrayType(out, inst.dt, inst.dims);
+        out << ", ptr " << inst.basePtr;
+        for (auto& idx : inst.idxs) out << ", " << inst.idxType << ' ' << idx;
+        out << inst.getComment();
     }
-    void IRPrinter::visit(FP2SIInst& inst, std::ostream& os)
+    void IRPrinter::visit(FP2SIInst& inst, OutBuffer& out)
     {
-        (void)inst;
-        os << inst.toString();
+        out << inst.dest << " = fptosi float " << inst.src << " to i32" << inst.getComment();
     }
-    void IRPrinter::visit(SI2FPInst& inst, std::ostream& os)
+    void IRPrinter::visit(SI2FPInst& inst, OutBuffer& out)
     {
-        (void)inst;
-        os << inst.toString();
+        out << inst.dest << " = sitofp i32 " << inst.src << " to float" << inst.getComment();
     }
-    void IRPrinter::visit(ZextInst& inst, std::ostream& os)
+    void IRPrinter::visit(ZextInst& inst, OutBuffer& out)
     {
-        (void)inst;
-        os << inst.toString();
+        out << inst.dest << " = zext " << inst.from << ' ' << inst.src << " to " << inst.to << inst.getComment();
     }
-    void IRPrinter::visit(PhiInst& inst, std::ostream& os)
+    void IRPrinter::visit(PhiInst& inst, OutBuffer& out)
     {
-        (void)inst;
-        os << inst.toString();
+        out << inst.res << " = phi " << inst.dt << ' ';
+        for (auto it = inst.incomingVals.begin(); it != inst.incomingVals.end(); ++it)
+        {
+            if (it != inst.incomingVals.begin()) out << ", ";
+            out << "[ " << it->second << ", " << it->first << " ]";
+        }
+        out << inst.getComment();
     }
 }  // namespace ME
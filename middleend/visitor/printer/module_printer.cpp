@@ -2,46 +2,84 @@
 
 namespace ME
 {
-    void IRPrinter::visit(Module& module, std::ostream& os)
+    void IRPrinter::print(Module& module, std::ostream& os)
     {
-        os << "; Function Declarations\n";
+        OutBuffer out(os);
+        apply(*this, module, out);
+    }
+
+    void IRPrinter::printHeader(Module& module, std::ostream& os)
+    {
+        OutBuffer out(os);
+        printDecls(module, out);
+        out << "; Function Definitions\n";
+    }
+
+    void IRPrinter::printFunction(Function& func, bool first, std::ostream& os)
+    {
+        OutBuffer out(os);
+        if (!first) out << '\n';
+        apply(*this, func, out);
+    }
+
+    void IRPrinter::printLateGlobals(Module& module, size_t from, std::ostream& os)
+    {
+        if (from >= module.globalVars.size()) return;
+
+        OutBuffer out(os);
+        out << "\n; Global Variable Declarations\n";
+        for (size_t i = from; i < module.globalVars.size(); ++i)
+        {
+            apply(*this, *module.globalVars[i], out);
+            out << '\n';
+        }
+    }
+
+    void IRPrinter::printDecls(Module& module, OutBuffer& out)
+    {
+        out << "; Function Declarations\n";
         for (auto& fdecl : module.funcDecls)
         {
-            apply(*this, *fdecl, os);
-            if (&fdecl != &module.funcDecls.back()) os << "\n";
+            apply(*this, *fdecl, out);
+            if (&fdecl != &module.funcDecls.back()) out << '\n';
         }
-        os << "\n\n";
+        out << "\n\n";
 
-        os << "; Global Variable Declarations\n";
+        out << "; Global Variable Declarations\n";
         for (auto& gdef : module.globalVars)
         {
-            apply(*this, *gdef, os);
-            if (&gdef != &module.globalVars.back()) os << "\n";
+            apply(*this, *gdef, out);
+            if (&gdef != &module.globalVars.back()) out << '\n';
         }
-        os << "\n\n";
+        out << "\n\n";
+    }
+
+    void IRPrinter::visit(Module& module, OutBuffer& out)
+    {
+        printDecls(module, out);
 
-        os << "; Function Definitions\n";
+        out << "; Function Definitions\n";
         for (auto& func : module.functions)
         {
-            apply(*this, *func, os);
-            if (&func != &module.functions.back()) os << "\n";
+            apply(*this, *func, out);
+            if (&func != &module.functions.back()) out << '\n';
         }
     }
-    void IRPrinter::visit(Function& func, std::ostream& os)
+    void IRPrinter::visit(Function& func, OutBuffer& out)
     {
-        apply(*this, *func.funcDef, os);
-        os << "\n{\n";
-        for (auto& [id, block] : func.blocks) apply(*this, *block, os);
-        os << "}\n";
+        apply(*this, *func.funcDef, out);
+        out << "\n{\n";
+        for (auto* block : func.blocks) apply(*this, *block, out);
+        out << "}\n";
     }
-    void IRPrinter::visit(Block& block, std::ostream& os)
+    void IRPrinter::visit(Block& block, OutBuffer& out)
     {
-        os << "Block" << block.blockId << ":" << block.getComment() << "\n";
-        for (auto& inst : block.insts)
+        out << "Block" << block.blockId << ':' << block.getComment() << '\n';
+        for (auto* inst : block.insts)
         {
-            os << "\t";
-            apply(*this, *inst, os);
-            os << "\n";
+            out << '\t';
+            apply(*this, *inst, out);
+            out << '\n';
         }
     }
 }  // namespace ME
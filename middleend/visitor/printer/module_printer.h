@@ -3,36 +3,58 @@
 
 #include <middleend/ir_visitor.h>
 #include <middleend/module/ir_module.h>
+#include <out_buffer.h>
+#include <ostream>
 
 namespace ME
 {
-    using Printer_t = Visitor_t<void, std::ostream&>;
+    using Printer_t = Visitor_t<void, OutBuffer&>;
 
+    /*
+     * IR 文本打印
+     * - 各指令直接格式化到 OutBuffer 中，不经过 Instruction::toString 的临时字符串
+     * - 输出须与 toString 的结果逐字节一致；修改任一侧的格式时需同步修改另一侧
+     */
     class IRPrinter : public Printer_t
     {
       public:
-        void visit(Module& module, std::ostream& os) override;
-        void visit(Function& func, std::ostream& os) override;
-        void visit(Block& block, std::ostream& os) override;
-
-        void visit(LoadInst& inst, std::ostream& os) override;
-        void visit(StoreInst& inst, std::ostream& os) override;
-        void visit(ArithmeticInst& inst, std::ostream& os) override;
-        void visit(IcmpInst& inst, std::ostream& os) override;
-        void visit(FcmpInst& inst, std::ostream& os) override;
-        void visit(AllocaInst& inst, std::ostream& os) override;
-        void visit(BrCondInst& inst, std::ostream& os) override;
-        void visit(BrUncondInst& inst, std::ostream& os) override;
-        void visit(GlbVarDeclInst& inst, std::ostream& os) override;
-        void visit(CallInst& inst, std::ostream& os) override;
-        void visit(FuncDeclInst& inst, std::ostream& os) override;
-        void visit(FuncDefInst& inst, std::ostream& os) override;
-        void visit(RetInst& inst, std::ostream& os) override;
-        void visit(GEPInst& inst, std::ostream& os) override;
-        void visit(FP2SIInst& inst, std::ostream& os) override;
-        void visit(SI2FPInst& inst, std::ostream& os) override;
-        void visit(ZextInst& inst, std::ostream& os) override;
-        void visit(PhiInst& inst, std::ostream& os) override;
+        void print(Module& module, std::ostream& os);
+
+        /*
+         * 流式输出（-fstream）：函数逐个生成、逐个输出；全局变量都在第一个函数之前时，拼起来与 print 的结果一致
+         * - printHeader 在第一个函数之前输出函数声明、已知的全局变量以及函数定义一节的标题
+         * - printFunction 输出一个函数，first 表示它是第一个函数（其前不加空行）
+         * - printLateGlobals 在最后补出 printHeader 之后才出现的全局变量（下标从 from 起）
+         */
+        void printHeader(Module& module, std::ostream& os);
+        void printFunction(Function& func, bool first, std::ostream& os);
+        void printLateGlobals(Module& module, size_t from, std::ostream& os);
+
+        void visit(Module& module, OutBuffer& out) override;
+        void visit(Function& func, OutBuffer& out) override;
+        void visit(Block& block, OutBuffer& out) override;
+
+        void visit(LoadInst& inst, OutBuffer& out) override;
+        void visit(StoreInst& inst, OutBuffer& out) override;
+        void visit(ArithmeticInst& inst, OutBuffer& out) override;
+        void visit(IcmpInst& inst, OutBuffer& out) override;
+        void visit(FcmpInst& inst, OutBuffer& out) override;
+        void visit(AllocaInst& inst, OutBuffer& out) override;
+        void visit(BrCondInst& inst, OutBuffer& out) override;
+        void visit(BrUncondInst& inst, OutBuffer& out) override;
+        void visit(GlbVarDeclInst& inst, OutBuffer& out) override;
+        void visit(CallInst& inst, OutBuffer& out) override;
+        void visit(FuncDeclInst& inst, OutBuffer& out) override;
+        void visit(FuncDefInst& inst, OutBuffer& out) override;
+        void visit(RetInst& inst, OutBuffer& out) override;
+        void visit(GEPInst& inst, OutBuffer& out) override;
+        void visit(FP2SIInst& inst, OutBuffer& out) override;
+        void visit(SI2FPInst& inst, OutBuffer& out) override;
+        void visit(ZextInst& inst, OutBuffer& out) override;
+        void visit(PhiInst& inst, OutBuffer& out) override;
+
+      private:
+        void printDecls(Module& module, OutBuffer& out);
     };
 }  // namespace ME
 
@@ -0,0 +1,110 @@
+#include <middleend/visitor/utils/clone_visitor.h>
+#include <middleend/module/ir_function.h>
+#include <middleend/module/ir_operand.h>
+
+namespace ME
+{
+    Instruction* InstClone::visit(LoadInst& inst, const OperandMapFn& map)
+    {
+        return target.create<LoadInst>(inst.dt, map(inst.ptr), map(inst.res));
+    }
+
+    Instruction* InstClone::visit(StoreInst& inst, const OperandMapFn& map)
+    {
+        return target.create<StoreInst>(inst.dt, map(inst.val), map(inst.ptr));
+    }
+
+    Instruction* InstClone::visit(ArithmeticInst& inst, const OperandMapFn& map)
+    {
+        return target.create<ArithmeticInst>(inst.opcode, inst.dt, map(inst.lhs), map(inst.rhs), map(inst.res));
+    }
+
+    Instruction* InstClone::visit(IcmpInst& inst, const OperandMapFn& map)
+    {
+        return target.create<IcmpInst>(inst.dt, inst.cond, map(inst.lhs), map(inst.rhs), map(inst.res));
+    }
+
+    Instruction* InstClone::visit(FcmpInst& inst, const OperandMapFn& map)
+    {
+        return target.create<FcmpInst>(inst.dt, inst.cond, map(inst.lhs), map(inst.rhs), map(inst.res));
+    }
+
+    Instruction* InstClone::visit(AllocaInst& inst, const OperandMapFn& map)
+    {
+        return target.create<AllocaInst>(inst.dt, map(inst.res), inst.dims);
+    }
+
+    Instruction* InstClone::visit(BrCondInst& inst, const OperandMapFn& map)
+    {
+        return target.create<BrCondInst>(map(inst.cond), map(inst.trueTar), map(inst.falseTar));
+    }
+
+    Instruction* InstClone::visit(BrUncondInst& inst, const OperandMapFn& map)
+    {
+        return target.create<BrUncondInst>(map(inst.target));
+    }
+
+    Instruction* InstClone::visit(GlbVarDeclInst& inst, const OperandMapFn& map)
+    {
+        (void)inst;
+        (void)map;
+        return nullptr;
+    }
+
+    Instruction* InstClone::visit(CallInst& inst, const OperandMapFn& map)
+    {
+        std::vector<CallInst::argPair> args;
+        for (auto& [type, arg] : inst.args) args.emplace_back(type, map(arg));
+        return target.create<CallInst>(inst.retType, std::string_view(inst.funcName), args, map(inst.res));
+    }
+
+    Instruction* InstClone::visit(FuncDeclInst& inst, const OperandMapFn& map)
+    {
+        (void)inst;
+        (void)map;
+        return nullptr;
+    }
+
+    Instruction* InstClone::visit(FuncDefInst& inst, const OperandMapFn& map)
+    {
+        (void)inst;
+        (void)map;
+        return nullptr;
+    }
+
+    Instruction* InstClone::visit(RetInst& inst, const OperandMapFn& map)
+    {
+        return target.create<RetInst>(inst.rt, map(inst.res));
+    }
+
+    Instruction* InstClone::visit(GEPInst& inst, const OperandMapFn& map)
+    {
+        std::vector<Operand*> idxs;
+        for (auto* idx : inst.idxs) idxs.push_back(map(idx));
+        return target.create<GEPInst>(inst.dt, inst.idxType, map(inst.basePtr), map(inst.res), inst.dims, idxs);
+    }
+
+    Instruction* InstClone::visit(FP2SIInst& inst, const OperandMapFn& map)
+    {
+        return target.create<FP2SIInst>(map(inst.src), map(inst.dest));
+    }
+
+    Instruction* InstClone::visit(SI2FPInst& inst, const OperandMapFn& map)
+    {
+        return target.create<SI2FPInst>(map(inst.src), map(inst.dest));
+    }
+
+    Instruction* InstClone::visit(ZextInst& inst, const OperandMapFn& map)
+    {
+        return target.create<ZextInst>(inst.from, inst.to, map(inst.src), map(inst.dest));
+    }
+
+    Instruction* InstClone::visit(PhiInst& inst, const OperandMapFn& map)
+    {
+        auto* phi = target.create<PhiInst>(inst.dt, map(inst.res));
+        // 来自没有副本的块（已删除或不在复制范围内）的 incoming 直接丢弃
+        for (auto& [label, val] : inst.incomingVals)
+            if (Operand* l = map(label)) phi->addIncoming(map(val), l);
+        return phi;
+    }
+}  // namespace ME
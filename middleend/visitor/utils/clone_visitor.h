@@ -0,0 +1,47 @@
+#ifndef __MIDDLEEND_VISITOR_UTILS_CLONE_VISITOR_H__
+#define __MIDDLEEND_VISITOR_UTILS_CLONE_VISITOR_H__
+
+#include <middleend/ir_visitor.h>
+#include <middleend/module/ir_instruction.h>
+#include <functional>
+
+namespace ME
+{
+    class Function;
+
+    // 操作数映射：寄存器与标签换成副本中的对应项，不需改写的操作数原样返回
+    using OperandMapFn = std::function<Operand*(Operand*)>;
+    using InstClone_t  = InsVisitor_t<Instruction*, const OperandMapFn&>;
+
+    // 以映射改写全部操作数（含定义的寄存器与跳转目标）后复制一条函数体内的指令，副本分配在 target 的 arena 上。
+    // phi 中标签映射为 nullptr 的 incoming 被丢弃；全局声明与函数声明、定义不在函数体内，返回 nullptr
+    class InstClone : public InstClone_t
+    {
+      private:
+        Function& target;
+
+      public:
+        explicit InstClone(Function& target) : target(target) {}
+
+        Instruction* visit(LoadInst&, const OperandMapFn&) override;
+        Instruction* visit(StoreInst&, const OperandMapFn&) override;
+        Instruction* visit(ArithmeticInst&, const OperandMapFn&) override;
+        Instruction* visit(IcmpInst&, const OperandMapFn&) override;
+        Instruction* visit(FcmpInst&, const OperandMapFn&) override;
+        Instruction* visit(AllocaInst&, const OperandMapFn&) override;
+        Instruction* visit(BrCondInst&, const OperandMapFn&) override;
+        Instruction* visit(BrUncondInst&, const OperandMapFn&) override;
+        Instruction* visit(GlbVarDeclInst&, const OperandMapFn&) override;
+        Instruction* visit(CallInst&, const OperandMapFn&) override;
+        Instruction* visit(FuncDeclInst&, const OperandMapFn&) override;
+        Instruction* visit(FuncDefInst&, const OperandMapFn&) override;
+        Instruction* visit(RetInst&, const OperandMapFn&) override;
+        Instruction* visit(GEPInst&, const OperandMapFn&) override;
+        Instruction* visit(FP2SIInst&, const OperandMapFn&) override;
+        Instruction* visit(SI2FPInst&, const OperandMapFn&) override;
+        Instruction* visit(ZextInst&, const OperandMapFn&) override;
+        Instruction* visit(PhiInst&, const OperandMapFn&) override;
+    };
+}  // namespace ME
+
+#endif  // __MIDDLEEND_VISITOR_UTILS_CLONE_VISITOR_H__
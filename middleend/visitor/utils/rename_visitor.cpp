@@ -3,52 +3,52 @@
 
 namespace ME
 {
-    void renameReg(Operand*& operand, RegMap& renameMap)
+    void renameReg(Operand*& operand, RegMap& renameMap, OperandFactory& operands)
     {
         if (!operand || operand->getType() != OperandType::REG) return;
 
         RegOperand* regOp = static_cast<RegOperand*>(operand);
         auto        it    = renameMap.find(regOp->regNum);
         if (it == renameMap.end()) return;
-        operand = getRegOperand(it->second);
+        operand = operands.getRegOperand(it->second);
     }
 
     void RegRename::visit(LoadInst& inst, RegMap& rm)
     {
-        renameReg(inst.ptr, rm);
-        renameReg(inst.res, rm);
+        renameReg(inst.ptr, rm, operands);
+        renameReg(inst.res, rm, operands);
     }
 
     void RegRename::visit(StoreInst& inst, RegMap& rm)
     {
-        renameReg(inst.ptr, rm);
-        renameReg(inst.val, rm);
+        renameReg(inst.ptr, rm, operands);
+        renameReg(inst.val, rm, operands);
     }
 
     void RegRename::visit(ArithmeticInst& inst, RegMap& rm)
     {
-        renameReg(inst.lhs, rm);
-        renameReg(inst.rhs, rm);
-        renameReg(inst.res, rm);
+        renameReg(inst.lhs, rm, operands);
+        renameReg(inst.rhs, rm, operands);
+        renameReg(inst.res, rm, operands);
     }
 
     void RegRename::visit(IcmpInst& inst, RegMap& rm)
     {
-        renameReg(inst.lhs, rm);
-        renameReg(inst.rhs, rm);
-        renameReg(inst.res, rm);
+        renameReg(inst.lhs, rm, operands);
+        renameReg(inst.rhs, rm, operands);
+        renameReg(inst.res, rm, operands);
     }
 
     void RegRename::visit(FcmpInst& inst, RegMap& rm)
     {
-        renameReg(inst.lhs, rm);
-        renameReg(inst.rhs, rm);
-        renameReg(inst.res, rm);
+        renameReg(inst.lhs, rm, operands);
+        renameReg(inst.rhs, rm, operands);
+        renameReg(inst.res, rm, operands);
     }
 
-    void RegRename::visit(AllocaInst& inst, RegMap& rm) { renameReg(inst.res, rm); }
+    void RegRename::visit(AllocaInst& inst, RegMap& rm) { renameReg(inst.res, rm, operands); }
 
-    void RegRename::visit(BrCondInst& inst, RegMap& rm) { renameReg(inst.cond, rm); }
+    void RegRename::visit(BrCondInst& inst, RegMap& rm) { renameReg(inst.cond, rm, operands); }
 
     void RegRename::visit(BrUncondInst& inst, RegMap& rm)
     {
@@ -56,12 +56,12 @@ namespace ME
         (void)rm;
     }
 
-    void RegRename::visit(GlbVarDeclInst& inst, RegMap& rm) { renameReg(inst.init, rm); }
+    void RegRename::visit(GlbVarDeclInst& inst, RegMap& rm) { renameReg(inst.init, rm, operands); }
 
     void RegRename::visit(CallInst& inst, RegMap& rm)
     {
-        for (auto& arg : inst.args) renameReg(arg.second, rm);
-        renameReg(inst.res, rm);
+        for (auto& arg : inst.args) renameReg(arg.second, rm, operands);
+        renameReg(inst.res, rm, operands);
     }
 
     void RegRename::visit(FuncDeclInst& inst, RegMap& rm)
@@ -72,74 +72,74 @@ namespace ME
 
     void RegRename::visit(FuncDefInst& inst, RegMap& rm)
     {
-        for (auto& arg : inst.argRegs) renameReg(arg.second, rm);
+        for (auto& arg : inst.argRegs) renameReg(arg.second, rm, operands);
     }
 
-    void RegRename::visit(RetInst& inst, RegMap& rm) { renameReg(inst.res, rm); }
+    void RegRename::visit(RetInst& inst, RegMap& rm) { renameReg(inst.res, rm, operands); }
 
     void RegRename::visit(GEPInst& inst, RegMap& rm)
     {
-        renameReg(inst.basePtr, rm);
-        renameReg(inst.res, rm);
-        for (auto& idx : inst.idxs) renameReg(idx, rm);
+        renameReg(inst.basePtr, rm, operands);
+        renameReg(inst.res, rm, operands);
+        for (auto& idx : inst.idxs) renameReg(idx, rm, operands);
     }
 
     void RegRename::visit(FP2SIInst& inst, RegMap& rm)
     {
-        renameReg(inst.src, rm);
-        renameReg(inst.dest, rm);
+        renameReg(inst.src, rm, operands);
+        renameReg(inst.dest, rm, operands);
     }
 
     void RegRename::visit(SI2FPInst& inst, RegMap& rm)
     {
-        renameReg(inst.src, rm);
-        renameReg(inst.dest, rm);
+        renameReg(inst.src, rm, operands);
+        renameReg(inst.dest, rm, operands);
     }
 
     void RegRename::visit(ZextInst& inst, RegMap& rm)
     {
-        renameReg(inst.src, rm);
-        renameReg(inst.dest, rm);
+        renameReg(inst.src, rm, operands);
+        renameReg(inst.dest, rm, operands);
     }
 
     void RegRename::visit(PhiInst& inst, RegMap& rm)
     {
-        renameReg(inst.res, rm);
-        std::map<Operand*, Operand*> newIncomingVals;
+        renameReg(inst.res, rm, operands);
+        PhiInst::IncomingMap newIncomingVals;
         for (auto& [label, val] : inst.incomingVals)
         {
             Operand* newVal = val;
-            renameReg(newVal, rm);
+            renameReg(newVal, rm, operands);
             newIncomingVals[label] = newVal;
         }
         inst.incomingVals = newIncomingVals;
     }
 
     // 添加
-    void SrcRegRename::visit(LoadInst& inst, RegMap& rm) { renameReg(inst.ptr, rm); }
+    void SrcRegRename::visit(LoadInst& inst, RegMap& rm) { renameReg(inst.ptr, rm, operands); }
 
     void SrcRegRename::visit(StoreInst& inst, RegMap& rm)
     {
-        renameReg(inst.ptr, rm);
-        renameReg(inst.val, rm);
+        renameReg(inst.ptr, rm, operands);
+        renameReg(inst.val, rm, operands);
     }
 
     void SrcRegRename::visit(ArithmeticInst& inst, RegMap& rm)
     {
-        renameReg(inst.lhs, rm);
-        renameReg(inst.rhs, rm);
+        renameReg(inst.lhs, rm, operands);
+        renameReg(inst.rhs, rm, operands);
     }
 
     void SrcRegRename::visit(IcmpInst& inst, RegMap& rm)
     {
-        renameReg(inst.lhs, rm);
-        renameReg(inst.rhs, rm);
+        renameReg(inst.lhs, rm, operands);
+        renameReg(inst.rhs, rm, operands);
     }
 
     void SrcRegRename::visit(FcmpInst& inst, RegMap& rm)
     {
-        renameReg(inst.lhs, rm);
-        renameReg(inst.rhs, rm);
+        renameReg(inst.lhs, rm, operands);
+        renameReg(inst.rhs, rm, operands);
     }
 
     void SrcRegRename::visit(AllocaInst& inst, RegMap& rm)
@@ -148,7 +148,7 @@ namespace ME
         (void)rm;
     }
 
-    void SrcRegRename::visit(BrCondInst& inst, RegMap& rm) { renameReg(inst.cond, rm); }
+    void SrcRegRename::visit(BrCondInst& inst, RegMap& rm) { renameReg(inst.cond, rm, operands); }
 
     void SrcRegRename::visit(BrUncondInst& inst, RegMap& rm)
     {
@@ -156,11 +156,11 @@ namespace ME
         (void)rm;
     }
 
-    void SrcRegRename::visit(GlbVarDeclInst& inst, RegMap& rm) { renameReg(inst.init, rm); }
+    void SrcRegRename::visit(GlbVarDeclInst& inst, RegMap& rm) { renameReg(inst.init, rm, operands); }
 
     void SrcRegRename::visit(CallInst& inst, RegMap& rm)
     {
-        for (auto& arg : inst.args) renameReg(arg.second, rm);
+        for (auto& arg : inst.args) renameReg(arg.second, rm, operands);
     }
 
     void SrcRegRename::visit(FuncDeclInst& inst, RegMap& rm)
@@ -175,33 +175,33 @@ namespace ME
         (void)rm;
     }
 
-    void SrcRegRename::visit(RetInst& inst, RegMap& rm) { renameReg(inst.res, rm); }
+    void SrcRegRename::visit(RetInst& inst, RegMap& rm) { renameReg(inst.res, rm, operands); }
 
     void SrcRegRename::visit(GEPInst& inst, RegMap& rm)
     {
-        renameReg(inst.basePtr, rm);
-        for (auto& idx : inst.idxs) renameReg(idx, rm);
+        renameReg(inst.basePtr, rm, operands);
+        for (auto& idx : inst.idxs) renameReg(idx, rm, operands);
     }
 
-    void SrcRegRename::visit(FP2SIInst& inst, RegMap& rm) { renameReg(inst.src, rm); }
+    void SrcRegRename::visit(FP2SIInst& inst, RegMap& rm) { renameReg(inst.src, rm, operands); }
 
-    void SrcRegRename::visit(SI2FPInst& inst, RegMap& rm) { renameReg(inst.src, rm); }
+    void SrcRegRename::visit(SI2FPInst& inst, RegMap& rm) { renameReg(inst.src, rm, operands); }
 
-    void SrcRegRename::visit(ZextInst& inst, RegMap& rm) { renameReg(inst.src, rm); }
+    void SrcRegRename::visit(ZextInst& inst, RegMap& rm) { renameReg(inst.src, rm, operands); }
 
     void SrcRegRename::visit(PhiInst& inst, RegMap& rm)
     {
-        std::map<Operand*, Operand*> newIncomingVals;
+        PhiInst::IncomingMap newIncomingVals;
         for (auto& [label, val] : inst.incomingVals)
         {
             Operand* newVal = val;
-            renameReg(newVal, rm);
+            renameReg(newVal, rm, operands);
             newIncomingVals[label] = newVal;
         }
         inst.incomingVals = newIncomingVals;
     }
 
-    void ResRegRename::visit(LoadInst& inst, RegMap& rm) { renameReg(inst.res, rm); }
+    void ResRegRename::visit(LoadInst& inst, RegMap& rm) { renameReg(inst.res, rm, operands); }
 
     void ResRegRename::visit(StoreInst& inst, RegMap& rm)
     {
@@ -209,13 +209,13 @@ namespace ME
         (void)rm;
     }
 
-    void ResRegRename::visit(ArithmeticInst& inst, RegMap& rm) { renameReg(inst.res, rm); }
+    void ResRegRename::visit(ArithmeticInst& inst, RegMap& rm) { renameReg(inst.res, rm, operands); }
 
-    void ResRegRename::visit(IcmpInst& inst, RegMap& rm) { renameReg(inst.res, rm); }
+    void ResRegRename::visit(IcmpInst& inst, RegMap& rm) { renameReg(inst.res, rm, operands); }
 
-    void ResRegRename::visit(FcmpInst& inst, RegMap& rm) { renameReg(inst.res, rm); }
+    void ResRegRename::visit(FcmpInst& inst, RegMap& rm) { renameReg(inst.res, rm, operands); }
 
-    void ResRegRename::visit(AllocaInst& inst, RegMap& rm) { renameReg(inst.res, rm); }
+    void ResRegRename::visit(AllocaInst& inst, RegMap& rm) { renameReg(inst.res, rm, operands); }
 
     void ResRegRename::visit(BrCondInst& inst, RegMap& rm)
     {
@@ -235,7 +235,7 @@ namespace ME
         (void)rm;
     }
 
-    void ResRegRename::visit(CallInst& inst, RegMap& rm) { renameReg(inst.res, rm); }
+    void ResRegRename::visit(CallInst& inst, RegMap& rm) { renameReg(inst.res, rm, operands); }
 
     void ResRegRename::visit(FuncDeclInst& inst, RegMap& rm)
     {
@@ -245,7 +245,7 @@ namespace ME
 
     void ResRegRename::visit(FuncDefInst& inst, RegMap& rm)
     {
-        for (auto& arg : inst.argRegs) renameReg(arg.second, rm);
+        for (auto& arg : inst.argRegs) renameReg(arg.second, rm, operands);
     }
 
     void ResRegRename::visit(RetInst& inst, RegMap& rm)
@@ -254,13 +254,13 @@ namespace ME
         (void)rm;
     }
 
-    void ResRegRename::visit(GEPInst& inst, RegMap& rm) { renameReg(inst.res, rm); }
+    void ResRegRename::visit(GEPInst& inst, RegMap& rm) { renameReg(inst.res, rm, operands); }
 
-    void ResRegRename::visit(FP2SIInst& inst, RegMap& rm) { renameReg(inst.dest, rm); }
+    void ResRegRename::visit(FP2SIInst& inst, RegMap& rm) { renameReg(inst.dest, rm, operands); }
 
-    void ResRegRename::visit(SI2FPInst& inst, RegMap& rm) { renameReg(inst.dest, rm); }
+    void ResRegRename::visit(SI2FPInst& inst, RegMap& rm) { renameReg(inst.dest, rm, operands); }
 
-    void ResRegRename::visit(ZextInst& inst, RegMap& rm) { renameReg(inst.dest, rm); }
+    void ResRegRename::visit(ZextInst& inst, RegMap& rm) { renameReg(inst.dest, rm, operands); }
 
-    void ResRegRename::visit(PhiInst& inst, RegMap& rm) { renameReg(inst.res, rm); }
+    void ResRegRename::visit(PhiInst& inst, RegMap& rm) { renameReg(inst.res, rm, operands); }
 }  // namespace ME
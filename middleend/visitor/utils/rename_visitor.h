@@ -11,8 +11,11 @@ namespace ME
 
     class RegRename : public RegRename_t
     {
+      private:
+        OperandFactory& operands;
+
       public:
-        RegRename() = default;
+        explicit RegRename(OperandFactory& operands) : operands(operands) {}
 
         void visit(LoadInst&, RegMap&) override;
         void visit(StoreInst&, RegMap&) override;
@@ -36,8 +39,11 @@ namespace ME
 
     class SrcRegRename : public RegRename_t
     {
+      private:
+        OperandFactory& operands;
+
       public:
-        SrcRegRename() = default;
+        explicit SrcRegRename(OperandFactory& operands) : operands(operands) {}
 
         void visit(LoadInst&, RegMap&) override;
         void visit(StoreInst&, RegMap&) override;
@@ -61,8 +67,11 @@ namespace ME
 
     class ResRegRename : public RegRename_t
     {
+      private:
+        OperandFactory& operands;
+
       public:
-        ResRegRename() = default;
+        explicit ResRegRename(OperandFactory& operands) : operands(operands) {}
 
         void visit(LoadInst&, RegMap&) override;
         void visit(StoreInst&, RegMap&) override;
@@ -40,8 +40,10 @@ def add_returncode(file,ret):
 
 # 测试用例的返回值的不要为124或139，否则会导致测试程序误判
 
-def execute_ir(input,output,opt,stdin,stdout,testout):
-    result = execute(["timeout","10","./bin/compiler","-llvm","-o",output,opt,input])
+def execute_ir(input,output,opts,stdin,stdout,testout):
+    result = execute(["timeout","10","./bin/compiler","-llvm","-o",output]+opts+[input])
+    if(opts != [opt_arg]):
+        input = input+" ("+" ".join(opts)+")"
     if(result.returncode != 0):
         print("\033[93mCompile Error on \033[0m"+input)
         return 0
@@ -79,9 +81,17 @@ def execute_ir(input,output,opt,stdin,stdout,testout):
         print("\033[91mWrong Answer on \033[0m"+input)
         return 0
 
-input_folders = ["basic_mem2reg","mem2reg","eliUnreachablebb","adce","scalar_cse","sccp"]
+input_folders = ["basic_mem2reg","mem2reg","eliUnreachablebb","adce","scalar_cse","sccp","scalar_licm","inline","loop_unroll","iv_sr"]
 output_folder = "test_output"
 opt_arg = "-O1"
+# 所测 pass 不在 -O1 流水线中的目录，改用这里列出的参数，每组参数各运行一次
+folder_opt_args = {
+    "scalar_licm": [["-O2"]],
+    "inline": [["-O2"]],
+    # 默认份数之外再覆盖只做完全展开（1）、奇数份数与较大份数的部分展开
+    "loop_unroll": [["-O2"],["-O2","-funroll-factor=1"],["-O2","-funroll-factor=3"],["-O2","-funroll-factor=8"]],
+    "iv_sr": [["-O2"]],
+}
 
 for input_name in input_folders: 
     input_folder = "testcase/optimize/" + input_name   
@@ -90,10 +100,11 @@ for input_name in input_folders:
             name = file.split(".")[0]
             input = name+".in"
             output = name+".out"
-            if(os.path.exists(input_folder + '/' + name + ".in")):
-                execute_ir(input_folder+'/'+file, output_folder+'/'+name+".ll", opt_arg, input_folder+'/'+input, input_folder+'/'+output, "tmp.out")
-            else:
-                execute_ir(input_folder+'/'+file, output_folder+'/'+name+".ll", opt_arg, "none", input_folder+'/'+output, "tmp.out")
+            for opts in folder_opt_args.get(input_name, [[opt_arg]]):
+                if(os.path.exists(input_folder + '/' + name + ".in")):
+                    execute_ir(input_folder+'/'+file, output_folder+'/'+name+".ll", opts, input_folder+'/'+input, input_folder+'/'+output, "tmp.out")
+                else:
+                    execute_ir(input_folder+'/'+file, output_folder+'/'+name+".ll", opts, "none", input_folder+'/'+output, "tmp.out")
             if(input_name=="eliUnreachablebb"):
                 result_ll = name + ".ll"
                 stats = os.stat(output_folder+"/"+result_ll)
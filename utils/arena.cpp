@@ -0,0 +1,71 @@
+#include <arena.h>
+#include <algorithm>
+#include <cstdint>
+
+namespace
+{
+    constexpr size_t maxChunkSize = 1 << 20;
+}
+
+Arena::Arena(size_t initChunkSize)
+    : chunks(), cur(nullptr), end(nullptr), nextChunkSize(initChunkSize), allocated(0), dtors(nullptr),
+      res(*this)
+{}
+
+Arena::~Arena() { reset(); }
+
+void* Arena::allocate(size_t size, size_t align)
+{
+    uintptr_t p = (reinterpret_cast<uintptr_t>(cur) + align - 1) & ~(uintptr_t)(align - 1);
+    if (!cur || p + size > reinterpret_cast<uintptr_t>(end))
+    {
+        // 块大小按倍数增长，超大对象单独占一块
+        size_t chunkSize = std::max(nextChunkSize, size + align);
+        nextChunkSize    = std::min(nextChunkSize * 2, maxChunkSize);
+
+        char* chunk = static_cast<char*>(::operator new(chunkSize));
+        chunks.push_back(chunk);
+        cur = chunk;
+        end = chunk + chunkSize;
+        p   = (reinterpret_cast<uintptr_t>(cur) + align - 1) & ~(uintptr_t)(align - 1);
+    }
+
+    cur = reinterpret_cast<char*>(p + size);
+    allocated += size;
+    return reinterpret_cast<void*>(p);
+}
+
+void Arena::rewind(const Mark& m)
+{
+#ifdef IR_HEAP_ALLOC
+    // 逐个 new 出的对象无法按分配位置区分，统一推迟到 reset()
+    (void)m;
+#else
+    for (DtorNode* node = dtors; node != m.dtors; node = node->next) node->dtor(node->obj);
+    dtors = m.dtors;
+
+    for (size_t i = m.numChunks; i < chunks.size(); ++i) ::operator delete(chunks[i]);
+    chunks.resize(m.numChunks);
+    cur       = m.cur;
+    end       = m.end;
+    allocated = m.allocated;
+#endif
+}
+
+void Arena::reset()
+{
+#ifdef IR_HEAP_ALLOC
+    for (auto& [obj, deleter] : live) deleter(obj);
+    live.clear();
+#endif
+
+    // 后创建的对象先析构
+    for (DtorNode* node = dtors; node; node = node->next) node->dtor(node->obj);
+    dtors = nullptr;
+
+    for (char* chunk : chunks) ::operator delete(chunk);
+    chunks.clear();
+    cur       = nullptr;
+    end       = nullptr;
+    allocated = 0;
+}
@@ -0,0 +1,154 @@
+#ifndef __UTILS_ARENA_H__
+#define __UTILS_ARENA_H__
+
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+/*
+ * Arena：按块顺序分配（bump allocator）的对象池
+ * - create<T>() 在当前内存块上顺序构造对象，块用完后再申请新块；对象不单独释放
+ * - 需要析构的对象会登记到析构链表，reset() 或 Arena 析构时逆序调用析构函数，随后整块归还内存
+ * - 声明了 allocator_type 的类型按 uses-allocator 约定以 (std::allocator_arg, allocator(), args...) 构造，
+ *   其成员容器改从同一 arena 取内存；再声明 kArenaSkipDtor = true 的类型不登记析构，随块一起整体丢弃
+ * - destroy() 表示对象已不再使用：arena 模式下什么都不做，统一推迟到 reset()
+ * - mark() / rewind() 回退到先前记下的分配位置，一次性释放其后分配的全部对象（如流式编译中一个函数的 AST）
+ * - 编译时定义 IR_HEAP_ALLOC（make IR_HEAP=1）则退化为逐个 new/delete，
+ *   便于用 mem_track.sh (valgrind) 精确定位到单个对象
+ */
+class Arena;
+
+// 类型不持有 arena 之外的内存时可跳过析构：kArenaSkipDtor 为真且 IR_HEAP_ALLOC 未定义
+template <typename T, typename = void>
+struct ArenaSkipsDtor : std::false_type
+{};
+template <typename T>
+struct ArenaSkipsDtor<T, std::void_t<decltype(T::kArenaSkipDtor)>> : std::bool_constant<T::kArenaSkipDtor>
+{};
+
+class Arena
+{
+  public:
+    using allocator_type = std::pmr::polymorphic_allocator<std::byte>;
+
+  private:
+    // 供 std::pmr 容器使用：从所属 arena 顺序分配，释放为空操作，内存随 arena 一起回收
+    class Resource : public std::pmr::memory_resource
+    {
+      private:
+        Arena& owner;
+
+      public:
+        explicit Resource(Arena& a) : owner(a) {}
+
+      private:
+        void* do_allocate(size_t bytes, size_t align) override { return owner.allocate(bytes, align); }
+        void  do_deallocate(void*, size_t, size_t) override {}
+        bool  do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+    };
+
+    struct DtorNode
+    {
+        void (*dtor)(void*);
+        void*     obj;
+        DtorNode* next;
+    };
+
+    std::vector<char*> chunks;
+    char*              cur;
+    char*              end;
+    size_t             nextChunkSize;
+    size_t             allocated;
+    DtorNode*          dtors;
+    Resource           res;
+
+#ifdef IR_HEAP_ALLOC
+    std::unordered_map<void*, void (*)(void*)> live;
+#endif
+
+  public:
+    explicit Arena(size_t initChunkSize = 4096);
+    ~Arena();
+
+    Arena(const Arena&)            = delete;
+    Arena& operator=(const Arena&) = delete;
+
+    template <typename T, typename... Args>
+    T* create(Args&&... args)
+    {
+#ifdef IR_HEAP_ALLOC
+        T* obj;
+        if constexpr (std::uses_allocator_v<T, allocator_type>)
+            obj = new T(std::allocator_arg, allocator(), std::forward<Args>(args)...);
+        else
+            obj = new T(std::forward<Args>(args)...);
+        live[obj]  = [](void* p) { delete static_cast<T*>(p); };
+        allocated += sizeof(T);
+        return obj;
+#else
+        void* mem = allocate(sizeof(T), alignof(T));
+        T*    obj;
+        if constexpr (std::uses_allocator_v<T, allocator_type>)
+            obj = new (mem) T(std::allocator_arg, allocator(), std::forward<Args>(args)...);
+        else
+            obj = new (mem) T(std::forward<Args>(args)...);
+        if constexpr (!std::is_trivially_destructible_v<T> && !ArenaSkipsDtor<T>::value)
+        {
+            auto* node = new (allocate(sizeof(DtorNode), alignof(DtorNode)))
+                DtorNode{[](void* p) { static_cast<T*>(p)->~T(); }, obj, dtors};
+            dtors = node;
+        }
+        return obj;
+#endif
+    }
+
+    template <typename T>
+    void destroy(T* obj)
+    {
+#ifdef IR_HEAP_ALLOC
+        if (!obj) return;
+        live.erase(static_cast<void*>(obj));
+        delete obj;
+#else
+        (void)obj;
+#endif
+    }
+
+    // 分配位置的快照，rewind 时析构并释放此后分配的对象；IR_HEAP_ALLOC 模式下 rewind 不做任何事
+    struct Mark
+    {
+        size_t    numChunks;
+        char*     cur;
+        char*     end;
+        size_t    allocated;
+        DtorNode* dtors;
+    };
+    Mark mark() const { return {chunks.size(), cur, end, allocated, dtors}; }
+    void rewind(const Mark& m);
+
+    // 析构所有仍存活的对象并归还全部内存块
+    void reset();
+
+    // 容器的分配器；IR_HEAP_ALLOC 模式下改走 new/delete，使 valgrind 仍能逐个追踪
+    allocator_type allocator()
+    {
+#ifdef IR_HEAP_ALLOC
+        return allocator_type(std::pmr::new_delete_resource());
+#else
+        return allocator_type(&res);
+#endif
+    }
+
+    // 累计分配的字节数（含析构登记等开销）
+    size_t bytesAllocated() const { return allocated; }
+
+    // 原始内存分配，调用者自行负责构造与析构（如需要）
+    void* allocate(size_t size, size_t align);
+};
+
+#endif  // __UTILS_ARENA_H__
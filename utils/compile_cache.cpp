@@ -0,0 +1,264 @@
+#include <compile_cache.h>
+#include <stats.h>
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/file.h>
+#include <sys/stat.h>
+#include <dirent.h>
+#include <unistd.h>
+
+namespace
+{
+    // Reference: https://github.com/aappleby/smhasher/blob/master/src/MurmurHash3.cpp MurmurHash3_x64_128
+    inline uint64_t rotl(uint64_t x, int r) { return (x << r) | (x >> (64 - r)); }
+    inline uint64_t fmix(uint64_t k)
+    {
+        k ^= k >> 33;
+        k *= 0xff51afd7ed558ccdULL;
+        k ^= k >> 33;
+        k *= 0xc4ceb9fe1a85ec53ULL;
+        k ^= k >> 33;
+        return k;
+    }
+
+    void murmur3_128(const std::string& s, uint64_t& out1, uint64_t& out2)
+    {
+        constexpr uint64_t c1 = 0x87c37b91114253d5ULL;
+        constexpr uint64_t c2 = 0x4cf5ad432745937fULL;
+
+        const unsigned char* p      = reinterpret_cast<const unsigned char*>(s.data());
+        size_t               len    = s.size();
+        size_t               blocks = len / 16;
+        uint64_t             h1 = 0, h2 = 0;
+
+        for (size_t i = 0; i < blocks; ++i)
+        {
+            uint64_t k1, k2;
+            std::memcpy(&k1, p + i * 16, 8);
+            std::memcpy(&k2, p + i * 16 + 8, 8);
+
+            k1 *= c1;
+            k1 = rotl(k1, 31);
+            k1 *= c2;
+            h1 ^= k1;
+            h1 = rotl(h1, 27);
+            h1 += h2;
+            h1 = h1 * 5 + 0x52dce729;
+
+            k2 *= c2;
+            k2 = rotl(k2, 33);
+            k2 *= c1;
+            h2 ^= k2;
+            h2 = rotl(h2, 31);
+            h2 += h1;
+            h2 = h2 * 5 + 0x38495ab5;
+        }
+
+        const unsigned char* tail = p + blocks * 16;
+        size_t               rest = len & 15;
+        uint64_t             k1 = 0, k2 = 0;
+        for (size_t i = rest; i > 8; --i) k2 ^= static_cast<uint64_t>(tail[i - 1]) << ((i - 9) * 8);
+        if (rest > 8)
+        {
+            k2 *= c2;
+            k2 = rotl(k2, 33);
+            k2 *= c1;
+            h2 ^= k2;
+        }
+        for (size_t i = std::min<size_t>(rest, 8); i > 0; --i) k1 ^= static_cast<uint64_t>(tail[i - 1]) << ((i - 1) * 8);
+        if (rest > 0)
+        {
+            k1 *= c1;
+            k1 = rotl(k1, 31);
+            k1 *= c2;
+            h1 ^= k1;
+        }
+
+        h1 ^= len;
+        h2 ^= len;
+        h1 += h2;
+        h2 += h1;
+        h1 = fmix(h1);
+        h2 = fmix(h2);
+        h1 += h2;
+        h2 += h1;
+
+        out1 = h1;
+        out2 = h2;
+    }
+
+    bool makeDir(const std::string& path) { return ::mkdir(path.c_str(), 0755) == 0 || errno == EEXIST; }
+
+    bool readFile(const std::string& path, std::string& data)
+    {
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) return false;
+
+        struct stat st;
+        bool        good = ::fstat(fd, &st) == 0;
+        if (good)
+        {
+            data.resize(static_cast<size_t>(st.st_size));
+            size_t done = 0;
+            while (good && done < data.size())
+            {
+                ssize_t n = ::read(fd, &data[done], data.size() - done);
+                if (n <= 0)
+                    good = false;
+                else
+                    done += static_cast<size_t>(n);
+            }
+        }
+        ::close(fd);
+        return good;
+    }
+}  // namespace
+
+CompileCache::CompileCache(std::string d, uint64_t maxBytes)
+    : dir(std::move(d)), objects(dir + "/objects"), maxBytes(maxBytes), build(buildId())
+{
+    ok = !build.empty() && makeDir(dir) && makeDir(objects);
+}
+
+std::string CompileCache::buildId()
+{
+    char    path[4096];
+    ssize_t n = ::readlink("/proc/self/exe", path, sizeof(path) - 1);
+    if (n <= 0) return "";
+    path[n] = '\0';
+
+    struct stat st;
+    if (::stat(path, &st) != 0) return "";
+    return std::string(path) + ':' + std::to_string(st.st_size) + ':' + std::to_string(st.st_mtim.tv_sec) + '.' +
+           std::to_string(st.st_mtim.tv_nsec) + ':' + std::to_string(st.st_ino);
+}
+
+std::string CompileCache::makeKey(const std::vector<std::string_view>& parts) const
+{
+    std::string buf = std::to_string(build.size()) + ':' + build;
+    for (auto part : parts)
+    {
+        buf += std::to_string(part.size());
+        buf += ':';
+        buf += part;
+    }
+
+    uint64_t h1, h2;
+    murmur3_128(buf, h1, h2);
+
+    char hex[33];
+    std::snprintf(hex, sizeof(hex), "%016llx%016llx", (unsigned long long)h1, (unsigned long long)h2);
+    return hex;
+}
+
+bool CompileCache::lookup(const std::string& key, std::string& data)
+{
+    std::string path = objects + '/' + key;
+    bool        hit  = readFile(path, data);
+    // 修改时间即最近使用时间，供淘汰时排序
+    if (hit) ::utimensat(AT_FDCWD, path.c_str(), nullptr, 0);
+
+    Stats::bump(hit ? "cache hits" : "cache misses");
+    record(hit, !hit, 0);
+    return hit;
+}
+
+void CompileCache::store(const std::string& key, const std::string& data)
+{
+    std::string tmp = objects + "/.tmp." + std::to_string(::getpid()) + '.' + key;
+    int         fd  = ::open(tmp.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) return;
+
+    size_t done = 0;
+    while (done < data.size())
+    {
+        ssize_t n = ::write(fd, data.data() + done, data.size() - done);
+        if (n <= 0) break;
+        done += static_cast<size_t>(n);
+    }
+    bool good = ::close(fd) == 0 && done == data.size();
+
+    if (!good || ::rename(tmp.c_str(), (objects + '/' + key).c_str()) != 0)
+    {
+        ::unlink(tmp.c_str());
+        return;
+    }
+    evict();
+}
+
+void CompileCache::evict()
+{
+    struct Entry
+    {
+        std::string     path;
+        struct timespec mtime;
+        uint64_t        size;
+    };
+    std::vector<Entry> entries;
+    uint64_t           total = 0;
+
+    DIR* d = ::opendir(objects.c_str());
+    if (!d) return;
+    while (struct dirent* e = ::readdir(d))
+    {
+        if (e->d_name[0] == '.') continue;  // 含 . / .. 与写入中的临时文件
+        std::string path = objects + '/' + e->d_name;
+        struct stat st;
+        if (::stat(path.c_str(), &st) != 0 || !S_ISREG(st.st_mode)) continue;
+        entries.push_back({path, st.st_mtim, static_cast<uint64_t>(st.st_size)});
+        total += static_cast<uint64_t>(st.st_size);
+    }
+    ::closedir(d);
+
+    if (total <= maxBytes) return;
+
+    std::sort(entries.begin(), entries.end(), [](const Entry& a, const Entry& b) {
+        if (a.mtime.tv_sec != b.mtime.tv_sec) return a.mtime.tv_sec < b.mtime.tv_sec;
+        return a.mtime.tv_nsec < b.mtime.tv_nsec;
+    });
+
+    uint64_t target  = maxBytes / 4 * 3;
+    uint64_t evicted = 0;
+    for (auto& e : entries)
+    {
+        if (total <= target) break;
+        // 并发淘汰时条目可能已被其它进程删除，此时不重复计数
+        if (::unlink(e.path.c_str()) == 0) ++evicted;
+        total -= e.size;
+    }
+
+    Stats::bump("cache evictions", static_cast<long>(evicted));
+    record(0, 0, evicted);
+}
+
+// DIR/stats 为一行文本 "hits <n> misses <n> evictions <n>"，读改写期间持有文件锁
+void CompileCache::record(uint64_t hits, uint64_t misses, uint64_t evictions)
+{
+    int fd = ::open((dir + "/stats").c_str(), O_RDWR | O_CREAT, 0644);
+    if (fd < 0) return;
+    if (::flock(fd, LOCK_EX) != 0)
+    {
+        ::close(fd);
+        return;
+    }
+
+    char    buf[128] = {};
+    ssize_t n        = ::read(fd, buf, sizeof(buf) - 1);
+    unsigned long long h = 0, m = 0, e = 0;
+    if (n > 0) std::sscanf(buf, "hits %llu misses %llu evictions %llu", &h, &m, &e);
+
+    int len = std::snprintf(
+        buf, sizeof(buf), "hits %llu misses %llu evictions %llu\n", h + hits, m + misses, e + evictions);
+    // 计数写入失败不影响编译结果
+    if (::ftruncate(fd, 0) == 0 && ::lseek(fd, 0, SEEK_SET) == 0)
+    {
+        ssize_t written = ::write(fd, buf, static_cast<size_t>(len));
+        (void)written;
+    }
+
+    ::flock(fd, LOCK_UN);
+    ::close(fd);
+}
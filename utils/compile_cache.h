@@ -0,0 +1,47 @@
+#ifndef __UTILS_COMPILE_CACHE_H__
+#define __UTILS_COMPILE_CACHE_H__
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/*
+ * CompileCache：以内容寻址的编译结果缓存（-fcache / -fcache-dir=DIR）
+ * - 键为输入源码、-march、-O 等级、步骤、pass 流水线与编译器构建标识的 128 位哈希，
+ *   条目为对应的 .s / .ll 输出，存放在 DIR/objects/<键> 中
+ * - 写入先落到同目录下的临时文件再 rename，并发编译同一输入时读者只会看到完整的条目
+ * - 命中时刷新条目的修改时间；总大小超过上限时按修改时间从旧到新淘汰，直到降至上限的 3/4
+ * - 命中 / 未命中 / 淘汰次数累计在 DIR/stats 中（flock 保护），本次运行的计数另记入 -stats
+ */
+class CompileCache
+{
+  public:
+    static constexpr uint64_t kDefaultMaxBytes = 256ull << 20;
+
+    CompileCache(std::string dir, uint64_t maxBytes = kDefaultMaxBytes);
+
+    // 目录不可用或无法确定构建标识时为 false，此时调用方应按未启用缓存处理
+    bool usable() const { return ok; }
+
+    // 构建标识与各部分依次计入哈希（带长度前缀，避免拼接歧义），返回 32 位十六进制字符串
+    std::string makeKey(const std::vector<std::string_view>& parts) const;
+
+    bool lookup(const std::string& key, std::string& data);
+    void store(const std::string& key, const std::string& data);
+
+    // 当前可执行文件的标识（路径、大小、修改时间、inode），重新链接后即改变
+    static std::string buildId();
+
+  private:
+    std::string dir;
+    std::string objects;
+    uint64_t    maxBytes;
+    bool        ok = false;
+    std::string build;
+
+    void evict();
+    void record(uint64_t hits, uint64_t misses, uint64_t evictions);
+};
+
+#endif  // __UTILS_COMPILE_CACHE_H__
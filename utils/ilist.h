@@ -0,0 +1,185 @@
+#ifndef __UTILS_ILIST_H__
+#define __UTILS_ILIST_H__
+
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+
+/*
+ * 侵入式双向链表
+ * - 元素类型 T 继承 IListNode<T>，前后指针保存在元素自身中，链表不分配任何内存
+ * - insert / erase / remove 均为 O(1)；增删其它元素不会使已有迭代器失效
+ * - 迭代器解引用得到 T*，因此 for (auto* x : list) 的写法与指针容器一致
+ * - 链表不拥有元素：元素的内存由其它地方（如 Function 的 arena）管理，erase 只负责摘除
+ * - 每个元素同一时刻只能位于一个链表中
+ */
+template <typename T>
+class IList;
+
+template <typename T>
+class IListNode
+{
+    friend class IList<T>;
+
+  private:
+    IListNode* prev = nullptr;
+    IListNode* next = nullptr;
+
+  public:
+    IListNode()                            = default;
+    IListNode(const IListNode&)            = delete;
+    IListNode& operator=(const IListNode&) = delete;
+
+    // 当前是否挂在某个链表上
+    bool isLinked() const { return next != nullptr; }
+};
+
+template <typename T>
+class IList
+{
+  private:
+    using Node = IListNode<T>;
+
+    Node   sentinel;  // 环形链表的哨兵：sentinel.next 为首元素，sentinel.prev 为尾元素
+    size_t count = 0;
+
+    template <bool Reverse>
+    class Iter
+    {
+        friend class IList;
+        Node* node;
+
+        explicit Iter(Node* n) : node(n) {}
+
+      public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type        = T*;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = T**;
+        using reference         = T*;
+
+        Iter() : node(nullptr) {}
+
+        T* operator*() const { return static_cast<T*>(node); }
+        T* operator->() const { return static_cast<T*>(node); }
+
+        Iter& operator++()
+        {
+            node = Reverse ? node->prev : node->next;
+            return *this;
+        }
+        Iter operator++(int)
+        {
+            Iter old = *this;
+            ++*this;
+            return old;
+        }
+        Iter& operator--()
+        {
+            node = Reverse ? node->next : node->prev;
+            return *this;
+        }
+        Iter operator--(int)
+        {
+            Iter old = *this;
+            --*this;
+            return old;
+        }
+
+        bool operator==(const Iter& other) const { return node == other.node; }
+        bool operator!=(const Iter& other) const { return node != other.node; }
+    };
+
+  public:
+    using iterator         = Iter<false>;
+    using reverse_iterator = Iter<true>;
+
+    IList() { sentinel.prev = sentinel.next = &sentinel; }
+    // 不触碰元素：析构时元素可能已先于链表被销毁
+    ~IList() = default;
+
+    IList(const IList&)            = delete;
+    IList& operator=(const IList&) = delete;
+
+    iterator         begin() { return iterator(sentinel.next); }
+    iterator         end() { return iterator(&sentinel); }
+    reverse_iterator rbegin() { return reverse_iterator(sentinel.prev); }
+    reverse_iterator rend() { return reverse_iterator(&sentinel); }
+
+    size_t size() const { return count; }
+    bool   empty() const { return count == 0; }
+
+    T* front() const
+    {
+        assert(count > 0);
+        return static_cast<T*>(sentinel.next);
+    }
+    T* back() const
+    {
+        assert(count > 0);
+        return static_cast<T*>(sentinel.prev);
+    }
+
+    // 该元素在链表中的位置，O(1)；元素必须位于本链表中
+    iterator iteratorTo(T* elem) { return iterator(elem); }
+
+    // 插入到 pos 之前，返回指向新元素的迭代器
+    iterator insert(iterator pos, T* elem)
+    {
+        Node* n = elem;
+        assert(!n->isLinked());
+        Node* at = pos.node;
+        n->prev  = at->prev;
+        n->next  = at;
+        at->prev->next = n;
+        at->prev       = n;
+        ++count;
+        return iterator(n);
+    }
+    void insertBefore(T* pos, T* elem) { insert(iterator(pos), elem); }
+    void insertAfter(T* pos, T* elem) { insert(iterator(static_cast<Node*>(pos)->next), elem); }
+
+    void push_front(T* elem) { insert(begin(), elem); }
+    void push_back(T* elem) { insert(end(), elem); }
+
+    // 摘除 pos 处的元素，返回其后继
+    iterator erase(iterator pos)
+    {
+        Node* n    = pos.node;
+        Node* next = n->next;
+        n->prev->next = next;
+        next->prev    = n->prev;
+        n->prev = n->next = nullptr;
+        --count;
+        return iterator(next);
+    }
+    // 摘除 [first, last)
+    iterator erase(iterator first, iterator last)
+    {
+        while (first != last) first = erase(first);
+        return last;
+    }
+    void remove(T* elem) { erase(iterator(elem)); }
+
+    // 按谓词摘除元素，返回摘除的个数
+    template <typename Pred>
+    size_t removeIf(Pred pred)
+    {
+        size_t removed = 0;
+        for (iterator it = begin(); it != end();)
+        {
+            if (pred(*it))
+            {
+                it = erase(it);
+                ++removed;
+            }
+            else
+                ++it;
+        }
+        return removed;
+    }
+
+    void clear() { erase(begin(), end()); }
+};
+
+#endif  // __UTILS_ILIST_H__
@@ -0,0 +1,45 @@
+#include <mapped_file.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+MappedFile::MappedFile(const std::string& path)
+{
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) return;
+    opened = true;
+
+    struct stat st;
+    if (::fstat(fd, &st) == 0 && S_ISREG(st.st_mode) && st.st_size > 0)
+    {
+        void* p = ::mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+        if (p != MAP_FAILED)
+        {
+            mapped = static_cast<const char*>(p);
+            length = static_cast<size_t>(st.st_size);
+            ::madvise(p, length, MADV_SEQUENTIAL);
+            ::close(fd);
+            return;
+        }
+    }
+
+    char buf[1 << 16];
+    for (;;)
+    {
+        ssize_t n = ::read(fd, buf, sizeof(buf));
+        if (n < 0)
+        {
+            opened = false;
+            break;
+        }
+        if (n == 0) break;
+        owned.append(buf, static_cast<size_t>(n));
+    }
+    ::close(fd);
+}
+
+MappedFile::~MappedFile()
+{
+    if (mapped) ::munmap(const_cast<char*>(mapped), length);
+}
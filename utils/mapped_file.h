@@ -0,0 +1,36 @@
+#ifndef __UTILS_MAPPED_FILE_H__
+#define __UTILS_MAPPED_FILE_H__
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+/*
+ * MappedFile：只读地把整个文件映射到内存
+ * - 普通文件用 mmap 映射，内容直接以 string_view 给出，不经过 istream 缓冲
+ * - 管道、/dev/stdin 等无法映射的输入退化为一次性读入自有缓冲区，接口不变
+ * - 对象存活期间 view() 始终有效，依赖其内容的 string_view（如词法单元的 lexeme）不得比它活得更久
+ */
+class MappedFile
+{
+  private:
+    const char* mapped = nullptr;
+    size_t      length = 0;
+    std::string owned;  // 退化路径下的内容
+    bool        opened = false;
+
+  public:
+    explicit MappedFile(const std::string& path);
+    ~MappedFile();
+
+    MappedFile(const MappedFile&)            = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    bool ok() const { return opened; }
+
+    const char*      data() const { return mapped ? mapped : owned.data(); }
+    size_t           size() const { return mapped ? length : owned.size(); }
+    std::string_view view() const { return {data(), size()}; }
+};
+
+#endif  // __UTILS_MAPPED_FILE_H__
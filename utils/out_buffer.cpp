@@ -0,0 +1,35 @@
+#include <out_buffer.h>
+#include <charconv>
+#include <cstring>
+#include <ostream>
+
+OutBuffer::OutBuffer(std::ostream& out) : os(out), buf(new char[kCapacity]) {}
+
+OutBuffer::~OutBuffer() { flush(); }
+
+void OutBuffer::flush()
+{
+    if (len == 0) return;
+    os.write(buf.get(), (std::streamsize)len);
+    len = 0;
+}
+
+OutBuffer& OutBuffer::write(const char* s, size_t n)
+{
+    if (n > kCapacity)
+    {
+        flush();
+        os.write(s, (std::streamsize)n);
+        return *this;
+    }
+    std::memcpy(reserve(n), s, n);
+    len += n;
+    return *this;
+}
+
+OutBuffer& OutBuffer::hex(unsigned long long v)
+{
+    char* p = reserve(kMaxDigits);
+    len     = std::to_chars(p, p + kMaxDigits, v, 16).ptr - buf.get();
+    return *this;
+}
@@ -0,0 +1,74 @@
+#ifndef __UTILS_OUT_BUFFER_H__
+#define __UTILS_OUT_BUFFER_H__
+
+#include <charconv>
+#include <cstddef>
+#include <iosfwd>
+#include <memory>
+#include <string>
+#include <string_view>
+
+/*
+ * OutBuffer：面向 ostream 的大块输出缓冲
+ * - 文本先写入一块可复用的内存，写满（或析构 / flush）时整块交给 ostream
+ * - 整数用 std::to_chars 直接格式化到缓冲区中，不产生任何临时字符串
+ * - 用于 IR / 汇编等大量小片段的输出，避免逐段经过 ostream 的格式化与虚调用
+ */
+class OutBuffer
+{
+  private:
+    static constexpr size_t kCapacity = 1 << 16;
+    static constexpr size_t kMaxDigits = 24;  // 64 位整数的十进制 / 十六进制表示所需的最大长度
+
+    std::ostream&           os;
+    std::unique_ptr<char[]> buf;
+    size_t                  len = 0;
+
+    // 保证至少还有 n 字节的空间
+    char* reserve(size_t n)
+    {
+        if (len + n > kCapacity) flush();
+        return buf.get() + len;
+    }
+
+    template <typename T>
+    OutBuffer& writeInt(T value)
+    {
+        char* p = reserve(kMaxDigits);
+        len     = std::to_chars(p, p + kMaxDigits, value).ptr - buf.get();
+        return *this;
+    }
+
+  public:
+    explicit OutBuffer(std::ostream& out);
+    ~OutBuffer();
+
+    OutBuffer(const OutBuffer&)            = delete;
+    OutBuffer& operator=(const OutBuffer&) = delete;
+
+    void flush();
+
+    OutBuffer& write(const char* s, size_t n);
+
+    OutBuffer& operator<<(char c)
+    {
+        *reserve(1) = c;
+        ++len;
+        return *this;
+    }
+    OutBuffer& operator<<(std::string_view s) { return write(s.data(), s.size()); }
+    OutBuffer& operator<<(const char* s) { return *this << std::string_view(s); }
+    OutBuffer& operator<<(const std::string& s) { return write(s.data(), s.size()); }
+
+    OutBuffer& operator<<(int v) { return writeInt(v); }
+    OutBuffer& operator<<(long v) { return writeInt(v); }
+    OutBuffer& operator<<(long long v) { return writeInt(v); }
+    OutBuffer& operator<<(unsigned v) { return writeInt(v); }
+    OutBuffer& operator<<(unsigned long v) { return writeInt(v); }
+    OutBuffer& operator<<(unsigned long long v) { return writeInt(v); }
+
+    // 小写十六进制、无前缀，与 ostream << std::hex 的输出一致
+    OutBuffer& hex(unsigned long long v);
+};
+
+#endif  // __UTILS_OUT_BUFFER_H__
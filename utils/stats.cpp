@@ -0,0 +1,308 @@
+#include <stats.h>
+#include <malloc.h>
+#include <sys/resource.h>
+#include <algorithm>
+#include <iomanip>
+#include <mutex>
+#include <ostream>
+#include <utility>
+#include <vector>
+
+namespace Stats
+{
+    namespace
+    {
+        struct Record
+        {
+            std::string                              name;
+            size_t                                   depth;
+            double                                   ms;
+            IRSize                                   before;
+            IRSize                                   after;
+            std::vector<std::pair<std::string, long>> counters;
+            long                                      peakRssKB = -1;  // -1 表示未记录内存
+            long                                      liveBytes = -1;
+            std::vector<std::pair<std::string, long>> gauges;
+        };
+
+        struct GaugeEntry
+        {
+            size_t                id;
+            std::string           name;
+            std::function<long()> read;
+        };
+
+        constexpr size_t npos = (size_t)-1;
+
+        bool   on          = false;
+        bool   showTiming  = false;
+        bool   showCounter = false;
+        bool   merge       = false;
+        bool   showMemory  = false;
+        Format fmt         = Format::TEXT;
+
+        std::vector<Record> records;
+        std::vector<size_t> open;  // 当前嵌套的 Scope 对应的记录下标
+        std::mutex          counterMtx;
+
+        std::vector<GaugeEntry> gaugeList;  // 按登记顺序排列
+        size_t                  nextGaugeId = 0;
+
+        std::string jsonEscape(const std::string& s)
+        {
+            std::string out;
+            for (char c : s)
+            {
+                if (c == '"' || c == '\\') out += '\\';
+                out += c;
+            }
+            return out;
+        }
+
+        // 未合并的记录只累加一次，结果与直接赋值相同
+        void accumulate(IRSize& into, const IRSize& size)
+        {
+            if (size.insts >= 0) into.insts = into.insts < 0 ? size.insts : into.insts + size.insts;
+            if (size.blocks >= 0) into.blocks = into.blocks < 0 ? size.blocks : into.blocks + size.blocks;
+        }
+
+        void keepMax(std::vector<std::pair<std::string, long>>& values, const std::string& name, long v)
+        {
+            for (auto& [n, value] : values)
+            {
+                if (n == name)
+                {
+                    value = std::max(value, v);
+                    return;
+                }
+            }
+            values.emplace_back(name, v);
+        }
+
+        // 峰值 RSS 取自内核的统计；存活字节数为 malloc 已交出且尚未归还的内存，含 mmap 直接分配的大块
+        void recordMemory(Record& r)
+        {
+            struct rusage usage;
+            if (getrusage(RUSAGE_SELF, &usage) == 0) r.peakRssKB = std::max(r.peakRssKB, (long)usage.ru_maxrss);
+            struct mallinfo2 info = mallinfo2();
+            r.liveBytes           = std::max(r.liveBytes, (long)(info.uordblks + info.hblkhd));
+            for (auto& g : gaugeList) keepMax(r.gauges, g.name, g.read());
+        }
+
+        void printSize(std::ostream& os, long before, long after)
+        {
+            if (before < 0 && after < 0)
+            {
+                os << std::setw(22) << "-";
+                return;
+            }
+            os << std::setw(9) << before << " -> " << std::setw(9) << after;
+        }
+
+        void reportText(std::ostream& os)
+        {
+            if (showTiming)
+            {
+                os << "===-------------------------------------------------------------------------===\n";
+                os << "                         Compilation time report\n";
+                os << "===-------------------------------------------------------------------------===\n";
+                os << std::right << std::setw(10) << "Wall(ms)" << std::setw(24) << "Insts" << std::setw(24)
+                   << "Blocks"
+                   << "   Stage\n";
+                for (auto& r : records)
+                {
+                    os << std::fixed << std::setprecision(3) << std::setw(10) << r.ms << "  ";
+                    printSize(os, r.before.insts, r.after.insts);
+                    os << "  ";
+                    printSize(os, r.before.blocks, r.after.blocks);
+                    os << "   " << std::string(r.depth * 2, ' ') << r.name << "\n";
+                }
+            }
+            if (showCounter)
+            {
+                os << "===-------------------------------------------------------------------------===\n";
+                os << "                          ... Statistics Collected ...\n";
+                os << "===-------------------------------------------------------------------------===\n";
+                for (auto& r : records)
+                {
+                    for (auto& [counter, n] : r.counters)
+                        os << std::setw(10) << n << "  " << r.name << " - " << counter << "\n";
+                }
+            }
+            if (showMemory)
+            {
+                // 各阶段登记的 Gauge 不尽相同，列取全部记录中出现过的名字，阶段结束时不存在的记为 -
+                std::vector<std::string> columns;
+                for (auto& r : records)
+                {
+                    for (auto& [name, v] : r.gauges)
+                        if (std::find(columns.begin(), columns.end(), name) == columns.end()) columns.push_back(name);
+                }
+
+                os << "===-------------------------------------------------------------------------===\n";
+                os << "                          Memory usage report\n";
+                os << "===-------------------------------------------------------------------------===\n";
+                os << std::right << std::setw(12) << "PeakRSS(KB)" << std::setw(12) << "Live(KB)";
+                for (auto& c : columns) os << std::setw(std::max<size_t>(c.size(), 10) + 2) << c;
+                os << "   Stage\n";
+                for (auto& r : records)
+                {
+                    os << std::setw(12) << r.peakRssKB << std::setw(12) << (r.liveBytes < 0 ? -1 : r.liveBytes / 1024);
+                    for (auto& c : columns)
+                    {
+                        auto it =
+                            std::find_if(r.gauges.begin(), r.gauges.end(), [&c](auto& g) { return g.first == c; });
+                        os << std::setw(std::max<size_t>(c.size(), 10) + 2);
+                        if (it == r.gauges.end())
+                            os << "-";
+                        else
+                            os << it->second;
+                    }
+                    os << "   " << std::string(r.depth * 2, ' ') << r.name << "\n";
+                }
+            }
+            os.flush();
+        }
+
+        void reportJSON(std::ostream& os)
+        {
+            os << "{\"stages\":[";
+            for (size_t i = 0; i < records.size(); ++i)
+            {
+                auto& r = records[i];
+                if (i) os << ",";
+                os << "{\"name\":\"" << jsonEscape(r.name) << "\",\"depth\":" << r.depth << ",\"wall_ms\":" << std::fixed
+                   << std::setprecision(3) << r.ms << ",\"insts_before\":" << r.before.insts
+                   << ",\"insts_after\":" << r.after.insts << ",\"blocks_before\":" << r.before.blocks
+                   << ",\"blocks_after\":" << r.after.blocks << ",\"counters\":{";
+                for (size_t j = 0; j < r.counters.size(); ++j)
+                {
+                    if (j) os << ",";
+                    os << "\"" << jsonEscape(r.counters[j].first) << "\":" << r.counters[j].second;
+                }
+                os << "}";
+                if (showMemory)
+                {
+                    os << ",\"peak_rss_kb\":" << r.peakRssKB << ",\"live_bytes\":" << r.liveBytes << ",\"objects\":{";
+                    for (size_t j = 0; j < r.gauges.size(); ++j)
+                    {
+                        if (j) os << ",";
+                        os << "\"" << jsonEscape(r.gauges[j].first) << "\":" << r.gauges[j].second;
+                    }
+                    os << "}";
+                }
+                os << "}";
+            }
+            os << "]}" << std::endl;
+        }
+    }  // namespace
+
+    void enable(bool timing, bool counters, Format format)
+    {
+        on          = on || timing || counters;
+        showTiming  = showTiming || timing;
+        showCounter = showCounter || counters;
+        if (format == Format::JSON) fmt = Format::JSON;
+    }
+
+    void enableMemory(Format format)
+    {
+        on         = true;
+        showMemory = true;
+        if (format == Format::JSON) fmt = Format::JSON;
+    }
+
+    bool enabled() { return on; }
+
+    void mergeRepeated(bool m) { merge = m; }
+
+    Scope::Scope(const std::string& name, SizeProbe p) : idx(npos), probe(std::move(p)), start()
+    {
+        if (!on) return;
+
+        IRSize before;
+        if (probe) before = probe();
+
+        // 在当前父阶段已有的子记录中找同名的一条
+        if (merge)
+        {
+            size_t first = open.empty() ? 0 : open.back() + 1;
+            for (size_t i = first; i < records.size(); ++i)
+            {
+                if (records[i].depth == open.size() && records[i].name == name)
+                {
+                    idx = i;
+                    break;
+                }
+            }
+        }
+
+        if (idx == npos)
+        {
+            Record r;
+            r.name   = name;
+            r.depth  = open.size();
+            r.ms     = 0;
+            r.before = before;
+
+            idx = records.size();
+            records.push_back(std::move(r));
+        }
+        else
+            accumulate(records[idx].before, before);
+
+        open.push_back(idx);
+        start = std::chrono::steady_clock::now();
+    }
+
+    Scope::~Scope()
+    {
+        if (idx == npos) return;
+
+        auto end        = std::chrono::steady_clock::now();
+        records[idx].ms += std::chrono::duration<double, std::milli>(end - start).count();
+        if (probe) accumulate(records[idx].after, probe());
+        if (showMemory) recordMemory(records[idx]);
+        open.pop_back();
+    }
+
+    Gauge::Gauge(const std::string& name, std::function<long()> read) : id(npos)
+    {
+        if (!showMemory) return;
+        id = nextGaugeId++;
+        gaugeList.push_back({id, name, std::move(read)});
+    }
+
+    Gauge::~Gauge()
+    {
+        if (id == npos) return;
+        gaugeList.erase(
+            std::find_if(gaugeList.begin(), gaugeList.end(), [this](const GaugeEntry& g) { return g.id == id; }));
+    }
+
+    void bump(const char* counter, long n)
+    {
+        if (!on || n == 0 || open.empty()) return;
+
+        std::lock_guard<std::mutex> lock(counterMtx);
+        auto&                       counters = records[open.back()].counters;
+        for (auto& [name, value] : counters)
+        {
+            if (name == counter)
+            {
+                value += n;
+                return;
+            }
+        }
+        counters.emplace_back(counter, n);
+    }
+
+    void report(std::ostream& os)
+    {
+        if (!on) return;
+        if (fmt == Format::JSON)
+            reportJSON(os);
+        else
+            reportText(os);
+    }
+}  // namespace Stats
@@ -0,0 +1,80 @@
+#ifndef __UTILS_STATS_H__
+#define __UTILS_STATS_H__
+
+#include <chrono>
+#include <functional>
+#include <iosfwd>
+#include <string>
+
+/*
+ * Stats：编译流程各阶段的计时与计数
+ * - 用 Stats::Scope 包住一个阶段或一个 pass，析构时记录墙钟时间，
+ *   以及通过 SizeProbe 取得的前后指令数 / 基本块数
+ * - 阶段内部用 Stats::bump("phis inserted") 累加具名计数器，计到当前最内层的 Scope 上
+ * - 由 -ftime-report / -stats 打开，报告输出到 stderr；未打开时 Scope 与 bump 均不做任何事
+ * - Scope 只应在主线程上创建；bump 可以在工作线程中调用
+ * - 流式编译中每个函数都会重复经过同一组阶段，打开 mergeRepeated 后同一父阶段下的同名阶段合并为一条记录，
+ *   时间与前后规模均累加
+ * - -fmem-report 另外在每个 Scope 结束时记录峰值 RSS、堆上存活字节数，以及当时已登记的各个 Gauge 的取值；
+ *   合并的记录取各次中的最大值
+ */
+namespace Stats
+{
+    struct IRSize
+    {
+        long insts  = -1;  // -1 表示该阶段没有可统计的 IR
+        long blocks = -1;
+    };
+    using SizeProbe = std::function<IRSize()>;
+
+    enum class Format
+    {
+        TEXT,
+        JSON
+    };
+
+    // timing: 打印各阶段计时表；counters: 额外打印具名计数器
+    void enable(bool timing, bool counters, Format format = Format::TEXT);
+    // 打印各阶段结束时的内存占用与对象个数
+    void enableMemory(Format format = Format::TEXT);
+    bool enabled();
+    void mergeRepeated(bool merge);
+
+    class Scope
+    {
+      private:
+        size_t                                idx;
+        SizeProbe                             probe;
+        std::chrono::steady_clock::time_point start;
+
+      public:
+        Scope(const std::string& name, SizeProbe probe = nullptr);
+        ~Scope();
+
+        Scope(const Scope&)            = delete;
+        Scope& operator=(const Scope&) = delete;
+    };
+
+    void bump(const char* counter, long n = 1);
+
+    /*
+     * Gauge：具名的对象个数或字节数，存活期间每个 Scope 结束时调用 read 取一次值
+     * 未打开 -fmem-report 时不登记；应先于 read 引用的对象析构，且只在主线程上创建
+     */
+    class Gauge
+    {
+      private:
+        size_t id;
+
+      public:
+        Gauge(const std::string& name, std::function<long()> read);
+        ~Gauge();
+
+        Gauge(const Gauge&)            = delete;
+        Gauge& operator=(const Gauge&) = delete;
+    };
+
+    void report(std::ostream& os);
+}  // namespace Stats
+
+#endif  // __UTILS_STATS_H__
@@ -0,0 +1,109 @@
+#include <thread_pool.h>
+#include <algorithm>
+#include <utility>
+
+ThreadPool::ThreadPool(size_t numThreads)
+{
+    if (numThreads == 0) numThreads = std::max(1u, std::thread::hardware_concurrency());
+
+    workers.reserve(numThreads);
+    for (size_t i = 0; i < numThreads; ++i) workers.push_back(std::make_unique<Worker>());
+    threads.reserve(numThreads);
+    for (size_t i = 0; i < numThreads; ++i) threads.emplace_back(&ThreadPool::workerLoop, this, i);
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        stopping = true;
+    }
+    wakeCv.notify_all();
+    for (auto& t : threads) t.join();
+}
+
+bool ThreadPool::takeTask(size_t self, size_t& task)
+{
+    {
+        Worker&                     own = *workers[self];
+        std::lock_guard<std::mutex> lock(own.mtx);
+        if (!own.tasks.empty())
+        {
+            task = own.tasks.back();
+            own.tasks.pop_back();
+            return true;
+        }
+    }
+    // 自己的队列空了，从其它线程的队首窃取
+    for (size_t i = 1; i < workers.size(); ++i)
+    {
+        Worker&                     victim = *workers[(self + i) % workers.size()];
+        std::lock_guard<std::mutex> lock(victim.mtx);
+        if (!victim.tasks.empty())
+        {
+            task = victim.tasks.front();
+            victim.tasks.pop_front();
+            return true;
+        }
+    }
+    return false;
+}
+
+void ThreadPool::workerLoop(size_t self)
+{
+    size_t seen = 0;
+    while (true)
+    {
+        size_t task;
+        if (takeTask(self, task))
+        {
+            try
+            {
+                (*job)(task);
+            }
+            catch (...)
+            {
+                std::lock_guard<std::mutex> lock(mtx);
+                if (!error) error = std::current_exception();
+            }
+
+            std::lock_guard<std::mutex> lock(mtx);
+            if (--pending == 0) doneCv.notify_all();
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(mtx);
+        wakeCv.wait(lock, [&] { return stopping || epoch != seen; });
+        if (stopping) return;
+        seen = epoch;
+    }
+}
+
+void ThreadPool::parallelFor(size_t count, const std::function<void(size_t)>& fn)
+{
+    if (count == 0) return;
+    if (threads.size() <= 1 || count == 1)
+    {
+        for (size_t i = 0; i < count; ++i) fn(i);
+        return;
+    }
+
+    std::unique_lock<std::mutex> lock(mtx);
+    job     = &fn;
+    error   = nullptr;
+    pending = count;
+
+    // 连续分块，相邻的任务尽量落在同一线程上；负载不均时由窃取补偿
+    size_t n = workers.size();
+    for (size_t w = 0; w < n; ++w)
+    {
+        std::lock_guard<std::mutex> wlock(workers[w]->mtx);
+        for (size_t i = w * count / n; i < (w + 1) * count / n; ++i) workers[w]->tasks.push_front(i);
+    }
+    ++epoch;
+    wakeCv.notify_all();
+
+    doneCv.wait(lock, [&] { return pending == 0; });
+    job = nullptr;
+    if (error) std::rethrow_exception(std::exchange(error, nullptr));
+}
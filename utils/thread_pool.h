@@ -0,0 +1,58 @@
+#ifndef __UTILS_THREAD_POOL_H__
+#define __UTILS_THREAD_POOL_H__
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/*
+ * 工作窃取线程池
+ * - 每个工作线程持有自己的任务双端队列：自己从队尾取，空闲时从其它线程的队首窃取
+ * - parallelFor(n, fn) 把下标 0..n-1 连续地分给各线程，阻塞至全部完成；
+ *   任务中抛出的第一个异常会在调用线程上重新抛出
+ * - 线程数为 0 时取硬件并发数
+ */
+class ThreadPool
+{
+  private:
+    struct Worker
+    {
+        std::mutex         mtx;
+        std::deque<size_t> tasks;
+    };
+
+    std::vector<std::unique_ptr<Worker>> workers;
+    std::vector<std::thread>             threads;
+
+    std::mutex              mtx;
+    std::condition_variable wakeCv;  // 有新任务或需要退出
+    std::condition_variable doneCv;  // 当前批次全部完成
+    bool                    stopping = false;
+    size_t                  epoch    = 0;  // 每次 parallelFor 加一，唤醒空闲线程
+    size_t                  pending  = 0;  // 当前批次未完成的任务数
+
+    const std::function<void(size_t)>* job = nullptr;
+    std::exception_ptr                 error;
+
+    void workerLoop(size_t self);
+    bool takeTask(size_t self, size_t& task);
+
+  public:
+    explicit ThreadPool(size_t numThreads = 0);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&)            = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    size_t size() const { return threads.size(); }
+
+    void parallelFor(size_t count, const std::function<void(size_t)>& fn);
+};
+
+#endif  // __UTILS_THREAD_POOL_H__